@@ -59,6 +59,11 @@ macro(global_set_flags)
         add_definitions(-DBUILD_WITH_NEON)
     endif()
 
+    # Set by os_set_flags() where AVX2 kernels are built next to the SSE ones; the unit-tests check them too
+    if (LRS_TRY_USE_AVX)
+        add_definitions(-DBUILD_WITH_AVX2)
+    endif()
+
     if (BUILD_SHARED_LIBS)
         add_definitions(-DBUILD_SHARED_LIBS)
     endif()
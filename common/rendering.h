@@ -652,6 +652,17 @@ namespace rs2
                     }
                     break;
                 }
+                case RS2_FORMAT_MOTION_BATCH:
+                {
+                    // Shows the latest sample of the batch
+                    auto motion = frame.as< motion_frame >();
+                    if( motion && motion.get_motion_sample_count() )
+                    {
+                        auto & sample = motion.get_motion_samples()[motion.get_motion_sample_count() - 1];
+                        draw_motion_data( sample.x, sample.y, sample.z );
+                    }
+                    break;
+                }
                 case RS2_FORMAT_COMBINED_MOTION:
                 {
                     auto & motion = *reinterpret_cast< const rs2_combined_motion * >( frame.get_data() );
@@ -1266,6 +1277,7 @@ namespace rs2
             case RS2_FORMAT_MOTION_RAW:
             case RS2_FORMAT_MOTION_XYZ32F:
             case RS2_FORMAT_COMBINED_MOTION:
+            case RS2_FORMAT_MOTION_BATCH:
             case RS2_FORMAT_GPIO_RAW:
             case RS2_FORMAT_6DOF:
                 return false;
@@ -530,6 +530,23 @@ unsigned int rs2_get_frame_object_detection_count(const rs2_frame* frame, rs2_er
 */
 void rs2_get_frame_object_detection(const rs2_frame* frame, unsigned int index, rs2_object_detection* detection, rs2_error** error);
 
+/**
+* Set the allocator for frame buffers allocated from now on, e.g. to place frames in huge pages or pinned memory
+* Buffers allocated before the call are still released through the allocator that provided them
+* \param[in] alloc      Returns a buffer of at least 'size' bytes, aligned to 64 bytes, or null on failure; null restores the default allocator
+* \param[in] free       Releases a buffer previously returned by 'alloc', given the same size
+* \param[in] user       Passed as-is to 'alloc' and 'free'
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(rs2_frame_buffer_alloc_ptr alloc, rs2_frame_buffer_free_ptr free, void* user, rs2_error** error);
+
+/**
+* Retrieve the counters of the pools through which frame buffers are recycled
+* \param[out] stats     Pointer to a user allocated struct, which contains the counters after a successful return
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_buffer_pool_stats(rs2_frame_buffer_pool_stats* stats, rs2_error** error);
+
 
 #ifdef __cplusplus
 }
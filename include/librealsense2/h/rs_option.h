@@ -135,6 +135,12 @@ extern "C" {
         RS2_OPTION_LEFT_IR_TEMPERATURE, /**< Temperature of the Left IR Sensor */
         
         RS2_OPTION_EMBEDDED_FILTER_ENABLED, /**< Enable/Disable Embedded Filter */
+        RS2_OPTION_MAX_ZERO_COPY_FRAMES, /**< Max number of backend frame buffers the user may hold without copying; 0 always copies */
+        RS2_OPTION_COMPACT_POINTS, /**< Point cloud holds only the points with a valid depth, instead of one per depth pixel */
+        RS2_OPTION_HISTOGRAM_UPDATE_THRESHOLD, /**< Fraction of the pixels by which the equalized histogram must change for the colorizer to recompute its colors; 0 follows every change */
+        RS2_OPTION_MAX_THREADS, /**< Largest number of threads a processing block splits its work over; 0 uses all those of the shared processing pool */
+        RS2_OPTION_FILTER_IN_PLACE, /**< Filter writes over the input frame instead of allocating a new one, when nothing else holds that frame */
+        RS2_OPTION_MOTION_BATCH_WINDOW, /**< Time span, in milliseconds, of the samples packed into each RS2_FORMAT_MOTION_BATCH frame */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
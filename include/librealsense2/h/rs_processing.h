@@ -313,6 +313,16 @@ rs2_processing_block* rs2_create_hdr_merge_processing_block(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error);
 
+/**
+* Creates a processing block that runs a chain of depth post-processing filters as a single pass over each frame.
+* Decimation, threshold, disparity transform, spatial, temporal and hole filling filters can be chained, in any order;
+* they keep their options and state, and are configured as when used by themselves. Only the output frame is allocated.
+* \param[in] filters   The filters, in the order they are to be applied
+* \param[in] count     The number of filters
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_fused_filter_block(rs2_processing_block** filters, int count, rs2_error** error);
+
 /**
 * Retrieve processing block specific information, like name.
 * \param[in]  block     The processing block
@@ -29,6 +29,16 @@ const char* rs2_playback_status_to_string(rs2_playback_status status);
 
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
+/** \brief How well the writer of a recording device keeps up with the device. */
+typedef struct rs2_record_statistics
+{
+    unsigned long long messages_written;    /**< Messages written to the file so far */
+    unsigned long long batches_written;     /**< Transactions the messages were written in */
+    unsigned long long frames_dropped;      /**< Frames dropped because the writer was behind; only when dropping is enabled */
+    unsigned long long backpressure_waits;  /**< Times a write had to wait for the writer to catch up */
+    double backpressure_time;               /**< Total time spent waiting, in milliseconds */
+} rs2_record_statistics;
+
 /**
  * Creates a recording device to record the given device and save it to the given file
  * \param[in]  device    The device to record
@@ -48,6 +58,20 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 */
 rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
 
+/**
+* Creates a recording device to record the given device and save it to the given file.
+* By default, a recording device that falls behind holds up the device until the file catches up. With
+* drop_frames_when_full, it drops frames instead; see rs2_record_device_get_statistics().
+* Dropping is only supported when recording to .db3 files, and is ignored otherwise.
+* \param[in]  device                The device to record
+* \param[in]  file                  The desired path to which the recorder should save the data
+* \param[in]  compression_enabled   Indicates if compression is enabled, 0 means false, otherwise true
+* \param[in]  drop_frames_when_full Indicates if frames may be dropped when the writer is behind, 0 means false, otherwise true
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return A pointer to a device that records its data to file, or null in case of failure
+*/
+rs2_device* rs2_create_record_device_ex2(const rs2_device* device, const char* file, int compression_enabled, int drop_frames_when_full, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
@@ -71,6 +95,14 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Gets how well the recorder has kept up with the device so far
+* \param[in]  device    A recording device
+* \param[out] stats     Receives the statistics
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* stats, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -103,6 +135,15 @@ unsigned long long int rs2_playback_get_duration(const rs2_device* device, rs2_e
  */
 void rs2_playback_seek(const rs2_device* device, long long int time, rs2_error** error);
 
+/**
+ * Set the playback to a recorded frame of one of its streams
+ * \param[in] device       A playback device.
+ * \param[in] profile      The stream profile of the frame, one of the playback device's
+ * \param[in] frame_index  The index of the frame among the recorded frames of the stream, counting from 0
+ * \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_seek_to_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_index, rs2_error** error);
+
 /**
  * Gets the current position of the playback in the file in terms of time. Units are expressed in nanoseconds
  * \param[in] device     A playback device
@@ -39,6 +39,7 @@ typedef enum rs2_camera_info {
     RS2_CAMERA_INFO_SMCU_FW_VERSION                , /**< Safety MCU FW Version */
     RS2_CAMERA_INFO_IMU_TYPE                       , /**< IMU Type */
     RS2_CAMERA_INFO_MIPI_DRIVER_VERSION            , /**< MIPI driver version (Jetson platform only) */
+    RS2_CAMERA_INFO_SIMD_LEVEL                     , /**< Instruction set the kernels of a processing block run with: Scalar, SSSE3, AVX2 or NEON */
     RS2_CAMERA_INFO_COUNT                            /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_camera_info;
 const char* rs2_camera_info_to_string(rs2_camera_info info);
@@ -103,6 +104,7 @@ typedef enum rs2_format
     RS2_FORMAT_M420            , /**< 24-bit for every pixel: y for each pixel, and u,v data for every four pixels - packed as 2 lines of y, 1 line of u,v */
     RS2_FORMAT_COMBINED_MOTION , /**< Combined motion data, as in the combined_motion structure */
     RS2_FORMAT_NV12            , /**< Semi-planar YUV 4:2:0: full-resolution Y plane followed by interleaved half-resolution U,V plane. 12 bits per pixel. */
+    RS2_FORMAT_MOTION_BATCH    , /**< Motion samples received over a time window, as an array of the motion_sample structure */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -122,6 +124,14 @@ typedef struct rs2_combined_motion
     struct { double x, y, z; } linear_acceleration;
 } rs2_combined_motion;
 
+/** \brief One sample of an RS2_FORMAT_MOTION_BATCH frame: GYRO or ACCEL data, as in RS2_FORMAT_MOTION_XYZ32F, with its own timestamp */
+typedef struct rs2_motion_sample
+{
+    double timestamp;   /**< Timestamp of the sample, in milliseconds, in the domain of the frame timestamp */
+    float x, y, z;
+    float reserved;     /**< Pads the sample to 24 bytes */
+} rs2_motion_sample;
+
 /**
 * Deletes sensors list, any sensors created from this list will remain unaffected
 * \param[in] info_list list to delete
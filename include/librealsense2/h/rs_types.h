@@ -14,6 +14,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 /** \brief Category of the librealsense notification. */
 typedef enum rs2_notification_category{
@@ -131,6 +132,14 @@ typedef struct rs2_object_detection
     float depth;        /**< Mean depth in meters at detection location */
 } rs2_object_detection;
 
+/** \brief Counters of the frame buffer pools, accumulated over all frame sources in the process */
+typedef struct rs2_frame_buffer_pool_stats
+{
+    unsigned long long hits;      /**< Frame buffers reused from a pool */
+    unsigned long long misses;    /**< Frame buffers that had to be newly allocated */
+    unsigned long long evictions; /**< Pooled frame buffers freed after being unused for too long */
+} rs2_frame_buffer_pool_stats;
+
 /** \brief Severity of the librealsense logger. */
 typedef enum rs2_log_severity {
     RS2_LOG_SEVERITY_DEBUG, /**< Detailed information about ordinary operations */
@@ -336,6 +345,8 @@ typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame*, rs2_source*, void*);
 typedef void (*rs2_update_progress_callback_ptr)(const float, void*);
 typedef void (*rs2_options_changed_callback_ptr)(const rs2_options_list *);
+typedef void* (*rs2_frame_buffer_alloc_ptr)(size_t size, void* user);
+typedef void (*rs2_frame_buffer_free_ptr)(void* buffer, size_t size, void* user);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
 typedef long long   rs2_metadata_type; /**< Metadata attribute type is defined as 64 bit signed integer*/
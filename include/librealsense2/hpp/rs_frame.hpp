@@ -1045,6 +1045,22 @@ namespace rs2
         {
             return *reinterpret_cast< rs2_combined_motion const * >( get_data() );
         }
+        /**
+         * Retrieve the samples of frames with RS2_FORMAT_MOTION_BATCH, each with its own timestamp.
+         * \return rs2_motion_sample const * - the first of get_motion_sample_count() samples, oldest first.
+         */
+        const rs2_motion_sample* get_motion_samples() const
+        {
+            return reinterpret_cast< rs2_motion_sample const * >( get_data() );
+        }
+        /**
+         * Retrieve the number of samples in frames with RS2_FORMAT_MOTION_BATCH.
+         * \return size_t - the number of samples returned by get_motion_samples().
+         */
+        size_t get_motion_sample_count() const
+        {
+            return static_cast< size_t >( get_data_size() ) / sizeof( rs2_motion_sample );
+        }
     };
 
     class pose_frame : public frame
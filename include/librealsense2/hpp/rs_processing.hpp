@@ -368,7 +368,8 @@ namespace rs2
         */
         rs2::frame process(rs2::frame frame) const override
         {
-            invoke(frame);
+            // Handing over our reference leaves the block the only one when the caller gave up theirs
+            invoke(std::move(frame));
             rs2::frame f;
             if (!_queue.poll_for_frame(&f))
                 throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
@@ -1298,6 +1299,54 @@ namespace rs2
         }
     };
 
+    class fused_filter : public filter
+    {
+    public:
+        /**
+        * Create a processing block that runs depth post-processing filters as a single pass over each frame.
+        * Decimation, threshold, disparity transform, spatial, temporal and hole filling filters can be chained;
+        * they keep their options and state, and are still configured through their own options.
+        * \param[in] filters - the filters, in the order they are to be applied
+        */
+        fused_filter(std::vector<filter> filters) : filter(init(filters), 1), _filters(filters) {}
+
+        /**
+        * Create a processing block that runs depth post-processing filters as a single pass over each frame.
+        * Taking the filters by reference keeps their types from being mistaken for processing functions.
+        * \param[in] filters - the filters, in the order they are to be applied
+        */
+        fused_filter(std::initializer_list<std::reference_wrapper<const filter>> filters)
+            : fused_filter(to_vector(filters)) {}
+
+    private:
+        friend class context;
+
+        std::shared_ptr<rs2_processing_block> init(std::vector<filter> const& filters)
+        {
+            std::vector<rs2_processing_block*> blocks;
+            for (auto&& f : filters)
+                blocks.push_back(f.get());
+
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_fused_filter_block(blocks.data(), int(blocks.size()), &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+
+        static std::vector<filter> to_vector(std::initializer_list<std::reference_wrapper<const filter>> filters)
+        {
+            std::vector<filter> result;
+            for (auto&& f : filters)
+                result.push_back(f.get());
+            return result;
+        }
+
+        std::vector<filter> _filters;
+    };
+
 
     class embedded_filter : public options
     {
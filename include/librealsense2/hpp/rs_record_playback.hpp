@@ -96,6 +96,18 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Sets the playback to a recorded frame of one of its streams
+        * \param[in] profile      The stream profile of the frame, one of the playback device's
+        * \param[in] frame_index  The index of the frame among the recorded frames of the stream, counting from 0
+        */
+        void seek_to_frame(const stream_profile& profile, unsigned long long frame_index)
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_seek_to_frame(_dev.get(), profile.get(), frame_index, &e);
+            error::handle(e);
+        }
+
         /**
         * Indicates if playback is in real time mode or non real time
         * \return True iff playback is in real time mode
@@ -234,6 +246,22 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device to record the given device and save it to the given file as rosbag format
+        * \param[in]  file                  The desired path to which the recorder should save the data
+        * \param[in]  device                The device to record
+        * \param[in]  compression_enabled   Indicates if compression is enabled
+        * \param[in]  drop_frames_when_full Indicates if frames may be dropped, rather than hold up the device, when the recorder falls behind
+        */
+        recorder(const std::string& file, rs2::device dev, bool compression_enabled, bool drop_frames_when_full)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                rs2_create_record_device_ex2(dev.get().get(), file.c_str(), compression_enabled, drop_frames_when_full, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
+
 
         /**
         * Pause the recording device without stopping the actual device from streaming.
@@ -266,6 +294,19 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Gets how well the recorder has kept up with the device so far
+        * \return The messages written, frames dropped and time spent waiting for the file
+        */
+        rs2_record_statistics get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_statistics stats;
+            rs2_record_device_get_statistics(_dev.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <functional>
+#include <cstddef>
 
 
 namespace librealsense {
@@ -12,6 +13,8 @@ class frame_continuation
 {
     std::function< void() > continuation;
     const void * protected_data = nullptr;
+    size_t protected_size = 0;
+    bool loaned = false;
 
     frame_continuation( const frame_continuation & ) = delete;
     frame_continuation & operator=( const frame_continuation & ) = delete;
@@ -28,14 +31,32 @@ public:
     {
     }
 
+    // The protected data may be the frame payload itself (e.g., a loaned backend buffer), in which case its size
+    // is needed by the frame.
+    // A loan is memory the lender may reuse while the frame is still around: a frame that's kept copies it instead.
+    explicit frame_continuation( std::function< void() > continuation,
+                                 const void * protected_data,
+                                 size_t protected_size,
+                                 bool loaned = false )
+        : continuation( continuation )
+        , protected_data( protected_data )
+        , protected_size( protected_size )
+        , loaned( loaned )
+    {
+    }
+
 
     frame_continuation( frame_continuation && other )
         : continuation( std::move( other.continuation ) )
         , protected_data( other.protected_data )
+        , protected_size( other.protected_size )
+        , loaned( other.loaned )
     {
         other.continuation = []() {
         };
         other.protected_data = nullptr;
+        other.protected_size = 0;
+        other.loaned = false;
     }
 
     void operator()()
@@ -44,25 +65,35 @@ public:
         continuation = []() {
         };
         protected_data = nullptr;
+        protected_size = 0;
+        loaned = false;
     }
 
     void reset()
     {
         protected_data = nullptr;
+        protected_size = 0;
+        loaned = false;
         continuation = []() {
         };
     }
 
     const void * get_data() const { return protected_data; }
+    size_t get_size() const { return protected_size; }
+    bool is_loan() const { return loaned; }
 
     frame_continuation & operator=( frame_continuation && other )
     {
         continuation();
         protected_data = other.protected_data;
+        protected_size = other.protected_size;
+        loaned = other.loaned;
         continuation = other.continuation;
         other.continuation = []() {
         };
         other.protected_data = nullptr;
+        other.protected_size = 0;
+        other.loaned = false;
         return *this;
     }
 
@@ -327,6 +327,15 @@ namespace librealsense
             status_file_eof = -404,             /**< EOF */
         };
 
+        struct writer_statistics
+        {
+            uint64_t messages_written = 0;
+            uint64_t batches_written = 0;
+            uint64_t frames_dropped = 0;        // only when dropping frames while the writer is behind
+            uint64_t backpressure_waits = 0;    // number of times a write had to wait for the writer to catch up
+            std::chrono::nanoseconds backpressure_time{ 0 };
+        };
+
         class writer
         {
         public:
@@ -337,6 +346,7 @@ namespace librealsense
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual void write_extrinsics(const stream_identifier& stream_id, uint32_t reference_id, const rs2_extrinsics& ext) {}
             virtual const std::string& get_file_name() const = 0;
+            virtual writer_statistics get_statistics() const { return {}; }
             virtual ~writer() = default;
         };
 
@@ -347,6 +357,8 @@ namespace librealsense
             virtual device_snapshot query_device_description(const nanoseconds& time) = 0;
             virtual std::shared_ptr<serialized_data> read_next_data() = 0;
             virtual void seek_to_time(const nanoseconds& time) = 0;
+            // Seeks to a stream's frame_index-th recorded frame, counting from 0, and returns the time of that frame
+            virtual nanoseconds seek_to_frame(const stream_identifier& stream_id, uint64_t frame_index) = 0;
             virtual nanoseconds query_duration() const = 0;
             virtual void reset() = 0;
             virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
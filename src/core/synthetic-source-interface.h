@@ -39,9 +39,11 @@ namespace librealsense
                                                       int new_stride = 0,
                                                       rs2_extension frame_type = RS2_EXTENSION_VIDEO_FRAME) = 0;
 
+        // A data_size of 0 allocates as much data as the original frame holds
         virtual frame_interface* allocate_motion_frame(std::shared_ptr<stream_profile_interface> stream,
                                                        frame_interface* original,
-                                                       rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) = 0;
+                                                       rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME,
+                                                       size_t data_size = 0) = 0;
 
         virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) = 0;
 
@@ -5,6 +5,7 @@
 #include "rs-dds-option.h"
 
 #include <realdds/topics/dds-topic-names.h>
+#include <realdds/topics/metadata-msg.h>
 #include <src/dds/rs-dds-embedded-filter.h>
 
 #include <src/stream.h>
@@ -65,23 +66,11 @@ void dds_depth_sensor_proxy::add_no_metadata( frame * const f, streaming_impl &
 }
 
 
-void dds_depth_sensor_proxy::add_frame_metadata( frame * const f, rsutils::json const & dds_md, streaming_impl & streaming )
+void dds_depth_sensor_proxy::add_frame_metadata( frame * const f,
+                                                 realdds::topics::metadata_msg const & dds_md,
+                                                 streaming_impl & streaming )
 {
-    if( auto du = dds_md.nested( realdds::topics::metadata::key::header, realdds::topics::metadata::header::key::depth_units ) )
-    {
-        try
-        {
-            f->additional_data.depth_units = du.get< float >();
-        }
-        catch( rsutils::json::exception const & )
-        {
-            f->additional_data.depth_units = get_depth_scale();
-        }
-    }
-    else
-    {
-        f->additional_data.depth_units = get_depth_scale();
-    }
+    f->additional_data.depth_units = dds_md.has_depth_units() ? dds_md.depth_units() : get_depth_scale();
 
     super::add_frame_metadata( f, dds_md, streaming );
 }
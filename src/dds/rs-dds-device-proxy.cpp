@@ -17,6 +17,7 @@
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/topics/blob-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 
 #include <src/stream.h>
@@ -398,7 +399,17 @@ dds_device_proxy::dds_device_proxy( std::shared_ptr< const device_info > const &
         }
     }
 
-    if( _dds_dev->supports_metadata() )
+    if( _dds_dev->supports_binary_metadata() )
+    {
+        _metadata_subscription = _dds_dev->on_binary_metadata_available(
+            [this]( std::shared_ptr< const realdds::topics::metadata_msg > const & dds_md )
+            {
+                auto it = _stream_name_to_owning_sensor.find( dds_md->stream_name() );
+                if( it != _stream_name_to_owning_sensor.end() )
+                    it->second->handle_new_metadata( dds_md );
+            } );
+    }
+    else if( _dds_dev->supports_metadata() )
     {
         _metadata_subscription = _dds_dev->on_metadata_available(
             [this]( std::shared_ptr< const json > const & dds_md )
@@ -13,8 +13,10 @@
 
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/image-msg.h>
+#include <realdds/topics/flat-image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <src/object-detection-frame.h>
 
@@ -43,6 +45,7 @@
 #include "rs-dds-inference-sensor-proxy.h"
 
 #include <cmath>
+#include <limits>
 
 using namespace realdds;
 using rsutils::json;
@@ -161,11 +164,14 @@ void dds_sensor_proxy::register_converters()
 
     if( jpeg_indexes.size() > 0 )
     {
-        std::vector< stream_profile > target_profiles;
-        for( int index : jpeg_indexes )
-            target_profiles.push_back( { RS2_FORMAT_RGB8, RS2_STREAM_COLOR, index } );
-        _formats_converter.register_converter( { { RS2_FORMAT_MJPEG, RS2_STREAM_COLOR } }, target_profiles,
-                                               []() { return std::make_shared< mjpeg_converter >( RS2_FORMAT_RGB8 ); } );
+        for( rs2_format format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8 } )
+        {
+            std::vector< stream_profile > target_profiles;
+            for( int index : jpeg_indexes )
+                target_profiles.push_back( { format, RS2_STREAM_COLOR, index } );
+            _formats_converter.register_converter( { { RS2_FORMAT_MJPEG, RS2_STREAM_COLOR } }, target_profiles,
+                                                   [format]() { return std::make_shared< mjpeg_converter >( format ); } );
+        }
     }
 
     // Depth
@@ -374,6 +380,106 @@ void dds_sensor_proxy::handle_video_data( std::vector< uint8_t > && buffer,
                                           realdds::dds_sample && dds_sample,
                                           const std::shared_ptr< stream_profile_interface > & profile,
                                           streaming_impl & streaming )
+{
+    // The frame keeps the received buffer rather than copying it into one of its own
+    auto pixels = std::make_shared< std::vector< uint8_t > >( std::move( buffer ) );
+    handle_video_frame( frame_continuation( [pixels] {}, pixels->data(), pixels->size() ),
+                        pixels->size(),
+                        timestamp,
+                        dds_sample,
+                        profile,
+                        streaming );
+}
+
+
+void dds_sensor_proxy::handle_flat_image( realdds::topics::flat_image_msg && image,
+                                          realdds::dds_sample && dds_sample,
+                                          const std::shared_ptr< stream_profile_interface > & profile,
+                                          streaming_impl & streaming )
+{
+    if( streaming.flat_image_depth < 2 )
+    {
+        // Each image may be overwritten as soon as the next is written: copy it right away
+        std::vector< uint8_t > pixels( image.data(), image.data() + image.data_size() );
+        if( ! image.is_current() )
+        {
+            LOG_DEBUG( "dropping flat image @ " << realdds::time_to_string( image.timestamp() )
+                                                << ": overwritten while copying" );
+            return;
+        }
+        handle_video_data( std::move( pixels ), image.timestamp(), std::move( dds_sample ), profile, streaming );
+        return;
+    }
+
+    // The pixels stay where DDS put them (shared memory, if the server is local): the frame holds the loan, and
+    // returns it when released. The server reuses an image's memory once it has written its history depth in newer
+    // images, so once it has written one less, frames still holding the image get a copy. The server's sequence
+    // numbers count what it wrote, whether we read it or not.
+    auto const sequence_number = dds_sample.sample_identity.sequence_number().to64long();
+    if( sequence_number + 2 > realdds::dds_sequence_number( streaming.flat_image_depth ) )
+        copy_flat_images( streaming, sequence_number + 2 - streaming.flat_image_depth );
+
+    auto loan = std::make_shared< flat_image_loan >();
+    loan->sequence_number = sequence_number;
+    auto msg = std::make_shared< realdds::topics::flat_image_msg >( std::move( image ) );
+    handle_video_frame( frame_continuation(
+                            [msg, loan]
+                            {
+                                // We were too late if the server got to it before the frame was done with it
+                                if( ! msg->is_current() )
+                                    LOG_WARNING( "flat image @ " << realdds::time_to_string( msg->timestamp() )
+                                                                 << " was overwritten while a frame held it" );
+                                std::lock_guard< std::mutex > lock( loan->mutex );
+                                loan->f = nullptr;
+                            },
+                            msg->data(),
+                            msg->data_size(),
+                            true ),  // loaned: copied if the frame is kept
+                        msg->data_size(),
+                        msg->timestamp(),
+                        dds_sample,
+                        profile,
+                        streaming,
+                        loan.get() );
+
+    std::lock_guard< std::mutex > lock( streaming.flat_image_loans_mutex );
+    streaming.flat_image_loans.push_back( std::move( loan ) );
+}
+
+
+/*static*/ void dds_sensor_proxy::copy_flat_images( streaming_impl & streaming, realdds::dds_sequence_number before )
+{
+    std::lock_guard< std::mutex > lock( streaming.flat_image_loans_mutex );
+    auto & loans = streaming.flat_image_loans;
+    while( ! loans.empty() && loans.front()->sequence_number < before )
+    {
+        auto loan = std::move( loans.front() );
+        loans.pop_front();
+
+        // Our reference keeps the frame from being released (and returning the loan) while it's copied; a frame
+        // that's already being released is about to return it anyway
+        frame * f = nullptr;
+        {
+            std::lock_guard< std::mutex > loan_lock( loan->mutex );
+            if( loan->f && loan->f->try_acquire() )
+                f = loan->f;
+        }
+        if( f )
+        {
+            f->copy_loan();
+            f->release();
+        }
+    }
+}
+
+
+void dds_sensor_proxy::handle_video_frame( frame_continuation && pixels,
+                                           size_t size,
+                                           realdds::dds_time const & timestamp,
+                                           realdds::dds_sample const & dds_sample,
+                                           const std::shared_ptr< stream_profile_interface > & profile,
+                                           streaming_impl & streaming,
+                                           flat_image_loan * loan )
 {
     frame_additional_data data;  // with NO metadata by default!
     data.system_time = time_service::get_time();  // time of arrival in system clock
@@ -384,7 +490,7 @@ void dds_sensor_proxy::handle_video_data( std::vector< uint8_t > && buffer,
     data.timestamp_domain;  // from metadata, or leave default (hardware domain)
     data.depth_units;       // from metadata
     data.frame_number;      // filled in only once metadata is known
-    data.raw_size = static_cast< uint32_t >( buffer.size() );
+    data.raw_size = static_cast< uint32_t >( size );
 
     update_timestamp_if_needed( data, streaming );
 
@@ -405,7 +511,13 @@ void dds_sensor_proxy::handle_video_data( std::vector< uint8_t > && buffer,
         return;
 
     auto new_frame = static_cast< frame * >( new_frame_interface );
-    new_frame->data = std::move( buffer );
+    new_frame->attach_continuation( std::move( pixels ) );
+    if( loan )
+    {
+        // Before anyone else can release the frame
+        std::lock_guard< std::mutex > lock( loan->mutex );
+        loan->f = new_frame;
+    }
 
     if( _md_enabled )
     {
@@ -415,7 +527,7 @@ void dds_sensor_proxy::handle_video_data( std::vector< uint8_t > && buffer,
     {
         add_no_metadata( new_frame, streaming );
         invoke_new_frame( new_frame,
-                          nullptr,    // pixels are already inside new_frame->data
+                          nullptr,    // pixels are already attached to new_frame
                           nullptr );  // so no deleter is necessary
     }
 }
@@ -464,6 +576,37 @@ void dds_sensor_proxy::handle_motion_data( realdds::topics::imu_msg && imu,
 }
 
 
+// Servers without binary metadata send JSON: it is converted on arrival, so frames only ever see the binary form
+static realdds::topics::metadata_msg
+metadata_from_json( std::string const & stream_name, realdds::dds_nsec timestamp, json const & dds_md )
+{
+    realdds::topics::metadata_msg md( stream_name, timestamp );
+
+    auto md_header = dds_md.nested( realdds::topics::metadata::key::header );
+    uint64_t frame_number;
+    if( md_header.nested( realdds::topics::metadata::header::key::frame_number ).get_ex( frame_number ) )
+        md.set_frame_number( frame_number );
+    int32_t timestamp_domain;
+    if( md_header.nested( realdds::topics::metadata::header::key::timestamp_domain ).get_ex( timestamp_domain ) )
+        md.set_timestamp_domain( timestamp_domain );
+    if( auto du = md_header.nested( realdds::topics::metadata::header::key::depth_units, &json::is_number ) )
+        md.set_depth_units( du.get< float >() );
+
+    // Metadata fields that are present but unknown by librealsense will be ignored.
+    auto md_values = dds_md.nested( realdds::topics::metadata::key::metadata );
+    if( ! md_values.empty() )
+    {
+        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+        {
+            auto key = static_cast< rs2_frame_metadata_value >( i );
+            if( auto value_j = md_values.nested( librealsense::get_string( key ), &json::is_number_integer ) )
+                md.add( static_cast< uint32_t >( key ), value_j.get< rs2_metadata_type >() );
+        }
+    }
+    return md;
+}
+
+
 void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
                                             std::shared_ptr< const json > const & dds_md )
 {
@@ -475,7 +618,12 @@ void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
     {
         if( auto timestamp = dds_md->nested( realdds::topics::metadata::key::header,
                                              realdds::topics::metadata::header::key::timestamp ) )
-            it->second.syncer.enqueue_metadata( timestamp.get< realdds::dds_nsec >(), dds_md );
+        {
+            auto const ts = timestamp.get< realdds::dds_nsec >();
+            it->second.syncer.enqueue_metadata(
+                ts,
+                std::make_shared< const realdds::topics::metadata_msg >( metadata_from_json( stream_name, ts, *dds_md ) ) );
+        }
         else
             throw std::runtime_error( "missing metadata header/timestamp" );
     }
@@ -483,6 +631,18 @@ void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
 }
 
 
+void dds_sensor_proxy::handle_new_metadata( std::shared_ptr< const realdds::topics::metadata_msg > const & dds_md )
+{
+    if( ! _md_enabled )
+        return;
+
+    auto it = _streaming_by_name.find( dds_md->stream_name() );
+    if( it != _streaming_by_name.end() )
+        it->second.syncer.enqueue_metadata( dds_md->timestamp(), dds_md );
+    // else we're not streaming -- must be another client that's subscribed
+}
+
+
 void dds_sensor_proxy::handle_inference_data( realdds::topics::string_msg && msg,
                                               realdds::dds_sample && sample,
                                               const std::shared_ptr< stream_profile_interface > & profile,
@@ -611,26 +771,22 @@ void dds_sensor_proxy::add_no_metadata( frame * const f, streaming_impl & stream
 
 
 void dds_sensor_proxy::add_frame_metadata( frame * const f,
-                                           json const & dds_md,
+                                           realdds::topics::metadata_msg const & dds_md,
                                            streaming_impl & streaming )
 {
-    auto md_header = dds_md.nested( realdds::topics::metadata::key::header );
-    auto md = dds_md.nested( realdds::topics::metadata::key::metadata );
-
     // A frame number is "optional". If the server supplies it, we try to use it for the simple fact that,
     // otherwise, we have no way of detecting drops without some advanced heuristic tracking the FPS and
     // timestamps. If not supplied, we use an increasing counter.
     // Note that if we have no metadata, we have no frame-numbers! So we need a way of generating them
-    if( md_header.nested( realdds::topics::metadata::header::key::frame_number )
-            .get_ex( f->additional_data.frame_number ) )
+    if( dds_md.has_frame_number() )
     {
+        f->additional_data.frame_number = dds_md.frame_number();
         f->additional_data.last_frame_number = streaming.last_frame_number.exchange( f->additional_data.frame_number );
         if( f->additional_data.frame_number != f->additional_data.last_frame_number + 1
             && f->additional_data.last_frame_number )
         {
-            LOG_DEBUG( dds_md.nested( realdds::topics::metadata::key::stream_name ).string_ref_or_empty()
-                       << " frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
-                       << f->additional_data.frame_number );
+            LOG_DEBUG( dds_md.stream_name() << " frame drop? expecting " << f->additional_data.last_frame_number + 1
+                                            << "; got " << f->additional_data.frame_number );
         }
     }
     else
@@ -643,29 +799,15 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
     // purposes, so we ignore here. The domain is optional, and really only rs-dds-adapter communicates it
     // because the source is librealsense...
     f->additional_data.timestamp;
-    if( ! _handle_global_timestamp_locally )
-        md_header.nested( realdds::topics::metadata::header::key::timestamp_domain ).get_ex( f->additional_data.timestamp_domain );
-
-    if( ! md.empty() )
-    {
-        // Other metadata fields. Metadata fields that are present but unknown by librealsense will be ignored.
-        auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
-        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
-        {
-            auto key = static_cast< rs2_frame_metadata_value >( i );
-            std::string const & keystr = librealsense::get_string( key );
-            try
-            {
-                if( auto value_j = md.nested( keystr, &json::is_number_integer ) )
-                    metadata[key] = { true, value_j.get< rs2_metadata_type >() };
-            }
-            catch( json::exception const & )
-            {
-                // The metadata key doesn't exist or the value isn't the right type... we ignore it!
-                // (all metadata is not there when we create the frame, so no need to erase)
-            }
-        }
-    }
+    if( ! _handle_global_timestamp_locally && dds_md.has_timestamp_domain() )
+        f->additional_data.timestamp_domain = static_cast< rs2_timestamp_domain >( dds_md.timestamp_domain() );
+
+    // Other metadata fields, by their rs2_frame_metadata_value keys; keys unknown by librealsense are ignored
+    // (all metadata is not there when we create the frame, so no need to erase)
+    auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
+    for( auto const & item : dds_md.items() )
+        if( item.key < static_cast< uint32_t >( RS2_FRAME_METADATA_COUNT ) )
+            metadata[item.key] = { true, item.value };
 }
 
 
@@ -691,7 +833,7 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
         auto & streaming = _streaming_by_name[dds_stream->name()];
         streaming.syncer.on_frame_release( frame_releaser );
         streaming.syncer.on_frame_ready(
-            [this, &streaming]( syncer_type::frame_holder && fh, std::shared_ptr< const json > const & md )
+            [this, &streaming]( syncer_type::frame_holder && fh, syncer_type::metadata_type const & md )
             {
                 if( _is_streaming ) // stop was not called
                 {
@@ -712,6 +854,13 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
                     if( _is_streaming )
                         handle_video_data( std::move( data ), std::move( timestamp ), std::move( sample ), profile, streaming );
                 } );
+            streaming.flat_image_depth = dds_video_stream->flat_image_depth();
+            dds_video_stream->on_flat_image_available(
+                [profile, this, &streaming]( realdds::topics::flat_image_msg && image, realdds::dds_sample && sample )
+                {
+                    if( _is_streaming )
+                        handle_flat_image( std::move( image ), std::move( sample ), profile, streaming );
+                } );
         }
         else if( auto dds_motion_stream = std::dynamic_pointer_cast< realdds::dds_motion_stream >( dds_stream ) )
         {
@@ -768,7 +917,10 @@ void dds_sensor_proxy::stop()
         // Nullifing the lambda is commented out because we don't want to nullify in middle of user callback (that might
         // be long) instead we use start/stop.
         //_streaming_by_name[dds_stream->name()].syncer.on_frame_ready( nullptr );
-        _streaming_by_name[dds_stream->name()].syncer.stop();
+        auto & streaming = _streaming_by_name[dds_stream->name()];
+        streaming.syncer.stop();
+        // The server may reuse its memory once we stop reading: frames still holding flat images get a copy
+        copy_flat_images( streaming, std::numeric_limits< realdds::dds_sequence_number >::max() );
 
         if( auto dds_video_stream = std::dynamic_pointer_cast< realdds::dds_video_stream >( dds_stream ) )
         {
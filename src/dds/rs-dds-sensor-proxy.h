@@ -17,6 +17,8 @@
 #include <rsutils/json-fwd.h>
 #include <memory>
 #include <map>
+#include <deque>
+#include <mutex>
 
 
 namespace realdds {
@@ -27,8 +29,10 @@ class dds_video_stream_profile;
 class dds_motion_stream_profile;
 class dds_inference_stream;
 namespace topics {
+class flat_image_msg;
 class imu_msg;
 class string_msg;
+class metadata_msg;
 }  // namespace topics
 }  // namespace realdds
 
@@ -49,17 +53,31 @@ class dds_sensor_proxy : public software_sensor, public global_time_interface
     bool const _md_enabled;
     options_watcher _options_watcher;
 
-    typedef realdds::dds_metadata_syncer syncer_type;
+    // Metadata is matched to frames in binary form, whether it arrived that way or as JSON
+    typedef realdds::dds_binary_metadata_syncer syncer_type;
     static void frame_releaser( syncer_type::frame_type * f ) { static_cast< frame * >( f )->release(); }
 
     std::shared_ptr< roi_sensor_interface > _roi_support;
 
 protected:
+    // A flat image wrapped by a frame, shared with the frame's continuation
+    struct flat_image_loan
+    {
+        std::mutex mutex;
+        frame * f = nullptr;  // until the frame returns the loan
+        realdds::dds_sequence_number sequence_number = 0;  // the server's
+    };
+
     struct streaming_impl
     {
         syncer_type syncer;
         std::atomic< unsigned long long > last_frame_number{ 0 };
         std::atomic< rs2_time_t > last_timestamp;
+        // Flat images wrapped by frames, oldest first. The server reuses an image's memory once it has written its
+        // history depth in newer images, however long frames hold it, so frames are given a copy before then.
+        std::mutex flat_image_loans_mutex;
+        std::deque< std::shared_ptr< flat_image_loan > > flat_image_loans;
+        int flat_image_depth = 0;
     };
 
 private:
@@ -123,19 +141,33 @@ protected:
                             realdds::dds_sample &&,
                             const std::shared_ptr< stream_profile_interface > &,
                             streaming_impl & streaming );
+    void handle_flat_image( realdds::topics::flat_image_msg &&,
+                            realdds::dds_sample &&,
+                            const std::shared_ptr< stream_profile_interface > &,
+                            streaming_impl & streaming );
+    // Gives frames wrapping flat images older than 'before' (a server sequence number) a copy, returning their loans
+    static void copy_flat_images( streaming_impl &, realdds::dds_sequence_number before );
+    void handle_video_frame( frame_continuation && pixels,
+                             size_t size,
+                             realdds::dds_time const &,
+                             realdds::dds_sample const &,
+                             const std::shared_ptr< stream_profile_interface > &,
+                             streaming_impl & streaming,
+                             flat_image_loan * loan = nullptr );
     void handle_motion_data( realdds::topics::imu_msg &&,
                              realdds::dds_sample &&,
                              const std::shared_ptr< stream_profile_interface > &,
                              streaming_impl & );
     void handle_new_metadata( std::string const & stream_name,
                               std::shared_ptr< const rsutils::json > const & metadata );
+    void handle_new_metadata( std::shared_ptr< const realdds::topics::metadata_msg > const & metadata );
     void handle_inference_data( realdds::topics::string_msg &&,
                                 realdds::dds_sample &&,
                                 const std::shared_ptr< stream_profile_interface > &,
                                 streaming_impl & );
 
     virtual void add_no_metadata( frame *, streaming_impl & );
-    virtual void add_frame_metadata( frame *, rsutils::json const & metadata, streaming_impl & );
+    virtual void add_frame_metadata( frame *, realdds::topics::metadata_msg const & metadata, streaming_impl & );
 
     void add_processing_block_settings( const std::string & filter_name,
                                         std::shared_ptr< librealsense::processing_block_interface > & ppb ) const;
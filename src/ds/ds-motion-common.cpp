@@ -527,6 +527,19 @@ namespace librealsense
             { return std::make_shared< gyroscope_transform >( _mm_calib, mm_correct_opt, gyro_scale_factor, high_accuracy );
             });
 
+        // Opt-in profiles delivering all the samples of a time window in one frame
+        auto batch_window = std::make_shared< motion_batch_window_option >();
+        hid_ep->register_option( RS2_OPTION_MOTION_BATCH_WINDOW, batch_window );
+        for( auto stream : { RS2_STREAM_ACCEL, RS2_STREAM_GYRO } )
+            hid_ep->register_processing_block(
+                { { RS2_FORMAT_MOTION_XYZ32F, stream } },
+                { { RS2_FORMAT_MOTION_BATCH, stream } },
+                [&, stream, mm_correct_opt, batch_window, gyro_scale_factor, high_accuracy]()
+                {
+                    return std::make_shared< motion_batch_transform >( stream, _mm_calib, mm_correct_opt, batch_window,
+                                                                       gyro_scale_factor, high_accuracy );
+                } );
+
         return hid_ep;
     }
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "frame-buffer-pool.h"
 #include <src/core/frame-interface.h>
 
 #include <atomic>
@@ -22,7 +23,7 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool buffers; // return frame buffers here
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
         std::recursive_mutex mutex;
@@ -34,35 +35,10 @@ namespace librealsense
         T alloc_frame(const size_t size, frame_additional_data && additional_data, bool requires_memory)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
-                {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
-                }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
-                }
-            }
-
             if (requires_memory)
             {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                // Not zero-initialized: the producer is expected to fill the whole buffer
+                backbuffer.data = buffers.acquire(size);
             }
             backbuffer.additional_data = std::move( additional_data );
             return backbuffer;
@@ -88,15 +64,13 @@ namespace librealsense
             if( fi )
             {
                 auto f = (T *)fi;
-                std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 fi->keep();
 
                 if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    buffers.release(std::move(f->data));
                 }
-                lock.unlock();
 
                 if (f->is_fixed())
                     published_frames.deallocate(f);
@@ -184,10 +158,7 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            buffers.clear();
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
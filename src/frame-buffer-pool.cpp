@@ -0,0 +1,284 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "frame-buffer-pool.h"
+
+#include <rsutils/concurrency/concurrency.h>
+#include <rsutils/shared-ptr-singleton.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+namespace {
+
+
+// Once set, an allocator must outlive all the buffers it provided; allocators are therefore never freed (users are
+// expected to set one at most a few times)
+struct frame_memory_allocator
+{
+    rs2_frame_buffer_alloc_ptr alloc;
+    rs2_frame_buffer_free_ptr free;
+    void * user;
+};
+
+std::atomic< frame_memory_allocator const * > the_allocator( nullptr );
+
+
+// Every buffer is preceded by a header that records the allocator that provided it. User allocators return 64-byte
+// aligned memory, which the header keeps; the free store only promises the fundamental alignment, so the default
+// allocation is over-sized and aligned by hand, and the header remembers where it really starts.
+struct alignas( 64 ) frame_memory_header
+{
+    frame_memory_allocator const * allocator;
+    void * base;  // what ::operator new returned, without a user allocator
+};
+
+size_t const FRAME_MEMORY_ALIGNMENT = alignof( frame_memory_header );
+
+
+std::atomic< unsigned long long > pool_hits( 0 );
+std::atomic< unsigned long long > pool_misses( 0 );
+std::atomic< unsigned long long > pool_evictions( 0 );
+
+
+}  // namespace
+
+
+void * allocate_frame_memory( size_t size )
+{
+    auto allocator = the_allocator.load( std::memory_order_acquire );
+    auto const total = size + sizeof( frame_memory_header );
+    frame_memory_header * header;
+    if( allocator )
+    {
+        header = static_cast< frame_memory_header * >( allocator->alloc( total, allocator->user ) );
+        if( ! header )
+            throw std::bad_alloc();
+        header->base = header;
+    }
+    else
+    {
+        void * base = ::operator new( total + FRAME_MEMORY_ALIGNMENT - 1 );
+        auto const aligned = ( reinterpret_cast< uintptr_t >( base ) + FRAME_MEMORY_ALIGNMENT - 1 )
+                           & ~uintptr_t( FRAME_MEMORY_ALIGNMENT - 1 );
+        header = reinterpret_cast< frame_memory_header * >( aligned );
+        header->base = base;
+    }
+    header->allocator = allocator;
+    return header + 1;
+}
+
+
+void free_frame_memory( void * ptr, size_t size )
+{
+    if( ! ptr )
+        return;
+    auto header = static_cast< frame_memory_header * >( ptr ) - 1;
+    if( auto allocator = header->allocator )
+        allocator->free( header, size + sizeof( frame_memory_header ), allocator->user );
+    else
+        ::operator delete( header->base );
+}
+
+
+void set_frame_memory_allocator( rs2_frame_buffer_alloc_ptr alloc, rs2_frame_buffer_free_ptr free, void * user )
+{
+    the_allocator = alloc ? new frame_memory_allocator{ alloc, free, user } : nullptr;
+}
+
+
+// Periodically frees buffers that were not reused for a while, in all pools.
+// Pools register themselves for as long as they exist: the janitor never owns a pool, so one is never destroyed on
+// the janitor's thread.
+//
+class frame_buffer_pool_janitor
+{
+    std::mutex _mutex;
+    std::vector< frame_buffer_pool * > _pools;
+    active_object<> _active_object;
+
+    static constexpr std::chrono::milliseconds TICK{ 250 };
+    static constexpr std::chrono::milliseconds MAX_AGE{ 1000 };
+
+public:
+    frame_buffer_pool_janitor()
+        : _active_object(
+            [this]( dispatcher::cancellable_timer timer )
+            {
+                if( timer.try_sleep( TICK ) )
+                    tick();
+            } )
+    {
+        _active_object.start();
+    }
+
+    ~frame_buffer_pool_janitor() { _active_object.stop(); }
+
+    void add( frame_buffer_pool * pool )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _pools.push_back( pool );
+    }
+
+    void remove( frame_buffer_pool * pool )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _pools.erase( std::remove( _pools.begin(), _pools.end(), pool ), _pools.end() );
+    }
+
+private:
+    void tick()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto pool : _pools )
+            pool->trim( MAX_AGE );
+    }
+};
+
+constexpr std::chrono::milliseconds frame_buffer_pool_janitor::TICK;
+constexpr std::chrono::milliseconds frame_buffer_pool_janitor::MAX_AGE;
+
+
+static rsutils::shared_ptr_singleton< frame_buffer_pool_janitor > the_janitor;
+
+
+const int frame_buffer_pool::MAX_SIZES;
+const int frame_buffer_pool::BUFFERS_PER_SIZE;
+
+
+frame_buffer_pool::frame_buffer_pool()
+    : _janitor( the_janitor.instance() )
+{
+    _janitor->add( this );
+}
+
+
+frame_buffer_pool::~frame_buffer_pool()
+{
+    _janitor->remove( this );
+}
+
+
+frame_buffer frame_buffer_pool::acquire( size_t size )
+{
+    for( auto & b : _buckets )
+    {
+        if( b.size.load( std::memory_order_acquire ) != size )
+            continue;
+
+        auto i = b.available.pop();
+        if( i != b.available.NONE )
+        {
+            frame_buffer buffer = std::move( b.buffers[i] );
+            b.unused.push( i );
+            // The bucket may have been emptied and taken for another size while we were looking
+            if( buffer.size() == size )
+            {
+                ++pool_hits;
+                return buffer;
+            }
+        }
+        break;
+    }
+
+    ++pool_misses;
+    frame_buffer buffer;
+    buffer.resize( size );
+    return buffer;
+}
+
+
+void frame_buffer_pool::release( frame_buffer buffer )
+{
+    // Frames may have been shrunk after they were filled (see points::resize); keep the buffer by the size it was
+    // acquired with, which is still its capacity. Growing it back doesn't initialize anything.
+    buffer.resize( buffer.capacity() );
+    auto const size = buffer.size();
+    if( ! size )
+        return;
+
+    bucket * target = nullptr;
+    for( auto & b : _buckets )
+    {
+        if( b.size.load( std::memory_order_acquire ) == size )
+        {
+            target = &b;
+            break;
+        }
+    }
+    if( ! target )
+    {
+        for( auto & b : _buckets )
+        {
+            size_t unused_size = 0;
+            if( b.size.compare_exchange_strong( unused_size, size ) )
+            {
+                target = &b;
+                break;
+            }
+        }
+        if( ! target )
+            return;  // Too many different sizes at once; let it go
+    }
+
+    auto i = target->unused.pop();
+    if( i == target->unused.NONE )
+        return;  // Already keeping enough buffers of this size
+
+    target->buffers[i] = std::move( buffer );
+    target->released[i] = std::chrono::steady_clock::now();
+    target->available.push( i );
+}
+
+
+void frame_buffer_pool::trim( std::chrono::steady_clock::duration max_age )
+{
+    auto const now = std::chrono::steady_clock::now();
+    for( auto & b : _buckets )
+    {
+        auto size = b.size.load( std::memory_order_acquire );
+        if( ! size )
+            continue;
+
+        // Take out all available buffers, then put back the ones that are still fresh
+        uint32_t fresh[BUFFERS_PER_SIZE];
+        int n_fresh = 0;
+        for( auto i = b.available.pop(); i != b.available.NONE; i = b.available.pop() )
+        {
+            if( now - b.released[i] > max_age )
+            {
+                b.buffers[i] = frame_buffer();
+                b.unused.push( i );
+                ++pool_evictions;
+            }
+            else
+            {
+                fresh[n_fresh++] = i;
+            }
+        }
+        for( auto n = n_fresh; n > 0; --n )
+            b.available.push( fresh[n - 1] );
+
+        // Nothing of this size was released lately: make room for other sizes
+        if( ! n_fresh )
+            b.size.compare_exchange_strong( size, 0 );
+    }
+}
+
+
+rs2_frame_buffer_pool_stats frame_buffer_pool::get_stats()
+{
+    rs2_frame_buffer_pool_stats stats;
+    stats.hits = pool_hits;
+    stats.misses = pool_misses;
+    stats.evictions = pool_evictions;
+    return stats;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "index-stack.h"
+#include <librealsense2/h/rs_types.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <new>
+
+
+namespace librealsense {
+
+
+// Raw memory for frame buffers: comes from the allocator last set with rs2_set_frame_allocator(), or the free store.
+// Memory is always freed through the allocator that provided it.
+void * allocate_frame_memory( size_t size );
+void free_frame_memory( void * ptr, size_t size );
+void set_frame_memory_allocator( rs2_frame_buffer_alloc_ptr alloc, rs2_frame_buffer_free_ptr free, void * user );
+
+
+// std::vector allocator for frame buffers.
+// Memory is taken from allocate_frame_memory(), and elements are default-initialized: resizing a new buffer does
+// not zero-fill memory that the producer is about to overwrite anyway.
+//
+template< class T >
+class frame_buffer_allocator
+{
+public:
+    using value_type = T;
+
+    frame_buffer_allocator() = default;
+    template< class U >
+    frame_buffer_allocator( frame_buffer_allocator< U > const & ) {}
+
+    T * allocate( size_t n ) { return static_cast< T * >( allocate_frame_memory( n * sizeof( T ) ) ); }
+    void deallocate( T * p, size_t n ) { free_frame_memory( p, n * sizeof( T ) ); }
+
+    template< class U >
+    void construct( U * p )
+    {
+        ::new( static_cast< void * >( p ) ) U;
+    }
+    template< class U, class... Args >
+    void construct( U * p, Args &&... args )
+    {
+        ::new( static_cast< void * >( p ) ) U( std::forward< Args >( args )... );
+    }
+
+    template< class U >
+    bool operator==( frame_buffer_allocator< U > const & ) const { return true; }
+    template< class U >
+    bool operator!=( frame_buffer_allocator< U > const & ) const { return false; }
+};
+
+using frame_buffer = std::vector< uint8_t, frame_buffer_allocator< uint8_t > >;
+
+
+class frame_buffer_pool_janitor;
+
+
+// Frame buffers returned by released frames, kept for reuse by new frames of the same size.
+// Buffers are kept per size in lock-free stacks, so acquire() and release() never block, and buffers that were not
+// reused for a while are freed periodically from a background thread shared by all pools.
+//
+class frame_buffer_pool
+{
+public:
+    static const int MAX_SIZES = 4;        // different buffer sizes kept at the same time
+    static const int BUFFERS_PER_SIZE = 32;
+
+    frame_buffer_pool();
+    ~frame_buffer_pool();
+
+    frame_buffer_pool( frame_buffer_pool const & ) = delete;
+    frame_buffer_pool & operator=( frame_buffer_pool const & ) = delete;
+
+    // Returns a buffer of exactly 'size' bytes, reused if possible; new buffers are not zero-initialized
+    frame_buffer acquire( size_t size );
+
+    // Keep the buffer for reuse; dropped if there's no room for it
+    void release( frame_buffer buffer );
+
+    // Free buffers that have not been reused for longer than 'max_age'
+    void trim( std::chrono::steady_clock::duration max_age );
+    void clear() { trim( std::chrono::steady_clock::duration::min() ); }
+
+    static rs2_frame_buffer_pool_stats get_stats();
+
+private:
+    struct bucket
+    {
+        std::atomic< size_t > size;                   // 0 if unused
+        index_stack< BUFFERS_PER_SIZE > available;    // slots holding a buffer
+        index_stack< BUFFERS_PER_SIZE > unused;       // slots without a buffer
+        frame_buffer buffers[BUFFERS_PER_SIZE];
+        std::chrono::steady_clock::time_point released[BUFFERS_PER_SIZE];
+
+        bucket()
+            : size( 0 )
+        {
+            unused.fill();
+        }
+    };
+
+    bucket _buckets[MAX_SIZES];
+    std::shared_ptr< frame_buffer_pool_janitor > _janitor;
+};
+
+
+}  // namespace librealsense
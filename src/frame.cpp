@@ -10,6 +10,8 @@
 
 #include <rsutils/string/from.h>
 
+#include <cstring>
+
 
 namespace librealsense {
 
@@ -96,11 +98,25 @@ void frame::keep()
 {
     if( ! _kept.exchange( true ))
     {
+        // A kept frame may be held indefinitely, but a loan is only good for as long as the lender does not reuse it
+        copy_loan();
         if (owner)
             owner->keep_frame( this );
     }
 }
 
+void frame::copy_loan()
+{
+    std::lock_guard< std::mutex > lock( _loan_mutex );
+    if( ! on_release.is_loan() )
+        return;
+    auto const size = on_release.get_size();
+    frame_buffer copy( size );
+    std::memcpy( copy.data(), on_release.get_data(), size );
+    data = std::move( copy );
+    on_release();  // return the loan; the frame data is now our own
+}
+
 frame_interface * frame::publish( std::shared_ptr< archive_interface > new_owner )
 {
     owner = new_owner;
@@ -124,6 +140,9 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 
 int frame::get_frame_data_size() const
 {
+    if( on_release.get_data() && on_release.get_size() )
+        return (int)on_release.get_size();
+
     return (int)data.size();
 }
 
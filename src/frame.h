@@ -10,7 +10,9 @@
 #include <atomic>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include "archive.h"
+#include "frame-buffer-pool.h"
 
 
 namespace librealsense {
@@ -20,7 +22,7 @@ namespace librealsense {
 class LRS_EXTENSION_API frame : public frame_interface
 {
 public:
-    std::vector< uint8_t > data;
+    frame_buffer data;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
     
@@ -87,7 +89,18 @@ public:
     }
 
     void acquire() override { ref_count.fetch_add( 1 ); }
+    // Acquires a reference only if one is still held, i.e. unless the frame is being released
+    bool try_acquire()
+    {
+        int n = ref_count.load();
+        while( n > 0 )
+            if( ref_count.compare_exchange_weak( n, n + 1 ) )
+                return true;
+        return false;
+    }
     void release() override;
+    // Whether a single reference to the frame is held, by the caller
+    bool is_unique() const { return ref_count == 1; }
     void keep() override;
 
     frame_interface * publish( std::shared_ptr< archive_interface > new_owner ) override;
@@ -98,6 +111,14 @@ public:
     }
     void disable_continuation() override { on_release.reset(); }
 
+    // Replace loaned data (see frame_continuation) with a copy, and return the loan; does nothing if there's no loan.
+    // Safe to call while the frame is kept on another thread, by whoever holds a reference to it.
+    void copy_loan();
+
+    // Whether the payload is in the frame's own buffer, rather than memory it was handed through its continuation
+    // (a device's, a software device user's, ...) that it must not write to
+    bool owns_data() const { return ! on_release.get_data(); }
+
     archive_interface * get_owner() const override;
 
     std::shared_ptr< sensor_interface > get_sensor() const override;
@@ -118,6 +139,7 @@ private:
     frame_continuation on_release;
     bool _fixed = false;
     std::atomic_bool _kept;
+    std::mutex _loan_mutex;  // so a loan is copied once
     std::shared_ptr< stream_profile_interface > stream;
 };
 
@@ -10,7 +10,8 @@
 namespace librealsense
 {
 #ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
+    // Built with AVX2 alongside the SSE code, and only used after checking the CPU at runtime
+    #ifdef BUILD_WITH_AVX2
     void unpack_yuy2_avx_y8(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_y16(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_rgb8(uint8_t * const d[], const uint8_t * s, int n);
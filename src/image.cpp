@@ -43,6 +43,7 @@ namespace librealsense
         case RS2_FORMAT_GPIO_RAW: return 1;
         case RS2_FORMAT_MOTION_RAW: return 1;
         case RS2_FORMAT_MOTION_XYZ32F: return 1;
+        case RS2_FORMAT_MOTION_BATCH: return 1;
         case RS2_FORMAT_6DOF: return 1;
         case RS2_FORMAT_MJPEG: return 8;
         case RS2_FORMAT_Y8I: return 16;
@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Lock-free LIFO of indices in [0, C), for managing slots of a fixed-size array.
+// Each index may be in the stack at most once: the caller owns an index from the moment it is popped until it is
+// pushed back. The head carries a tag that changes on every update, so a pop racing with a pop+push of the same
+// index (ABA) fails its CAS and retries.
+//
+template< int C >
+class index_stack
+{
+    std::atomic< uint64_t > _head;
+    std::atomic< uint32_t > _next[C];
+
+    static uint64_t make_head( uint64_t old_head, uint32_t index )
+    {
+        return ( ( ( old_head >> 32 ) + 1 ) << 32 ) | index;
+    }
+
+public:
+    static const int CAPACITY = C;
+    static const uint32_t NONE = ~uint32_t( 0 );
+
+    index_stack()
+        : _head( NONE )
+    {
+        for( auto & next : _next )
+            next.store( NONE, std::memory_order_relaxed );
+    }
+
+    // Fill with all indices, so that 0 is popped first
+    void fill()
+    {
+        for( auto i = C; i > 0; --i )
+            push( uint32_t( i - 1 ) );
+    }
+
+    void push( uint32_t index )
+    {
+        auto head = _head.load( std::memory_order_relaxed );
+        do
+        {
+            _next[index].store( uint32_t( head ), std::memory_order_relaxed );
+        }
+        while( ! _head.compare_exchange_weak( head,
+                                              make_head( head, index ),
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed ) );
+    }
+
+    // Returns NONE if empty
+    uint32_t pop()
+    {
+        auto head = _head.load( std::memory_order_acquire );
+        while( uint32_t( head ) != NONE )
+        {
+            auto next = _next[uint32_t( head )].load( std::memory_order_relaxed );
+            if( _head.compare_exchange_weak( head,
+                                             make_head( head, next ),
+                                             std::memory_order_acquire,
+                                             std::memory_order_acquire ) )
+                return uint32_t( head );
+        }
+        return NONE;
+    }
+
+    bool empty() const { return uint32_t( _head.load( std::memory_order_acquire ) ) == NONE; }
+};
+
+template< int C > const int index_stack< C >::CAPACITY;
+template< int C > const uint32_t index_stack< C >::NONE;
+
+
+}  // namespace librealsense
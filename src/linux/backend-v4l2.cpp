@@ -410,6 +410,28 @@ namespace librealsense
             _must_enqueue = false;
         }
 
+        void buffer::detach_memory()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (!_use_memory_map)
+                return;
+
+            // The copy is moved over the original mapping in one step, so readers never see it unmapped
+            void * copy = mmap(nullptr, _original_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (copy == MAP_FAILED)
+            {
+                LOG_WARNING("Failed to allocate a copy of buffer " << std::dec << _index << ": " << strerror(errno));
+                return;
+            }
+            memcpy(copy, _start, _original_length);
+            if (mremap(copy, _original_length, _original_length, MREMAP_MAYMOVE | MREMAP_FIXED, _start) == MAP_FAILED)
+            {
+                LOG_WARNING("Failed to detach buffer " << std::dec << _index << ": " << strerror(errno));
+                munmap(copy, _original_length);
+            }
+        }
+
         void buffer::request_next_frame(int fd, bool force)
         {
             std::lock_guard<std::mutex> lock(_mutex);
@@ -2543,6 +2565,9 @@ namespace librealsense
                 for(size_t i = 0; i < _buffers.size(); i++)
                 {
                     _buffers[i]->detach_buffer();
+                    // Buffers loaned to frames outlive the stream; while still mapped, REQBUFS(0) would fail with EBUSY
+                    if (_buffers[i].use_count() > 1)
+                        _buffers[i]->detach_memory();
                 }
                 _buffers.resize(0);
             }
@@ -2790,6 +2815,8 @@ namespace librealsense
                 for(size_t i = 0; i < _md_buffers.size(); i++)
                 {
                     _md_buffers[i]->detach_buffer();
+                    if (_md_buffers[i].use_count() > 1)
+                        _md_buffers[i]->detach_memory();
                 }
                 _md_buffers.resize(0);
             }
@@ -128,6 +128,10 @@ namespace librealsense
 
             void detach_buffer();
 
+            // Replaces a memory-mapped buffer with an anonymous copy at the same address, releasing the kernel buffer
+            // while whoever still holds the buffer can keep reading it
+            void detach_memory();
+
             void request_next_frame(int fd, bool force=false);
 
             uint32_t get_full_length() const { return _length; }
@@ -376,6 +380,9 @@ namespace librealsense
 
             bool is_platform_jetson() const override {return false;}
 
+            // Kernel buffers stay mapped and are re-queued only from the frame continuation
+            bool supports_frame_loans() const override { return true; }
+
         protected:
             virtual uint32_t get_cid(rs2_option option) const;
 
@@ -286,43 +286,88 @@ void playback_device::seek_to_time(std::chrono::nanoseconds time)
     {
         LOG_INFO("Seek to time: " << time.count());
         m_reader->seek_to_time(time);
-        m_device_description = m_reader->query_device_description(time);
-        update_extensions(m_device_description);
-        m_prev_timestamp = time; //Updating prev timestamp to make get_position return true indication even when playbakc is paused
-        catch_up();
-        if (m_is_paused)
+        on_seek(time);
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for seek_to_time, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+}
+
+void playback_device::seek_to_frame(const stream_profile_interface& profile, uint64_t frame_index)
+{
+    device_serializer::stream_identifier stream_id{ get_device_index(), 0, profile.get_stream_type(), static_cast<uint32_t>(profile.get_stream_index()) };
+    auto sensor = std::find_if(m_sensors.begin(), m_sensors.end(), [&](std::pair<const uint32_t, std::shared_ptr<playback_sensor>> const & s)
+    {
+        auto profiles = s.second->get_stream_profiles();
+        return std::any_of(profiles.begin(), profiles.end(), [&](std::shared_ptr<stream_profile_interface> const & p)
         {
-            //raise_last_frames(time);
-            auto current_frames = m_reader->fetch_last_frames(time);
-            for (auto&& f : current_frames)
-            {
-                if (auto frame = f->as<serialized_frame>())
-                {
-                    if (frame->stream_id.device_index != get_device_index() || frame->stream_id.sensor_index >= m_sensors.size())
-                    {
-                        std::string error_msg = rsutils::string::from()
-                                             << "Unexpected sensor index while playing file (Read index = "
-                                             << frame->stream_id.sensor_index << ")";
-                        LOG_ERROR(error_msg);
-                    }
-                    //push frame to the sensor (see handle_frame definition for more details)
-                    m_sensors.at(frame->stream_id.sensor_index)->handle_frame(std::move(frame->frame), m_real_time,
-                        []() { return device_serializer::nanoseconds(0); },
-                        []() { return false; },
-                        [this, time]()
-                        {
-                            std::lock_guard<std::mutex> locker(m_last_published_timestamp_mutex);
-                            m_last_published_timestamp = time;
-                        });
-                }
-            }
+            return p->get_unique_id() == profile.get_unique_id();
+        });
+    });
+    if (sensor == m_sensors.end())
+        throw invalid_value_exception("Stream profile is not of the played device");
+    stream_id.sensor_index = sensor->first;
+
+    LOG_INFO("Request to seek to frame: " << frame_index);
+    std::exception_ptr error;
+    (*m_read_thread)->invoke([this, stream_id, frame_index, &error](dispatcher::cancellable_timer t)
+    {
+        try
+        {
+            auto time = m_reader->seek_to_frame(stream_id, frame_index);
+            LOG_INFO("Seek to time: " << time.count());
+            on_seek(time);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
         }
     });
     if ((*m_read_thread)->flush() == false)
     {
-        LOG_ERROR("Error - timeout waiting for seek_to_time, possible deadlock detected");
+        LOG_ERROR("Error - timeout waiting for seek_to_frame, possible deadlock detected");
         assert(0); //Detect this immediately in debug
     }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// Called on the reading thread, once the reader was moved to 'time'
+void playback_device::on_seek(device_serializer::nanoseconds time)
+{
+    m_device_description = m_reader->query_device_description(time);
+    update_extensions(m_device_description);
+    m_prev_timestamp = time; //Updating prev timestamp to make get_position return true indication even when playbakc is paused
+    catch_up();
+    if (m_is_paused)
+    {
+        //raise_last_frames(time);
+        auto current_frames = m_reader->fetch_last_frames(time);
+        for (auto&& f : current_frames)
+        {
+            if (auto frame = f->as<serialized_frame>())
+            {
+                if (frame->stream_id.device_index != get_device_index() || frame->stream_id.sensor_index >= m_sensors.size())
+                {
+                    std::string error_msg = rsutils::string::from()
+                                         << "Unexpected sensor index while playing file (Read index = "
+                                         << frame->stream_id.sensor_index << ")";
+                    LOG_ERROR(error_msg);
+                }
+                //push frame to the sensor (see handle_frame definition for more details)
+                m_sensors.at(frame->stream_id.sensor_index)->handle_frame(std::move(frame->frame), m_real_time,
+                    []() { return device_serializer::nanoseconds(0); },
+                    []() { return false; },
+                    [this, time]()
+                    {
+                        std::lock_guard<std::mutex> locker(m_last_published_timestamp_mutex);
+                        m_last_published_timestamp = time;
+                    });
+            }
+        }
+    }
 }
 
 rs2_playback_status playback_device::get_current_status() const
@@ -37,6 +37,7 @@ namespace librealsense
 
         void set_frame_rate(double rate);
         void seek_to_time(std::chrono::nanoseconds time);
+        void seek_to_frame(const stream_profile_interface& profile, uint64_t frame_index);
         rs2_playback_status get_current_status() const;
         uint64_t get_duration() const;
         void pause();
@@ -74,6 +75,7 @@ namespace librealsense
         std::shared_ptr<stream_profile_interface> get_stream(const std::map<unsigned, std::shared_ptr<playback_sensor>>& sensors_map, device_serializer::stream_identifier stream_id);
         rs2_extrinsics calc_extrinsic(const rs2_extrinsics& from, const rs2_extrinsics& to);
         void catch_up();
+        void on_seek(device_serializer::nanoseconds time);
         void register_device_info(const device_serializer::device_snapshot& device_description);
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
@@ -438,6 +438,10 @@ const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
 }
+device_serializer::writer_statistics librealsense::record_device::get_statistics() const
+{
+    return m_ros_writer->get_statistics();
+}
 std::shared_ptr< const device_info > record_device::get_device_info() const
 {
     return m_device->get_device_info();
@@ -41,6 +41,7 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        device_serializer::writer_statistics get_statistics() const;
         std::shared_ptr< const device_info > get_device_info() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
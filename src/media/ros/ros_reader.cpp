@@ -63,6 +63,7 @@ namespace librealsense
 
         if (next_msg.isType<sensor_msgs::Image>()
             || next_msg.isType<sensor_msgs::Imu>()
+            || next_msg.isType<std_msgs::Float64MultiArray>()
             || next_msg.isType<realsense_legacy_msgs::pose>()
             || next_msg.isType<geometry_msgs::Transform>())
         {
@@ -107,7 +108,28 @@ namespace librealsense
         }
         auto seek_time_as_secs = std::chrono::duration_cast<std::chrono::duration<double>>(seek_time);
         auto seek_time_as_rostime = rs2rosinternal::Time(seek_time_as_secs.count());
+        seek_samples_view(seek_time_as_rostime);
+    }
+
+    nanoseconds ros_reader::seek_to_frame(const stream_identifier& stream_id, uint64_t frame_index)
+    {
+        // The bag's index holds the time of every message: the frames before the requested one are not read
+        rosbag::View frames(m_file, rosbag::TopicQuery(ros_topic::frame_data_topic(stream_id)));
+        if (frame_index >= frames.size())
+        {
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "Requested frame is out of the recorded frames. (Requested = "
+                                           << frame_index << ", Frames = " << frames.size() << ")" );
+        }
+        auto frame = frames.begin();
+        std::advance(frame, frame_index);
+        auto time = (*frame).getTime();
+        seek_samples_view(time);
+        return to_nanoseconds(time);
+    }
 
+    void ros_reader::seek_samples_view(const rs2rosinternal::Time& time)
+    {
         m_samples_view.reset(new rosbag::View(m_file, FalseQuery()));
 
         //Using cached topics here and not querying them (before reseting) since a previous call to seek
@@ -115,7 +137,7 @@ namespace librealsense
         //E.g:  Recording Depth+Color, stopping Depth, starting IR, stopping IR and Color. Play IR+Depth: will play only depth, then only IR, then we seek to a point only IR was streaming, and then to 0.
         for (auto topic : m_enabled_streams_topics)
         {
-            m_samples_view->addQuery(m_file, rosbag::TopicQuery(topic), seek_time_as_rostime);
+            m_samples_view->addQuery(m_file, rosbag::TopicQuery(topic), time);
         }
         m_samples_itrator = m_samples_view->begin();
     }
@@ -134,7 +156,7 @@ namespace librealsense
         std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
         for (auto&& m : view)
         {
-            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>() || m.isType<std_msgs::Float64MultiArray>())
             {
                 auto id = ros_topic::get_stream_identifier(m.getTopic());
                 last_frames[id] = m.getTime();
@@ -274,6 +296,10 @@ namespace librealsense
         {
             frame = create_motion_sample(msg);
         }
+        else if (msg.isType<std_msgs::Float64MultiArray>())
+        {
+            frame = create_motion_batch(msg);
+        }
         else if (msg.isType<realsense_legacy_msgs::pose>() || msg.isType<geometry_msgs::Transform>())
         {
             frame = create_pose_sample(msg);
@@ -438,11 +464,12 @@ namespace librealsense
             get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
         }
 
+        // Images keep the message's buffer (see below), so only labeled points need one of their own
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
             msg->data.size(),
             std::move( additional_data ),
-            true );
+            stream_id.stream_type == RS2_STREAM_LABELED_POINT_CLOUD );
 
         if (frame == nullptr)
         {
@@ -460,7 +487,8 @@ namespace librealsense
             frame->get_stream()->set_format(stream_format);
             frame->get_stream()->set_stream_index(int(stream_id.stream_index));
             frame->get_stream()->set_stream_type(stream_id.stream_type);
-            video_frame->data = std::move(msg->data);
+            // The frame holds on to the message rather than copying its data
+            video_frame->attach_continuation( frame_continuation( [msg] {}, msg->data.data(), msg->data.size() ) );
             librealsense::frame_holder fh{ video_frame };
             LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
@@ -476,7 +504,7 @@ namespace librealsense
             frame->get_stream()->set_format(stream_format);
             frame->get_stream()->set_stream_index(int(stream_id.stream_index));
             frame->get_stream()->set_stream_type(stream_id.stream_type);
-            lab_points->data = std::move(msg->data);
+            lab_points->data.assign(msg->data.begin(), msg->data.end());  // labeled points read their own buffer
             librealsense::frame_holder fh{ lab_points };
             LOG_DEBUG("Created image frame: " << stream_id << " " << stream_format);
 
@@ -573,6 +601,57 @@ namespace librealsense
         return std::move(fh);
     }
 
+    frame_holder ros_reader::create_motion_batch(const rosbag::MessageInstance &batch_data) const
+    {
+        LOG_DEBUG("Trying to create a motion batch frame from message");
+
+        auto msg = instantiate_msg<std_msgs::Float64MultiArray>(batch_data);
+
+        // See ros_writer::write_motion_batch_frame
+        size_t offset = msg->layout.data_offset;
+        if (offset < 2 || msg->data.size() < offset || (msg->data.size() - offset) % 4 != 0)
+        {
+            throw io_exception( rsutils::string::from() << "Invalid motion batch message (Topic: " << batch_data.getTopic() << ")" );
+        }
+        size_t count = (msg->data.size() - offset) / 4;
+
+        frame_additional_data additional_data{};
+        additional_data.frame_number = static_cast<unsigned long long>(msg->data[0]);
+        additional_data.timestamp = msg->data[1];
+
+        stream_identifier stream_id = ros_topic::get_stream_identifier(batch_data.getTopic());
+        auto info_topic = ros_topic::frame_metadata_topic(stream_id);
+        get_frame_metadata(m_file, info_topic, stream_id, batch_data, additional_data);
+
+        frame_interface * frame = m_frame_source->alloc_frame(
+            { stream_id.stream_type, stream_id.stream_index, RS2_EXTENSION_MOTION_FRAME },
+            count * sizeof(rs2_motion_sample),
+            std::move( additional_data ),
+            true );
+        if (frame == nullptr)
+        {
+            LOG_WARNING("Failed to allocate new frame");
+            return nullptr;
+        }
+        librealsense::motion_frame* motion_frame = static_cast<librealsense::motion_frame*>(frame);
+        //attaching a temp stream to the frame. Playback sensor should assign the real stream
+        frame->set_stream( std::make_shared< motion_stream_profile >() );
+        frame->get_stream()->set_format(RS2_FORMAT_MOTION_BATCH);
+        frame->get_stream()->set_stream_index(stream_id.stream_index);
+        frame->get_stream()->set_stream_type(stream_id.stream_type);
+
+        auto samples = reinterpret_cast<rs2_motion_sample*>(motion_frame->data.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double* row = msg->data.data() + offset + 4 * i;
+            samples[i] = { row[0], static_cast<float>(row[1]), static_cast<float>(row[2]), static_cast<float>(row[3]), 0.f };
+        }
+        librealsense::frame_holder fh{ motion_frame };
+        LOG_DEBUG("Created motion batch frame: " << stream_id << ", " << count << " samples");
+
+        return std::move(fh);
+    }
+
     inline float3 ros_reader::to_float3(const geometry_msgs::Vector3& v)
     {
         float3 f{};
@@ -29,6 +29,7 @@ namespace librealsense
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
+        nanoseconds seek_to_frame(const stream_identifier& stream_id, uint64_t frame_index) override;
         std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override;
         nanoseconds query_duration() const override;
         void reset() override;
@@ -37,6 +38,7 @@ namespace librealsense
         const std::string& get_file_name() const override;
 
     private:
+        void seek_samples_view(const rs2rosinternal::Time& time);
 
         template <typename ROS_TYPE>
         static typename ROS_TYPE::ConstPtr instantiate_msg(const rosbag::MessageInstance& msg)
@@ -81,6 +83,7 @@ namespace librealsense
                                                                      frame_additional_data& additional_data);
         frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
+        frame_holder create_motion_batch(const rosbag::MessageInstance &batch_data) const;
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
         static inline float4 to_float4(const geometry_msgs::Quaternion& q);
         frame_holder create_pose_sample(const rosbag::MessageInstance &msg) const;
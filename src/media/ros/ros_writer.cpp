@@ -61,7 +61,10 @@ namespace librealsense
 
         if (Is<motion_frame>(frame.frame))
         {
-            write_motion_frame(stream_id, timestamp, std::move(frame));
+            if (frame->get_stream()->get_format() == RS2_FORMAT_MOTION_BATCH)
+                write_motion_batch_frame(stream_id, timestamp, std::move(frame));
+            else
+                write_motion_frame(stream_id, timestamp, std::move(frame));
             return;
         }
 
@@ -262,6 +265,43 @@ namespace librealsense
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
+    void ros_writer::write_motion_batch_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    {
+        if (!frame)
+        {
+            throw io_exception("Null frame passed to write_motion_batch_frame");
+        }
+
+        // The frame number and timestamp, skipped by the data offset, then one row of [timestamp, x, y, z] per sample
+        std_msgs::Float64MultiArray batch_msg;
+        auto samples = reinterpret_cast<const rs2_motion_sample*>(frame.frame->get_frame_data());
+        auto count = static_cast<uint32_t>(frame.frame->get_frame_data_size() / sizeof(rs2_motion_sample));
+        std_msgs::MultiArrayDimension rows;
+        rows.label = "samples";
+        rows.size = count;
+        rows.stride = count * 4;
+        std_msgs::MultiArrayDimension columns;
+        columns.label = "timestamp_x_y_z";
+        columns.size = 4;
+        columns.stride = 4;
+        batch_msg.layout.dim = { rows, columns };
+        batch_msg.layout.data_offset = 2;
+        batch_msg.data.reserve(2 + 4 * count);
+        batch_msg.data.push_back(static_cast<double>(frame.frame->get_frame_number()));
+        batch_msg.data.push_back(frame.frame->get_frame_timestamp());
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            batch_msg.data.push_back(samples[i].timestamp);
+            batch_msg.data.push_back(samples[i].x);
+            batch_msg.data.push_back(samples[i].y);
+            batch_msg.data.push_back(samples[i].z);
+        }
+
+        auto topic = ros_topic::frame_data_topic(stream_id);
+        write_message(topic, timestamp, batch_msg);
+        write_additional_frame_messages(stream_id, timestamp, frame);
+    }
+
     inline geometry_msgs::Vector3 ros_writer::to_vector3(const float3& f)
     {
         geometry_msgs::Vector3 v;
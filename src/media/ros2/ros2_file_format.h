@@ -3,6 +3,7 @@
 
 #pragma once
 #include <string>
+#include <vector>
 #include <chrono>
 #include <memory>
 #include <stdexcept>
@@ -294,6 +295,51 @@ namespace librealsense
         static size_t getCdrSerializedSize(const cdr_uint32&, size_t = 0) { return sizeof(uint32_t); }
     };
 
+    // std_msgs/msg/Float64MultiArray
+    struct cdr_float64_multi_array {
+        struct dimension {
+            std::string label;
+            uint32_t size = 0;
+            uint32_t stride = 0;
+        };
+        std::vector<dimension> dim;
+        uint32_t data_offset = 0;
+        std::vector<double> data;
+
+        void serialize(eprosima::fastcdr::Cdr& cdr) const
+        {
+            cdr << static_cast<uint32_t>(dim.size());
+            for (auto const& d : dim)
+                cdr << d.label << d.size << d.stride;
+            cdr << data_offset << data;
+        }
+        void deserialize(eprosima::fastcdr::Cdr& cdr)
+        {
+            uint32_t n_dims = 0;
+            cdr >> n_dims;
+            dim.resize(n_dims);
+            for (auto& d : dim)
+                cdr >> d.label >> d.size >> d.stride;
+            cdr >> data_offset >> data;
+        }
+        static size_t getCdrSerializedSize(const cdr_float64_multi_array& a, size_t current_alignment = 0)
+        {
+            size_t initial_alignment = current_alignment;
+            current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+            for (auto const& d : a.dim)
+            {
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) + d.label.size() + 1;
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+            }
+            current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+            current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+            if (!a.data.empty())
+                current_alignment += a.data.size() * 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+            return current_alignment - initial_alignment;
+        }
+    };
+
     inline std::shared_ptr<rcutils_uint8_array_t> create_buffer(size_t size)
     {
         auto buffer = std::shared_ptr<rcutils_uint8_array_t>(new rcutils_uint8_array_t(),
@@ -0,0 +1,210 @@
+// License: Apache 2.0 See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "ros2_read_ahead.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace librealsense
+{
+    constexpr size_t ros2_buffer_pool::MAX_FREE_BUFFERS;
+    constexpr size_t ros2_read_ahead::MAX_AHEAD;
+
+
+    ros2_buffer_pool::~ros2_buffer_pool()
+    {
+        for (auto buffer : _free)
+            destroy(buffer);
+    }
+
+    void ros2_buffer_pool::destroy(rcutils_uint8_array_t* buffer)
+    {
+        rcutils_ret_t ret = rcutils_uint8_array_fini(buffer);
+        (void)ret; // Cast to void to suppress unused warning
+        delete buffer;
+    }
+
+    std::shared_ptr< rcutils_uint8_array_t > ros2_buffer_pool::acquire(size_t size)
+    {
+        rcutils_uint8_array_t* buffer = nullptr;
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            if (!_free.empty())
+            {
+                buffer = _free.back();
+                _free.pop_back();
+            }
+        }
+
+        if (!buffer)
+        {
+            buffer = new rcutils_uint8_array_t();
+            rcutils_allocator_t alloc = rcutils_get_default_allocator();
+            if (rcutils_uint8_array_init(buffer, size, &alloc) != RCUTILS_RET_OK)
+            {
+                delete buffer;
+                throw std::runtime_error("Failed to initialize rosbag2 buffer");
+            }
+        }
+        else if (buffer->buffer_capacity < size && rcutils_uint8_array_resize(buffer, size) != RCUTILS_RET_OK)
+        {
+            destroy(buffer);
+            throw std::runtime_error("Failed to resize rosbag2 buffer");
+        }
+        buffer->buffer_length = 0;
+
+        // The pool may be gone by the time the message is released
+        std::weak_ptr< ros2_buffer_pool > weak_pool = shared_from_this();
+        return std::shared_ptr< rcutils_uint8_array_t >(buffer,
+            [weak_pool](rcutils_uint8_array_t* buffer)
+            {
+                if (auto pool = weak_pool.lock())
+                    pool->release(buffer);
+                else
+                    destroy(buffer);
+            });
+    }
+
+    void ros2_buffer_pool::release(rcutils_uint8_array_t* buffer)
+    {
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            if (_free.size() < MAX_FREE_BUFFERS)
+            {
+                _free.push_back(buffer);
+                return;
+            }
+        }
+        destroy(buffer);
+    }
+
+
+    ros2_read_ahead::ros2_read_ahead(storage const& storage, std::function< void(message&) > prepare)
+        : _storage(storage)
+        , _prepare(std::move(prepare))
+    {
+        // Reading from storage is sequential; preparing (decompressing) is what takes the time
+        auto n_workers = std::max(1u, std::min(8u, std::thread::hardware_concurrency() - 1));
+        for (unsigned i = 0; i < n_workers; ++i)
+            _workers.emplace_back([this]() { prepare_worker(); });
+        _reader = std::thread([this]() { read_worker(); });
+    }
+
+    ros2_read_ahead::~ros2_read_ahead()
+    {
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            _stopping = true;
+        }
+        _read_cv.notify_all();
+        _prepare_cv.notify_all();
+        _reader.join();
+        for (auto& worker : _workers)
+            worker.join();
+    }
+
+    void ros2_read_ahead::read_worker()
+    {
+        std::unique_lock< std::mutex > lock(_mutex);
+        while (true)
+        {
+            _read_cv.wait(lock, [this]() { return _stopping || _n_read - _next < MAX_AHEAD; });
+            if (_stopping)
+                break;
+
+            lock.unlock();
+            message msg;
+            std::exception_ptr error;
+            try
+            {
+                if (_storage->has_next())
+                    msg = _storage->read_next();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (!msg)
+            {
+                _read_error = error;
+                _eof = true;
+                _ready_cv.notify_all();
+                break;
+            }
+            _to_prepare.emplace_back(_n_read++, std::move(msg));
+            _prepare_cv.notify_one();
+        }
+    }
+
+    void ros2_read_ahead::prepare_worker()
+    {
+        std::unique_lock< std::mutex > lock(_mutex);
+        while (true)
+        {
+            _prepare_cv.wait(lock, [this]() { return _stopping || !_to_prepare.empty(); });
+            if (_stopping)
+                break;
+
+            auto job = std::move(_to_prepare.front());
+            _to_prepare.pop_front();
+            lock.unlock();
+
+            entry e;
+            try
+            {
+                _prepare(job.second);
+                e.msg = std::move(job.second);
+            }
+            catch (...)
+            {
+                e.error = std::current_exception();
+            }
+
+            lock.lock();
+            _ready.emplace(job.first, std::move(e));
+            if (job.first == _next)
+                _ready_cv.notify_all();
+        }
+    }
+
+    bool ros2_read_ahead::next_ready() const
+    {
+        return _ready.find(_next) != _ready.end() || (_eof && _next == _n_read);
+    }
+
+    bool ros2_read_ahead::has_next()
+    {
+        std::unique_lock< std::mutex > lock(_mutex);
+        _ready_cv.wait(lock, [this]() { return next_ready(); });
+        return _next < _n_read || _read_error;
+    }
+
+    ros2_read_ahead::message ros2_read_ahead::next()
+    {
+        std::unique_lock< std::mutex > lock(_mutex);
+        _ready_cv.wait(lock, [this]() { return next_ready(); });
+
+        auto it = _ready.find(_next);
+        if (it == _ready.end())
+        {
+            // End of file, or we could not read any further
+            if (_read_error)
+                std::rethrow_exception(_read_error);
+            return nullptr;
+        }
+
+        auto e = std::move(it->second);
+        _ready.erase(it);
+        ++_next;
+        lock.unlock();
+        _read_cv.notify_one();
+
+        if (e.error)
+            std::rethrow_exception(e.error);
+        return e.msg;
+    }
+}
@@ -0,0 +1,90 @@
+// License: Apache 2.0 See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+#include <rosbag2_storage/serialized_bag_message.hpp>
+#include <rosbag2_storage/storage_interfaces/read_write_interface.hpp>
+#include <rcutils/types/uint8_array.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Recycles the rcutils buffers that messages are decompressed into.
+    // Buffers are handed out as shared_ptrs that return to the pool once the message using them is released.
+    class ros2_buffer_pool : public std::enable_shared_from_this< ros2_buffer_pool >
+    {
+    public:
+        static constexpr size_t MAX_FREE_BUFFERS = 64;
+
+        ~ros2_buffer_pool();
+
+        // Returns a buffer with a capacity of at least 'size' bytes, and a length of 0
+        std::shared_ptr< rcutils_uint8_array_t > acquire( size_t size );
+
+    private:
+        void release( rcutils_uint8_array_t * buffer );
+        static void destroy( rcutils_uint8_array_t * buffer );
+
+        std::mutex _mutex;
+        std::vector< rcutils_uint8_array_t * > _free;
+    };
+
+
+    // Reads messages from storage ahead of the consumer, and prepares them (e.g., decompression) on worker threads.
+    // Messages are returned in the order they are read from storage.
+    // Once created, the storage must not be used by anyone else until the read-ahead is destroyed.
+    class ros2_read_ahead
+    {
+    public:
+        using message = std::shared_ptr< rosbag2_storage::SerializedBagMessage >;
+        using storage = std::shared_ptr< rosbag2_storage::storage_interfaces::ReadWriteInterface >;
+
+        static constexpr size_t MAX_AHEAD = 32;  // messages read but not yet returned
+
+        ros2_read_ahead( storage const & storage, std::function< void( message & ) > prepare );
+        ~ros2_read_ahead();
+
+        // Both block until the next message is ready; next() returns null at end of file. If preparing the next
+        // message failed, the exception is thrown here.
+        bool has_next();
+        message next();
+
+    private:
+        struct entry
+        {
+            message msg;
+            std::exception_ptr error;
+        };
+
+        void read_worker();
+        void prepare_worker();
+        bool next_ready() const;
+
+        storage _storage;
+        std::function< void( message & ) > _prepare;
+
+        std::mutex _mutex;
+        std::condition_variable _read_cv;       // reader waits for room
+        std::condition_variable _prepare_cv;    // workers wait for messages to prepare
+        std::condition_variable _ready_cv;      // consumer waits for the next message
+        std::deque< std::pair< uint64_t, message > > _to_prepare;
+        std::map< uint64_t, entry > _ready;
+        uint64_t _n_read = 0;                   // messages read from storage so far
+        uint64_t _next = 0;                     // next message to return
+        bool _eof = false;
+        bool _stopping = false;
+        std::exception_ptr _read_error;
+        std::thread _reader;
+        std::vector< std::thread > _workers;
+    };
+}
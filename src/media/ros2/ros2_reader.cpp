@@ -102,7 +102,9 @@ namespace librealsense
     {
         try
         {
-            reset(); //Note: calling a virtual function inside c'tor, safe while base function is pure virtual
+            // Like reset(), but the duration is read before any read-ahead thread starts using the storage: the
+            // storage is not thread-safe, and nothing else queries its metadata later
+            reopen();
             m_total_duration = get_file_duration();
         }
         catch (const std::exception& e)
@@ -122,6 +124,7 @@ namespace librealsense
         if (!has_next_cached())
         {
             LOG_DEBUG("End of file reached");
+            report_throughput();
             return std::make_shared<serialized_end_of_file>();
         }
 
@@ -149,6 +152,8 @@ namespace librealsense
                     continue;
                 }
                 LOG_DEBUG("Next message is a frame");
+                ++_frames_read;
+                _bytes_read += msg->serialized_data ? msg->serialized_data->buffer_length : 0;
                 return create_frame(msg);
             }
 
@@ -174,13 +179,12 @@ namespace librealsense
 
             LOG_ERROR("read_next_data: unknown message type on topic: " << topic);
         }
+        report_throughput();
         return std::make_shared<serialized_end_of_file>();
     }
 
     void ros2_reader::seek_to_time(const nanoseconds& seek_time)
     {
-        // read all messages up to the requested time, updating the last frame is done inside the read function
-
         if (seek_time > m_total_duration)
         {
             throw invalid_value_exception( rsutils::string::from()
@@ -188,14 +192,33 @@ namespace librealsense
                                            << seek_time.count() << ", Duration = " << m_total_duration.count() << ")" );
         }
 
-        reset();
+        // The storage's timestamp index takes us straight to the first message at or after seek_time, rather than
+        // reading (and decompressing) everything before it
+        reopen();
+        _storage->seek(seek_time.count());
+        if (!_streaming_filter_topics.empty())
+            start_read_ahead();
+    }
 
-        auto msg = peek_next_cached();
-        while (msg && nanoseconds(msg->time_stamp) < seek_time)
+    nanoseconds ros2_reader::seek_to_frame(const stream_identifier& stream_id, uint64_t frame_index)
+    {
+        // The frame is looked up through a storage of its own, as the read-ahead may be using ours: playback is
+        // left as it was if there's no such frame
+        rosbag2_storage_plugins::SqliteStorage index;
+        index.open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        rcutils_time_point_value_t timestamp = 0;
+        if (!index.get_message_timestamp(ros2_topic::frame_data_topic(stream_id), frame_index, timestamp))
         {
-            read_next_cached();
-            msg = peek_next_cached();
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "Requested frame is out of the recorded frames. (Requested = "
+                                           << frame_index << ")" );
         }
+
+        reopen();
+        _storage->seek(timestamp);
+        if (!_streaming_filter_topics.empty())
+            start_read_ahead();
+        return nanoseconds(timestamp);
     }
 
     std::vector<std::shared_ptr<serialized_data>> ros2_reader::fetch_last_frames(const nanoseconds& seek_time)
@@ -218,8 +241,14 @@ namespace librealsense
 
     void ros2_reader::reset()
     {
-        _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
-        _storage->open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        reopen();
+        if (!_streaming_filter_topics.empty())
+            start_read_ahead();
+    }
+
+    void ros2_reader::reopen()
+    {
+        open_storage();
         m_frame_source = std::make_shared<frame_source>(32);
         m_frame_source->init(m_metadata_parser_map);
         _cache_valid = false;
@@ -231,6 +260,38 @@ namespace librealsense
         }
     }
 
+    void ros2_reader::open_storage()
+    {
+        // The read-ahead uses the storage, so must be gone before we replace it
+        _read_ahead.reset();
+        _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
+        _storage->open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+    }
+
+    void ros2_reader::start_read_ahead()
+    {
+        auto buffers = _buffers;
+        _read_ahead.reset(new ros2_read_ahead(_storage,
+            [buffers](ros2_read_ahead::message& msg) { decompress_if_needed(msg, *buffers); }));
+
+        _read_start = std::chrono::steady_clock::now();
+        _frames_read = 0;
+        _bytes_read = 0;
+    }
+
+    void ros2_reader::report_throughput() const
+    {
+        if (!_frames_read)
+            return;
+
+        std::chrono::duration< double > const elapsed = std::chrono::steady_clock::now() - _read_start;
+        if (elapsed.count() <= 0)
+            return;
+        LOG_INFO("Read " << _frames_read << " frames (" << (_bytes_read / ( 1024 * 1024 )) << " MB) in "
+                         << elapsed.count() << " sec: " << (_frames_read / elapsed.count()) << " frames/s, "
+                         << (_bytes_read / ( 1024. * 1024. ) / elapsed.count()) << " MB/s");
+    }
+
     void ros2_reader::enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
         for (const auto& id : stream_ids) _enabled_streams.insert(id);
@@ -313,6 +374,23 @@ namespace librealsense
             // Update additional_data fields from the JSON payload
             additional_data.frame_number = static_cast< unsigned long long >( payload->frame_id );
         }
+        else if (is_imu_topic && _motion_batch_topics.count(msg->topic_name))
+        {
+            // See ros2_writer::write_frame; the frame number and timestamp also come with the metadata
+            auto batch = deserialize_message<cdr_float64_multi_array>(msg);
+            size_t offset = batch.data_offset;
+            if (offset < 2 || batch.data.size() < offset || (batch.data.size() - offset) % 4 != 0)
+                throw io_exception( rsutils::string::from() << "Invalid motion batch message (Topic: " << msg->topic_name << ")" );
+            size_t count = (batch.data.size() - offset) / 4;
+
+            data.resize(count * sizeof(rs2_motion_sample));
+            auto samples = reinterpret_cast<rs2_motion_sample*>(data.data());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const double* row = batch.data.data() + offset + 4 * i;
+                samples[i] = { row[0], static_cast<float>(row[1]), static_cast<float>(row[2]), static_cast<float>(row[3]), 0.f };
+            }
+        }
         else if (is_imu_topic)
         {
             auto imu = deserialize_message<sensor_msgs::msg::Imu>(msg);
@@ -370,6 +448,8 @@ namespace librealsense
 
     nanoseconds ros2_reader::get_file_duration()
     {
+        if (_read_ahead)
+            throw wrong_api_call_sequence_exception("The file duration cannot be read while reading ahead");
         auto meta = _storage->get_metadata();
         return nanoseconds(meta.duration.count());
     }
@@ -525,12 +605,15 @@ namespace librealsense
         const stream_identifier& stream_id,
         frame_additional_data additional_data) const
     {
+        // Images keep the deserialized buffer rather than copying it into one of their own; other frames read their
+        // payload from their own buffer, which is small, so it comes from the archive's pool
         auto frame_ext = frame_source::stream_to_frame_types(stream_id.stream_type);
+        bool const adopt = frame_ext == RS2_EXTENSION_VIDEO_FRAME || frame_ext == RS2_EXTENSION_DEPTH_FRAME;
         frame_interface* frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_ext },
             data.size(),
             std::move(additional_data),
-            true);
+            ! adopt);
 
         if (frame == nullptr)
         {
@@ -538,9 +621,14 @@ namespace librealsense
             return frame_holder{};
         }
 
-        // Move the deserialized data directly — avoids a full memcpy of image data
         auto base_frame = static_cast<librealsense::frame*>(frame);
-        base_frame->data = std::move(data);
+        if (adopt)
+        {
+            auto pixels = std::make_shared< std::vector< uint8_t > >( std::move( data ) );
+            base_frame->attach_continuation( frame_continuation( [pixels] {}, pixels->data(), pixels->size() ) );
+        }
+        else
+            base_frame->data.assign(data.begin(), data.end());
 
         setup_frame(frame, stream_id);
 
@@ -1019,6 +1107,9 @@ namespace librealsense
         if (_initialized) return m_initial_device_description;
 
         _topics_cache = _storage->get_all_topics_and_types();
+        for (auto const& topic : _topics_cache)
+            if (topic.type == "std_msgs/msg/Float64MultiArray")
+                _motion_batch_topics.insert(topic.name);
 
         //// Read sensor indices from topics cached - does not read from storage
         std::vector<sensor_snapshot> sensor_descriptions;
@@ -1151,8 +1242,7 @@ namespace librealsense
     void ros2_reader::prepare_for_streaming()
     {
         // Reopen storage to reset the filter, and apply relevant filters for streaming
-        _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
-        _storage->open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        open_storage();
 
         // Stream topics: /device_N/sensor_N/StreamType_Idx/<ros_type>/(data|metadata)
         auto stream_topics_regex = std::regex((rsutils::string::from() << "^/device_" << get_device_index() << "/sensor_\\d+/[^/]+/[^/]+/(data|metadata)$").str());
@@ -1171,6 +1261,7 @@ namespace librealsense
         _streaming_filter_topics.insert(_streaming_filter_topics.end(), notification_topics.begin(), notification_topics.end());
 
         _storage->set_filter({ _streaming_filter_topics });
+        start_read_ahead();
     }
 
     std::shared_ptr<info_container> ros2_reader::read_info_snapshot(const std::string& topic)
@@ -1289,7 +1380,7 @@ namespace librealsense
         if (_cache_valid)
             return true;
 
-        return _storage->has_next();
+        return _read_ahead ? _read_ahead->has_next() : _storage->has_next();
     }
 
     static bool is_zstd_compressed(const uint8_t* src, size_t src_size)
@@ -1298,7 +1389,7 @@ namespace librealsense
         return src_size >= 4 && src[0] == 0x28 && src[1] == 0xB5 && src[2] == 0x2F && src[3] == 0xFD;
     }
 
-    void ros2_reader::decompress_if_needed(std::shared_ptr<rosbag2_storage::SerializedBagMessage>& msg)
+    void ros2_reader::decompress_if_needed(std::shared_ptr<rosbag2_storage::SerializedBagMessage>& msg, ros2_buffer_pool& buffers)
     {
         if (!msg || !msg->serialized_data || !msg->serialized_data->buffer || msg->serialized_data->buffer_length == 0)
             return;
@@ -1322,11 +1413,9 @@ namespace librealsense
 
         auto decompressed_size = static_cast<size_t>(frame_content_size);
 
-        // We create a new buffer for the decompressed data each time. We could use
-        // a reusable member buffer like the writer does, but here the frame data may
-        // still be in use when the metadata is read next and overwrite it — allowing
-        // it to reallocate for simplicity for now.
-        auto out = create_buffer(decompressed_size);
+        // The frame data may still be in use when the metadata is read next, so each message gets its own buffer;
+        // buffers go back to the pool when their message is released
+        auto out = buffers.acquire(decompressed_size);
 
         auto result = ZSTD_decompress(out->buffer, out->buffer_capacity, src, src_size);
         if (ZSTD_isError(result))
@@ -1345,13 +1434,8 @@ namespace librealsense
             return _cached_message;
         }
 
-        // Otherwise, read from storage and return immediately (no caching)
-        if (!_storage->has_next())
-            return nullptr;
-
-        auto msg = _storage->read_next();
-        decompress_if_needed(msg);
-        return msg;
+        // Otherwise, read the next message and return immediately (no caching)
+        return read_next_message();
     }
 
     std::shared_ptr<rosbag2_storage::SerializedBagMessage> ros2_reader::peek_next_cached()
@@ -1360,13 +1444,25 @@ namespace librealsense
         if (_cache_valid)
             return _cached_message;
 
-        // Otherwise, read from storage and cache it
-        if (!_storage->has_next())
+        // Otherwise, read the next message and cache it
+        _cached_message = read_next_message();
+        if (!_cached_message)
             return nullptr;
 
-        _cached_message = _storage->read_next();
-        decompress_if_needed(_cached_message);
         _cache_valid = true;
         return _cached_message;
     }
+
+    std::shared_ptr<rosbag2_storage::SerializedBagMessage> ros2_reader::read_next_message()
+    {
+        if (_read_ahead)
+            return _read_ahead->next();
+
+        if (!_storage->has_next())
+            return nullptr;
+
+        auto msg = _storage->read_next();
+        decompress_if_needed(msg, *_buffers);
+        return msg;
+    }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <rosbag2_storage_default_plugins/sqlite/sqlite_storage.hpp>
 
 #include "ros2_file_format.h"
+#include "ros2_read_ahead.h"
 
 
 namespace librealsense
@@ -28,6 +29,7 @@ namespace librealsense
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
+        nanoseconds seek_to_frame(const stream_identifier& stream_id, uint64_t frame_index) override;
         std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override;
         nanoseconds query_duration() const override;
         void reset() override;
@@ -41,6 +43,13 @@ namespace librealsense
         bool has_next_cached() const;
         std::shared_ptr<rosbag2_storage::SerializedBagMessage> read_next_cached();
         std::shared_ptr<rosbag2_storage::SerializedBagMessage> peek_next_cached();
+        std::shared_ptr<rosbag2_storage::SerializedBagMessage> read_next_message();
+
+        // While streaming, messages are read and decompressed ahead by a ros2_read_ahead
+        void reopen();
+        void open_storage();
+        void start_read_ahead();
+        void report_throughput() const;
 
         static std::vector<std::string> split_string(const std::string& s, char delimiter);
         static std::string get_value(const std::map<std::string, std::string>& kv, const std::string& key);
@@ -65,7 +74,7 @@ namespace librealsense
             return data;
         }
 
-        nanoseconds get_file_duration();
+        nanoseconds get_file_duration();  // queries the storage: not while reading ahead
 
         uint32_t read_file_version();
         bool try_read_stream_extrinsic(const stream_identifier& stream_id, uint32_t& group_id, rs2_extrinsics& extrinsic);
@@ -128,6 +137,7 @@ namespace librealsense
         std::string                             m_file_path;
         std::shared_ptr<frame_source>           m_frame_source;
         std::vector< rosbag2_storage::TopicMetadata > _topics_cache;
+        std::set< std::string > _motion_batch_topics;  // motion data topics recorded as Float64MultiArray
         std::shared_ptr<context>                m_context;
         std::map<uint32_t, std::map<rs2_option, std::string>> m_read_options_descriptions;
 
@@ -141,7 +151,15 @@ namespace librealsense
 
         std::map< stream_identifier, std::pair< uint32_t, rs2_extrinsics > > m_extrinsics_map;
 
-        static void decompress_if_needed(std::shared_ptr<rosbag2_storage::SerializedBagMessage>& msg);
+        static void decompress_if_needed(std::shared_ptr<rosbag2_storage::SerializedBagMessage>& msg, ros2_buffer_pool& buffers);
+
+        std::shared_ptr<ros2_buffer_pool> _buffers = std::make_shared<ros2_buffer_pool>();
+        std::unique_ptr<ros2_read_ahead> _read_ahead;  // only while streaming
+
+        // Playback throughput since the last reset, reported at end of file
+        std::chrono::steady_clock::time_point _read_start;
+        uint64_t _frames_read = 0;
+        uint64_t _bytes_read = 0;
 
         std::shared_ptr<rosbag2_storage::SerializedBagMessage> _cached_message;
         bool _cache_valid = false;  // true means _cached_message contains valid unconsumed data
@@ -22,6 +22,7 @@
 #include <src/labeled-points.h>
 #include <src/object-detection-frame.h>
 
+#include <algorithm>
 #include <fstream>
 
 namespace librealsense
@@ -35,7 +36,13 @@ namespace librealsense
         return file.substr(0, file.size() - 4);
     }
 
-    ros2_writer::ros2_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
+    constexpr size_t ros2_writer::MAX_IN_FLIGHT;
+    constexpr size_t ros2_writer::BATCH_SIZE;
+    constexpr std::chrono::milliseconds ros2_writer::BATCH_WINDOW;
+
+    ros2_writer::ros2_writer(const std::string& file, bool compress_while_record, bool drop_frames_when_full)
+        : m_file_path(file)
+        , _drop_frames_when_full(drop_frames_when_full)
     {
         LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
         _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
@@ -61,25 +68,242 @@ namespace librealsense
 
         _compress = compress_while_record;
 
+        // Only queued, not written, until the threads start: nothing after them may throw, or their destruction while
+        // still joinable would terminate us
         write_file_version();
+
+        try
+        {
+            if (_compress)
+            {
+                // Compression is what the single writer thread could not keep up with; leave a core or two to the rest
+                auto n_workers = std::max(1u, std::min(4u, std::thread::hardware_concurrency() / 2));
+                for (unsigned i = 0; i < n_workers; ++i)
+                    _compress_workers.emplace_back([this]() { compress_worker(); });
+            }
+            _write_thread = std::thread([this]() { write_worker(); });
+        }
+        catch (...)
+        {
+            stop_workers();
+            throw;
+        }
     }
 
-    void ros2_writer::ensure_topic(const std::string& name, const std::string& type)
+    void ros2_writer::stop_workers()
     {
-        if (_topics.find(name) != _topics.end())
-            return;
-        rosbag2_storage::TopicMetadata md;
-        md.name = name;
-        md.type = type;
-        md.serialization_format = "cdr";
-        _storage->create_topic(md);
-        _topics.emplace(name, md);
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            _stopping = true;
+        }
+        _work_cv.notify_all();
+        for (auto& worker : _compress_workers)
+            if (worker.joinable())
+                worker.join();
+        if (_write_thread.joinable())
+            _write_thread.join();
+    }
+
+    ros2_writer::~ros2_writer()
+    {
+        stop_workers();
+
+        auto stats = get_statistics();
+        LOG_INFO("Recording to '" << m_file_path << "' done: " << stats.messages_written << " messages in "
+                 << stats.batches_written << " batches, " << stats.frames_dropped << " frames dropped, waited "
+                 << stats.backpressure_waits << " times ("
+                 << std::chrono::duration_cast< std::chrono::milliseconds >(stats.backpressure_time).count()
+                 << " ms) for the writer");
+    }
+
+    writer_statistics ros2_writer::get_statistics() const
+    {
+        std::lock_guard< std::mutex > lock(_mutex);
+        return _stats;
+    }
+
+    std::shared_ptr<rcutils_uint8_array_t> ros2_writer::acquire_buffer(size_t size)
+    {
+        std::shared_ptr<rcutils_uint8_array_t> buffer;
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            if (!_free_buffers.empty())
+            {
+                buffer = std::move(_free_buffers.back());
+                _free_buffers.pop_back();
+            }
+        }
+        return std::move(ensure_buffer_capacity(buffer, size));
+    }
+
+    void ros2_writer::recycle_buffer(std::shared_ptr<rcutils_uint8_array_t>&& buffer)
+    {
+        // Only keep as many as can be in use at once; CDR and compressed buffers alternate
+        std::lock_guard< std::mutex > lock(_mutex);
+        if (_free_buffers.size() < 2 * MAX_IN_FLIGHT)
+            _free_buffers.push_back(std::move(buffer));
+    }
+
+    bool ros2_writer::pipeline_full() const
+    {
+        return _in_flight >= MAX_IN_FLIGHT;
+    }
+
+    void ros2_writer::enqueue(std::shared_ptr<rosbag2_storage::SerializedBagMessage>&& msg, std::string const& msg_type)
+    {
+        pending_message pending;
+        pending.msg = std::move(msg);
+
+        // Topics are created by the writer thread, just before their first message
+        if (_topics.find(pending.msg->topic_name) == _topics.end())
+        {
+            rosbag2_storage::TopicMetadata md;
+            md.name = pending.msg->topic_name;
+            md.type = msg_type;
+            md.serialization_format = "cdr";
+            _topics.emplace(md.name, md);
+            pending.new_topic = std::make_shared< rosbag2_storage::TopicMetadata >(std::move(md));
+        }
+
+        std::unique_lock< std::mutex > lock(_mutex);
+        if (!_error.empty())
+            throw std::runtime_error(_error);
+        if (pipeline_full())
+        {
+            ++_stats.backpressure_waits;
+            auto const start = std::chrono::steady_clock::now();
+            _space_cv.wait(lock, [this]() { return !pipeline_full() || !_error.empty(); });
+            _stats.backpressure_time += std::chrono::steady_clock::now() - start;
+            if (!_error.empty())
+                throw std::runtime_error(_error);
+        }
+
+        auto seq = _next_seq++;
+        ++_in_flight;
+        if (_compress)
+            _to_compress.emplace_back(seq, std::move(pending));
+        else
+            _ready.emplace(seq, std::move(pending));
+        lock.unlock();
+        _work_cv.notify_all();
+    }
+
+    void ros2_writer::compress_worker()
+    {
+        std::unique_lock< std::mutex > lock(_mutex);
+        while (true)
+        {
+            _work_cv.wait(lock, [this]() { return _stopping || !_to_compress.empty(); });
+            if (_to_compress.empty())
+                break;  // stopping, and nothing left to compress
+
+            auto job = std::move(_to_compress.front());
+            _to_compress.pop_front();
+            lock.unlock();
+
+            auto& msg = job.second.msg;
+            auto input = std::move(msg->serialized_data);
+            try
+            {
+                msg->serialized_data = compress_buffer(input);
+            }
+            catch (std::exception const& e)
+            {
+                // Keep the message uncompressed rather than lose it
+                LOG_ERROR(e.what());
+                msg->serialized_data = input;
+                input.reset();
+            }
+            if (input)
+                recycle_buffer(std::move(input));
+
+            lock.lock();
+            _ready.emplace(job.first, std::move(job.second));
+            _work_cv.notify_all();
+        }
+    }
+
+    void ros2_writer::write_worker()
+    {
+        std::vector< pending_message > batch;
+        std::unique_lock< std::mutex > lock(_mutex);
+        while (true)
+        {
+            // Collect the next messages, in order, until we have a full batch or the window closes
+            auto const deadline = std::chrono::steady_clock::now() + BATCH_WINDOW;
+            while (batch.size() < BATCH_SIZE)
+            {
+                auto it = _ready.find(_next_write_seq);
+                if (it != _ready.end())
+                {
+                    batch.push_back(std::move(it->second));
+                    _ready.erase(it);
+                    ++_next_write_seq;
+                    continue;
+                }
+                if (_stopping && _in_flight == batch.size())
+                    break;  // nothing more is coming
+                if (!batch.empty() && _work_cv.wait_until(lock, deadline) == std::cv_status::timeout)
+                    break;
+                if (batch.empty())
+                    _work_cv.wait(lock);
+            }
+            if (batch.empty())
+                break;  // stopping
+
+            lock.unlock();
+            std::string error;
+            try
+            {
+                write_batch(batch);
+            }
+            catch (std::exception const& e)
+            {
+                error = rsutils::string::from() << "Failed to write to '" << m_file_path << "': " << e.what();
+                LOG_ERROR(error);
+            }
+            for (auto& pending : batch)
+                recycle_buffer(std::move(pending.msg->serialized_data));
+            auto const n_written = batch.size();
+            batch.clear();
+            lock.lock();
+
+            _in_flight -= n_written;
+            if (error.empty())
+            {
+                _stats.messages_written += n_written;
+                ++_stats.batches_written;
+            }
+            else if (_error.empty())
+                _error = std::move(error);
+            _space_cv.notify_all();
+        }
+    }
+
+    void ros2_writer::write_batch(std::vector< pending_message >& batch)
+    {
+        // Each batch is written in a single transaction, except that topics must be created first
+        std::vector< std::shared_ptr< const rosbag2_storage::SerializedBagMessage > > messages;
+        messages.reserve(batch.size());
+        for (auto& pending : batch)
+        {
+            if (pending.new_topic)
+            {
+                if (!messages.empty())
+                    _storage->write(messages);
+                messages.clear();
+                _storage->create_topic(*pending.new_topic);
+            }
+            messages.push_back(pending.msg);
+        }
+        if (!messages.empty())
+            _storage->write(messages);
     }
 
     std::shared_ptr<rcutils_uint8_array_t> ros2_writer::compress_buffer(const std::shared_ptr<rcutils_uint8_array_t>& input)
     {
         auto bound = ZSTD_compressBound(input->buffer_length);
-        auto& out = ensure_buffer_capacity(_compress_buf, bound);
+        auto out = acquire_buffer(bound);
 
         // Level 1 is the fastest zstd level with good-enough ratio; comparable in speed to LZ4 used by rosbag1
         auto compressed_size = ZSTD_compress(out->buffer, out->buffer_capacity, input->buffer, input->buffer_length, 1);
@@ -130,6 +354,17 @@ namespace librealsense
         if (!frame || !frame.frame)
             return;
 
+        if (_drop_frames_when_full)
+        {
+            std::lock_guard< std::mutex > lock(_mutex);
+            if (pipeline_full())
+            {
+                if (!_stats.frames_dropped++)
+                    LOG_WARNING("Recording to '" << m_file_path << "' cannot keep up; dropping frames");
+                return;
+            }
+        }
+
         // Build ROS2 timestamp from nanoseconds
         auto ns_count = timestamp.count();
         int32_t stamp_sec = static_cast<int32_t>(ns_count / 1000000000LL);
@@ -158,6 +393,29 @@ namespace librealsense
 
             write_message(ros2_topic::frame_data_topic(stream_id), "sensor_msgs/msg/Image", timestamp, img);
         }
+        else if (Is<motion_frame>(frame.frame)
+                 && frame->get_stream()->get_format() == RS2_FORMAT_MOTION_BATCH)
+        {
+            // Same layout as in ROS1 (see ros_writer::write_motion_batch_frame): the frame number and timestamp,
+            // skipped by the data offset, then one row of [timestamp, x, y, z] per sample
+            auto samples = reinterpret_cast<const rs2_motion_sample*>(frame->get_frame_data());
+            auto count = static_cast<uint32_t>(frame->get_frame_data_size() / sizeof(rs2_motion_sample));
+            cdr_float64_multi_array batch;
+            batch.dim = { { "samples", count, count * 4 }, { "timestamp_x_y_z", 4, 4 } };
+            batch.data_offset = 2;
+            batch.data.reserve(2 + 4 * count);
+            batch.data.push_back(static_cast<double>(frame->get_frame_number()));
+            batch.data.push_back(frame->get_frame_timestamp());
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                batch.data.push_back(samples[i].timestamp);
+                batch.data.push_back(samples[i].x);
+                batch.data.push_back(samples[i].y);
+                batch.data.push_back(samples[i].z);
+            }
+
+            write_message(ros2_topic::frame_data_topic(stream_id), "std_msgs/msg/Float64MultiArray", timestamp, batch);
+        }
         else if (Is<motion_frame>(frame.frame))
         {
             auto motion = As<motion_frame>(frame.frame);
@@ -8,6 +8,11 @@
 
 #include "ros2_file_format.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 
 namespace librealsense
 {
@@ -20,18 +25,22 @@ namespace librealsense
     class ros2_writer: public writer
     {
     public:
-        explicit ros2_writer( const std::string& file, bool compress_while_record);
+        // By default, writes wait while the pipeline is full. With 'drop_frames_when_full', write_frame() drops (and
+        // counts) frames instead, so a live recording does not stall the device
+        ros2_writer( const std::string& file, bool compress_while_record, bool drop_frames_when_full = false );
+        ~ros2_writer();
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
 
+        writer_statistics get_statistics() const override;
+
     private:
         void write_file_version();
         void write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
         void write_string( std::string const & topic, const device_serializer::nanoseconds & ts, std::string const & payload );
-        void ensure_topic( const std::string & name, const std::string & type );
 
         void write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n) override;
         void write_extrinsics(const stream_identifier& stream_id, uint32_t reference_id, const rs2_extrinsics& ext) override;
@@ -67,35 +76,69 @@ namespace librealsense
         template<typename T>
         void write_message(const std::string& topic, const std::string& msg_type, const nanoseconds& timestamp, const T& data)
         {
-            // Serialize into reusable CDR buffer — avoids per-message malloc on the hot path
+            // Serialize into a recycled CDR buffer — avoids per-message malloc on the hot path
             auto total_size = T::getCdrSerializedSize(data) + CDR_HEADER_SIZE;
-            auto& buffer = ensure_buffer_capacity(_cdr_buf, total_size);
+            auto buffer = acquire_buffer(total_size);
             eprosima::fastcdr::FastBuffer fb(reinterpret_cast<char*>(buffer->buffer), total_size);
             eprosima::fastcdr::Cdr cdr(fb, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
             cdr.serialize_encapsulation();
             data.serialize(cdr);
             buffer->buffer_length = static_cast<size_t>(cdr.getSerializedDataLength());
 
-            // Write to storage
-            ensure_topic(topic, msg_type);
             auto msg = std::make_shared<rosbag2_storage::SerializedBagMessage>();
-            msg->serialized_data = _compress ? compress_buffer(buffer) : buffer;
+            msg->serialized_data = std::move(buffer);
             msg->time_stamp = static_cast<rcutils_time_point_value_t>(timestamp.count());
             msg->topic_name = topic;
-            _storage->write(msg);
+            enqueue(std::move(msg), msg_type);
         }
 
+        // Messages are written in a pipeline, so the caller only has to serialize them:
+        //     enqueue() --> compression workers (if compressing) --> reordering --> writer thread
+        // The writer thread inserts them into storage in the original order, in batches of up to BATCH_SIZE messages
+        // per transaction (or whatever arrived within BATCH_WINDOW).
+        static constexpr size_t MAX_IN_FLIGHT = 64;     // messages queued in the pipeline
+        static constexpr size_t BATCH_SIZE = 32;
+        static constexpr std::chrono::milliseconds BATCH_WINDOW{ 100 };
+
+        struct pending_message
+        {
+            std::shared_ptr< rosbag2_storage::SerializedBagMessage > msg;
+            std::shared_ptr< rosbag2_storage::TopicMetadata > new_topic;  // to create before writing msg
+        };
+
+        void enqueue( std::shared_ptr< rosbag2_storage::SerializedBagMessage > && msg, std::string const & msg_type );
+        bool pipeline_full() const;
+        void compress_worker();
+        void write_worker();
+        void write_batch( std::vector< pending_message > & batch );
+        void stop_workers();
+        std::shared_ptr< rcutils_uint8_array_t > acquire_buffer( size_t size );
+        void recycle_buffer( std::shared_ptr< rcutils_uint8_array_t > && buffer );
+
         std::shared_ptr<rcutils_uint8_array_t> compress_buffer(const std::shared_ptr<rcutils_uint8_array_t>& input);
 
         static uint8_t is_big_endian();
         std::string m_file_path;
         bool _compress = false;
-        // Reused across calls. Safe only while _storage->write() stays synchronous
-        // (sqlite binds SQLITE_STATIC and drops the ref in execute_and_reset).
-        std::shared_ptr<rcutils_uint8_array_t> _cdr_buf;
-        std::shared_ptr<rcutils_uint8_array_t> _compress_buf;
+        bool _drop_frames_when_full = false;
         std::map< std::string, rosbag2_storage::TopicMetadata > _topics; // created topics cache
-        std::shared_ptr< rosbag2_storage::storage_interfaces::ReadWriteInterface > _storage;
+        std::shared_ptr< rosbag2_storage::storage_interfaces::ReadWriteInterface > _storage;  // writer thread only
+
+        // Pipeline state, all protected by _mutex
+        mutable std::mutex _mutex;
+        std::condition_variable _work_cv;       // compression workers and writer thread wait on this
+        std::condition_variable _space_cv;      // producers wait on this when the pipeline is full
+        uint64_t _next_seq = 0;                 // sequence number of the next enqueued message
+        uint64_t _next_write_seq = 0;           // sequence number of the next message to write
+        size_t _in_flight = 0;
+        std::deque< std::pair< uint64_t, pending_message > > _to_compress;
+        std::map< uint64_t, pending_message > _ready;  // compressed (or uncompressed) and waiting to be written in order
+        std::vector< std::shared_ptr< rcutils_uint8_array_t > > _free_buffers;
+        bool _stopping = false;
+        std::string _error;                     // first storage error, reported on the next write
+        writer_statistics _stats;
+        std::vector< std::thread > _compress_workers;
+        std::thread _write_thread;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
         std::set<device_serializer::stream_identifier> m_extrinsics_msgs;
     };
@@ -54,11 +54,11 @@ namespace librealsense
     }
 
     std::shared_ptr<device_serializer::writer> create_writer_for_file(
-        const std::string& file, bool compress)
+        const std::string& file, bool compress, bool drop_frames_when_full)
     {
 #ifdef BUILD_ROSBAG2
         rcutils_logging_set_output_handler(rcutils_to_librealsense_log);
-        return std::make_shared<ros2_writer>(file, compress);
+        return std::make_shared<ros2_writer>(file, compress, drop_frames_when_full);
 #else
         if (is_db3_file(file))
             throw invalid_value_exception("Cannot record to .db3 without BUILD_ROSBAG2");
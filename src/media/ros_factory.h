@@ -19,6 +19,7 @@ namespace librealsense
 
     // With BUILD_ROSBAG2: always ros2_writer (requires .db3 extension)
     // Without BUILD_ROSBAG2: ros_writer (rejects .db3)
+    // With 'drop_frames_when_full', the ros2_writer drops frames when it cannot keep up, rather than stall the device
     std::shared_ptr<device_serializer::writer> create_writer_for_file(
-        const std::string& file, bool compress);
+        const std::string& file, bool compress, bool drop_frames_when_full = false);
 }
@@ -93,6 +93,8 @@ namespace librealsense
 
             bool is_platform_jetson() const override { return false;}
 
+            bool supports_frame_loans() const override { return false; }
+
             std::string get_device_location() const override { return _location; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
             IAMVideoProcAmp* get_video_proc() const;
@@ -80,6 +80,14 @@ void float_option::set(float value)
     _value = value;
 }
 
+void atomic_int_option::set( float value )
+{
+    if( ! is_valid( value ) )
+        throw invalid_value_exception( rsutils::string::from()
+                                       << "set(...) failed! " << value << " is not a valid value" );
+    _value = static_cast< int >( value );
+}
+
 
 void auto_disabling_control::set( float value )
 {
@@ -287,6 +287,29 @@ namespace librealsense
         using ptr = std::shared_ptr< bool_option >;
     };
 
+    // An integer option that is read by other threads (e.g., the frame callbacks) while the user may set it
+    class atomic_int_option : public option_base
+    {
+    public:
+        atomic_int_option( option_range range, std::string description )
+            : option_base( range )
+            , _value( static_cast< int >( range.def ) )
+            , _description( std::move( description ) )
+        {
+        }
+
+        void set( float value ) override;
+        float query() const override { return static_cast< float >( _value.load() ); }
+        bool is_enabled() const override { return true; }
+        const char * get_description() const override { return _description.c_str(); }
+
+        int get() const { return _value; }
+
+    private:
+        std::atomic< int > _value;
+        std::string _description;
+    };
+
 
     /** Wrapper for another option -- forwards all API calls to the proxied option
     *such that specific functionality can be easily overriden */
@@ -458,4 +481,15 @@ namespace librealsense
         std::atomic<bool>  _is_active;
     };
 
+    class motion_batch_window_option : public float_option
+    {
+    public:
+        motion_batch_window_option() : float_option(option_range{ 1, 1000, 1, 10 }) {}
+
+        const char* get_description() const override
+        {
+            return "Time span, in milliseconds, of the samples packed into each motion batch frame";
+        }
+    };
+
 }
@@ -13,7 +13,7 @@ namespace librealsense
     {
         aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
             processing_block("aggregator"),
-            _queue(new single_consumer_frame_queue<frame_holder>(1)),
+            _queue(new lock_free_frame_queue<frame_holder>(1)),
             _streams_to_aggregate_ids(streams_to_aggregate),
             _streams_to_sync_ids(streams_to_sync),
             _accepting(true)
@@ -147,9 +147,10 @@ platform_camera::platform_camera( std::shared_ptr< const device_info > const & d
         processing_block_factory::create_pbf_vector< nv12_converter >( RS2_FORMAT_NV12,
                                                                        map_supported_color_formats( RS2_FORMAT_NV12 ),
                                                                        RS2_STREAM_COLOR ) );
-    color_ep->register_processing_block( { { RS2_FORMAT_MJPEG } },
-                                         { { RS2_FORMAT_RGB8, RS2_STREAM_COLOR } },
-                                         []() { return std::make_shared< mjpeg_converter >( RS2_FORMAT_RGB8 ); } );
+    color_ep->register_processing_block( processing_block_factory::create_pbf_vector< mjpeg_converter >(
+        RS2_FORMAT_MJPEG,
+        { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8 },
+        RS2_STREAM_COLOR ) );
     color_ep->register_processing_block(
         processing_block_factory::create_id_pbf( RS2_FORMAT_MJPEG, RS2_STREAM_COLOR ) );
     color_ep->register_processing_block(
@@ -147,6 +147,10 @@ public:
 
     virtual bool is_platform_jetson() const = 0;
 
+    // True when the frame pixels handed to the frame callback remain valid until its continuation is invoked, so
+    // that the frame may be published without copying and the backend buffer returned only once it is released
+    virtual bool supports_frame_loans() const = 0;
+
     virtual ~uvc_device() = default;
 
 protected:
@@ -251,6 +255,8 @@ public:
 
     bool is_platform_jetson() const override { return _dev->is_platform_jetson(); }
 
+    bool supports_frame_loans() const override { return _dev->supports_frame_loans(); }
+
 private:
     std::shared_ptr< uvc_device > _dev;
 };
@@ -389,6 +395,14 @@ public:
         return false;
     }
 
+    bool supports_frame_loans() const override
+    {
+        for( auto & elem : _dev )
+            if( ! elem || ! elem->supports_frame_loans() )
+                return false;
+        return ! _dev.empty();
+    }
+
 private:
     uint32_t get_dev_index_by_profiles( const stream_profile & profile ) const
     {
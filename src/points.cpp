@@ -68,7 +68,9 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
     const auto threshold = 0.05f;
     auto width = video_stream_profile->get_width();
     std::vector< std::tuple< int, int, int > > faces;
-    for( uint32_t x = 0; x < width - 1; ++x )
+    // Compacted points no longer follow the depth image, so their neighbours are unknown
+    bool const on_grid = get_vertex_count() == width * video_stream_profile->get_height();
+    for( uint32_t x = 0; on_grid && x < width - 1; ++x )
     {
         for( uint32_t y = 0; y < video_stream_profile->get_height() - 1; ++y )
         {
@@ -149,6 +151,13 @@ size_t points::get_vertex_count() const
     return data.size() / ( sizeof( float3 ) + sizeof( int2 ) );
 }
 
+void points::resize( size_t vertex_count )
+{
+    if( vertex_count > get_vertex_count() )
+        throw librealsense::invalid_value_exception( "points can only shrink" );
+    data.resize( vertex_count * ( sizeof( float3 ) + sizeof( int2 ) ) );
+}
+
 float2 * points::get_texture_coordinates()
 {
     get_frame_data();  // call GetData to ensure data is in main memory
@@ -20,6 +20,9 @@ public:
     size_t get_vertex_count() const;
     float2 * get_texture_coordinates();
 
+    // Keeps only the first 'vertex_count' vertices, whose texture coordinates must already follow them
+    void resize( size_t vertex_count );
+
 };
 MAP_EXTENSION( RS2_EXTENSION_POINTS, librealsense::points );
 
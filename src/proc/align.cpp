@@ -10,8 +10,14 @@
 #include "environment.h"
 #include "align.h"
 #include "stream.h"
+#include "option.h"
+#include "proc/pointcloud.h"
+#include "proc/worker-pool.h"
 #include <rsutils/easylogging/easyloggingpp.h>
 
+#include <cstring>
+#include <limits>
+
 #if defined(RS2_USE_CUDA)
 #include "proc/cuda/cuda-align.h"
 #include "rsutils/accelerators/gpu.h"
@@ -35,66 +41,211 @@ namespace librealsense
         }
         #endif
         #if defined(__SSSE3__)
+        if (simd_enabled(simd_level::ssse3))
+        {
             LOG_INFO("Using SSE-optimized align implementation");
             return std::make_shared<librealsense::align_sse>(align_to);
+        }
         #elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+        {
             LOG_INFO("Using NEON-optimized align implementation");
             return std::make_shared<librealsense::align_neon>(align_to);
-        #else
-            LOG_INFO("Using generic (non-SIMD) align implementation");
-            return std::make_shared<librealsense::align>(align_to);
+        }
         #endif
+        LOG_INFO("Using generic (non-SIMD) align implementation");
+        return std::make_shared<librealsense::align>(align_to);
+    }
+
+    void map_depth_pixels(int2* other_pixels, const uint16_t* z_pixels, float z_scale, const float* rays_x,
+        const float* rays_y, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+            if (float depth = z_scale * z_pixels[i])
+            {
+                const float depth_point[3] = { depth * rays_x[i], depth * rays_y[i], depth };
+                float other_point[3], other_pixel[2];
+                rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                rs2_project_point_to_pixel(other_pixel, &other, other_point);
+                other_pixels[i] = { static_cast<int>(other_pixel[0] + 0.5f), static_cast<int>(other_pixel[1] + 0.5f) };
+            }
+        }
     }
 
-    template<class GET_DEPTH, class TRANSFER_PIXEL>
-    void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
-        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
+    void scatter_depth_to_other(worker_pool& workers, int max_threads, uint16_t* dest, const rs2_intrinsics& other,
+        const uint16_t* z_pixels, const rs2_intrinsics& depth, const int2* top_left, const int2* bottom_right)
     {
-        // Iterate over the pixels of the depth image
-#pragma omp parallel for schedule(dynamic)
-        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        size_t const bands = workers.get_concurrency() * 4;
+
+        // The rows of the other image that each depth row reaches, so that each band only goes through the depth rows
+        // that reach it
+        std::vector<int2> row_span(depth.height);
+        workers.parallel_for(depth.height, (depth.height + bands - 1) / bands, [&](size_t begin, size_t end)
         {
-            int depth_pixel_index = depth_y * depth_intrin.width;
-            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            for (size_t y = begin; y < end; ++y)
             {
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (float depth = get_depth(depth_pixel_index))
+                int2 span = { std::numeric_limits<int>::max(), std::numeric_limits<int>::min() };
+                for (size_t i = y * depth.width; i < (y + 1) * depth.width; ++i)
                 {
-                    // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
-                        continue;
+                    if (z_pixels[i])
+                    {
+                        span.x = std::min(span.x, top_left[i].y);
+                        span.y = std::max(span.y, bottom_right[i].y);
+                    }
+                }
+                row_span[y] = span;
+            }
+        }, max_threads);
 
-                    // Transfer between the depth pixels and the pixels inside the rectangle on the other image
-                    for (int y = other_y0; y <= other_y1; ++y)
+        workers.parallel_for(other.height, (other.height + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            int const band_begin = static_cast<int>(begin);
+            int const band_end = static_cast<int>(end);
+            for (int y = 0; y < depth.height; ++y)
+            {
+                if (row_span[y].y < band_begin || row_span[y].x >= band_end)
+                    continue;
+                for (int i = y * depth.width; i < (y + 1) * depth.width; ++i)
+                {
+                    auto z = z_pixels[i];
+                    if (!z)
+                        continue;
+                    int const x0 = std::max(top_left[i].x, 0), x1 = std::min(bottom_right[i].x, other.width - 1);
+                    int const y0 = std::max(top_left[i].y, band_begin), y1 = std::min(bottom_right[i].y, band_end - 1);
+                    for (int other_y = y0; other_y <= y1; ++other_y)
                     {
-                        for (int x = other_x0; x <= other_x1; ++x)
-                        {
-                            transfer_pixel(depth_pixel_index, y * other_intrin.width + x);
-                        }
+                        auto out = dest + other_y * other.width;
+                        for (int other_x = x0; other_x <= x1; ++other_x)
+                            out[other_x] = out[other_x] ? std::min(out[other_x], z) : z;
                     }
                 }
             }
+        }, max_threads);
+    }
+
+    template<class TRANSFER_PIXEL>
+    static void gather_pixels(worker_pool& workers, int max_threads, const rs2_intrinsics& other,
+        const uint16_t* z_pixels, const rs2_intrinsics& depth, const int2* top_left, const int2* bottom_right,
+        TRANSFER_PIXEL transfer_pixel)
+    {
+        // Each depth pixel is only written by its own row
+        size_t const bands = workers.get_concurrency() * 4;
+        workers.parallel_for(depth.height, (depth.height + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin * depth.width; i < end * depth.width; ++i)
+            {
+                if (!z_pixels[i])
+                    continue;
+                int const x0 = std::max(top_left[i].x, 0), x1 = std::min(bottom_right[i].x, other.width - 1);
+                int const y0 = std::max(top_left[i].y, 0), y1 = std::min(bottom_right[i].y, other.height - 1);
+                if (x0 <= x1 && y0 <= y1)
+                    transfer_pixel(i, size_t(y1) * other.width + x1);
+            }
+        }, max_threads);
+    }
+
+    template<int N>
+    static void gather_bytes(worker_pool& workers, int max_threads, uint8_t* dest, const uint8_t* source,
+        const rs2_intrinsics& other, const uint16_t* z_pixels, const rs2_intrinsics& depth, const int2* top_left,
+        const int2* bottom_right)
+    {
+        auto in_other = (const bytes<N> *)(source);
+        auto out_other = (bytes<N> *)(dest);
+        gather_pixels(workers, max_threads, other, z_pixels, depth, top_left, bottom_right,
+            [out_other, in_other](size_t depth_pixel_index, size_t other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
+    }
+
+    void gather_other_to_depth(worker_pool& workers, int max_threads, uint8_t* dest, const uint8_t* source,
+        rs2_format format, int bpp, const rs2_intrinsics& other, const uint16_t* z_pixels, const rs2_intrinsics& depth,
+        const int2* top_left, const int2* bottom_right)
+    {
+        switch (format)
+        {
+        case RS2_FORMAT_YUYV:
+        case RS2_FORMAT_UYVY:
+        {
+            // Luma and chroma alternate in each pixel, the chroma of a pair being U then V: a pixel gets the luma of
+            // the pixel it covers, and the chroma of its own position from that pixel's pair
+            int const luma = format == RS2_FORMAT_YUYV ? 0 : 1;
+            gather_pixels(workers, max_threads, other, z_pixels, depth, top_left, bottom_right,
+                [dest, source, luma](size_t depth_pixel_index, size_t other_pixel_index)
+            {
+                dest[2 * depth_pixel_index + luma] = source[2 * other_pixel_index + luma];
+                dest[2 * depth_pixel_index + 1 - luma] = source[2 * (other_pixel_index & ~size_t(1)) + 2 * (depth_pixel_index & 1) + 1 - luma];
+            });
+            break;
+        }
+        default:
+            switch (bpp)
+            {
+            case 1: gather_bytes<1>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            case 2: gather_bytes<2>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            case 3: gather_bytes<3>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            case 4: gather_bytes<4>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            case 6: gather_bytes<6>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            case 8: gather_bytes<8>(workers, max_threads, dest, source, other, z_pixels, depth, top_left, bottom_right); break;
+            default:
+                gather_pixels(workers, max_threads, other, z_pixels, depth, top_left, bottom_right,
+                    [dest, source, bpp](size_t depth_pixel_index, size_t other_pixel_index)
+                { std::memcpy(dest + depth_pixel_index * bpp, source + other_pixel_index * bpp, bpp); });
+            }
         }
     }
 
     align::align(rs2_stream to_stream) : align(to_stream, "Align")
     {}
 
+    void align::init_workers()
+    {
+        _workers = worker_pool::get();
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
+    }
+
+    void align::map_depth_rectangles(const rs2::video_frame& depth, float z_scale, const rs2_intrinsics& other_intrin,
+        const rs2_extrinsics& depth_to_other)
+    {
+        auto z_intrin = depth.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+        size_t const width = z_intrin.width;
+        size_t const pixels = width * z_intrin.height;
+
+        // The corners of the depth pixels only depend on the depth intrinsics
+        if (memcmp(&z_intrin, &_rays_intrinsics, sizeof(z_intrin)) || _top_left_x.size() != pixels)
+        {
+            _rays_intrinsics = z_intrin;
+            _top_left_x.resize(pixels);
+            _top_left_y.resize(pixels);
+            _bottom_right_x.resize(pixels);
+            _bottom_right_y.resize(pixels);
+            compute_pixel_rays(z_intrin, _top_left_x.data(), _top_left_y.data(), -0.5f);
+            compute_pixel_rays(z_intrin, _bottom_right_x.data(), _bottom_right_y.data(), 0.5f);
+        }
+        _top_left.resize(pixels);
+        _bottom_right.resize(pixels);
+
+        auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+        size_t const bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(z_intrin.height, (z_intrin.height + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            // Map the top-left and bottom-right corners of the depth pixels onto the other image
+            map_depth_pixels(_top_left.data(), z_pixels, z_scale, _top_left_x.data(), _top_left_y.data(),
+                depth_to_other, other_intrin, begin * width, end * width);
+            map_depth_pixels(_bottom_right.data(), z_pixels, z_scale, _bottom_right_x.data(), _bottom_right_y.data(),
+                depth_to_other, other_intrin, begin * width, end * width);
+
+            // Depth pixels that are not entirely inside the other image are skipped: their rectangle is emptied
+            for (size_t i = begin * width; i < end * width; ++i)
+            {
+                if (z_pixels[i] && (_top_left[i].x < 0 || _top_left[i].y < 0
+                    || _bottom_right[i].x >= other_intrin.width || _bottom_right[i].y >= other_intrin.height))
+                    _bottom_right[i] = { -1, -1 };
+            }
+        }, _max_threads);
+    }
+
     void align::align_z_to_other(rs2::video_frame& aligned, 
         const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale)
     {
@@ -111,48 +262,9 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
-            [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
-        {
-            out_z[other_pixel_index] = out_z[other_pixel_index] ?
-                std::min((int)out_z[other_pixel_index], (int)z_pixels[z_pixel_index]) :
-                z_pixels[z_pixel_index];
-        });
-    }
-
-    template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels)
-    {
-        auto in_other = (const bytes<N> *)(other_pixels);
-        auto out_other = (bytes<N> *)(other_aligned_to_depth);
-        align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
-            [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
-    }
-
-    template<class GET_DEPTH>
-    void align_other_to_depth( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels, rs2_format other_format)
-    {
-        switch (other_format)
-        {
-        case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_Y16:
-        case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_RGB8:
-        case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_RGBA8:
-        case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        default:
-            assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
-        }
+        map_depth_rectangles(depth, z_scale, other_intrin, z_to_other);
+        scatter_depth_to_other(*_workers, _max_threads, out_z, other_intrin, z_pixels, z_intrin,
+            _top_left.data(), _bottom_right.data());
     }
 
     void align::align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale)
@@ -171,8 +283,9 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto other_pixels = reinterpret_cast<const uint8_t *>(other.get_data());
 
-        align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+        map_depth_rectangles(depth, z_scale, other_intrin, z_to_other);
+        gather_other_to_depth(*_workers, _max_threads, aligned_data, other_pixels, other_profile.format(),
+            other.get_bytes_per_pixel(), other_intrin, z_pixels, z_intrin, _top_left.data(), _bottom_right.data());
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
@@ -3,14 +3,40 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "simd-dispatch.h"
 
 #include <src/basics.h>
+#include <src/float3.h>
 #include <map>
 #include <utility>
 
 
 namespace librealsense
 {
+    class worker_pool;
+
+    // Maps pixels [begin, end) of a Z16 image to the other image. Each pixel with a depth is deprojected through its
+    // ray (see compute_pixel_rays()), transformed and projected as rs2_deproject_pixel_to_point(),
+    // rs2_transform_point_to_point() and rs2_project_point_to_pixel() would, then rounded to the nearest pixel.
+    // Pixels without depth are left alone.
+    void map_depth_pixels(int2* other_pixels, const uint16_t* z_pixels, float z_scale, const float* rays_x,
+        const float* rays_y, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other, size_t begin, size_t end);
+
+    // Writes each depth pixel into the rectangle of the other image it covers, from top_left to bottom_right inclusive,
+    // keeping the nearest depth where rectangles overlap. Pixels without depth are skipped, and so are the parts of
+    // rectangles outside the other image. Each band of rows of the other image is written by a single thread, so the
+    // result does not depend on the number of threads.
+    void scatter_depth_to_other(worker_pool& workers, int max_threads, uint16_t* dest, const rs2_intrinsics& other,
+        const uint16_t* z_pixels, const rs2_intrinsics& depth, const int2* top_left, const int2* bottom_right);
+
+    // Copies into each depth pixel the pixel of the other image that it covers: the last one, in row order, of its
+    // rectangle clipped to the other image. Pixels without depth, or whose rectangle is outside the other image, are
+    // left alone. YUYV and UYVY pixels keep the chroma of their own position in their pair; other formats are copied
+    // as whole pixels of 'bpp' bytes.
+    void gather_other_to_depth(worker_pool& workers, int max_threads, uint8_t* dest, const uint8_t* source,
+        rs2_format format, int bpp, const rs2_intrinsics& other, const uint16_t* z_pixels, const rs2_intrinsics& depth,
+        const int2* top_left, const int2* bottom_right);
+
     class LRS_EXTENSION_API align : public generic_processing_block
     {
     public:
@@ -20,8 +46,11 @@ namespace librealsense
     protected:
         align(rs2_stream to_stream, const char* name)
             : generic_processing_block(name),
-              _to_stream_type(to_stream), _depth_scale(0)
-        {}
+              _to_stream_type(to_stream), _depth_scale(0), _max_threads(0), _rays_intrinsics()
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(simd_level::scalar));
+            init_workers();
+        }
 
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -48,8 +77,22 @@ namespace librealsense
         std::map<std::pair<stream_profile_interface*, stream_profile_interface*>, std::shared_ptr<rs2::video_stream_profile>> _align_stream_unique_ids;
         rs2::stream_profile _source_stream_profile;
         float _depth_scale;
+        std::shared_ptr<worker_pool> _workers;
+        int _max_threads;
 
     private:
+        // Gets the shared worker pool, and registers the option limiting its threads
+        void init_workers();
+        void map_depth_rectangles(const rs2::video_frame& depth, float z_scale, const rs2_intrinsics& other_intrin,
+            const rs2_extrinsics& depth_to_other);
+
+        // The rays through the top-left and bottom-right corners of the depth pixels, for _rays_intrinsics
+        rs2_intrinsics _rays_intrinsics;
+        std::vector<float> _top_left_x, _top_left_y, _bottom_right_x, _bottom_right_y;
+
+        // The rectangle of the other image that each depth pixel of the current frame covers
+        std::vector<int2> _top_left, _bottom_right;
+
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
         void align_frames(rs2::video_frame& aligned, const rs2::video_frame& from, const rs2::video_frame& to);
     };
@@ -6,10 +6,7 @@
 #include "option.h"
 #include "image-avx.h"
 #include "image.h"
-
-#define STB_IMAGE_STATIC
-#define STB_IMAGE_IMPLEMENTATION
-#include "../third-party/stb_image.h"
+#include "worker-pool.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -20,32 +17,6 @@
 #endif
 #include "neon/image-neon.h"
 
-#if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__)) || (defined (__APPLE__) && !defined (__x86_64__))
-
-bool has_avx() { return false; }
-
-#else
-
-#ifdef _WIN32
-#include <intrin.h>
-#define cpuid(info, x)    __cpuidex(info, x, 0)
-#else
-#include <cpuid.h>
-void cpuid(int info[4], int info_type) {
-    __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
-}
-#endif
-
-bool has_avx()
-{
-    int info[4];
-    cpuid(info, 0);
-    cpuid(info, 0x80000000);
-    return (info[2] & ((int)1 << 28)) != 0;
-}
-
-#endif
-
 // explanations for converting YUV values to RGB can be found in:
 // https://en.wikipedia.org/wiki/YUV#Y%E2%80%B2UV444_to_RGB888_conversion
 
@@ -54,6 +25,142 @@ namespace librealsense
     /////////////////////////////
     // YUY2 unpacking routines //
     /////////////////////////////
+    // Generic code, for when the SIMD kernels are not available or not allowed
+    template<rs2_format FORMAT> void unpack_yuy2_generic( uint8_t * const d[], const uint8_t * s, int n)
+    {
+        auto src = reinterpret_cast<const uint8_t *>(s);
+        auto dst = reinterpret_cast<uint8_t *>(d[0]);
+        for (; n; n -= 16, src += 32)
+        {
+            if (FORMAT == RS2_FORMAT_Y8)
+            {
+                uint8_t out[16] = {
+                    src[0], src[2], src[4], src[6],
+                    src[8], src[10], src[12], src[14],
+                    src[16], src[18], src[20], src[22],
+                    src[24], src[26], src[28], src[30],
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_Y16)
+            {
+                // Y16 is little-endian.  We output Y << 8.
+                uint8_t out[32] = {
+                    0, src[0], 0, src[2], 0, src[4], 0, src[6],
+                    0, src[8], 0, src[10], 0, src[12], 0, src[14],
+                    0, src[16], 0, src[18], 0, src[20], 0, src[22],
+                    0, src[24], 0, src[26], 0, src[28], 0, src[30],
+                };
+                std::memcpy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            int16_t y[16] = {
+                src[0], src[2], src[4], src[6],
+                src[8], src[10], src[12], src[14],
+                src[16], src[18], src[20], src[22],
+                src[24], src[26], src[28], src[30],
+            }, u[16] = {
+                src[1], src[1], src[5], src[5],
+                src[9], src[9], src[13], src[13],
+                src[17], src[17], src[21], src[21],
+                src[25], src[25], src[29], src[29],
+            }, v[16] = {
+                src[3], src[3], src[7], src[7],
+                src[11], src[11], src[15], src[15],
+                src[19], src[19], src[23], src[23],
+                src[27], src[27], src[31], src[31],
+            };
+
+            uint8_t r[16], g[16], b[16];
+            for (int i = 0; i < 16; i++)
+            {
+                int32_t c = y[i] - 16;
+                int32_t d = u[i] - 128;
+                int32_t e = v[i] - 128;
+
+                int32_t t;
+#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
+                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
+                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
+#undef clamp
+            }
+
+            if (FORMAT == RS2_FORMAT_RGB8)
+            {
+                uint8_t out[16 * 3] = {
+                    r[0], g[0], b[0], r[1], g[1], b[1],
+                    r[2], g[2], b[2], r[3], g[3], b[3],
+                    r[4], g[4], b[4], r[5], g[5], b[5],
+                    r[6], g[6], b[6], r[7], g[7], b[7],
+                    r[8], g[8], b[8], r[9], g[9], b[9],
+                    r[10], g[10], b[10], r[11], g[11], b[11],
+                    r[12], g[12], b[12], r[13], g[13], b[13],
+                    r[14], g[14], b[14], r[15], g[15], b[15],
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_BGR8)
+            {
+                uint8_t out[16 * 3] = {
+                    b[0], g[0], r[0], b[1], g[1], r[1],
+                    b[2], g[2], r[2], b[3], g[3], r[3],
+                    b[4], g[4], r[4], b[5], g[5], r[5],
+                    b[6], g[6], r[6], b[7], g[7], r[7],
+                    b[8], g[8], r[8], b[9], g[9], r[9],
+                    b[10], g[10], r[10], b[11], g[11], r[11],
+                    b[12], g[12], r[12], b[13], g[13], r[13],
+                    b[14], g[14], r[14], b[15], g[15], r[15],
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_RGBA8)
+            {
+                uint8_t out[16 * 4] = {
+                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
+                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
+                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
+                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
+                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
+                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
+                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
+                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_BGRA8)
+            {
+                uint8_t out[16 * 4] = {
+                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
+                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
+                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
+                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
+                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
+                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
+                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
+                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+        }
+    }
+
     // This templated function unpacks YUY2 into Y8/Y16/RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
     template<rs2_format FORMAT> void unpack_yuy2( uint8_t * const d[], const uint8_t * s, int width, int height, int actual_size)
@@ -68,10 +175,11 @@ namespace librealsense
         }
 #endif
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
-#ifdef __AVX2__
-
-        if (do_avx)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+#ifdef BUILD_WITH_AVX2
+        // The AVX2 kernels take 32 pixels at a time
+        static const bool do_avx = simd_enabled(simd_level::avx2);
+        if (do_avx && n % 32 == 0)
         {
             if (FORMAT == RS2_FORMAT_Y8) unpack_yuy2_avx_y8(d, s, n);
             if (FORMAT == RS2_FORMAT_Y16) unpack_yuy2_avx_y16(d, s, n);
@@ -82,6 +190,7 @@ namespace librealsense
         }
         else
 #endif
+        if (do_sse)
         {
             auto src = reinterpret_cast<const __m128i *>(s);
             auto dst = reinterpret_cast<__m128i *>(d[0]);
@@ -228,8 +337,15 @@ namespace librealsense
                 }
             }
         }
-
+        else
+            unpack_yuy2_generic<FORMAT>(d, s, n);
 #elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+        {
+            unpack_yuy2_generic<FORMAT>(d, s, n);
+            return;
+        }
 
         if (FORMAT == RS2_FORMAT_Y8) unpack_yuy2_neon_y8(d, s, n);
         if (FORMAT == RS2_FORMAT_Y16) unpack_yuy2_neon_y16(d, s, n);
@@ -238,55 +354,36 @@ namespace librealsense
         if (FORMAT == RS2_FORMAT_BGR8) unpack_yuy2_neon_bgr8(d, s, n);
         if (FORMAT == RS2_FORMAT_BGRA8) unpack_yuy2_neon_bgra8(d, s, n);
 
-#else  // Generic code for when SSSE3 is not available.
-        auto src = reinterpret_cast<const uint8_t *>(s);
-        auto dst = reinterpret_cast<uint8_t *>(d[0]);
-        for (; n; n -= 16, src += 32)
+#else
+        unpack_yuy2_generic<FORMAT>(d, s, n);
+#endif
+    }
+
+    template<rs2_format FORMAT>
+    void m420_parse_one_line(const uint8_t * y_one_line, const uint8_t * uv_one_line, uint8_t** dst, int width)
+    {
+        // building 16 pixels at each iteration 
+        for (int y_pix = 0, uv_pix = 0; y_pix < width; y_pix += 16, uv_pix += 16)
         {
-            if (FORMAT == RS2_FORMAT_Y8)
-            {
-                uint8_t out[16] = {
-                    src[0], src[2], src[4], src[6],
-                    src[8], src[10], src[12], src[14],
-                    src[16], src[18], src[20], src[22],
-                    src[24], src[26], src[28], src[30],
-                };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
+            // grabbing matching y,u,v values
+            uint8_t y[16] = { 0 };
+            std::memcpy( y, &y_one_line[y_pix], 16 );
 
-            if (FORMAT == RS2_FORMAT_Y16)
-            {
-                // Y16 is little-endian.  We output Y << 8.
-                uint8_t out[32] = {
-                    0, src[0], 0, src[2], 0, src[4], 0, src[6],
-                    0, src[8], 0, src[10], 0, src[12], 0, src[14],
-                    0, src[16], 0, src[18], 0, src[20], 0, src[22],
-                    0, src[24], 0, src[26], 0, src[28], 0, src[30],
-                };
-                std::memcpy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
-            }
+            uint8_t u[16] = {
+                uv_one_line[uv_pix + 0], uv_one_line[uv_pix + 0], uv_one_line[uv_pix + 2], uv_one_line[uv_pix + 2],
+                uv_one_line[uv_pix + 4], uv_one_line[uv_pix + 4], uv_one_line[uv_pix + 6], uv_one_line[uv_pix + 6],
+                uv_one_line[uv_pix + 8], uv_one_line[uv_pix + 8], uv_one_line[uv_pix + 10], uv_one_line[uv_pix + 10],
+                uv_one_line[uv_pix + 12], uv_one_line[uv_pix + 12], uv_one_line[uv_pix + 14], uv_one_line[uv_pix + 14]
+            };
 
-            int16_t y[16] = {
-                src[0], src[2], src[4], src[6],
-                src[8], src[10], src[12], src[14],
-                src[16], src[18], src[20], src[22],
-                src[24], src[26], src[28], src[30],
-            }, u[16] = {
-                src[1], src[1], src[5], src[5],
-                src[9], src[9], src[13], src[13],
-                src[17], src[17], src[21], src[21],
-                src[25], src[25], src[29], src[29],
-            }, v[16] = {
-                src[3], src[3], src[7], src[7],
-                src[11], src[11], src[15], src[15],
-                src[19], src[19], src[23], src[23],
-                src[27], src[27], src[31], src[31],
+            uint8_t v[16] = {
+                uv_one_line[uv_pix + 1], uv_one_line[uv_pix + 1], uv_one_line[uv_pix + 3], uv_one_line[uv_pix + 3],
+                uv_one_line[uv_pix + 5], uv_one_line[uv_pix + 5], uv_one_line[uv_pix + 7], uv_one_line[uv_pix + 7],
+                uv_one_line[uv_pix + 9], uv_one_line[uv_pix + 9], uv_one_line[uv_pix + 11], uv_one_line[uv_pix + 11],
+                uv_one_line[uv_pix + 13], uv_one_line[uv_pix + 13], uv_one_line[uv_pix + 15], uv_one_line[uv_pix + 15]
             };
 
+            // converting y,u,v values to r,g,b values
             uint8_t r[16], g[16], b[16];
             for (int i = 0; i < 16; i++)
             {
@@ -302,20 +399,21 @@ namespace librealsense
 #undef clamp
             }
 
+            // outputting r,g,b values in the order needed for each format
             if (FORMAT == RS2_FORMAT_RGB8)
             {
                 uint8_t out[16 * 3] = {
-                    r[0], g[0], b[0], r[1], g[1], b[1],
-                    r[2], g[2], b[2], r[3], g[3], b[3],
-                    r[4], g[4], b[4], r[5], g[5], b[5],
-                    r[6], g[6], b[6], r[7], g[7], b[7],
-                    r[8], g[8], b[8], r[9], g[9], b[9],
+                    r[0],  g[0],  b[0],  r[1],  g[1],  b[1],
+                    r[2],  g[2],  b[2],  r[3],  g[3],  b[3],
+                    r[4],  g[4],  b[4],  r[5],  g[5],  b[5],
+                    r[6],  g[6],  b[6],  r[7],  g[7],  b[7],
+                    r[8],  g[8],  b[8],  r[9],  g[9],  b[9],
                     r[10], g[10], b[10], r[11], g[11], b[11],
                     r[12], g[12], b[12], r[13], g[13], b[13],
-                    r[14], g[14], b[14], r[15], g[15], b[15],
+                    r[14], g[14], b[14], r[15], g[15], b[15]
                 };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
+                std::memcpy( *dst, out, sizeof( out ) );
+                *dst += sizeof out;
                 continue;
             }
 
@@ -331,8 +429,8 @@ namespace librealsense
                     b[12], g[12], r[12], b[13], g[13], r[13],
                     b[14], g[14], r[14], b[15], g[15], r[15],
                 };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
+                std::memcpy( *dst, out, sizeof out );
+                *dst += sizeof out;
                 continue;
             }
 
@@ -348,8 +446,8 @@ namespace librealsense
                     r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
                     r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
                 };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
+                std::memcpy( *dst, out, sizeof out );
+                *dst += sizeof out;
                 continue;
             }
 
@@ -365,120 +463,8 @@ namespace librealsense
                     b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
                     b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
                 };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
-        }
-#endif
-    }
-
-    template<rs2_format FORMAT>
-    void m420_parse_one_line(const uint8_t * y_one_line, const uint8_t * uv_one_line, uint8_t** dst, int width)
-    {
-        // building 16 pixels at each iteration 
-        for (int y_pix = 0, uv_pix = 0; y_pix < width; y_pix += 16, uv_pix += 16)
-        {
-            // grabbing matching y,u,v values
-            uint8_t y[16] = { 0 };
-            std::memcpy( y, &y_one_line[y_pix], 16 );
-
-            uint8_t u[16] = {
-                uv_one_line[uv_pix + 0], uv_one_line[uv_pix + 0], uv_one_line[uv_pix + 2], uv_one_line[uv_pix + 2],
-                uv_one_line[uv_pix + 4], uv_one_line[uv_pix + 4], uv_one_line[uv_pix + 6], uv_one_line[uv_pix + 6],
-                uv_one_line[uv_pix + 8], uv_one_line[uv_pix + 8], uv_one_line[uv_pix + 10], uv_one_line[uv_pix + 10],
-                uv_one_line[uv_pix + 12], uv_one_line[uv_pix + 12], uv_one_line[uv_pix + 14], uv_one_line[uv_pix + 14]
-            };
-
-            uint8_t v[16] = {
-                uv_one_line[uv_pix + 1], uv_one_line[uv_pix + 1], uv_one_line[uv_pix + 3], uv_one_line[uv_pix + 3],
-                uv_one_line[uv_pix + 5], uv_one_line[uv_pix + 5], uv_one_line[uv_pix + 7], uv_one_line[uv_pix + 7],
-                uv_one_line[uv_pix + 9], uv_one_line[uv_pix + 9], uv_one_line[uv_pix + 11], uv_one_line[uv_pix + 11],
-                uv_one_line[uv_pix + 13], uv_one_line[uv_pix + 13], uv_one_line[uv_pix + 15], uv_one_line[uv_pix + 15]
-            };
-
-            // converting y,u,v values to r,g,b values
-            uint8_t r[16], g[16], b[16];
-            for (int i = 0; i < 16; i++)
-            {
-                int32_t c = y[i] - 16;
-                int32_t d = u[i] - 128;
-                int32_t e = v[i] - 128;
-
-                int32_t t;
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
-                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
-#undef clamp
-            }
-
-            // outputting r,g,b values in the order needed for each format
-            if (FORMAT == RS2_FORMAT_RGB8)
-            {
-                uint8_t out[16 * 3] = {
-                    r[0],  g[0],  b[0],  r[1],  g[1],  b[1],
-                    r[2],  g[2],  b[2],  r[3],  g[3],  b[3],
-                    r[4],  g[4],  b[4],  r[5],  g[5],  b[5],
-                    r[6],  g[6],  b[6],  r[7],  g[7],  b[7],
-                    r[8],  g[8],  b[8],  r[9],  g[9],  b[9],
-                    r[10], g[10], b[10], r[11], g[11], b[11],
-                    r[12], g[12], b[12], r[13], g[13], b[13],
-                    r[14], g[14], b[14], r[15], g[15], b[15]
-                };
-                std::memcpy( *dst, out, sizeof( out ) );
-                *dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_BGR8)
-            {
-                uint8_t out[16 * 3] = {
-                    b[0], g[0], r[0], b[1], g[1], r[1],
-                    b[2], g[2], r[2], b[3], g[3], r[3],
-                    b[4], g[4], r[4], b[5], g[5], r[5],
-                    b[6], g[6], r[6], b[7], g[7], r[7],
-                    b[8], g[8], r[8], b[9], g[9], r[9],
-                    b[10], g[10], r[10], b[11], g[11], r[11],
-                    b[12], g[12], r[12], b[13], g[13], r[13],
-                    b[14], g[14], r[14], b[15], g[15], r[15],
-                };
-                std::memcpy( *dst, out, sizeof out );
-                *dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_RGBA8)
-            {
-                uint8_t out[16 * 4] = {
-                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
-                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
-                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
-                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
-                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
-                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
-                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
-                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
-                };
-                std::memcpy( *dst, out, sizeof out );
-                *dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_BGRA8)
-            {
-                uint8_t out[16 * 4] = {
-                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
-                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
-                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
-                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
-                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
-                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
-                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
-                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
-                };
-                std::memcpy( *dst, out, sizeof out );
-                *dst += sizeof out;
+                std::memcpy( *dst, out, sizeof out );
+                *dst += sizeof out;
                 continue;
             }
         }
@@ -617,6 +603,62 @@ namespace librealsense
     /////////////////////////////
     // M420 unpacking routines //
     /////////////////////////////
+    // Generic code, for when the SIMD kernels are not available or not allowed
+    template<rs2_format FORMAT> void unpack_m420_generic( uint8_t * const d[], const uint8_t * s, int width, int height)
+    {
+        auto src = reinterpret_cast<const uint8_t*>(s);
+        auto dst = reinterpret_cast<uint8_t*>(d[0]);
+
+        auto src_height = height * 12 >> 3;
+
+        if (FORMAT == RS2_FORMAT_Y8)
+        {
+            for (int k = 0; k < src_height; k += 3)
+            {
+                // fill the destination with y values
+                // while y is on 2 lines, and uv on the third line
+                auto start_of_y = src + k * width;
+                std::memcpy( dst, start_of_y, 2 * width );
+                dst += 2 * width;
+            }
+            return;
+        }
+        if (FORMAT == RS2_FORMAT_Y16)
+        {
+            for (int k = 0; k < src_height; k += 3)
+            {
+                // fill the destination with y values
+                // while y is on 2 lines, and uv on the third line
+                auto start_of_y = src + k * width;
+
+                for (int pix = 0; pix < 2 * width; pix += 16)
+                {
+                    uint16_t y[16];
+                    for (int dst_idx = 0, src_idx = 0; dst_idx < 16; dst_idx += 1, ++src_idx)
+                    {
+                        y[dst_idx] = start_of_y[src_idx + pix] << 8;
+                    }
+                    std::memcpy( dst, y, sizeof y );
+                    dst += sizeof y;
+                }
+            }
+            return;
+        }
+        for (int k = 0; k < src_height; k += 3)
+        {
+            // fill the y_buffer and uv_buffer
+            // while y is on 2 lines, and uv on the third line
+            auto start_of_y = src + k * width;
+            auto start_of_second_line = start_of_y + width;
+            auto end_of_y = start_of_second_line + width;
+            auto start_of_uv = end_of_y;
+            auto end_of_uv = start_of_uv + width;
+
+            m420_parse_one_line<FORMAT>(start_of_y, start_of_uv, &dst, width);
+            m420_parse_one_line<FORMAT>(start_of_second_line, start_of_uv, &dst, width);
+        }
+    }
+
     // This templated function unpacks M420 into Y8/Y16/RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
     // The M420 is a standard format - see: https://www.kernel.org/doc/html/v4.10/media/uapi/v4l/pixfmt-m420.html
@@ -635,8 +677,12 @@ namespace librealsense
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
 
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
-
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+        {
+            unpack_m420_generic<FORMAT>(d, s, width, height);
+            return;
+        }
         auto src = reinterpret_cast<const __m128i*>(s);
         auto dst = reinterpret_cast<__m128i*>(d[0]);
 
@@ -702,58 +748,7 @@ namespace librealsense
         delete[] source_chunks_uv;
 
 #else
-        auto src = reinterpret_cast<const uint8_t*>(s);
-        auto dst = reinterpret_cast<uint8_t*>(d[0]);
-
-        auto src_height = height * 12 >> 3;
-
-        if (FORMAT == RS2_FORMAT_Y8)
-        {
-            for (int k = 0; k < src_height; k += 3)
-            {
-                // fill the destination with y values
-                // while y is on 2 lines, and uv on the third line
-                auto start_of_y = src + k * width;
-                std::memcpy( dst, start_of_y, 2 * width );
-                dst += 2 * width;
-            }
-            return;
-        }
-        if (FORMAT == RS2_FORMAT_Y16)
-        {
-            for (int k = 0; k < src_height; k += 3)
-            {
-                // fill the destination with y values
-                // while y is on 2 lines, and uv on the third line
-                auto start_of_y = src + k * width;
-
-                for (int pix = 0; pix < 2 * width; pix += 16)
-                {
-                    uint16_t y[16];
-                    for (int dst_idx = 0, src_idx = 0; dst_idx < 16; dst_idx += 1, ++src_idx)
-                    {
-                        y[dst_idx] = start_of_y[src_idx + pix] << 8;
-                    }
-                    std::memcpy( dst, y, sizeof y );
-                    dst += sizeof y;
-                }
-            }
-            return;
-        }
-        for (int k = 0; k < src_height; k += 3)
-        {
-            // fill the y_buffer and uv_buffer
-            // while y is on 2 lines, and uv on the third line
-            auto start_of_y = src + k * width;
-            auto start_of_second_line = start_of_y + width;
-            auto end_of_y = start_of_second_line + width;
-            auto start_of_uv = end_of_y;
-            auto end_of_uv = start_of_uv + width;
-
-            m420_parse_one_line<FORMAT>(start_of_y, start_of_uv, &dst, width);
-            m420_parse_one_line<FORMAT>(start_of_second_line, start_of_uv, &dst, width);
-        }
-        return;
+        unpack_m420_generic<FORMAT>(d, s, width, height);
 #endif // __SSSE3__
     }
 
@@ -817,6 +812,47 @@ namespace librealsense
     /////////////////////////////
     // NV12 unpacking routines //
     /////////////////////////////
+    // Generic code, for when the SIMD kernels are not available or not allowed
+    template<rs2_format FORMAT> void unpack_nv12_generic( uint8_t * const d[], const uint8_t * s, int width, int height)
+    {
+        auto src = reinterpret_cast<const uint8_t*>(s);
+        auto dst = reinterpret_cast<uint8_t*>(d[0]);
+
+        // Y plane at offset 0, UV plane at offset width*height
+        auto y_start = src;
+        auto uv_start = src + width * height;
+
+        if (FORMAT == RS2_FORMAT_Y8)
+        {
+            // Just copy the entire Y plane
+            std::memcpy( dst, y_start, width * height );
+            return;
+        }
+        if (FORMAT == RS2_FORMAT_Y16)
+        {
+            for (int pix = 0; pix < width * height; pix += 16)
+            {
+                uint16_t y[16];
+                for (int i = 0; i < 16; ++i)
+                {
+                    y[i] = y_start[pix + i] << 8;
+                }
+                std::memcpy( dst, y, sizeof y );
+                dst += sizeof y;
+            }
+            return;
+        }
+        for (int j = 0; j < height; j += 2)
+        {
+            auto y_row0 = y_start + j * width;
+            auto y_row1 = y_start + (j + 1) * width;
+            auto uv_row = uv_start + (j / 2) * width;
+
+            m420_parse_one_line<FORMAT>(y_row0, uv_row, &dst, width);
+            m420_parse_one_line<FORMAT>(y_row1, uv_row, &dst, width);
+        }
+    }
+
     // This templated function unpacks NV12 into Y8/Y16/RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // NV12 is a semi-planar YUV 4:2:0 format:
     //   - Y plane: width*height bytes at offset 0 (one Y per pixel)
@@ -829,8 +865,14 @@ namespace librealsense
         assert(height % 2 == 0);
 
 #if defined __SSSE3__ && ! defined ANDROID
-        auto dst = reinterpret_cast<__m128i*>(d[0]);
-
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+        {
+            unpack_nv12_generic<FORMAT>(d, s, width, height);
+            return;
+        }
+        auto dst = reinterpret_cast<__m128i*>(d[0]);
+
         // Y plane starts at offset 0, UV plane starts at offset width*height
         auto y_plane = reinterpret_cast<const __m128i*>(s);
         auto uv_plane = reinterpret_cast<const __m128i*>(s + width * height);
@@ -899,43 +941,7 @@ namespace librealsense
         }
 
 #else
-        auto src = reinterpret_cast<const uint8_t*>(s);
-        auto dst = reinterpret_cast<uint8_t*>(d[0]);
-
-        // Y plane at offset 0, UV plane at offset width*height
-        auto y_start = src;
-        auto uv_start = src + width * height;
-
-        if (FORMAT == RS2_FORMAT_Y8)
-        {
-            // Just copy the entire Y plane
-            std::memcpy( dst, y_start, width * height );
-            return;
-        }
-        if (FORMAT == RS2_FORMAT_Y16)
-        {
-            for (int pix = 0; pix < width * height; pix += 16)
-            {
-                uint16_t y[16];
-                for (int i = 0; i < 16; ++i)
-                {
-                    y[i] = y_start[pix + i] << 8;
-                }
-                std::memcpy( dst, y, sizeof y );
-                dst += sizeof y;
-            }
-            return;
-        }
-        for (int j = 0; j < height; j += 2)
-        {
-            auto y_row0 = y_start + j * width;
-            auto y_row1 = y_start + (j + 1) * width;
-            auto uv_row = uv_start + (j / 2) * width;
-
-            m420_parse_one_line<FORMAT>(y_row0, uv_row, &dst, width);
-            m420_parse_one_line<FORMAT>(y_row1, uv_row, &dst, width);
-        }
-        return;
+        unpack_nv12_generic<FORMAT>(d, s, width, height);
 #endif // __SSSE3__
     }
 
@@ -970,6 +976,115 @@ namespace librealsense
     /////////////////////////////
     // UYVY unpacking routines //
     /////////////////////////////
+    // Generic code, for when the SIMD kernels are not available or not allowed
+    template<rs2_format FORMAT> void unpack_uyvy_generic( uint8_t * const d[], const uint8_t * s, int n)
+    {
+        auto src = reinterpret_cast<const uint8_t *>(s);
+        auto dst = reinterpret_cast<uint8_t *>(d[0]);
+        for (; n; n -= 16, src += 32)
+        {
+            int16_t y[16] = {
+                src[1], src[3], src[5], src[7],
+                src[9], src[11], src[13], src[15],
+                src[17], src[19], src[21], src[23],
+                src[25], src[27], src[29], src[31],
+            }, u[16] = {
+                src[0], src[0], src[4], src[4],
+                src[8], src[8], src[12], src[12],
+                src[16], src[16], src[20], src[20],
+                src[24], src[24], src[28], src[28],
+            }, v[16] = {
+                src[2], src[2], src[6], src[6],
+                src[10], src[10], src[14], src[14],
+                src[18], src[18], src[22], src[22],
+                src[26], src[26], src[30], src[30],
+            };
+
+            uint8_t r[16], g[16], b[16];
+            for (int i = 0; i < 16; i++)
+            {
+                int32_t c = y[i] - 16;
+                int32_t d = u[i] - 128;
+                int32_t e = v[i] - 128;
+
+                int32_t t;
+#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
+                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
+                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
+#undef clamp
+            }
+
+            if (FORMAT == RS2_FORMAT_RGB8)
+            {
+                uint8_t out[16 * 3] = {
+                    r[0], g[0], b[0], r[1], g[1], b[1],
+                    r[2], g[2], b[2], r[3], g[3], b[3],
+                    r[4], g[4], b[4], r[5], g[5], b[5],
+                    r[6], g[6], b[6], r[7], g[7], b[7],
+                    r[8], g[8], b[8], r[9], g[9], b[9],
+                    r[10], g[10], b[10], r[11], g[11], b[11],
+                    r[12], g[12], b[12], r[13], g[13], b[13],
+                    r[14], g[14], b[14], r[15], g[15], b[15],
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_BGR8)
+            {
+                uint8_t out[16 * 3] = {
+                    b[0], g[0], r[0], b[1], g[1], r[1],
+                    b[2], g[2], r[2], b[3], g[3], r[3],
+                    b[4], g[4], r[4], b[5], g[5], r[5],
+                    b[6], g[6], r[6], b[7], g[7], r[7],
+                    b[8], g[8], r[8], b[9], g[9], r[9],
+                    b[10], g[10], r[10], b[11], g[11], r[11],
+                    b[12], g[12], r[12], b[13], g[13], r[13],
+                    b[14], g[14], r[14], b[15], g[15], r[15],
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_RGBA8)
+            {
+                uint8_t out[16 * 4] = {
+                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
+                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
+                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
+                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
+                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
+                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
+                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
+                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+
+            if (FORMAT == RS2_FORMAT_BGRA8)
+            {
+                uint8_t out[16 * 4] = {
+                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
+                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
+                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
+                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
+                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
+                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
+                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
+                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
+                };
+                std::memcpy( dst, out, sizeof out );
+                dst += sizeof out;
+                continue;
+            }
+        }
+    }
+
     // This templated function unpacks UYVY into RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
     template<rs2_format FORMAT> void unpack_uyvy( uint8_t * const d[], const uint8_t * s, int width, int height, int actual_size)
@@ -977,6 +1092,12 @@ namespace librealsense
         auto n = width * height;
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
 #ifdef __SSSE3__
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+        {
+            unpack_uyvy_generic<FORMAT>(d, s, n);
+            return;
+        }
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
         for (; n; n -= 16)
@@ -1103,111 +1224,8 @@ namespace librealsense
                 }
             }
         }
-#else  // Generic code for when SSSE3 is not available.
-        auto src = reinterpret_cast<const uint8_t *>(s);
-        auto dst = reinterpret_cast<uint8_t *>(d[0]);
-        for (; n; n -= 16, src += 32)
-        {
-            int16_t y[16] = {
-                src[1], src[3], src[5], src[7],
-                src[9], src[11], src[13], src[15],
-                src[17], src[19], src[21], src[23],
-                src[25], src[27], src[29], src[31],
-            }, u[16] = {
-                src[0], src[0], src[4], src[4],
-                src[8], src[8], src[12], src[12],
-                src[16], src[16], src[20], src[20],
-                src[24], src[24], src[28], src[28],
-            }, v[16] = {
-                src[2], src[2], src[6], src[6],
-                src[10], src[10], src[14], src[14],
-                src[18], src[18], src[22], src[22],
-                src[26], src[26], src[30], src[30],
-            };
-
-            uint8_t r[16], g[16], b[16];
-            for (int i = 0; i < 16; i++)
-            {
-                int32_t c = y[i] - 16;
-                int32_t d = u[i] - 128;
-                int32_t e = v[i] - 128;
-
-                int32_t t;
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
-                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
-#undef clamp
-            }
-
-            if (FORMAT == RS2_FORMAT_RGB8)
-            {
-                uint8_t out[16 * 3] = {
-                    r[0], g[0], b[0], r[1], g[1], b[1],
-                    r[2], g[2], b[2], r[3], g[3], b[3],
-                    r[4], g[4], b[4], r[5], g[5], b[5],
-                    r[6], g[6], b[6], r[7], g[7], b[7],
-                    r[8], g[8], b[8], r[9], g[9], b[9],
-                    r[10], g[10], b[10], r[11], g[11], b[11],
-                    r[12], g[12], b[12], r[13], g[13], b[13],
-                    r[14], g[14], b[14], r[15], g[15], b[15],
-                };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_BGR8)
-            {
-                uint8_t out[16 * 3] = {
-                    b[0], g[0], r[0], b[1], g[1], r[1],
-                    b[2], g[2], r[2], b[3], g[3], r[3],
-                    b[4], g[4], r[4], b[5], g[5], r[5],
-                    b[6], g[6], r[6], b[7], g[7], r[7],
-                    b[8], g[8], r[8], b[9], g[9], r[9],
-                    b[10], g[10], r[10], b[11], g[11], r[11],
-                    b[12], g[12], r[12], b[13], g[13], r[13],
-                    b[14], g[14], r[14], b[15], g[15], r[15],
-                };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_RGBA8)
-            {
-                uint8_t out[16 * 4] = {
-                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
-                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
-                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
-                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
-                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
-                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
-                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
-                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
-                };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
-
-            if (FORMAT == RS2_FORMAT_BGRA8)
-            {
-                uint8_t out[16 * 4] = {
-                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
-                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
-                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
-                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
-                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
-                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
-                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
-                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
-                };
-                std::memcpy( dst, out, sizeof out );
-                dst += sizeof out;
-                continue;
-            }
-        }
+#else
+        unpack_uyvy_generic<FORMAT>(d, s, n);
 #endif
     }
 
@@ -1233,29 +1251,6 @@ namespace librealsense
         }
     }
 
-    /////////////////////////////
-    // MJPEG unpacking routines //
-    /////////////////////////////
-    void unpack_mjpeg( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
-    {
-        int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
-        {
-            auto uncompressed_size = w * h * bpp;
-            if (uncompressed_size != actual_size)
-            {
-                LOG_WARNING( "MJPEG decode size mismatch. Expected " << actual_size << ", got "
-                                                                     << uncompressed_size );
-                uncompressed_size = std::min( uncompressed_size, actual_size );
-            }
-            std::memcpy( dest[0], uncompressed_rgb, uncompressed_size );
-            stbi_image_free(uncompressed_rgb);
-        }
-        else
-            LOG_ERROR("mjpeg decode failed");
-    }
-
     /////////////////////////////
     // BGR unpacking routines //
     /////////////////////////////
@@ -1282,9 +1277,21 @@ namespace librealsense
         unpack_uyvyc(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    mjpeg_converter::mjpeg_converter(const char* name, rs2_format target_format) :
+        color_converter(name, target_format),
+        _max_threads(0)
+    {
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, worker_pool::get()->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
+    }
+
     void mjpeg_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        // Without the raw frame size metadata, the decoder stops at the end of the image
+        size_t size = input_size > 0 ? input_size : actual_size;
+        if( ! _decoder.decode( source, size, _target_format, dest[0], width, height, _max_threads ) )
+            LOG_ERROR( "mjpeg decode failed" );
     }
 
     void bgr_to_rgb::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "mjpeg-decoder.h"
+#include "simd-dispatch.h"
 
 namespace librealsense
 {
@@ -22,7 +24,10 @@ namespace librealsense
 
     protected:
         yuy2_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+            color_converter(name, target_format)
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
+        }
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
@@ -34,7 +39,10 @@ namespace librealsense
 
     protected:
         uyvy_converter(const char* name, rs2_format target_format, rs2_stream target_stream) :
-            color_converter(name, target_format, target_stream) {};
+            color_converter(name, target_format, target_stream)
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::ssse3 })));
+        }
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
@@ -45,9 +53,11 @@ namespace librealsense
             mjpeg_converter("MJPEG Converter", target_format) {};
 
     protected:
-        mjpeg_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+        mjpeg_converter(const char* name, rs2_format target_format);
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+
+        mjpeg_decoder _decoder;
+        int _max_threads;
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
@@ -70,7 +80,10 @@ namespace librealsense
 
     protected:
         m420_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+            color_converter(name, target_format)
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::ssse3 })));
+        }
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
@@ -82,7 +95,10 @@ namespace librealsense
 
     protected:
         nv12_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+            color_converter(name, target_format)
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::ssse3 })));
+        }
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
@@ -10,6 +10,14 @@
 #include "option.h"
 #include "colorizer.h"
 #include "disparity-transform.h"
+#include "worker-pool.h"
+#include "sse/sse-colorizer.h"
+#include "sse/avx-colorizer.h"
+#include "simd-dispatch.h"
+#include "neon/neon-colorizer.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace librealsense
 {
@@ -141,8 +149,9 @@ namespace librealsense
     colorizer::colorizer(const char* name)
         : stream_filter_processing_block(name),
          _min(0.f), _max(6.f), _equalize(true), 
-         _target_stream_profile(), _histogram()
+         _target_stream_profile(), _histogram(), _workers(worker_pool::get()), _max_threads(0)
     {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
         _histogram = std::vector<int>(MAX_DEPTH, 0);
         _hist_data = _histogram.data();
         _stream_filter.stream = RS2_STREAM_DEPTH;
@@ -238,6 +247,14 @@ namespace librealsense
         register_option(RS2_OPTION_VISUAL_PRESET, preset_opt);
 
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
+
+        auto threshold_opt = std::make_shared<ptr_option<float>>(0.f, 1.f, 0.001f, 0.f, &_histogram_threshold,
+            "Change in the equalized histogram, as a fraction of the pixels, below which the depth colors are kept");
+        register_option(RS2_OPTION_HISTOGRAM_UPDATE_THRESHOLD, threshold_opt);
+
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
     }
 
     bool colorizer::should_process(const rs2::frame& frame)
@@ -281,14 +298,16 @@ namespace librealsense
             if (depth_format == RS2_FORMAT_DISPARITY32)
             {
                 auto depth_data = reinterpret_cast<const float*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
+                update_histogram_parallel(depth_data, w, h);
                 make_rgb_data<float>(depth_data, rgb_data, w, h, coloring_function);
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_histogram_parallel(depth_data, w, h);
+                if (lut_outdated())
+                    update_lut(coloring_function);
+                colorize_depth(depth_data, rgb_data, w, h);
             }
         };
 
@@ -321,7 +340,9 @@ namespace librealsense
                     if (min >= max) return 0.f;
                     return (data * _depth_units - min) / (max - min);
                 };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                if (lut_outdated())
+                    update_lut(coloring_function);
+                colorize_depth(depth_data, rgb_data, w, h);
             }
         };
 
@@ -337,4 +358,131 @@ namespace librealsense
 
         return ret;
     }
+
+    template<typename T>
+    void colorizer::update_histogram_parallel(const T* depth_data, int w, int h)
+    {
+        // Each band of the image is counted into a histogram of its own, and these are then added up. Bands are
+        // large enough for clearing and adding their histograms to cost less than counting them.
+        size_t const n = size_t(w) * h;
+        size_t const parts = std::max<size_t>(1, std::min<size_t>(_workers->get_concurrency(), n / (2 * MAX_DEPTH)));
+        if (parts == 1)
+        {
+            update_histogram(_hist_data, depth_data, w, h);
+            return;
+        }
+
+        if (_partial_histograms.size() < parts - 1)
+            _partial_histograms.resize(parts - 1, std::vector<int>(MAX_DEPTH));
+
+        size_t const chunk = (n + parts - 1) / parts;
+        size_t const used = (n + chunk - 1) / chunk;
+        _workers->parallel_for(n, chunk, [&](size_t begin, size_t end)
+        {
+            auto part = begin / chunk;
+            auto hist = part ? _partial_histograms[part - 1].data() : _hist_data;
+            memset(hist, 0, MAX_DEPTH * sizeof(int));
+            for (auto i = begin; i < end; ++i)
+            {
+                T depth_val = depth_data[i];
+                int index = static_cast< int >( depth_val );
+                hist[index] += 1;
+            }
+        }, _max_threads);
+
+        size_t const bins_chunk = MAX_DEPTH / _workers->get_concurrency() + 1;
+        _workers->parallel_for(MAX_DEPTH, bins_chunk, [&](size_t begin, size_t end)
+        {
+            for (size_t p = 0; p + 1 < used; ++p)
+            {
+                auto partial = _partial_histograms[p].data();
+                for (auto i = begin; i < end; ++i)
+                    _hist_data[i] += partial[i];
+            }
+        }, _max_threads);
+
+        for (auto i = 2; i < MAX_DEPTH; ++i) _hist_data[i] += _hist_data[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
+    }
+
+    bool colorizer::lut_outdated()
+    {
+        lut_options options = { _equalize, _map_index, _min, _max, _depth_units };
+        if (_lut.empty() || !(options == _lut_options))
+            return true;
+        if (!_equalize)
+            return false;
+
+        // Whether the fraction of the pixels within any depth changed by more than the threshold. The table is built
+        // for at least one valid pixel: NaN levels always count as a change.
+        auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+        auto levels = _lut_levels.data();
+        for (auto i = 1; i < MAX_DEPTH; ++i)
+        {
+            if (!(std::fabs(_hist_data[i] / pixels - levels[i]) <= _histogram_threshold))
+                return true;
+        }
+        return false;
+    }
+
+    template<typename F>
+    void colorizer::update_lut(F coloring_func)
+    {
+        _lut.resize(MAX_DEPTH);
+        auto lut = _lut.data();
+        auto cm = _maps[_map_index];
+        size_t const bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(MAX_DEPTH, (MAX_DEPTH + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            make_lut(lut, *cm, coloring_func, int(begin), int(end));
+        }, _max_threads);
+
+        _lut_options = { _equalize, _map_index, _min, _max, _depth_units };
+        if (_equalize)
+        {
+            _lut_levels.resize(MAX_DEPTH);
+            auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+            for (auto i = 1; i < MAX_DEPTH; ++i)
+                _lut_levels[i] = _hist_data[i] / pixels;
+        }
+    }
+
+    // Returns the end of the pixels that were colored with SIMD, which takes 16 at a time
+    static size_t simd_colorize_depth(uint8_t* rgb_data, const uint16_t* depth_data, const uint32_t* lut, size_t begin, size_t end)
+    {
+        end = begin + (end - begin) / 16 * 16;
+#if defined(__SSSE3__)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+            colorize_depth_pixels_avx2(rgb_data, depth_data, lut, begin, end);
+        else
+#endif
+            colorize_depth_pixels_sse(rgb_data, depth_data, lut, begin, end);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        colorize_depth_pixels_neon(rgb_data, depth_data, lut, begin, end);
+        return end;
+#else
+        return begin;
+#endif
+    }
+
+    void colorizer::colorize_depth(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto lut = _lut.data();
+        size_t const n = size_t(width) * height;
+        size_t const bands = _workers->get_concurrency() * 4;
+        size_t const chunk = ((n + bands - 1) / bands + 15) / 16 * 16;
+        _workers->parallel_for(n, std::max<size_t>(chunk, 16), [&](size_t begin, size_t end)
+        {
+            auto simd_end = simd_colorize_depth(rgb_data, depth_data, lut, begin, end);
+            colorize_depth_pixels(rgb_data, depth_data, lut, simd_end, end);
+        }, _max_threads);
+    }
 }
@@ -5,6 +5,7 @@
 #include <src/float3.h>
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <set>
 
@@ -15,6 +16,21 @@ namespace rs2
 
 namespace librealsense {
 
+    class worker_pool;
+
+    // Colors Z16 pixels [begin, end) through a lookup table holding the R, G and B bytes of each depth value, followed
+    // by an unused byte. This is the reference implementation: SIMD versions must produce identical results.
+    inline void colorize_depth_pixels(uint8_t* rgb_data, const uint16_t* depth_data, const uint32_t* lut, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto c = reinterpret_cast<const uint8_t*>(lut + depth_data[i]);
+            rgb_data[i * 3 + 0] = c[0];
+            rgb_data[i * 3 + 1] = c[1];
+            rgb_data[i * 3 + 2] = c[2];
+        }
+    }
+
     class LRS_EXTENSION_API color_map
     {
     public:
@@ -116,6 +132,30 @@ namespace librealsense {
             for (auto i = 2; i < MAX_DEPTH; ++i) hist[i] += hist[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
         }
 
+        // Fills entries [begin, end) of a Z16 lookup table, for colorize_depth_pixels(), with the colors that
+        // colorize_pixel() gives these depth values
+        template<typename F>
+        static void make_lut(uint32_t* lut, const color_map& cm, F coloring_func, int begin, int end)
+        {
+            for (auto d = begin; d < end; ++d)
+            {
+                auto c = reinterpret_cast<uint8_t*>(lut + d);
+                if (d)
+                {
+                    auto f = coloring_func(static_cast<uint16_t>(d));
+                    auto color = cm.get(f);
+                    c[0] = (uint8_t)color.x;
+                    c[1] = (uint8_t)color.y;
+                    c[2] = (uint8_t)color.z;
+                }
+                else
+                {
+                    c[0] = c[1] = c[2] = 0;
+                }
+                c[3] = 0;
+            }
+        }
+
         static const int MAX_DEPTH = 0x10000;
         static const int MAX_DISPARITY = 0x2710;
 
@@ -125,6 +165,17 @@ namespace librealsense {
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // update_histogram() into _hist_data, over bands of the image counted in parallel
+        template<typename T>
+        void update_histogram_parallel(const T* depth_data, int w, int h);
+
+        // Z16 frames are colored through a lookup table, rebuilt only when the options change or the equalized
+        // histogram changes by more than the threshold option
+        bool lut_outdated();
+        template<typename F>
+        void update_lut(F coloring_func);
+        void colorize_depth(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
         template<typename T, typename F>
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
@@ -163,6 +214,25 @@ namespace librealsense {
 
         std::vector<int> _histogram;
         int* _hist_data;
+        std::vector<std::vector<int>> _partial_histograms;  // Of the bands counted by the other threads
+
+        // The options the lookup table was made for
+        struct lut_options
+        {
+            bool equalize;
+            int map_index;
+            float min, max, depth_units;
+
+            bool operator==(const lut_options& other) const
+            {
+                return equalize == other.equalize && map_index == other.map_index
+                    && min == other.min && max == other.max && depth_units == other.depth_units;
+            }
+        };
+        std::vector<uint32_t> _lut;
+        lut_options _lut_options;
+        std::vector<float> _lut_levels;     // The equalized value of each depth in the table, when equalizing
+        float _histogram_threshold = 0.f;
 
         int _preset = 0;
         rs2::stream_profile _target_stream_profile;
@@ -172,5 +242,8 @@ namespace librealsense {
         float   _d2d_convert_factor = 0.f;
 
         const std::set<rs2_format> _supported_formats = {RS2_FORMAT_Z16, RS2_FORMAT_DISPARITY32};
+
+        std::shared_ptr<worker_pool> _workers;
+        int _max_threads;
     };
 }
@@ -13,7 +13,10 @@ namespace librealsense
     class align_cuda : public align
     {
     public:
-        align_cuda(rs2_stream align_to) : align(align_to, "Align (CUDA)") {}
+        align_cuda(rs2_stream align_to) : align(align_to, "Align (CUDA)")
+        {
+            update_info(RS2_CAMERA_INFO_SIMD_LEVEL, "CUDA");
+        }
 
     protected:
         void reset_cache(rs2_stream from, rs2_stream to) override
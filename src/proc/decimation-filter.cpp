@@ -4,6 +4,7 @@
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
 
+#include <algorithm>
 #include <numeric>
 #include <cmath>
 #include "environment.h"
@@ -12,6 +13,11 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/decimation-filter.h"
+#include "proc/worker-pool.h"
+#include "proc/sse/sse-decimation-filter.h"
+#include "proc/sse/avx-decimation-filter.h"
+#include "proc/simd-dispatch.h"
+#include "proc/neon/neon-decimation-filter.h"
 
 #include <rsutils/string/from.h>
 
@@ -206,14 +212,19 @@ namespace librealsense
         _decimation_factor(decimation_default_val),
         _control_val(decimation_default_val),
         _patch_size(decimation_default_val),
-        _kernel_size(_patch_size*_patch_size),
         _real_width(),
         _real_height(0),
         _padded_width(0),
         _padded_height(0),
         _recalc_profile(false),
-        _options_changed(false)
+        _options_changed(false),
+        _fused_format(RS2_FORMAT_ANY),
+        _fused_width(0),
+        _fused_height(0),
+        _workers(worker_pool::get()),
+        _max_threads(0)
     {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
 
@@ -240,17 +251,20 @@ namespace librealsense
             if (_control_val != _decimation_factor)
             {
                 _patch_size = _decimation_factor = _control_val;
-                _kernel_size = _patch_size * _patch_size;
                 _options_changed = true;
             }
         });
 
         register_option(RS2_OPTION_FILTER_MAGNITUDE, decimation_control);
+
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
     }
 
     rs2::frame decimation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
-        update_output_profile(f);
+        update_output_profile(f.get_profile());
 
         auto src = f.as<rs2::video_frame>();
         rs2::stream_profile profile = f.get_profile();
@@ -282,12 +296,35 @@ namespace librealsense
         return f;
     }
 
-    void  decimation_filter::update_output_profile(const rs2::frame& f)
+    bool decimation_filter::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        if (!should_process_profile(image.profile))
+            return false;
+
+        update_output_profile(image.profile);
+        _fused_format = image.profile.format();
+        _fused_width = image.width;
+        _fused_height = image.height;
+        image.profile = _target_stream_profile;
+        image.width = _padded_width;
+        image.height = _padded_height;
+        return true;
+    }
+
+    void decimation_filter::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        if (_fused_format == RS2_FORMAT_Z16)
+            decimate_depth(static_cast<const uint16_t*>(in), static_cast<uint16_t*>(out), _fused_width, _fused_height, _patch_size);
+        else
+            decimate_others(_fused_format, in, out, _fused_width, _fused_height, _patch_size);
+    }
+
+    void  decimation_filter::update_output_profile(const rs2::stream_profile& profile)
     {
-        if (_options_changed || f.get_profile().get() != _source_stream_profile.get())
+        if (_options_changed || profile.get() != _source_stream_profile.get())
         {
             _options_changed = false;
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
             const auto pf = _registered_profiles.find(std::make_tuple(_source_stream_profile.get(), _decimation_factor));
             if (_registered_profiles.end() != pf)
             {
@@ -373,135 +410,159 @@ namespace librealsense
         return ret;
     }
 
-    void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
-        size_t width_in, size_t height_in, size_t scale)
+    void decimate_depth_pixels(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
     {
-        // Use median filtering
-        std::vector<uint16_t> working_kernel(_kernel_size);
-        auto wk_begin = working_kernel.data();
-        auto wk_itr = wk_begin;
-        std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
-
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            // Use median filtering
+            uint16_t working_kernel[9];
+            for (size_t i = u_begin; i < u_end; i++)
             {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
-
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                auto wk_itr = working_kernel;
+                // extract data the kernel to process
+                for (size_t n = 0; n < scale; ++n)
                 {
-                    wk_itr = wk_begin;
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
-                        {
-                            if (*(p + m))
-                                *wk_itr++ = *(p + m);
-                        }
-                    }
-
-                    // For even-size kernels pick the member one below the middle
-                    auto ks = (int)(wk_itr - wk_begin);
-                    if (ks == 0)
-                        *frame_data_out++ = 0;
-                    else
+                    auto p = in + width_in * n + i * scale;
+                    for (size_t m = 0; m < scale; ++m)
                     {
-                        switch (ks)
-                        {
-                        case 1:
-                            *frame_data_out++ = working_kernel[0];
-                            break;
-                        case 2:
-                            *frame_data_out++ = PIX_MIN(working_kernel[0], working_kernel[1]);
-                            break;
-                        case 3:
-                            *frame_data_out++ = opt_med3<uint16_t>(working_kernel.data());
-                            break;
-                        case 4:
-                            *frame_data_out++ = opt_med4<uint16_t>(working_kernel.data());
-                            break;
-                        case 5:
-                            *frame_data_out++ = opt_med5<uint16_t>(working_kernel.data());
-                            break;
-                        case 6:
-                            *frame_data_out++ = opt_med6<uint16_t>(working_kernel.data());
-                            break;
-                        case 7:
-                            *frame_data_out++ = opt_med7<uint16_t>(working_kernel.data());
-                            break;
-                        case 8:
-                            *frame_data_out++ = opt_med8<uint16_t>(working_kernel.data());
-                            break;
-                        case 9:
-                            *frame_data_out++ = opt_med9<uint16_t>(working_kernel.data());
-                            break;
-                        }
+                        if (*(p + m))
+                            *wk_itr++ = *(p + m);
                     }
-
-                    chunk_offset += scale;
                 }
 
-                // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
+                // For even-size kernels pick the member one below the middle
+                auto ks = (int)(wk_itr - working_kernel);
+                switch (ks)
+                {
+                case 0:
+                    out[i] = 0;
+                    break;
+                case 1:
+                    out[i] = working_kernel[0];
+                    break;
+                case 2:
+                    out[i] = PIX_MIN(working_kernel[0], working_kernel[1]);
+                    break;
+                case 3:
+                    out[i] = opt_med3<uint16_t>(working_kernel);
+                    break;
+                case 4:
+                    out[i] = opt_med4<uint16_t>(working_kernel);
+                    break;
+                case 5:
+                    out[i] = opt_med5<uint16_t>(working_kernel);
+                    break;
+                case 6:
+                    out[i] = opt_med6<uint16_t>(working_kernel);
+                    break;
+                case 7:
+                    out[i] = opt_med7<uint16_t>(working_kernel);
+                    break;
+                case 8:
+                    out[i] = opt_med8<uint16_t>(working_kernel);
+                    break;
+                case 9:
+                    out[i] = opt_med9<uint16_t>(working_kernel);
+                    break;
+                }
             }
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t i = u_begin; i < u_end; i++)
             {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
+                int sum = 0;
+                int counter = 0;
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                // extract data the kernel to process
+                for (size_t n = 0; n < scale; ++n)
                 {
-                    int sum = 0;
-                    int counter = 0;
-
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
+                    auto p = in + width_in * n + i * scale;
+                    for (size_t m = 0; m < scale; ++m)
                     {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
+                        if (*(p + m))
                         {
-                            if (*(p + m))
-                            {
-                                sum += p[m];
-                                ++counter;
-                            }
+                            sum += p[m];
+                            ++counter;
                         }
                     }
-
-                    *frame_data_out++ = (counter == 0 ? 0 : sum / counter);
-                    chunk_offset += scale;
                 }
 
-                // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
+                out[i] = (counter == 0 ? 0 : sum / counter);
             }
         }
+    }
 
-        // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
+    // Returns the end of the pixels of the row that were decimated with SIMD, which takes 8 (or 16, with AVX2) at a time
+    static size_t simd_decimate_depth(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t width_out)
+    {
+        if (scale < 2)
+            return 0;
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
         {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
+            size_t end = width_out / 16 * 16;
+            if (scale <= 3)
+                decimate_depth_median_avx2(in, width_in, out, scale, 0, end);
+            else
+                decimate_depth_mean_avx2(in, width_in, out, scale, 0, end);
+            return end;
         }
+#endif
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return 0;
+        size_t end = width_out / 8 * 8;
+        if (scale <= 3)
+            decimate_depth_median_sse(in, width_in, out, scale, 0, end);
+        else
+            decimate_depth_mean_sse(in, width_in, out, scale, 0, end);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return 0;
+        size_t end = width_out / 8 * 8;
+        if (scale <= 3)
+            decimate_depth_median_neon(in, width_in, out, scale, 0, end);
+        else
+            decimate_depth_mean_neon(in, width_in, out, scale, 0, end);
+        return end;
+#else
+        return 0;
+#endif
+    }
+
+    void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t height_in, size_t scale)
+    {
+        size_t const real_width = _real_width;
+        size_t const real_height = _real_height;
+        size_t const padded_width = _padded_width;
+        size_t const padded_height = _padded_height;
+
+        // Each output row only reads its own 'scale' input rows, so bands of rows are decimated concurrently
+        size_t const bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(padded_height, (padded_height + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            for (size_t v = begin; v < end; v++)
+            {
+                auto out = frame_data_out + v * padded_width;
+                size_t u = 0;
+                if (v < real_height)
+                {
+                    auto in = frame_data_in + v * scale * width_in;
+                    u = simd_decimate_depth(in, width_in, out, scale, real_width);
+                    decimate_depth_pixels(in, width_in, out, scale, u, real_width);
+                    u = real_width;
+                }
+
+                // Fill-in the padded columns, and the padded rows, with zeros
+                std::fill(out + u, out + padded_width, uint16_t(0));
+            }
+        }, _max_threads);
     }
 
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
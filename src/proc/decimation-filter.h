@@ -6,15 +6,28 @@
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
+#include "proc/fused-filter.h"
 
 namespace librealsense
 {
+    class worker_pool;
 
-    class decimation_filter : public stream_filter_processing_block
+    // Decimates pixels [u_begin, u_end) of an output row, from the 'scale' rows of a Z16 image starting at 'in'. Each
+    // output pixel is taken from the non-zero pixels of its scale x scale patch: their median for scales 2 and 3, the
+    // lower of the middle two for even counts, and their mean for other scales. Patches with none of them give 0.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void decimate_depth_pixels(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end);
+
+    class decimation_filter : public stream_filter_processing_block, public fusable_filter
     {
     public:
         decimation_filter();
 
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        bool is_in_place() const override { return false; }
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source, rs2_extension tgt_type);
 
@@ -26,12 +39,11 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
-        void    update_output_profile(const rs2::frame& f);
+        void    update_output_profile(const rs2::stream_profile& profile);
 
         uint8_t                 _decimation_factor;
         uint8_t                 _control_val;
         uint8_t                 _patch_size;
-        uint8_t                 _kernel_size;
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         std::map<std::tuple<const rs2_stream_profile*, uint8_t>, rs2::stream_profile> _registered_profiles;
@@ -41,6 +53,11 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        rs2_format              _fused_format;      // The input, when run by a fused_filter
+        size_t                  _fused_width;
+        size_t                  _fused_height;
+        std::shared_ptr<worker_pool> _workers;
+        int                     _max_threads;
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
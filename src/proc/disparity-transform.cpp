@@ -12,17 +12,73 @@
 #include "proc/disparity-transform.h"
 #include "software-device.h"
 #include "environment.h"
+#include "simd-dispatch.h"
+#include "sse/sse-depth-transforms.h"
+#include "sse/avx-depth-transforms.h"
+#include "neon/neon-depth-transforms.h"
 
 namespace librealsense
 {
+    void depth_to_disparity_pixels(const uint16_t* in, float* out, const float* reciprocals, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            out[i] = reciprocals[in[i]];
+    }
+
+    void fill_disparity_reciprocals(float* reciprocals, float d2d_convert_factor)
+    {
+        // As the division the table replaces: z is only 0 when it is not a normal number
+        reciprocals[0] = 0;
+        for (int z = 1; z <= 0xFFFF; z++)
+            reciprocals[z] = d2d_convert_factor / z;
+    }
+
+    void disparity_to_depth_pixels(const float* in, uint16_t* out, float d2d_convert_factor, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            float input = in[i];
+            if (std::isnormal(input))
+                out[i] = static_cast<uint16_t>((d2d_convert_factor / input) + 0.5f);
+            else
+                out[i] = 0;
+        }
+    }
+
+    // The widest SIMD kernel enabled, or none
+    struct disparity_kernel
+    {
+        void (*to_depth)(const float* in, uint16_t* out, float d2d_convert_factor, size_t begin, size_t end);
+        size_t step; // pixels converted at a time
+    };
+
+    static disparity_kernel select_disparity_kernel()
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        if (simd_enabled(simd_level::avx2))
+            return { disparity_to_depth_pixels_avx2, 16 };
+#endif
+        if (simd_enabled(simd_level::ssse3))
+            return { disparity_to_depth_pixels_sse, 8 };
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+            return { disparity_to_depth_pixels_neon, 8 };
+#endif
+        return { nullptr, 0 };
+    }
+
     disparity_transform::disparity_transform(bool transform_to_disparity):
         generic_processing_block(transform_to_disparity ? "Depth to Disparity" : "Disparity to Depth"),
         _transform_to_disparity(transform_to_disparity),
         _update_target(false),
+        _reciprocals_factor(0),
         _width(0), _height(0), _bpp(0)
     {
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
 
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
+
         on_set_mode(_transform_to_disparity);
     }
 
@@ -51,21 +107,64 @@ namespace librealsense
     {
         rs2::frame tgt;
 
-        update_transformation_profile(f);
+        update_transformation_profile(f, f.get_profile());
 
         if (_stereoscopic_depth && (tgt = prepare_target_frame(f, source)))
         {
             auto src = f.as<rs2::video_frame>();
-
-            if (_transform_to_disparity)
-                convert<uint16_t, float>(src.get_data(), const_cast<void*>(tgt.get_data()));
-            else
-                convert<float, uint16_t>(src.get_data(), const_cast<void*>(tgt.get_data()));
+            convert(src.get_data(), const_cast<void*>(tgt.get_data()), 0, _height);
         }
 
         return tgt;
     }
 
+    bool disparity_transform::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        auto format = image.profile.format();
+        if (image.profile.stream_type() != RS2_STREAM_DEPTH)
+            return false;
+        if (_transform_to_disparity && (format != RS2_FORMAT_Z16 || image.type != RS2_EXTENSION_DEPTH_FRAME))
+            return false;
+        if (!_transform_to_disparity && ((format != RS2_FORMAT_DISPARITY16 && format != RS2_FORMAT_DISPARITY32)
+                                         || image.type != RS2_EXTENSION_DISPARITY_FRAME))
+            return false;
+
+        update_transformation_profile(f, image.profile);
+        if (!_stereoscopic_depth)
+            return false;
+
+        image.profile = _target_stream_profile;
+        image.type = _transform_to_disparity ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+        image.bpp = _bpp;
+        return true;
+    }
+
+    void disparity_transform::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        convert(in, out, begin, end);
+    }
+
+    void disparity_transform::convert(const void* in_data, void* out_data, size_t begin, size_t end) const
+    {
+        static const disparity_kernel simd = select_disparity_kernel();
+
+        size_t const first = begin * _width;
+        size_t const last = end * _width;
+        if (_transform_to_disparity)
+        {
+            depth_to_disparity_pixels(static_cast<const uint16_t*>(in_data), static_cast<float*>(out_data),
+                                      _reciprocals.data(), first, last);
+            return;
+        }
+
+        auto in = static_cast<const float*>(in_data);
+        auto out = static_cast<uint16_t*>(out_data);
+        size_t const simd_end = simd.step ? first + (last - first) / simd.step * simd.step : first;
+        if (simd_end > first)
+            simd.to_depth(in, out, _d2d_convert_factor, first, simd_end);
+        disparity_to_depth_pixels(in, out, _d2d_convert_factor, simd_end, last);
+    }
+
     void disparity_transform::on_set_mode(bool to_disparity)
     {
         _transform_to_disparity = to_disparity;
@@ -73,16 +172,25 @@ namespace librealsense
         _update_target = true;
     }
 
-    void disparity_transform::update_transformation_profile(const rs2::frame& f)
+    void disparity_transform::update_transformation_profile(const rs2::frame& f, const rs2::stream_profile& profile)
     {
-        if(f.get_profile().get() != _source_stream_profile.get())
+        if(profile.get() != _source_stream_profile.get())
         {
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
 
-            auto info = disparity_info::update_info_from_frame(f);
+            auto info = disparity_info::update_info_from_frame(f, profile);
             _stereoscopic_depth = info.stereoscopic_depth;
             _d2d_convert_factor = info.d2d_convert_factor;
 
+            // Depth is converted to disparity through a table of the divisions, which only depend on the factor
+            if (_transform_to_disparity && _stereoscopic_depth
+                && (_reciprocals.empty() || _reciprocals_factor != _d2d_convert_factor))
+            {
+                _reciprocals.resize(0x10000);
+                fill_disparity_reciprocals(_reciprocals.data(), _d2d_convert_factor);
+                _reciprocals_factor = _d2d_convert_factor;
+            }
+
             auto vp = _source_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
             _height = vp.height();
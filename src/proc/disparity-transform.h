@@ -11,47 +11,43 @@
 #include <src/core/sensor-interface.h>
 #include <src/depth-sensor.h>
 #include "synthetic-stream.h"
+#include "fused-filter.h"
 
 namespace librealsense
 {
-    class disparity_transform : public generic_processing_block
+    // Converts pixels [begin, end) of a Z16 image to disparity, through the table of d2d_convert_factor / z for each
+    // z (see fill_disparity_reciprocals())
+    void depth_to_disparity_pixels(const uint16_t* in, float* out, const float* reciprocals, size_t begin, size_t end);
+
+    // Fills the 65536 entries of a table with d2d_convert_factor / z, and 0 for z = 0
+    void fill_disparity_reciprocals(float* reciprocals, float d2d_convert_factor);
+
+    // Converts pixels [begin, end) of a 32-bit disparity image to Z16, d2d_convert_factor / d rounded to the nearest
+    // unit. Pixels that are not normal numbers are zeroed.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void disparity_to_depth_pixels(const float* in, uint16_t* out, float d2d_convert_factor, size_t begin, size_t end);
+
+    class disparity_transform : public generic_processing_block, public fusable_filter
     {
     public:
         disparity_transform(bool transform_to_disparity);
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        bool is_row_local() const override { return true; }
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename Tin, typename Tout>
-        void convert(const void* in_data, void* out_data)
-        {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
-        }
+        // Converts rows [begin, end), in the direction of the transform
+        void convert(const void* in_data, void* out_data, size_t begin, size_t end) const;
 
     private:
-        void    update_transformation_profile(const rs2::frame& f);
+        // The profile is that of 'f', unless the frame was changed by filters that ran before in a fused_filter
+        void    update_transformation_profile(const rs2::frame& f, const rs2::stream_profile& profile);
 
         void    on_set_mode(bool to_disparity);
 
@@ -62,6 +58,8 @@ namespace librealsense
         bool                    _stereoscopic_depth;
         float                   _stereo_baseline_meter; // in meters
         float                   _d2d_convert_factor;
+        std::vector<float>      _reciprocals;           // d2d_convert_factor / z, for each z
+        float                   _reciprocals_factor;    // The factor _reciprocals were computed for
         size_t                  _width, _height;
         size_t                  _bpp;
     };
@@ -76,6 +74,12 @@ namespace librealsense
         };
 
         static info update_info_from_frame(const rs2::frame& f)
+        {
+            return update_info_from_frame(f, f.get_profile());
+        }
+
+        // With the intrinsics of 'profile' instead of the frame's
+        static info update_info_from_frame(const rs2::frame& f, const rs2::stream_profile& profile)
         {
             // Check if the new frame originated from stereo-based depth sensor
             // and retrieve the stereo baseline parameter that will be used in transformations
@@ -106,7 +110,7 @@ namespace librealsense
 
             if (info.stereoscopic_depth)
             {
-                auto vp = f.get_profile().as<rs2::video_stream_profile>();
+                auto vp = profile.as<rs2::video_stream_profile>();
                 auto focal_lenght_mm = vp.get_intrinsics().fx;
                 const uint8_t fractional_bits = 5;
                 const uint8_t fractions = 1 << fractional_bits;
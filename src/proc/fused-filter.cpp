@@ -0,0 +1,159 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+#include "proc/synthetic-stream.h"
+#include "proc/fused-filter.h"
+#include "option.h"
+#include "proc/worker-pool.h"
+
+#include <rsutils/string/from.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace librealsense
+{
+    fused_image::fused_image(const rs2::frame& f) :
+        profile(f.get_profile()),
+        type(f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME)
+    {
+        auto vf = f.as<rs2::video_frame>();
+        width = vf.get_width();
+        height = vf.get_height();
+        bpp = vf.get_bytes_per_pixel();
+    }
+
+    fused_filter::fused_filter(std::vector<std::shared_ptr<processing_block_interface>> filters) :
+        depth_processing_block("Fused Filter"),
+        _blocks(std::move(filters)),
+        _workers(worker_pool::get()),
+        _max_threads(0)
+    {
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+        _stream_filter.format = RS2_FORMAT_Z16;
+
+        for (size_t i = 0; i < _blocks.size(); i++)
+        {
+            auto filter = dynamic_cast<fusable_filter*>(_blocks[i].get());
+            if (!filter)
+                throw invalid_value_exception(rsutils::string::from() << "Filter " << i << " cannot be fused");
+            // Its lock is taken once per frame
+            if (std::find(_filters.begin(), _filters.end(), filter) != _filters.end())
+                throw invalid_value_exception(rsutils::string::from() << "Filter " << i << " appears more than once");
+            _filters.push_back(filter);
+        }
+
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
+    }
+
+    rs2::frame fused_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        // No option can change while the chain runs. Filters may be shared by several fused filters, so they're
+        // always locked in the same (address) order, whatever order they're chained in.
+        std::vector<std::mutex*> mutexes;
+        for (auto filter : _filters)
+            mutexes.push_back(&filter->get_fused_mutex());
+        std::sort(mutexes.begin(), mutexes.end(), std::less<std::mutex*>());
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(mutexes.size());
+        for (auto m : mutexes)
+            locks.emplace_back(*m);
+
+        std::vector<stage> stages;
+        fused_image image(f);
+        for (auto filter : _filters)
+        {
+            stage s{ filter, image, image, nullptr, nullptr };
+            if (filter->configure_fused(f, s.out))
+            {
+                image = s.out;
+                stages.push_back(s);
+            }
+        }
+        if (stages.empty())
+            return f;
+
+        rs2::frame tgt = source.allocate_video_frame(image.profile, f, int(image.bpp), int(image.width), int(image.height),
+                                                     int(image.width * image.bpp), image.type);
+        if (!tgt)
+            return f;
+
+        plan_buffers(stages, f, const_cast<void*>(tgt.get_data()));
+        run(stages.begin(), stages.end());
+
+        for (auto& s : stages)
+            s.filter->finish_fused();
+
+        return tgt;
+    }
+
+    void fused_filter::plan_buffers(std::vector<stage>& stages, const rs2::frame& f, void* output)
+    {
+        // A stage writes over its input when it can; the first can't write over the original frame. Of the others,
+        // the last one writes into the output frame, and the rest alternate between the two buffers.
+        auto needs_buffer = [&](size_t i)
+        {
+            auto& s = stages[i];
+            return i == 0 || !s.filter->is_in_place()
+                || s.in.width != s.out.width || s.in.height != s.out.height || s.in.bpp != s.out.bpp;
+        };
+
+        size_t last = 0;
+        for (size_t i = 0; i < stages.size(); i++)
+            if (needs_buffer(i))
+                last = i;
+
+        // Sized before any pointer into them is taken
+        std::vector<int> buffer_of(stages.size(), -1);
+        int cur = -1;
+        for (size_t i = 0; i < stages.size(); i++)
+        {
+            if (!needs_buffer(i) || i == last)
+                continue;
+            buffer_of[i] = cur = (cur == 0 ? 1 : 0);
+            if (_buffers[cur].size() < stages[i].out.size())
+                _buffers[cur].resize(stages[i].out.size());
+        }
+
+        const void* src = f.get_data();
+        for (size_t i = 0; i < stages.size(); i++)
+        {
+            auto& s = stages[i];
+            s.src = src;
+            if (!needs_buffer(i))
+                s.dst = const_cast<void*>(src);
+            else
+                s.dst = buffer_of[i] < 0 ? output : _buffers[buffer_of[i]].data();
+            src = s.dst;
+        }
+    }
+
+    void fused_filter::run(std::vector<stage>::iterator begin, std::vector<stage>::iterator end)
+    {
+        while (begin != end)
+        {
+            if (!begin->filter->is_row_local())
+            {
+                begin->filter->process_fused(begin->src, begin->dst, 0, begin->in.height);
+                ++begin;
+                continue;
+            }
+
+            // Row-local stages keep the image size: each band goes through all of them before the next is started
+            auto group_end = std::find_if(begin, end, [](const stage& s) { return !s.filter->is_row_local(); });
+            size_t height = begin->in.height;
+            size_t const bands = _workers->get_concurrency() * 4;
+            _workers->parallel_for(height, (height + bands - 1) / bands, [&](size_t first, size_t last)
+            {
+                for (auto s = begin; s != group_end; ++s)
+                    s->filter->process_fused(s->src, s->dst, first, last);
+            }, _max_threads);
+            begin = group_end;
+        }
+    }
+}
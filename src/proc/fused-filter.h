@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+// Runs a chain of depth post-processing filters as a single pass over each frame
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <mutex>
+
+namespace librealsense
+{
+    class worker_pool;
+
+    // The image handed from one stage of a fused_filter to the next
+    struct fused_image
+    {
+        rs2::stream_profile profile;
+        rs2_extension type;             // Strictly Depth/Disparity
+        size_t width, height, bpp;
+
+        fused_image() : type(RS2_EXTENSION_DEPTH_FRAME), width(0), height(0), bpp(0) {}
+        explicit fused_image(const rs2::frame& f);
+
+        size_t size() const { return width * height * bpp; }
+    };
+
+    // Implemented by the filters that can be stages of a fused_filter: instead of allocating a new frame, these filter
+    // buffers owned by the chain
+    class fusable_filter
+    {
+    public:
+        virtual ~fusable_filter() = default;
+
+        // Prepares to filter 'image', as the previous stages leave it for the original frame 'f', and updates it to
+        // describe the output. Returns false if the filter would pass such frames through as they are.
+        virtual bool configure_fused(const rs2::frame& f, fused_image& image) = 0;
+
+        // Row-local filters only read the input rows they write, and are run on bands of rows along with the
+        // neighbouring row-local stages, while the data is still in cache. Others are given the whole image.
+        virtual bool is_row_local() const { return false; }
+
+        // Whether the output can be written over the input, when the image keeps its size
+        virtual bool is_in_place() const { return true; }
+
+        // Filters rows [begin, end) of the input into the output, which may be the same buffer
+        virtual void process_fused(const void* in, void* out, size_t begin, size_t end) = 0;
+
+        // Called once the whole frame was filtered
+        virtual void finish_fused() {}
+
+        // Held by the chain while it configures and runs the filter, as when the filter processes frames by itself
+        virtual std::mutex& get_fused_mutex() = 0;
+    };
+
+    // Filters depth frames with a chain of fusable filters, allocating a single output frame. Consecutive row-local
+    // filters are run together on bands of rows; intermediate images are kept in buffers reused across frames.
+    // The filters keep their own options and state, and are configured as when they are used by themselves.
+    class fused_filter : public depth_processing_block
+    {
+    public:
+        fused_filter(std::vector<std::shared_ptr<processing_block_interface>> filters);
+
+    protected:
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        struct stage
+        {
+            fusable_filter* filter;
+            fused_image in, out;
+            const void* src;
+            void* dst;
+        };
+
+        void plan_buffers(std::vector<stage>& stages, const rs2::frame& f, void* output);
+        void run(std::vector<stage>::iterator begin, std::vector<stage>::iterator end);
+
+        std::vector<std::shared_ptr<processing_block_interface>> _blocks;     // Keeps the filters alive
+        std::vector<fusable_filter*> _filters;
+        std::vector<uint8_t> _buffers[2];
+        std::shared_ptr<worker_pool> _workers;
+        int _max_threads;
+    };
+}
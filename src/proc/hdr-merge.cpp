@@ -2,6 +2,11 @@
 // Copyright(c) 2020 RealSense, Inc. All Rights Reserved.
 
 #include "hdr-merge.h"
+#include "worker-pool.h"
+#include "simd-dispatch.h"
+#include "sse/sse-hdr-merge.h"
+#include "sse/avx-hdr-merge.h"
+#include "neon/neon-hdr-merge.h"
 #include <src/core/depth-frame.h>
 
 namespace librealsense
@@ -9,8 +14,16 @@ namespace librealsense
     hdr_merge::hdr_merge()
         : generic_processing_block("HDR Merge"),
         _previous_depth_frame_counter(0),
-        _frames_without_requested_metadata_counter(0)
-    {}
+        _frames_without_requested_metadata_counter(0),
+        _workers(worker_pool::get()),
+        _max_threads(0)
+    {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
+
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
+    }
 
     // processing only framesets
     bool hdr_merge::should_process(const rs2::frame& frame)
@@ -204,48 +217,95 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-
-            int width_height_product = width * height;
-
-            if (use_ir)
-            {
-                if (first_ir.get_profile().format() == RS2_FORMAT_Y8)
-                {
-                    merge_frames_using_ir<uint8_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else if (first_ir.get_profile().format() == RS2_FORMAT_Y16)
-                {
-                    merge_frames_using_ir<uint16_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else
-                {
-                    merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-                }
-            }
-            else
-            {
-                merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-            }
+            merge_frames(new_data, d0, d1, first_ir, second_ir, use_ir, width, height);
 
             return new_f;
         }
         return first_fs;
     }
 
-    void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
+    void hdr_merge_depth_pixels(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t begin, size_t end)
     {
-        for (int i = 0; i < width_height_prod; i++)
+        for (size_t i = begin; i < end; i++)
         {
             if (d0[i])
-                new_data[i] = d0[i];
+                out[i] = d0[i];
             else if (d1[i])
-                new_data[i] = d1[i];
+                out[i] = d1[i];
             else
-                new_data[i] = 0;
+                out[i] = 0;
         }
     }
 
+    // The widest SIMD kernels enabled, or none
+    struct hdr_merge_kernels
+    {
+        void (*depth)(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t begin, size_t end);
+        void (*y8)(const uint16_t* d0, const uint16_t* d1, const uint8_t* ir0, const uint8_t* ir1,
+            int ir_min, int ir_max, uint16_t* out, size_t begin, size_t end);
+        void (*y16)(const uint16_t* d0, const uint16_t* d1, const uint16_t* ir0, const uint16_t* ir1,
+            int ir_min, int ir_max, uint16_t* out, size_t begin, size_t end);
+        size_t step; // pixels merged at a time
+    };
+
+    static hdr_merge_kernels select_hdr_merge_kernels()
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        if (simd_enabled(simd_level::avx2))
+            return { hdr_merge_depth_pixels_avx2, hdr_merge_y8_pixels_avx2, hdr_merge_y16_pixels_avx2, 16 };
+#endif
+        if (simd_enabled(simd_level::ssse3))
+            return { hdr_merge_depth_pixels_sse, hdr_merge_y8_pixels_sse, hdr_merge_y16_pixels_sse, 8 };
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+            return { hdr_merge_depth_pixels_neon, hdr_merge_y8_pixels_neon, hdr_merge_y16_pixels_neon, 8 };
+#endif
+        return { nullptr, nullptr, nullptr, 0 };
+    }
+
+    void hdr_merge::merge_frames(uint16_t* new_data, const uint16_t* d0, const uint16_t* d1,
+        const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, bool use_ir, int width, int height) const
+    {
+        static const hdr_merge_kernels simd = select_hdr_merge_kernels();
+
+        auto ir_format = use_ir ? first_ir.get_profile().format() : RS2_FORMAT_ANY;
+        const void* i0 = use_ir ? first_ir.get_data() : nullptr;
+        const void* i1 = use_ir ? second_ir.get_data() : nullptr;
+
+        // Each pixel only depends on the same pixel of the inputs, so bands of rows are merged concurrently
+        size_t const bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(height, (height + bands - 1) / bands, [&](size_t first_row, size_t last_row)
+        {
+            size_t const begin = first_row * width;
+            size_t const end = last_row * width;
+            size_t const simd_end = simd.step ? begin + (end - begin) / simd.step * simd.step : begin;
+
+            if (ir_format == RS2_FORMAT_Y8)
+            {
+                auto ir0 = static_cast<const uint8_t*>(i0);
+                auto ir1 = static_cast<const uint8_t*>(i1);
+                if (simd_end > begin)
+                    simd.y8(d0, d1, ir0, ir1, IR_UNDER_SATURATED_VALUE_Y8, IR_OVER_SATURATED_VALUE_Y8, new_data, begin, simd_end);
+                hdr_merge_ir_pixels(d0, d1, ir0, ir1, IR_UNDER_SATURATED_VALUE_Y8, IR_OVER_SATURATED_VALUE_Y8, new_data, simd_end, end);
+            }
+            else if (ir_format == RS2_FORMAT_Y16)
+            {
+                auto ir0 = static_cast<const uint16_t*>(i0);
+                auto ir1 = static_cast<const uint16_t*>(i1);
+                if (simd_end > begin)
+                    simd.y16(d0, d1, ir0, ir1, IR_UNDER_SATURATED_VALUE_Y16, IR_OVER_SATURATED_VALUE_Y16, new_data, begin, simd_end);
+                hdr_merge_ir_pixels(d0, d1, ir0, ir1, IR_UNDER_SATURATED_VALUE_Y16, IR_OVER_SATURATED_VALUE_Y16, new_data, simd_end, end);
+            }
+            else
+            {
+                if (simd_end > begin)
+                    simd.depth(d0, d1, new_data, begin, simd_end);
+                hdr_merge_depth_pixels(d0, d1, new_data, simd_end, end);
+            }
+        }, _max_threads);
+    }
+
     bool hdr_merge::should_ir_be_used_for_merging(const rs2::depth_frame& first_depth, const rs2::video_frame& first_ir,
         const rs2::depth_frame& second_depth, const rs2::video_frame& second_ir) const
     {
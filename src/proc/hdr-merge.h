@@ -9,6 +9,31 @@ Copyright(c) 2020 RealSense, Inc. All Rights Reserved. */
 
 namespace librealsense
 {
+    class worker_pool;
+
+    // Merges pixels [begin, end) of the depth frames of an HDR sequence: each output pixel is taken from the first
+    // frame where it is non-zero, or is 0.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void hdr_merge_depth_pixels(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t begin, size_t end);
+
+    // As hdr_merge_depth_pixels(), where the depth of a frame is only used if its IR pixel is neither under- nor
+    // over-saturated: strictly between ir_min and ir_max, which must both lie within the values of T.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    template <typename T>
+    void hdr_merge_ir_pixels(const uint16_t* d0, const uint16_t* d1, const T* ir0, const T* ir1,
+        int ir_min, int ir_max, uint16_t* out, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (ir0[i] > ir_min && ir0[i] < ir_max && d0[i])
+                out[i] = d0[i];
+            else if (ir1[i] > ir_min && ir1[i] < ir_max && d1[i])
+                out[i] = d1[i];
+            else
+                out[i] = 0;
+        }
+    }
+
     class hdr_merge : public generic_processing_block
     {
     public:
@@ -38,50 +63,15 @@ namespace librealsense
             const rs2::depth_frame& second_depth, const rs2::video_frame& second_ir) const;
         rs2::frame merging_algorithm(const rs2::frame_source& source, const rs2::frameset first_fs,
             const rs2::frameset second_fs, const bool use_ir) const;
-        template <typename T>
-        bool is_infrared_valid(T ir_value, rs2_format ir_format) const;
-        template <typename T>
-        void merge_frames_using_ir(uint16_t* new_data, uint16_t* d0, uint16_t* d1,
-            const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width_height_prod) const;
-        void merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const;
+        void merge_frames(uint16_t* new_data, const uint16_t* d0, const uint16_t* d1,
+            const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, bool use_ir, int width, int height) const;
 
         unsigned long long _previous_depth_frame_counter;
         int _frames_without_requested_metadata_counter;
         std::map<int, rs2::frameset> _framesets;
         rs2::frame _depth_merged_frame;
+        std::shared_ptr<worker_pool> _workers;
+        int _max_threads;
     };
     MAP_EXTENSION(RS2_EXTENSION_HDR_MERGE, librealsense::hdr_merge);
-
-    template <typename T>
-    void hdr_merge::merge_frames_using_ir(uint16_t* new_data, uint16_t* d0, uint16_t* d1,
-        const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width_height_prod) const
-    {
-        auto i0 = (T*)first_ir.get_data();
-        auto i1 = (T*)second_ir.get_data();
-
-        auto format = first_ir.get_profile().format();
-
-        for (int i = 0; i < width_height_prod; i++)
-        {
-            if (is_infrared_valid<T>(i0[i], format) && d0[i])
-                new_data[i] = d0[i];
-            else if (is_infrared_valid<T>(i1[i], format) && d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
-        }
-    }
-
-    template <typename T>
-    bool hdr_merge::is_infrared_valid(T ir_value, rs2_format ir_format) const
-    {
-        bool result = false;
-        if (ir_format == RS2_FORMAT_Y8)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y8) && (ir_value < IR_OVER_SATURATED_VALUE_Y8);
-        else if (ir_format == RS2_FORMAT_Y16)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y16) && (ir_value < IR_OVER_SATURATED_VALUE_Y16);
-        else
-            result = false;
-        return result;
-    }
 }
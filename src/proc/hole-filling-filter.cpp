@@ -61,7 +61,7 @@ namespace librealsense
 
     rs2::frame hole_filling_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
-        update_configuration(f);
+        update_configuration(f.get_profile(), f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME);
         auto tgt = prepare_target_frame(f, source);
 
         // Hole filling pass
@@ -73,14 +73,14 @@ namespace librealsense
         return tgt;
     }
 
-    void  hole_filling_filter::update_configuration(const rs2::frame& f)
+    void  hole_filling_filter::update_configuration(const rs2::stream_profile& profile, rs2_extension type)
     {
-        if (f.get_profile().get() != _source_stream_profile.get())
+        if (profile.get() != _source_stream_profile.get())
         {
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
 
-            _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+            _extension_type = type;
             _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
@@ -91,6 +91,27 @@ namespace librealsense
         }
     }
 
+    bool hole_filling_filter::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        if (!should_process_profile(image.profile))
+            return false;
+
+        update_configuration(image.profile, image.type);
+        image.profile = _target_stream_profile;
+        return true;
+    }
+
+    void hole_filling_filter::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        if (out != in)
+            memcpy(out, in, _current_frm_size_pixels * _bpp);
+
+        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+            apply_hole_filling<float>(out);
+        else
+            apply_hole_filling<uint16_t>(out);
+    }
+
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
         // Allocate and copy the content of the input data to the target
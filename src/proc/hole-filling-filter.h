@@ -3,6 +3,8 @@
 // Enhancing the input video frame by filling missing data.
 #pragma once
 
+#include "fused-filter.h"
+
 #include <rsutils/string/from.h>
 
 namespace librealsense
@@ -15,13 +17,17 @@ namespace librealsense
         hf_max_value
     };
 
-    class hole_filling_filter : public depth_processing_block
+    class hole_filling_filter : public depth_processing_block, public fusable_filter
     {
     public:
         hole_filling_filter();
 
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
     protected:
-        void update_configuration(const rs2::frame& f);
+        void update_configuration(const rs2::stream_profile& profile, rs2_extension type);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
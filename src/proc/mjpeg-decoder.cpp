@@ -0,0 +1,462 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+#include "worker-pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace librealsense
+{
+    // stb_image allocates the component planes of every image it decodes. While a decoder runs, they are taken from
+    // blocks it keeps instead: the same image size asks for the same blocks, so these are only allocated once.
+    class scratch_arena
+    {
+    public:
+        void rewind() { _next = 0; }
+
+        void* allocate(size_t size)
+        {
+            if (_next == _blocks.size())
+                _blocks.emplace_back();
+            auto& block = _blocks[_next++];
+            if (block.size() < size)
+                block.resize(size);
+            return block.data();
+        }
+
+        void* reallocate(void* p, size_t size)
+        {
+            for (size_t i = 0; i < _next; i++)
+                if (_blocks[i].data() == p)
+                {
+                    _blocks[i].resize(size);
+                    return _blocks[i].data();
+                }
+            return p ? nullptr : allocate(size);
+        }
+
+    private:
+        std::vector<std::vector<uint8_t>> _blocks;
+        size_t _next = 0;
+    };
+
+    static thread_local scratch_arena* current_arena = nullptr;
+
+    static void* arena_malloc(size_t size) { return current_arena ? current_arena->allocate(size) : malloc(size); }
+    static void* arena_realloc(void* p, size_t size) { return current_arena ? current_arena->reallocate(p, size) : realloc(p, size); }
+    static void arena_free(void* p) { if (!current_arena) free(p); }
+}
+
+#define STBI_MALLOC(size) librealsense::arena_malloc(size)
+#define STBI_REALLOC(p, size) librealsense::arena_realloc(p, size)
+#define STBI_FREE(p) librealsense::arena_free(p)
+#define STBI_ONLY_JPEG
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "../third-party/stb_image.h"
+
+namespace librealsense
+{
+    // Decodes MCUs [begin, end) of the current scan, as stbi__parse_entropy_coded_data does for a baseline image
+    static bool decode_mcus(stbi__jpeg* z, size_t begin, size_t end)
+    {
+        STBI_SIMD_ALIGN(short, data[64]);
+        if (z->scan_n == 1)
+        {
+            // Non-interleaved: every block is an MCU
+            int n = z->order[0];
+            auto& comp = z->img_comp[n];
+            size_t w = (comp.x + 7) >> 3;
+            for (size_t m = begin; m < end; m++)
+            {
+                int i = int(m % w), j = int(m / w);
+                if (!stbi__jpeg_decode_block(z, data, z->huff_dc + comp.hd, z->huff_ac + comp.ha, z->fast_ac[comp.ha], n, z->dequant[comp.tq]))
+                    return false;
+                z->idct_block_kernel(comp.data + comp.w2 * j * 8 + i * 8, comp.w2, data);
+            }
+            return true;
+        }
+
+        for (size_t m = begin; m < end; m++)
+        {
+            int i = int(m % z->img_mcu_x), j = int(m / z->img_mcu_x);
+            for (int k = 0; k < z->scan_n; k++)
+            {
+                int n = z->order[k];
+                auto& comp = z->img_comp[n];
+                for (int y = 0; y < comp.v; y++)
+                    for (int x = 0; x < comp.h; x++)
+                    {
+                        int x2 = (i * comp.h + x) * 8;
+                        int y2 = (j * comp.v + y) * 8;
+                        if (!stbi__jpeg_decode_block(z, data, z->huff_dc + comp.hd, z->huff_ac + comp.ha, z->fast_ac[comp.ha], n, z->dequant[comp.tq]))
+                            return false;
+                        z->idct_block_kernel(comp.data + comp.w2 * y2 + x2, comp.w2, data);
+                    }
+            }
+        }
+        return true;
+    }
+
+    // How a component is upsampled to the image size, as in stb_image's load_jpeg_image
+    struct resampler
+    {
+        resample_row_func resample;
+        int hs, vs;
+        int w_lores;
+    };
+
+    struct mjpeg_decoder::impl
+    {
+        stbi__context s;
+        stbi__jpeg z;
+        scratch_arena arena;
+
+        // Restart interval decoding: where each interval starts, followed by the end of the scan, and the state of
+        // the decoder working on each band of intervals
+        std::vector<const uint8_t*> intervals;
+        std::vector<stbi__jpeg> band_decoders;
+        std::vector<stbi__context> band_contexts;
+
+        resampler planes[4];
+        int decode_n;
+        bool is_rgb;
+        std::vector<uint8_t> band_lines;    // Line buffers of every band of rows: the upsampled components, then a RGBA row
+
+        std::shared_ptr<worker_pool> workers;
+        int max_threads;
+
+        bool decode_image();
+        bool decode_scan();
+        bool find_intervals(size_t count);
+        size_t scan_mcus() const;
+        void prepare_output(int n);
+        void convert_rows(rs2_format format, uint8_t* out, size_t first, size_t last, uint8_t* lines);
+    };
+
+    mjpeg_decoder::mjpeg_decoder() :
+        _impl(new impl())
+    {
+        memset(&_impl->z, 0, sizeof(_impl->z));
+        _impl->z.s = &_impl->s;
+        stbi__setup_jpeg(&_impl->z);
+        _impl->workers = worker_pool::get();
+        _impl->max_threads = 0;
+    }
+
+    mjpeg_decoder::~mjpeg_decoder() = default;
+
+    bool mjpeg_decoder::is_supported(rs2_format format)
+    {
+        switch (format)
+        {
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8:
+        case RS2_FORMAT_Y8:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool mjpeg_decoder::decode(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* out, int width, int height,
+                               int max_threads)
+    {
+        if (!is_supported(format) || !jpeg || size > size_t(INT32_MAX))
+            return false;
+
+        struct arena_scope
+        {
+            arena_scope(scratch_arena* arena) { arena->rewind(); current_arena = arena; }
+            ~arena_scope() { current_arena = nullptr; }
+        } scope(&_impl->arena);
+
+        _impl->max_threads = max_threads;
+        stbi__start_mem(&_impl->s, jpeg, int(size));
+        _impl->s.img_n = 0;
+        // The tables are kept from the previous image: frames that leave out their Huffman tables reuse them
+        if (!_impl->decode_image() || int(_impl->s.img_x) != width)
+            return false;
+
+        int n = format == RS2_FORMAT_Y8 ? 1 : 4;
+        _impl->prepare_output(n);
+
+        size_t const rows = std::min(size_t(_impl->s.img_y), size_t(height));
+        size_t const bands = _impl->workers->get_concurrency() * 4;
+        size_t const chunk = (rows + bands - 1) / bands;
+        size_t const line_size = _impl->decode_n * (width + 3) + 4 * width;
+        if (_impl->band_lines.size() < bands * line_size)
+            _impl->band_lines.resize(bands * line_size);
+        _impl->workers->parallel_for(rows, chunk, [&](size_t first, size_t last)
+        {
+            _impl->convert_rows(format, out, first, last, _impl->band_lines.data() + first / chunk * line_size);
+        }, max_threads);
+        return true;
+    }
+
+    // As stbi__decode_jpeg_image, with the scans decoded by decode_scan()
+    bool mjpeg_decoder::impl::decode_image()
+    {
+        for (int m = 0; m < 4; m++)
+        {
+            z.img_comp[m].raw_data = NULL;
+            z.img_comp[m].raw_coeff = NULL;
+        }
+        z.restart_interval = 0;
+        if (!stbi__decode_jpeg_header(&z, STBI__SCAN_load))
+            return false;
+        int m = stbi__get_marker(&z);
+        while (!stbi__EOI(m))
+        {
+            if (stbi__SOS(m))
+            {
+                if (!stbi__process_scan_header(&z) || !decode_scan())
+                    return false;
+                if (z.marker == STBI__MARKER_none)
+                    z.marker = stbi__skip_jpeg_junk_at_end(&z);
+                m = stbi__get_marker(&z);
+                if (STBI__RESTART(m))
+                    m = stbi__get_marker(&z);
+            }
+            else if (stbi__DNL(m))
+            {
+                int Ld = stbi__get16be(z.s);
+                stbi__uint32 NL = stbi__get16be(z.s);
+                if (Ld != 4 || NL != z.s->img_y)
+                    return false;
+                m = stbi__get_marker(&z);
+            }
+            else
+            {
+                // Like stb_image, a truncated image is decoded as far as it goes
+                if (!stbi__process_marker(&z, m))
+                    return true;
+                m = stbi__get_marker(&z);
+            }
+        }
+        if (z.progressive)
+            stbi__jpeg_finish(&z);
+        return true;
+    }
+
+    size_t mjpeg_decoder::impl::scan_mcus() const
+    {
+        if (z.scan_n == 1)
+        {
+            auto& comp = z.img_comp[z.order[0]];
+            return size_t((comp.x + 7) >> 3) * size_t((comp.y + 7) >> 3);
+        }
+        return size_t(z.img_mcu_x) * size_t(z.img_mcu_y);
+    }
+
+    // Finds the 'count' restart intervals of the scan starting at the current position, or returns false
+    bool mjpeg_decoder::impl::find_intervals(size_t count)
+    {
+        auto p = static_cast<const uint8_t*>(z.s->img_buffer);
+        auto end = static_cast<const uint8_t*>(z.s->img_buffer_end);
+        intervals.clear();
+        intervals.push_back(p);
+        while (p + 1 < end)
+        {
+            p = static_cast<const uint8_t*>(memchr(p, 0xFF, end - p - 1));
+            if (!p)
+            {
+                p = end;
+                break;
+            }
+            uint8_t marker = p[1];
+            if (marker == 0x00)
+                p += 2;                 // A stuffed 0xFF
+            else if (marker == 0xFF)
+                p += 1;                 // Fill byte
+            else if (STBI__RESTART(marker))
+            {
+                p += 2;
+                intervals.push_back(p);
+            }
+            else
+                break;                  // The end of the scan
+        }
+        intervals.push_back(std::min(p, end));
+        return intervals.size() == count + 1;
+    }
+
+    bool mjpeg_decoder::impl::decode_scan()
+    {
+        if (z.progressive || !z.restart_interval)
+            return stbi__parse_entropy_coded_data(&z) != 0;
+
+        size_t const mcus = scan_mcus();
+        size_t const interval = size_t(z.restart_interval);
+        size_t const count = (mcus + interval - 1) / interval;
+        if (count < 2 || workers->get_concurrency() < 2 || max_threads == 1 || !find_intervals(count))
+            return stbi__parse_entropy_coded_data(&z) != 0;
+
+        // Every interval starts byte-aligned with reset DC predictions: each band of intervals is decoded by a copy
+        // of the decoder, reading from its own context. The MCUs of different intervals write to different blocks.
+        size_t const bands = workers->get_concurrency() * 4;
+        size_t const chunk = (count + bands - 1) / bands;
+        size_t const used = (count + chunk - 1) / chunk;
+        if (band_decoders.size() < used)
+        {
+            band_decoders.resize(used);
+            band_contexts.resize(used);
+        }
+        std::atomic<bool> ok(true);
+        workers->parallel_for(count, chunk, [&](size_t first, size_t last)
+        {
+            auto& d = band_decoders[first / chunk];
+            auto& s = band_contexts[first / chunk];
+            s = *z.s;
+            d = z;
+            d.s = &s;
+            for (size_t i = first; i < last && ok; i++)
+            {
+                s.img_buffer = const_cast<stbi_uc*>(intervals[i]);
+                s.img_buffer_end = const_cast<stbi_uc*>(intervals[i + 1]);
+                stbi__jpeg_reset(&d);
+                if (!decode_mcus(&d, i * interval, std::min((i + 1) * interval, mcus)))
+                    ok = false;
+            }
+        }, max_threads);
+
+        // Continue with the marker that ends the scan
+        z.s->img_buffer = const_cast<stbi_uc*>(intervals.back());
+        z.marker = STBI__MARKER_none;
+        return ok;
+    }
+
+    void mjpeg_decoder::impl::prepare_output(int n)
+    {
+        is_rgb = s.img_n == 3 && (z.rgb == 3 || (z.app14_color_transform == 0 && !z.jfif));
+        decode_n = s.img_n == 3 && n < 3 && !is_rgb ? 1 : s.img_n;
+
+        for (int k = 0; k < decode_n; k++)
+        {
+            auto& r = planes[k];
+            r.hs = z.img_h_max / z.img_comp[k].h;
+            r.vs = z.img_v_max / z.img_comp[k].v;
+            r.w_lores = (s.img_x + r.hs - 1) / r.hs;
+            if (r.hs == 1 && r.vs == 1) r.resample = resample_row_1;
+            else if (r.hs == 1 && r.vs == 2) r.resample = stbi__resample_row_v_2;
+            else if (r.hs == 2 && r.vs == 1) r.resample = stbi__resample_row_h_2;
+            else if (r.hs == 2 && r.vs == 2) r.resample = z.resample_row_hv_2_kernel;
+            else r.resample = stbi__resample_row_generic;
+        }
+    }
+
+    // Writes rows [first, last) of the image, converted as stb_image's load_jpeg_image does. The rows stb_image
+    // upsamples from are found from the row number, rather than by stepping through the image from the top.
+    void mjpeg_decoder::impl::convert_rows(rs2_format format, uint8_t* out, size_t first, size_t last, uint8_t* lines)
+    {
+        int const w = int(s.img_x);
+        uint8_t* rgba = lines + decode_n * (w + 3);
+        stbi_uc* c[4] = { nullptr, nullptr, nullptr, nullptr };
+
+        for (size_t j = first; j < last; j++)
+        {
+            for (int k = 0; k < decode_n; k++)
+            {
+                auto& r = planes[k];
+                auto& comp = z.img_comp[k];
+                int steps = (r.vs >> 1) + int(j);
+                int ypos = steps / r.vs, ystep = steps % r.vs;
+                stbi_uc* line1 = comp.data + comp.w2 * std::min(ypos, comp.y - 1);
+                stbi_uc* line0 = comp.data + comp.w2 * std::max(0, std::min(ypos - 1, comp.y - 1));
+                bool y_bot = ystep >= (r.vs >> 1);
+                c[k] = r.resample(lines + k * (w + 3), y_bot ? line1 : line0, y_bot ? line0 : line1, r.w_lores, r.hs);
+            }
+
+            if (format == RS2_FORMAT_Y8)
+            {
+                uint8_t* dst = out + j * w;
+                if (is_rgb)
+                    for (int i = 0; i < w; i++)
+                        dst[i] = stbi__compute_y(c[0][i], c[1][i], c[2][i]);
+                else if (s.img_n == 4 && z.app14_color_transform == 0)
+                    for (int i = 0; i < w; i++)
+                    {
+                        stbi_uc m = c[3][i];
+                        dst[i] = stbi__compute_y(stbi__blinn_8x8(c[0][i], m), stbi__blinn_8x8(c[1][i], m), stbi__blinn_8x8(c[2][i], m));
+                    }
+                else if (s.img_n == 4 && z.app14_color_transform == 2)
+                    for (int i = 0; i < w; i++)
+                        dst[i] = stbi__blinn_8x8(255 - c[0][i], c[3][i]);
+                else
+                    memcpy(dst, c[0], w);
+                continue;
+            }
+
+            // RGBA8 and BGRA8 are written in place; RGB8 and BGR8 are packed from a RGBA row
+            bool const direct = format == RS2_FORMAT_RGBA8 || format == RS2_FORMAT_BGRA8;
+            uint8_t* dst = direct ? out + j * w * 4 : rgba;
+            if (s.img_n == 3 && !is_rgb)
+                z.YCbCr_to_RGB_kernel(dst, c[0], c[1], c[2], w, 4);
+            else if (s.img_n == 3)
+                for (int i = 0; i < w; i++)
+                {
+                    dst[i * 4 + 0] = c[0][i];
+                    dst[i * 4 + 1] = c[1][i];
+                    dst[i * 4 + 2] = c[2][i];
+                    dst[i * 4 + 3] = 255;
+                }
+            else if (s.img_n == 4 && z.app14_color_transform == 0)
+                for (int i = 0; i < w; i++)
+                {
+                    stbi_uc m = c[3][i];
+                    dst[i * 4 + 0] = stbi__blinn_8x8(c[0][i], m);
+                    dst[i * 4 + 1] = stbi__blinn_8x8(c[1][i], m);
+                    dst[i * 4 + 2] = stbi__blinn_8x8(c[2][i], m);
+                    dst[i * 4 + 3] = 255;
+                }
+            else if (s.img_n == 4)
+            {
+                z.YCbCr_to_RGB_kernel(dst, c[0], c[1], c[2], w, 4);
+                if (z.app14_color_transform == 2)
+                    for (int i = 0; i < w; i++)
+                    {
+                        stbi_uc m = c[3][i];
+                        dst[i * 4 + 0] = stbi__blinn_8x8(255 - dst[i * 4 + 0], m);
+                        dst[i * 4 + 1] = stbi__blinn_8x8(255 - dst[i * 4 + 1], m);
+                        dst[i * 4 + 2] = stbi__blinn_8x8(255 - dst[i * 4 + 2], m);
+                    }
+            }
+            else
+                for (int i = 0; i < w; i++)
+                {
+                    dst[i * 4 + 0] = dst[i * 4 + 1] = dst[i * 4 + 2] = c[0][i];
+                    dst[i * 4 + 3] = 255;
+                }
+
+            switch (format)
+            {
+            case RS2_FORMAT_BGRA8:
+                for (int i = 0; i < w; i++)
+                    std::swap(dst[i * 4 + 0], dst[i * 4 + 2]);
+                break;
+            case RS2_FORMAT_RGB8:
+            case RS2_FORMAT_BGR8:
+            {
+                int const r = format == RS2_FORMAT_RGB8 ? 0 : 2;
+                uint8_t* packed = out + j * w * 3;
+                for (int i = 0; i < w; i++)
+                {
+                    packed[i * 3 + 0] = rgba[i * 4 + r];
+                    packed[i * 3 + 1] = rgba[i * 4 + 1];
+                    packed[i * 3 + 2] = rgba[i * 4 + 2 - r];
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+}
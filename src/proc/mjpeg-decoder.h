@@ -0,0 +1,40 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+// Decodes MJPEG frames straight into the buffers of the converted frames
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace librealsense
+{
+    class worker_pool;
+
+    // Decodes JPEG images into RGB8, BGR8, RGBA8, BGRA8 or Y8 buffers, with no intermediate image. The decoder state
+    // (Huffman and quantization tables included) and all scratch buffers are kept from one image to the next, so a
+    // stream of same-sized images is decoded without allocating memory. Scans split by restart markers have their
+    // restart intervals decoded in parallel, and the color conversion is run in bands of rows.
+    class mjpeg_decoder
+    {
+    public:
+        mjpeg_decoder();
+        ~mjpeg_decoder();
+
+        static bool is_supported(rs2_format format);
+
+        // Decodes the 'size' bytes of 'jpeg' into 'out', 'width' x 'height' pixels in 'format'. An image narrower or
+        // wider than 'width' can't be decoded; rows past 'height' are dropped. Returns false if the image is corrupt
+        // or can't be decoded; 'out' may then be partly written. At most 'max_threads' threads of the shared pool work
+        // on the image at once (0 for no limit).
+        bool decode(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* out, int width, int height,
+                    int max_threads = 0);
+
+    private:
+        struct impl;
+        std::unique_ptr<impl> _impl;
+    };
+}
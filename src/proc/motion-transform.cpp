@@ -6,8 +6,13 @@
 #include "synthetic-stream.h"
 #include "motion-transform.h"
 #include "stream.h"
+#include "option.h"
+#include "simd-dispatch.h"
+#include "sse/sse-motion-transform.h"
+#include "neon/neon-motion-transform.h"
 #include <src/platform/hid-data.h>
 #include <src/core/frame-processor-callback.h>
+#include <src/core/frame-holder.h>
 
 
 namespace librealsense
@@ -78,6 +83,20 @@ namespace librealsense
         }
     };
 
+    static_assert( sizeof( rs2_motion_sample ) == 24, "rs2_motion_sample must be laid out the same on all platforms" );
+
+    void correct_motion_samples(float* x, float* y, float* z, const float3x3& m, const float3& bias,
+        size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            float const vx = x[i], vy = y[i], vz = z[i];
+            x[i] = m.x.x * vx + m.y.x * vy + m.z.x * vz - bias.x;
+            y[i] = m.x.y * vx + m.y.y * vy + m.z.y * vz - bias.y;
+            z[i] = m.x.z * vx + m.y.z * vy + m.z.z * vz - bias.z;
+        }
+    }
+
     motion_transform::motion_transform( rs2_format target_format,
                                         rs2_stream target_stream,
                                         std::shared_ptr< mm_calib_handler > mm_calib,
@@ -304,5 +323,141 @@ namespace librealsense
     {
         _converter->convert( dest, source );
     }
-}
 
+    motion_batch_transform::motion_batch_transform( rs2_stream target_stream,
+                                                    std::shared_ptr< mm_calib_handler > mm_calib,
+                                                    std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                                    std::shared_ptr< option > window,
+                                                    double gyro_scale_factor, bool high_accuracy )
+        : motion_transform( "Motion Batch Transform", RS2_FORMAT_MOTION_BATCH, target_stream, mm_calib, mm_correct_opt )
+        , _window( window )
+        , _sample_period( 0. )
+    {
+        static constexpr float gravity = 9.80665f;  // Standard Gravitation Acceleration
+        static constexpr double accelerator_scale_factor = 0.001 * gravity;
+
+        double const scale_factor
+            = target_stream == RS2_STREAM_ACCEL ? accelerator_scale_factor : deg2rad( gyro_scale_factor );
+        if( high_accuracy )
+            _converter = std::make_unique< converter_32_bit >( scale_factor );
+        else
+            _converter = std::make_unique< converter_16_bit >( scale_factor );
+
+        register_info( RS2_CAMERA_INFO_SIMD_LEVEL,
+                       get_string( select_simd_level( { simd_level::ssse3, simd_level::neon } ) ) );
+        configure_processing_callback();
+    }
+
+    void motion_batch_transform::configure_processing_callback()
+    {
+        auto process_callback = [&]( frame_holder && frame, synthetic_source_interface * source )
+        {
+            auto profile = frame->get_stream();
+            if( profile.get() != _source_stream_profile.get() )
+            {
+                // Samples of another stream configuration do not belong with the pending ones
+                _timestamps.clear();
+                _x.clear();
+                _y.clear();
+                _z.clear();
+                _source_stream_profile = profile;
+                _batch_profile = profile->clone();
+                _batch_profile->set_format( _target_format );
+                _sample_period = profile->get_framerate() ? 1000. / profile->get_framerate() : 0.;
+            }
+
+            float3 xyz;
+            uint8_t * dest[1] = { reinterpret_cast< uint8_t * >( &xyz ) };
+            process_function( dest, static_cast< const uint8_t * >( frame->get_frame_data() ), 0, 0, 0, 0 );
+
+            double const timestamp = frame->get_frame_timestamp();
+            _timestamps.push_back( timestamp );
+            _x.push_back( xyz.x );
+            _y.push_back( xyz.y );
+            _z.push_back( xyz.z );
+            _last = std::move( frame );
+
+            // Flush once the next sample would fall outside the window
+            double const window = _window ? _window->query() : 10.;
+            if( timestamp - _timestamps.front() + _sample_period >= window )
+                flush( source );
+        };
+
+        set_processing_callback( make_frame_processor_callback( std::move( process_callback ) ) );
+    }
+
+    void motion_batch_transform::process_function( uint8_t * const dest[], const uint8_t * source, int, int, int, int )
+    {
+        _converter->convert( dest, source );
+    }
+
+    // The widest SIMD kernel enabled, or none
+    struct motion_samples_kernel
+    {
+        void ( *samples )( float * x, float * y, float * z, const float3x3 & m, const float3 & bias,
+                           size_t begin, size_t end );
+        size_t step;  // samples corrected at a time
+    };
+
+    static motion_samples_kernel select_motion_samples_kernel()
+    {
+#if defined( __SSSE3__ )
+        if( simd_enabled( simd_level::ssse3 ) )
+            return { correct_motion_samples_sse, 4 };
+#elif defined( __ARM_NEON ) && defined( BUILD_WITH_NEON ) && ! defined( ANDROID )
+        if( simd_enabled( simd_level::neon ) )
+            return { correct_motion_samples_neon, 4 };
+#endif
+        return { nullptr, 0 };
+    }
+
+    void motion_batch_transform::correct_samples()
+    {
+        static const motion_samples_kernel simd = select_motion_samples_kernel();
+
+        // The alignment and calibration fold into a single matrix for the whole batch
+        float3x3 m = _imu2depth_cs_alignment_matrix;
+        float3 bias = { 0, 0, 0 };
+        if( _mm_correct_opt && _mm_correct_opt->query() > 0.f )
+        {
+            if( _target_stream == RS2_STREAM_ACCEL )
+            {
+                m = _accel_sensitivity * m;
+                bias = _accel_bias;
+            }
+            else if( _target_stream == RS2_STREAM_GYRO )
+            {
+                m = _gyro_sensitivity * m;
+                bias = _gyro_bias;
+            }
+        }
+
+        size_t const n = _timestamps.size();
+        size_t const simd_end = simd.step ? n / simd.step * simd.step : 0;
+        if( simd_end )
+            simd.samples( _x.data(), _y.data(), _z.data(), m, bias, 0, simd_end );
+        correct_motion_samples( _x.data(), _y.data(), _z.data(), m, bias, simd_end, n );
+    }
+
+    void motion_batch_transform::flush( synthetic_source_interface * source )
+    {
+        correct_samples();
+
+        size_t const n = _timestamps.size();
+        frame_holder batch = source->allocate_motion_frame( _batch_profile,
+                                                            _last.frame,
+                                                            RS2_EXTENSION_MOTION_FRAME,
+                                                            n * sizeof( rs2_motion_sample ) );
+        auto samples = reinterpret_cast< rs2_motion_sample * >( const_cast< uint8_t * >( batch->get_frame_data() ) );
+        for( size_t i = 0; i < n; ++i )
+            samples[i] = { _timestamps[i], _x[i], _y[i], _z[i], 0.f };
+
+        _timestamps.clear();
+        _x.clear();
+        _y.clear();
+        _z.clear();
+        _last.reset();
+
+        source->frame_ready( std::move( batch ) );
+    }
+}
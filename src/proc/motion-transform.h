@@ -3,12 +3,20 @@
 
 #pragma once
 #include "synthetic-stream.h"
+#include <src/float3.h>
 
 namespace librealsense
 {
     class enable_motion_correction;
     class mm_calib_handler;
     class functional_processing_block;
+    class option;
+
+    // Corrects samples [begin, end), held as separate x, y and z arrays, in place: v = m * v - bias, where m is the
+    // column-major product of the calibration and alignment matrices.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void correct_motion_samples(float* x, float* y, float* z, const float3x3& m, const float3& bias,
+        size_t begin, size_t end);
 
     class imu_to_librs_converter
     {
@@ -100,4 +108,32 @@ namespace librealsense
                              
         void process_function( uint8_t * const dest[], const uint8_t * source, int, int, int, int) override;
     };
+
+    // Packs the accel or gyro samples received over a time window into one RS2_FORMAT_MOTION_BATCH frame of
+    // rs2_motion_sample, each with the timestamp of its raw frame. The batch carries the metadata of its last sample,
+    // and is corrected in a single pass over all of its samples.
+    class motion_batch_transform : public motion_transform
+    {
+    public:
+        motion_batch_transform( rs2_stream target_stream,
+                                std::shared_ptr< mm_calib_handler > mm_calib,
+                                std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                std::shared_ptr< option > window,
+                                double gyro_scale_factor, bool high_accuracy );
+
+    protected:
+        void configure_processing_callback();
+        void process_function( uint8_t * const dest[], const uint8_t * source, int, int, int, int ) override;
+        // Corrects the pending samples and hands them over as one frame
+        void flush( synthetic_source_interface * source );
+        void correct_samples();
+
+        std::shared_ptr< option > _window;    // RS2_OPTION_MOTION_BATCH_WINDOW, in milliseconds
+        std::shared_ptr< stream_profile_interface > _source_stream_profile;
+        std::shared_ptr< stream_profile_interface > _batch_profile;
+        double _sample_period;                 // in milliseconds, from the frame rate of the source stream
+        std::vector< double > _timestamps;
+        std::vector< float > _x, _y, _z;
+        frame_holder _last;                    // the raw frame of the latest sample
+    };
 }
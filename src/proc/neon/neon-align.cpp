@@ -6,14 +6,10 @@
 #if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
 
 #include <arm_neon.h>
+#include "proc/worker-pool.h"
+
 namespace librealsense
 {
-    template <int N>
-    struct bytes
-    {
-        uint8_t b[N];
-    };
-
     static inline bool is_special_resolution(const rs2_intrinsics &depth, const rs2_intrinsics &to)
     {
         if ((depth.width == 640 && depth.height == 240 && to.width == 320 && to.height == 180) ||
@@ -62,13 +58,13 @@ namespace librealsense
     template <rs2_distortion dist>
     static inline void get_texture_map_neon(const uint16_t *depth,
                                             float depth_scale,
-                                            const unsigned int size,
+                                            size_t begin, size_t end,
                                             const float *pre_compute_x, const float *pre_compute_y,
                                             uint8_t *pixels_ptr_int,
                                             const rs2_intrinsics &to,
                                             const rs2_extrinsics &from_to_other)
     {
-        auto res = reinterpret_cast<int32_t *>(pixels_ptr_int);
+        auto res = reinterpret_cast<int32_t *>(pixels_ptr_int) + begin * 2;
 
         float32x4_t r[9];
         float32x4_t t[3];
@@ -93,7 +89,7 @@ namespace librealsense
         const auto ppy = vdupq_n_f32(to.ppy);
         const auto scale = vdupq_n_f32(depth_scale);
 
-        for (unsigned int i = 0; i < size; i += 8)
+        for (size_t i = begin; i < end; i += 8)
         {
             const auto x0 = vld1q_f32(pre_compute_x + i);
             const auto x1 = vld1q_f32(pre_compute_x + i + 4);
@@ -172,14 +168,33 @@ namespace librealsense
         }
     }
 
-    align_neon_helper::align_neon_helper(const rs2_intrinsics &from, float depth_scale)
+    align_neon_helper::align_neon_helper(const rs2_intrinsics &from, float depth_scale, std::shared_ptr<worker_pool> workers)
         : _depth(from),
           _depth_scale(depth_scale),
+          _workers(std::move(workers)),
           _pixel_top_left_int(from.width * from.height),
           _pixel_bottom_right_int(from.width * from.height)
     {
     }
 
+    template <rs2_distortion dist>
+    void align_neon_helper::get_texture_map(
+        int max_threads, const uint16_t *z_pixels, const std::vector<float> &pre_compute_map_x,
+        const std::vector<float> &pre_compute_map_y, std::vector<int2> &pixels,
+        const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
+    {
+        // The kernel works on groups of 8 pixels, in bands of groups
+        const size_t groups = (pixels.size() + 7) / 8;
+        const size_t bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(groups, (groups + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            get_texture_map_neon<dist>(
+                z_pixels, _depth_scale, begin * 8, end * 8,
+                pre_compute_map_x.data(), pre_compute_map_y.data(),
+                (uint8_t *)pixels.data(), to, from_to_other);
+        }, max_threads);
+    }
+
     void align_neon_helper::pre_compute_x_y_map_corners()
     {
         pre_compute_x_y_map(_pre_compute_map_x_top_left, _pre_compute_map_y_top_left, -0.5f);
@@ -219,79 +234,45 @@ namespace librealsense
     }
 
     void align_neon_helper::align_depth_to_other(
-        const uint16_t *z_pixels, uint16_t *dest, int bpp, const rs2_intrinsics &depth,
+        int max_threads, const uint16_t *z_pixels, uint16_t *dest, int bpp, const rs2_intrinsics &depth,
         const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
     {
         switch (to.model)
         {
         case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
-            align_depth_to_other_neon<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, dest, depth, to, from_to_other);
+            align_depth_to_other_neon<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(max_threads, z_pixels, dest, depth, to, from_to_other);
             break;
         default:
-            align_depth_to_other_neon(z_pixels, dest, depth, to, from_to_other);
+            align_depth_to_other_neon(max_threads, z_pixels, dest, depth, to, from_to_other);
             break;
         }
     }
 
-    inline void align_neon_helper::move_depth_to_other(
-        const uint16_t *z_pixels, uint16_t *dest, const rs2_intrinsics &to,
-        const std::vector<librealsense::int2> &pixel_top_left_int,
-        const std::vector<librealsense::int2> &pixel_bottom_right_int)
-    {
-        for (int y = 0; y < _depth.height; ++y)
-        {
-            for (int x = 0; x < _depth.width; ++x)
-            {
-                const auto depth_pixel_index = y * _depth.width + x;
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (z_pixels[depth_pixel_index])
-                {
-                    for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
-                    {
-                        if (other_y < 0 || other_y >= to.height)
-                            continue;
-
-                        const auto y_width = other_y * to.width;
-                        for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
-                        {
-                            if (other_x < 0 || other_x >= to.width)
-                                continue;
-                            const auto other_ind = y_width + other_x;
-
-                            dest[other_ind] = dest[other_ind] ? std::min(dest[other_ind], z_pixels[depth_pixel_index]) : z_pixels[depth_pixel_index];
-                        }
-                    }
-                }
-            }
-        }
-    }
-
     void align_neon_helper::align_other_to_depth(
-        const uint16_t *z_pixels, const uint8_t *source, uint8_t *dest,
-        int bpp, const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
+        int max_threads, const uint16_t *z_pixels, const uint8_t *source, uint8_t *dest,
+        rs2_format format, int bpp, const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
     {
         switch (to.model)
         {
         case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
         case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
-            align_other_to_depth_neon<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, source, dest, bpp, to, from_to_other);
+            align_other_to_depth_neon<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(max_threads, z_pixels, source, dest, format, bpp, to, from_to_other);
             break;
         default:
-            align_other_to_depth_neon(z_pixels, source, dest, bpp, to, from_to_other);
+            align_other_to_depth_neon(max_threads, z_pixels, source, dest, format, bpp, to, from_to_other);
             break;
         }
     }
 
     template <rs2_distortion dist>
     inline void align_neon_helper::align_depth_to_other_neon(
-        const uint16_t *z_pixels, uint16_t *dest, const rs2_intrinsics &depth,
+        int max_threads, const uint16_t *z_pixels, uint16_t *dest, const rs2_intrinsics &depth,
         const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
     {
         // Map the top-left corner of the depth pixel onto the other image
-        get_texture_map_neon<dist>(
-            z_pixels, _depth_scale, _depth.height * _depth.width,
-            _pre_compute_map_x_top_left.data(), _pre_compute_map_y_top_left.data(),
-            (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+        get_texture_map<dist>(
+            max_threads, z_pixels, _pre_compute_map_x_top_left, _pre_compute_map_y_top_left,
+            _pixel_top_left_int, to, from_to_other);
 
         float fov[2];
         rs2_fov(&depth, fov);
@@ -303,107 +284,43 @@ namespace librealsense
         if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
         {
             // Map the bottom-right corner of the depth pixel onto the other image
-            get_texture_map_neon<dist>(
-                z_pixels, _depth_scale, _depth.height * _depth.width,
-                _pre_compute_map_x_bottom_right.data(), _pre_compute_map_y_bottom_right.data(),
-                (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+            get_texture_map<dist>(
+                max_threads, z_pixels, _pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right,
+                _pixel_bottom_right_int, to, from_to_other);
 
-            move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
+            scatter_depth_to_other(*_workers, max_threads, dest, to, z_pixels, _depth,
+                _pixel_top_left_int.data(), _pixel_bottom_right_int.data());
         }
         else
         {
-            move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_top_left_int);
+            scatter_depth_to_other(*_workers, max_threads, dest, to, z_pixels, _depth,
+                _pixel_top_left_int.data(), _pixel_top_left_int.data());
         }
     }
 
     template <rs2_distortion dist>
     inline void align_neon_helper::align_other_to_depth_neon(
-        const uint16_t *z_pixels, const uint8_t *source, uint8_t *dest,
-        int bpp, const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
+        int max_threads, const uint16_t *z_pixels, const uint8_t *source, uint8_t *dest,
+        rs2_format format, int bpp, const rs2_intrinsics &to, const rs2_extrinsics &from_to_other)
     {
         // Map the top-left corner of the depth pixel onto the other image
-        get_texture_map_neon<dist>(
-            z_pixels, _depth_scale, _depth.height * _depth.width,
-            _pre_compute_map_x_top_left.data(), _pre_compute_map_y_top_left.data(),
-            (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+        get_texture_map<dist>(
+            max_threads, z_pixels, _pre_compute_map_x_top_left, _pre_compute_map_y_top_left,
+            _pixel_top_left_int, to, from_to_other);
 
         std::vector<int2> &bottom_right = _pixel_top_left_int;
         if (to.height < _depth.height && to.width < _depth.width)
         {
             // Map the bottom-right corner of the depth pixel onto the other image
-            get_texture_map_neon<dist>(
-                z_pixels, _depth_scale, _depth.height * _depth.width,
-                _pre_compute_map_x_bottom_right.data(), _pre_compute_map_y_bottom_right.data(),
-                (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+            get_texture_map<dist>(
+                max_threads, z_pixels, _pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right,
+                _pixel_bottom_right_int, to, from_to_other);
 
             bottom_right = _pixel_bottom_right_int;
         }
 
-        switch (bpp)
-        {
-        case 1:
-            move_other_to_depth(
-                z_pixels,
-                reinterpret_cast<const bytes<1> *>(source), reinterpret_cast<bytes<1> *>(dest),
-                to, _pixel_top_left_int, bottom_right);
-            break;
-        case 2:
-            move_other_to_depth(
-                z_pixels,
-                reinterpret_cast<const bytes<2> *>(source), reinterpret_cast<bytes<2> *>(dest),
-                to, _pixel_top_left_int, bottom_right);
-            break;
-        case 3:
-            move_other_to_depth(
-                z_pixels,
-                reinterpret_cast<const bytes<3> *>(source), reinterpret_cast<bytes<3> *>(dest),
-                to, _pixel_top_left_int, bottom_right);
-            break;
-        case 4:
-            move_other_to_depth(
-                z_pixels,
-                reinterpret_cast<const bytes<4> *>(source), reinterpret_cast<bytes<4> *>(dest),
-                to, _pixel_top_left_int, bottom_right);
-            break;
-        default:
-            break;
-        }
-    }
-
-    template <class T>
-    void align_neon_helper::move_other_to_depth(
-        const uint16_t *z_pixels, const T *source, T *dest,
-        const rs2_intrinsics &to,
-        const std::vector<librealsense::int2> &pixel_top_left_int,
-        const std::vector<librealsense::int2> &pixel_bottom_right_int)
-    {
-        // Iterate over the pixels of the depth image
-        for (int y = 0; y < _depth.height; ++y)
-        {
-            for (int x = 0; x < _depth.width; ++x)
-            {
-                const auto depth_pixel_index = y * _depth.width + x;
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (z_pixels[depth_pixel_index])
-                {
-                    for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
-                    {
-                        if (other_y < 0 || other_y >= to.height)
-                            continue;
-
-                        const auto y_width = other_y * to.width;
-                        for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
-                        {
-                            if (other_x < 0 || other_x >= to.width)
-                                continue;
-                            const auto other_ind = y_width + other_x;
-
-                            dest[depth_pixel_index] = source[other_ind];
-                        }
-                    }
-                }
-            }
-        }
+        gather_other_to_depth(*_workers, max_threads, dest, source, format, bpp, to, z_pixels, _depth,
+            _pixel_top_left_int.data(), bottom_right.data());
     }
 
     void align_neon::reset_cache(rs2_stream from, rs2_stream to)
@@ -429,11 +346,11 @@ namespace librealsense
 
         if (_neon_helper == nullptr)
         {
-            _neon_helper = std::make_shared<align_neon_helper>(z_intrin, z_scale);
+            _neon_helper = std::make_shared<align_neon_helper>(z_intrin, z_scale, _workers);
             _neon_helper->pre_compute_x_y_map_corners();
         }
         _neon_helper->align_depth_to_other(
-            z_pixels, reinterpret_cast<uint16_t *>(aligned_data), 2,
+            _max_threads, z_pixels, reinterpret_cast<uint16_t *>(aligned_data), 2,
             z_intrin, other_intrin, z_to_other);
     }
 
@@ -457,12 +374,12 @@ namespace librealsense
 
         if (_neon_helper == nullptr)
         {
-            _neon_helper = std::make_shared<align_neon_helper>(z_intrin, z_scale);
+            _neon_helper = std::make_shared<align_neon_helper>(z_intrin, z_scale, _workers);
             _neon_helper->pre_compute_x_y_map_corners();
         }
 
         _neon_helper->align_other_to_depth(
-            z_pixels, other_pixels, aligned_data, other.get_bytes_per_pixel(),
+            _max_threads, z_pixels, other_pixels, aligned_data, other_profile.format(), other.get_bytes_per_pixel(),
             other_intrin, z_to_other);
     }
 } // namespace librealsense
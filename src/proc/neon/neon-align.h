@@ -13,17 +13,17 @@ namespace librealsense
     class align_neon_helper
     {
     public:
-        align_neon_helper(const rs2_intrinsics& from, float depth_scale);
+        align_neon_helper(const rs2_intrinsics& from, float depth_scale, std::shared_ptr<worker_pool> workers);
 
-        inline void align_depth_to_other(const uint16_t* z_pixels,
+        inline void align_depth_to_other(int max_threads, const uint16_t* z_pixels,
             uint16_t* dest, int bpp,
             const rs2_intrinsics& depth,
             const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
 
-        inline void align_other_to_depth(const uint16_t* z_pixels,
+        inline void align_other_to_depth(int max_threads, const uint16_t* z_pixels,
             const uint8_t * source,
-            uint8_t* dest, int bpp, const rs2_intrinsics& to,
+            uint8_t* dest, rs2_format format, int bpp, const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
 
         void pre_compute_x_y_map_corners();
@@ -31,6 +31,7 @@ namespace librealsense
     private:
         const rs2_intrinsics _depth;
         float _depth_scale;
+        std::shared_ptr<worker_pool> _workers;
 
         std::vector<float> _pre_compute_map_x_top_left;
         std::vector<float> _pre_compute_map_y_top_left;
@@ -44,35 +45,34 @@ namespace librealsense
             std::vector<float>& pre_compute_map_y,
             float offset = 0);
 
+        // Maps the depth pixels onto the other image through the given map, in bands on the worker pool
+        template<rs2_distortion dist>
+        void get_texture_map(int max_threads, const uint16_t* z_pixels,
+            const std::vector<float>& pre_compute_map_x,
+            const std::vector<float>& pre_compute_map_y,
+            std::vector<int2>& pixels, const rs2_intrinsics& to,
+            const rs2_extrinsics& from_to_other);
+
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
-        inline void align_depth_to_other_neon(const uint16_t* z_pixels,
+        inline void align_depth_to_other_neon(int max_threads, const uint16_t* z_pixels,
             uint16_t* dest, const rs2_intrinsics& depth,
             const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
 
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
-        inline void align_other_to_depth_neon(const uint16_t* z_pixels,
+        inline void align_other_to_depth_neon(int max_threads, const uint16_t* z_pixels,
             const uint8_t * source,
-            uint8_t* dest, int bpp, const rs2_intrinsics& to,
+            uint8_t* dest, rs2_format format, int bpp, const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
-
-        inline void move_depth_to_other(const uint16_t* z_pixels,
-            uint16_t* dest, const rs2_intrinsics& to,
-            const std::vector<int2>& pixel_top_left_int,
-            const std::vector<int2>& pixel_bottom_right_int);
-
-        template<class T >
-        inline void move_other_to_depth(const uint16_t* z_pixels,
-            const T* source,
-            T* dest, const rs2_intrinsics& to,
-            const std::vector<int2>& pixel_top_left_int,
-            const std::vector<int2>& pixel_bottom_right_int);
     };
 
     class align_neon : public align
     {
     public:
-        align_neon(rs2_stream align_to) : align(align_to, "Align (NEON)") {}
+        align_neon(rs2_stream align_to) : align(align_to, "Align (NEON)")
+        {
+            update_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(simd_level::neon));
+        }
     protected:
         void reset_cache(rs2_stream from, rs2_stream to) override;
 
@@ -0,0 +1,29 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-colorizer.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    void colorize_depth_pixels_neon(uint8_t * rgb_data, const uint16_t * depth_data, const uint32_t * lut, size_t begin, size_t end)
+    {
+        uint32_t colors[16];
+        for (size_t i = begin; i < end; i += 16)
+        {
+            auto d = depth_data + i;
+            for (int k = 0; k < 16; k++)
+                colors[k] = lut[d[k]];
+
+            // Split the entries into their R, G, B and unused bytes, and store the first three interleaved
+            uint8x16x4_t rgbx = vld4q_u8(reinterpret_cast<const uint8_t *>(colors));
+            uint8x16x3_t rgb = { { rgbx.val[0], rgbx.val[1], rgbx.val[2] } };
+            vst3q_u8(rgb_data + i * 3, rgb);
+        }
+    }
+}
+
+#endif
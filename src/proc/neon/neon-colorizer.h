@@ -0,0 +1,18 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON version of colorize_depth_pixels() in colorizer.h, producing identical results. Pixels are colored 16 at
+    // a time, so the range must hold a multiple of 16.
+    void colorize_depth_pixels_neon(uint8_t * rgb_data, const uint16_t * depth_data, const uint32_t * lut, size_t begin, size_t end);
+#endif
+#endif
+}
@@ -0,0 +1,155 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-decimation-filter.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    static inline void sort2(uint16x8_t & a, uint16x8_t & b)
+    {
+        uint16x8_t t = vminq_u16(a, b);
+        b = vmaxq_u16(a, b);
+        a = t;
+    }
+
+    static inline void sort4(uint16x8_t * p)
+    {
+        sort2(p[0], p[1]); sort2(p[2], p[3]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]);
+        sort2(p[1], p[2]);
+    }
+
+    // R.W. Floyd's 25-comparator network. Only the lower half of the result is used, and the compiler drops the rest.
+    static inline void sort9(uint16x8_t * p)
+    {
+        sort2(p[0], p[3]); sort2(p[1], p[7]); sort2(p[2], p[5]); sort2(p[4], p[8]);
+        sort2(p[0], p[7]); sort2(p[2], p[4]); sort2(p[3], p[8]); sort2(p[5], p[6]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]); sort2(p[4], p[5]); sort2(p[7], p[8]);
+        sort2(p[1], p[4]); sort2(p[3], p[6]); sort2(p[5], p[7]);
+        sort2(p[0], p[1]); sort2(p[2], p[4]); sort2(p[3], p[5]); sort2(p[6], p[8]);
+        sort2(p[2], p[3]); sort2(p[4], p[5]); sort2(p[6], p[7]);
+        sort2(p[1], p[2]); sort2(p[3], p[4]); sort2(p[5], p[6]);
+    }
+
+    // The median of the non-zero values among p[0..n) in each lane, as picked by the scalar version: the lower of the
+    // middle two for even counts, and 0 when there are none
+    static inline uint16x8_t masked_median(uint16x8_t * p, int n)
+    {
+        const uint16x8_t zero = vdupq_n_u16(0);
+
+        uint16x8_t count = vdupq_n_u16(uint16_t(n));
+        for (int i = 0; i < n; i++)
+        {
+            uint16x8_t invalid = vceqq_u16(p[i], zero);
+            count = vaddq_u16(count, invalid);
+            // Zeros become the largest value, so the valid ones are sorted first
+            p[i] = vorrq_u16(p[i], invalid);
+        }
+
+        if (n == 4)
+            sort4(p);
+        else
+            sort9(p);
+
+        // The median of 'count' values is the ((count - 1) / 2)-th smallest
+        uint16x8_t res = p[0];
+        for (int i = 1; 2 * i < n; i++)
+            res = vbslq_u16(vcgtq_u16(count, vdupq_n_u16(uint16_t(2 * i))), p[i], res);
+        return vbicq_u16(res, vceqq_u16(count, zero));
+    }
+
+    void decimate_depth_median_neon(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        uint16x8_t p[9];
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            auto patch = in + u * scale;
+            if (scale == 2)
+            {
+                for (size_t r = 0; r < 2; r++)
+                {
+                    uint16x8x2_t cols = vld2q_u16(patch + r * width_in);
+                    p[2 * r] = cols.val[0];
+                    p[2 * r + 1] = cols.val[1];
+                }
+                vst1q_u16(out + u, masked_median(p, 4));
+            }
+            else
+            {
+                for (size_t r = 0; r < 3; r++)
+                {
+                    uint16x8x3_t cols = vld3q_u16(patch + r * width_in);
+                    p[3 * r] = cols.val[0];
+                    p[3 * r + 1] = cols.val[1];
+                    p[3 * r + 2] = cols.val[2];
+                }
+                vst1q_u16(out + u, masked_median(p, 9));
+            }
+        }
+    }
+
+    void decimate_depth_mean_neon(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        const uint16x8_t zero = vdupq_n_u16(0);
+        const uint32x4_t one = vdupq_n_u32(1);
+
+        // Per input column of the 8 patches
+        uint32_t col_sums[64];
+        uint16_t col_zeros[64];
+
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            auto patch = in + u * scale;
+
+            // Add up the 'scale' rows of each column. Zeros don't change the sum, they are only counted.
+            for (size_t c = 0; c < 8 * scale; c += 8)
+            {
+                uint32x4_t lo = vdupq_n_u32(0), hi = vdupq_n_u32(0);
+                uint16x8_t zeros = zero;
+                for (size_t r = 0; r < scale; r++)
+                {
+                    uint16x8_t p = vld1q_u16(patch + r * width_in + c);
+                    lo = vaddw_u16(lo, vget_low_u16(p));
+                    hi = vaddw_u16(hi, vget_high_u16(p));
+                    zeros = vsubq_u16(zeros, vceqq_u16(p, zero));
+                }
+                vst1q_u32(col_sums + c, lo);
+                vst1q_u32(col_sums + c + 4, hi);
+                vst1q_u16(col_zeros + c, zeros);
+            }
+
+            // Then the columns of each patch
+            uint32_t sums[8], counts[8];
+            for (size_t j = 0; j < 8; j++)
+            {
+                uint32_t sum = 0;
+                uint32_t count = uint32_t(scale * scale);
+                for (size_t k = j * scale; k < (j + 1) * scale; k++)
+                {
+                    sum += col_sums[k];
+                    count -= col_zeros[k];
+                }
+                sums[j] = sum;
+                counts[j] = count;
+            }
+
+            // The sums are below 2^22 and the counts at most 64, so both are exact as floats. Their quotient keeps
+            // at least 8 fractional bits, finer than its distance of 1/count or more from the next integer, so it is
+            // truncated to the same integer as the integer division. Empty patches are divided by 1 instead of 0.
+            uint16x4_t res[2];
+            for (int h = 0; h < 2; h++)
+            {
+                uint32x4_t count = vmaxq_u32(vld1q_u32(counts + 4 * h), one);
+                float32x4_t mean = vdivq_f32(vcvtq_f32_u32(vld1q_u32(sums + 4 * h)), vcvtq_f32_u32(count));
+                res[h] = vmovn_u32(vcvtq_u32_f32(mean));
+            }
+            vst1q_u16(out + u, vcombine_u16(res[0], res[1]));
+        }
+    }
+}
+
+#endif
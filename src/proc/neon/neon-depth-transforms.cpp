@@ -0,0 +1,62 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-depth-transforms.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    void threshold_depth_pixels_neon(const uint16_t * in, uint16_t * out, float units, float min, float max,
+                                     size_t begin, size_t end)
+    {
+        const float32x4_t u = vdupq_n_f32(units);
+        const float32x4_t lo_dist = vdupq_n_f32(min);
+        const float32x4_t hi_dist = vdupq_n_f32(max);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            const uint16x8_t z = vld1q_u16(in + i);
+            const float32x4_t lo = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(z))), u);
+            const float32x4_t hi = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(z))), u);
+            const uint32x4_t keep_lo = vandq_u32(vcgeq_f32(lo, lo_dist), vcleq_f32(lo, hi_dist));
+            const uint32x4_t keep_hi = vandq_u32(vcgeq_f32(hi, lo_dist), vcleq_f32(hi, hi_dist));
+            const uint16x8_t keep = vcombine_u16(vmovn_u32(keep_lo), vmovn_u32(keep_hi));
+            vst1q_u16(out + i, vandq_u16(z, keep));
+        }
+    }
+
+    void depth_to_meters_pixels_neon(const uint16_t * in, float * out, float units, size_t begin, size_t end)
+    {
+        const float32x4_t u = vdupq_n_f32(units);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            const uint16x8_t z = vld1q_u16(in + i);
+            vst1q_f32(out + i, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(z))), u));
+            vst1q_f32(out + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(z))), u));
+        }
+    }
+
+    // factor / d rounded and converted as static_cast<uint16_t> does on ARM, keeping the low 16 bits of its unsigned
+    // 32-bit conversion, where d is a normal number; 0 elsewhere
+    static inline uint16x4_t to_depth(float32x4_t d, float32x4_t factor)
+    {
+        // Normal numbers have an exponent that is neither all zeros nor all ones
+        const uint32x4_t abs_bits = vandq_u32(vreinterpretq_u32_f32(d), vdupq_n_u32(0x7FFFFFFF));
+        const uint32x4_t normal = vandq_u32(vcgtq_u32(abs_bits, vdupq_n_u32(0x007FFFFF)),
+                                            vcltq_u32(abs_bits, vdupq_n_u32(0x7F800000)));
+        const uint32x4_t z = vcvtq_u32_f32(vaddq_f32(vdivq_f32(factor, d), vdupq_n_f32(0.5f)));
+        return vmovn_u32(vandq_u32(z, normal));
+    }
+
+    void disparity_to_depth_pixels_neon(const float * in, uint16_t * out, float d2d_convert_factor,
+                                        size_t begin, size_t end)
+    {
+        const float32x4_t factor = vdupq_n_f32(d2d_convert_factor);
+        for (size_t i = begin; i < end; i += 8)
+            vst1q_u16(out + i, vcombine_u16(to_depth(vld1q_f32(in + i), factor), to_depth(vld1q_f32(in + i + 4), factor)));
+    }
+}
+
+#endif
@@ -0,0 +1,23 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON versions of threshold_depth_pixels() in threshold.h, depth_to_meters_pixels() in units-transform.h and
+    // disparity_to_depth_pixels() in disparity-transform.h, producing identical results. They convert 8 pixels at a
+    // time: the range must hold a multiple of 8.
+    void threshold_depth_pixels_neon(const uint16_t * in, uint16_t * out, float units, float min, float max,
+                                     size_t begin, size_t end);
+    void depth_to_meters_pixels_neon(const uint16_t * in, float * out, float units, size_t begin, size_t end);
+    void disparity_to_depth_pixels_neon(const float * in, uint16_t * out, float d2d_convert_factor,
+                                        size_t begin, size_t end);
+#endif
+#endif
+}
@@ -0,0 +1,64 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-hdr-merge.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    static inline uint16x8_t load(const uint16_t * p)
+    {
+        return vld1q_u16(p);
+    }
+
+    // 8 IR bytes, widened to 16 bits
+    static inline uint16x8_t load(const uint8_t * p)
+    {
+        return vmovl_u8(vld1_u8(p));
+    }
+
+    // The depth of the first frame where it is valid and non-zero: 'a' and 'b' already hold 0 where it is not valid
+    static inline uint16x8_t merge(uint16x8_t a, uint16x8_t b)
+    {
+        return vorrq_u16(a, vandq_u16(vceqq_u16(a, vdupq_n_u16(0)), b));
+    }
+
+    void hdr_merge_depth_pixels_neon(const uint16_t * d0, const uint16_t * d1, uint16_t * out, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 8)
+            vst1q_u16(out + i, merge(load(d0 + i), load(d1 + i)));
+    }
+
+    template<class T>
+    static inline void merge_ir(const uint16_t * d0, const uint16_t * d1, const T * ir0, const T * ir1,
+                                int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        const uint16x8_t lo = vdupq_n_u16(uint16_t(ir_min));
+        const uint16x8_t hi = vdupq_n_u16(uint16_t(ir_max));
+        for (size_t i = begin; i < end; i += 8)
+        {
+            uint16x8_t v0 = load(ir0 + i);
+            uint16x8_t v1 = load(ir1 + i);
+            uint16x8_t a = vandq_u16(load(d0 + i), vandq_u16(vcgtq_u16(v0, lo), vcltq_u16(v0, hi)));
+            uint16x8_t b = vandq_u16(load(d1 + i), vandq_u16(vcgtq_u16(v1, lo), vcltq_u16(v1, hi)));
+            vst1q_u16(out + i, merge(a, b));
+        }
+    }
+
+    void hdr_merge_y8_pixels_neon(const uint16_t * d0, const uint16_t * d1, const uint8_t * ir0, const uint8_t * ir1,
+                                  int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+
+    void hdr_merge_y16_pixels_neon(const uint16_t * d0, const uint16_t * d1, const uint16_t * ir0, const uint16_t * ir1,
+                                   int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+}
+
+#endif
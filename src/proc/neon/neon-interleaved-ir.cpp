@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-interleaved-ir.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    // x << 6 | x >> 4, truncated to 16 bits: scales 10-bit values up to 16 bits
+    static inline uint16x8_t scale_to_16_bits(uint16x8_t x)
+    {
+        return vorrq_u16(vshlq_n_u16(x, 6), vshrq_n_u16(x, 4));
+    }
+
+    void split_y8i_pixels_neon(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16x2_t p = vld2q_u8(source + i * 2);
+            vst1q_u8(left + i, p.val[0]);
+            vst1q_u8(right + i, p.val[1]);
+        }
+    }
+
+    void split_y8i_mipi_pixels_neon(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16x2_t p = vld2q_u8(source + i * 2);
+            // The left bytes of each pair of pixels are swapped
+            vst1q_u8(left + i, vrev16q_u8(p.val[0]));
+            vst1q_u8(right + i, p.val[1]);
+        }
+    }
+
+    // b0, b1 and b2 are the bytes of 8 Y12I pixels. The right value is in the low bits of the first two, and the left
+    // value in the high bits of the last two.
+    static inline void store_y12(uint8x8_t b0, uint8x8_t b1, uint8x8_t b2, uint16_t * left, uint16_t * right)
+    {
+        uint16x8_t r = vorrq_u16(vshll_n_u8(vand_u8(b1, vdup_n_u8(0x0F)), 8), vmovl_u8(b0));
+        uint16x8_t l = vorrq_u16(vshll_n_u8(b2, 4), vmovl_u8(vshr_n_u8(b1, 4)));
+        vst1q_u16(left, scale_to_16_bits(l));
+        vst1q_u16(right, scale_to_16_bits(r));
+    }
+
+    void split_y12i_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16x3_t p = vld3q_u8(source + i * 3);
+            store_y12(vget_low_u8(p.val[0]), vget_low_u8(p.val[1]), vget_low_u8(p.val[2]), left + i, right + i);
+            store_y12(vget_high_u8(p.val[0]), vget_high_u8(p.val[1]), vget_high_u8(p.val[2]), left + i + 8, right + i + 8);
+        }
+    }
+
+    void split_y12i_mipi_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        // As Y12I, with a padding byte after each pixel
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16x4_t p = vld4q_u8(source + i * 4);
+            store_y12(vget_low_u8(p.val[0]), vget_low_u8(p.val[1]), vget_low_u8(p.val[2]), left + i, right + i);
+            store_y12(vget_high_u8(p.val[0]), vget_high_u8(p.val[1]), vget_high_u8(p.val[2]), left + i + 8, right + i + 8);
+        }
+    }
+
+    void split_y16i_10msb_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        auto in = reinterpret_cast<const uint16_t *>(source);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            uint16x8x2_t p = vld2q_u16(in + i * 2);
+            vst1q_u16(left + i, scale_to_16_bits(p.val[0]));
+            vst1q_u16(right + i, scale_to_16_bits(p.val[1]));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,22 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON versions of the split_*_pixels() functions of the interleaved IR converters, producing identical results.
+    // They split 16 pixels at a time: the range must hold a multiple of 16.
+    void split_y8i_pixels_neon(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end);
+    void split_y8i_mipi_pixels_neon(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end);
+    void split_y12i_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+    void split_y12i_mipi_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+    void split_y16i_10msb_pixels_neon(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+#endif
+#endif
+}
@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-motion-transform.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    // One output axis of 4 samples: row . v - bias, added up in the order of the scalar version
+    static inline float32x4_t correct_axis(float32x4_t vx, float32x4_t vy, float32x4_t vz,
+                                           float mx, float my, float mz, float bias)
+    {
+        float32x4_t r = vmulq_n_f32(vx, mx);
+        r = vaddq_f32(r, vmulq_n_f32(vy, my));
+        r = vaddq_f32(r, vmulq_n_f32(vz, mz));
+        return vsubq_f32(r, vdupq_n_f32(bias));
+    }
+
+    void correct_motion_samples_neon(float * x, float * y, float * z, const float3x3 & m, const float3 & bias,
+                                     size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 4)
+        {
+            const float32x4_t vx = vld1q_f32(x + i);
+            const float32x4_t vy = vld1q_f32(y + i);
+            const float32x4_t vz = vld1q_f32(z + i);
+            vst1q_f32(x + i, correct_axis(vx, vy, vz, m.x.x, m.y.x, m.z.x, bias.x));
+            vst1q_f32(y + i, correct_axis(vx, vy, vz, m.x.y, m.y.y, m.z.y, bias.y));
+            vst1q_f32(z + i, correct_axis(vx, vy, vz, m.x.z, m.y.z, m.z.z, bias.z));
+        }
+    }
+}
+
+#endif
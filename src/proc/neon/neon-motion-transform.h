@@ -0,0 +1,19 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <src/float3.h>
+#include <cstddef>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON version of correct_motion_samples() in motion-transform.h. It corrects 4 samples at a time: the range must
+    // hold a multiple of 4.
+    void correct_motion_samples_neon(float * x, float * y, float * z, const float3x3 & m, const float3 & bias,
+                                     size_t begin, size_t end);
+#endif
+#endif
+}
@@ -4,6 +4,7 @@
 #include <librealsense2/rs.hpp>
 
 #include "neon-pointcloud.h"
+#include "../simd-dispatch.h"
 
 #include <iostream>
 
@@ -83,80 +84,57 @@ namespace librealsense
         *distorted_y = vaddq_f32(y_f, vfmaq_f32(vfmaq_f32(vmulq_f32(c[2], r2), two, vmulq_f32(c[3], vmulq_f32(x, y))), two, vmulq_f32(c[2], vmulq_f32(y, y))));
     }
 
-    pointcloud_neon::pointcloud_neon() : pointcloud("Pointcloud (NEON)") {}
-
-    void pointcloud_neon::preprocess()
+    void deproject_depth_pixels_neon(float3 *points, const uint16_t *depth, const float *rays_x, const float *rays_y,
+                                     size_t begin, size_t end, float depth_scale)
     {
-        _pre_compute_map_x.resize(_depth_intrinsics->width * _depth_intrinsics->height);
-        _pre_compute_map_y.resize(_depth_intrinsics->width * _depth_intrinsics->height);
+        const auto scale = vdupq_n_f32(depth_scale);
 
-        for (int h = 0; h < _depth_intrinsics->height; ++h)
+        for (size_t i = begin; i < end; i += 8)
         {
-            for (int w = 0; w < _depth_intrinsics->width; ++w)
-            {
-                const float pixel[] = {(float)w, (float)h};
-
-                float x = (pixel[0] - _depth_intrinsics->ppx) / _depth_intrinsics->fx;
-                float y = (pixel[1] - _depth_intrinsics->ppy) / _depth_intrinsics->fy;
-
-                if (_depth_intrinsics->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-                {
-                    const float r2 = x * x + y * y;
-                    const float f = 1.0f + _depth_intrinsics->coeffs[0] * r2 + _depth_intrinsics->coeffs[1] * r2 * r2 + _depth_intrinsics->coeffs[4] * r2 * r2 * r2;
-                    const float ux = x * f + 2.0f * _depth_intrinsics->coeffs[2] * x * y + _depth_intrinsics->coeffs[3] * (r2 + 2.0f * x * x);
-                    const float uy = y * f + 2.0f * _depth_intrinsics->coeffs[3] * x * y + _depth_intrinsics->coeffs[2] * (r2 + 2.0f * y * y);
-                    x = ux;
-                    y = uy;
-                }
-
-                _pre_compute_map_x[h * _depth_intrinsics->width + w] = x;
-                _pre_compute_map_y[h * _depth_intrinsics->width + w] = y;
-            }
-        }
-    }
+            const auto x0 = vld1q_f32(rays_x + i);
+            const auto x1 = vld1q_f32(rays_x + i + 4);
 
-    const float3 *pointcloud_neon::depth_to_points(rs2::points output,
-                                                   const rs2_intrinsics &depth_intrinsics,
-                                                   const rs2::depth_frame &depth_frame)
-    {
-        auto depth_image = (const uint16_t *)depth_frame.get_data();
-
-        float *pre_compute_x = _pre_compute_map_x.data();
-        float *pre_compute_y = _pre_compute_map_y.data();
+            const auto y0 = vld1q_f32(rays_y + i);
+            const auto y1 = vld1q_f32(rays_y + i + 4);
 
-        const uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
-
-        auto points = (float *)output.get_vertices();
-        const auto scale = vdupq_n_f32(depth_frame.get_units());
-
-        for (unsigned int i = 0; i < size; i += 8)
-        {
-            const auto x0 = vld1q_f32(pre_compute_x + i);
-            const auto x1 = vld1q_f32(pre_compute_x + i + 4);
-
-            const auto y0 = vld1q_f32(pre_compute_y + i);
-            const auto y1 = vld1q_f32(pre_compute_y + i + 4);
-
-            const auto d = vld1q_u16(depth_image + i);
-            const auto depth0 = vmulq_f32(vcvtq_f32_s32((int32x4_t)vmovl_u16(vget_low_u16(d))), scale);
-            const auto depth1 = vmulq_f32(vcvtq_f32_s32((int32x4_t)vmovl_u16(vget_high_u16(d))), scale);
+            const auto d = vld1q_u16(depth + i);
+            const auto depth0 = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(d))), scale);
+            const auto depth1 = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(d))), scale);
 
             // calculate 3D points
+            auto point = reinterpret_cast<float *>(points + i);
             float32x4x3_t xyz0;
             xyz0.val[0] = vmulq_f32(depth0, x0);
             xyz0.val[1] = vmulq_f32(depth0, y0);
             xyz0.val[2] = depth0;
-            vst3q_f32(&points[0], xyz0);
+            vst3q_f32(&point[0], xyz0);
 
             float32x4x3_t xyz1;
             xyz1.val[0] = vmulq_f32(depth1, x1);
             xyz1.val[1] = vmulq_f32(depth1, y1);
             xyz1.val[2] = depth1;
-            vst3q_f32(&points[12], xyz1);
-
-            points += 24;
+            vst3q_f32(&point[12], xyz1);
         }
-        return (float3 *)output.get_vertices();
+    }
+
+    pointcloud_neon::pointcloud_neon() : pointcloud("Pointcloud (NEON)")
+    {
+        update_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(simd_level::neon));
+    }
+
+    const float3 *pointcloud_neon::depth_to_points(rs2::points output,
+                                                   const rs2_intrinsics &depth_intrinsics,
+                                                   const rs2::depth_frame &depth_frame)
+    {
+        auto points = (float3 *)output.get_vertices();
+        auto depth = (const uint16_t *)depth_frame.get_data();
+        auto depth_scale = depth_frame.get_units();
+        const size_t size = size_t(depth_intrinsics.height) * depth_intrinsics.width;
+        const size_t done = size / 8 * 8;
+
+        deproject_depth_pixels_neon(points, depth, _pre_compute_map_x.data(), _pre_compute_map_y.data(), 0, done, depth_scale);
+        deproject_depth_pixels(points, depth, _pre_compute_map_x.data(), _pre_compute_map_y.data(), done, size, depth_scale);
+        return points;
     }
 
     template <rs2_distortion dist>
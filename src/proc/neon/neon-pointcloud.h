@@ -7,12 +7,16 @@
 namespace librealsense
 {
 #if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+    // NEON version of deproject_depth_pixels() in pointcloud.h, producing identical results. Pixels are deprojected
+    // 8 at a time, so the range must hold a multiple of 8.
+    void deproject_depth_pixels_neon(float3 * points, const uint16_t * depth, const float * rays_x, const float * rays_y,
+                                     size_t begin, size_t end, float depth_scale);
+
     class pointcloud_neon : public pointcloud
     {
     public:
         pointcloud_neon();
 
-        void preprocess() override;
         const float3 * depth_to_points(
             rs2::points output,
             const rs2_intrinsics &depth_intrinsics,
@@ -35,11 +39,6 @@ namespace librealsense
             const rs2_intrinsics & other_intrinsics,
             const rs2_extrinsics & extr,
             float2 * pixels_ptr);
-
-        std::vector<float> _pre_compute_map_x;
-        std::vector<float> _pre_compute_map_y;
-
-        void pre_compute_x_y_map();
     };
 #endif
 }
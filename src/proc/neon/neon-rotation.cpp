@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-rotation.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    // Transposes the 8x8 bytes of r in place
+    static inline void transpose_8x8_bytes(uint8x8_t r[8])
+    {
+        // Transposing 2x2 blocks of bytes, then of pairs of bytes, then of 4 bytes
+        uint8x8x2_t t0 = vtrn_u8(r[0], r[1]);
+        uint8x8x2_t t1 = vtrn_u8(r[2], r[3]);
+        uint8x8x2_t t2 = vtrn_u8(r[4], r[5]);
+        uint8x8x2_t t3 = vtrn_u8(r[6], r[7]);
+        uint16x4x2_t u0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+        uint16x4x2_t u1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+        uint16x4x2_t u2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+        uint16x4x2_t u3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+        // v[i] holds rows i and i + 4 of the result
+        uint32x2x2_t v[4] = {
+            vtrn_u32(vreinterpret_u32_u16(u0.val[0]), vreinterpret_u32_u16(u2.val[0])),
+            vtrn_u32(vreinterpret_u32_u16(u1.val[0]), vreinterpret_u32_u16(u3.val[0])),
+            vtrn_u32(vreinterpret_u32_u16(u0.val[1]), vreinterpret_u32_u16(u2.val[1])),
+            vtrn_u32(vreinterpret_u32_u16(u1.val[1]), vreinterpret_u32_u16(u3.val[1])),
+        };
+        for (int i = 0; i < 4; ++i)
+        {
+            r[i] = vreinterpret_u8_u32(v[i].val[0]);
+            r[i + 4] = vreinterpret_u8_u32(v[i].val[1]);
+        }
+    }
+
+    void transpose_8x8_u8_neon(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        uint8x8_t r[8];
+        for (int i = 0; i < 8; ++i)
+            r[i] = vld1_u8(src + i * src_stride);
+        transpose_8x8_bytes(r);
+        for (int i = 0; i < 8; ++i)
+            vst1_u8(dst + i * dst_stride, r[i]);
+    }
+
+    void transpose_8x8_u24_neon(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        // The rows are split into planes of their first, second and third bytes, each transposed like bytes
+        uint8x8_t planes[3][8];
+        for (int i = 0; i < 8; ++i)
+        {
+            uint8x8x3_t p = vld3_u8(src + i * src_stride);
+            for (int k = 0; k < 3; ++k)
+                planes[k][i] = p.val[k];
+        }
+        for (int k = 0; k < 3; ++k)
+            transpose_8x8_bytes(planes[k]);
+        for (int i = 0; i < 8; ++i)
+        {
+            uint8x8x3_t p;
+            for (int k = 0; k < 3; ++k)
+                p.val[k] = planes[k][i];
+            vst3_u8(dst + i * dst_stride, p);
+        }
+    }
+
+    static inline uint16x4_t load_u16(const uint8_t * p)
+    {
+        return vld1_u16(reinterpret_cast<const uint16_t *>(p));
+    }
+
+    void transpose_8x8_u16_neon(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        // Four 4x4 blocks, each transposed into the place of its mirror
+        for (int bi = 0; bi < 2; ++bi)
+            for (int bj = 0; bj < 2; ++bj)
+            {
+                const uint8_t * s = src + 4 * bi * src_stride + 8 * bj;
+                uint8_t * d = dst + 4 * bj * dst_stride + 8 * bi;
+                uint16x4x2_t t0 = vtrn_u16(load_u16(s), load_u16(s + src_stride));
+                uint16x4x2_t t1 = vtrn_u16(load_u16(s + 2 * src_stride), load_u16(s + 3 * src_stride));
+                uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(t0.val[0]), vreinterpret_u32_u16(t1.val[0]));
+                uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(t0.val[1]), vreinterpret_u32_u16(t1.val[1]));
+                vst1_u16(reinterpret_cast<uint16_t *>(d), vreinterpret_u16_u32(v0.val[0]));
+                vst1_u16(reinterpret_cast<uint16_t *>(d + dst_stride), vreinterpret_u16_u32(v1.val[0]));
+                vst1_u16(reinterpret_cast<uint16_t *>(d + 2 * dst_stride), vreinterpret_u16_u32(v0.val[1]));
+                vst1_u16(reinterpret_cast<uint16_t *>(d + 3 * dst_stride), vreinterpret_u16_u32(v1.val[1]));
+            }
+    }
+
+    static inline uint32x4_t load_u32(const uint8_t * p)
+    {
+        return vld1q_u32(reinterpret_cast<const uint32_t *>(p));
+    }
+
+    void transpose_8x8_u32_neon(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        for (int bi = 0; bi < 2; ++bi)
+            for (int bj = 0; bj < 2; ++bj)
+            {
+                const uint8_t * s = src + 4 * bi * src_stride + 16 * bj;
+                uint8_t * d = dst + 4 * bj * dst_stride + 16 * bi;
+                uint32x4x2_t t0 = vtrnq_u32(load_u32(s), load_u32(s + src_stride));
+                uint32x4x2_t t1 = vtrnq_u32(load_u32(s + 2 * src_stride), load_u32(s + 3 * src_stride));
+                vst1q_u32(reinterpret_cast<uint32_t *>(d), vcombine_u32(vget_low_u32(t0.val[0]), vget_low_u32(t1.val[0])));
+                vst1q_u32(reinterpret_cast<uint32_t *>(d + dst_stride), vcombine_u32(vget_low_u32(t0.val[1]), vget_low_u32(t1.val[1])));
+                vst1q_u32(reinterpret_cast<uint32_t *>(d + 2 * dst_stride), vcombine_u32(vget_high_u32(t0.val[0]), vget_high_u32(t1.val[0])));
+                vst1q_u32(reinterpret_cast<uint32_t *>(d + 3 * dst_stride), vcombine_u32(vget_high_u32(t0.val[1]), vget_high_u32(t1.val[1])));
+            }
+    }
+}
+
+#endif
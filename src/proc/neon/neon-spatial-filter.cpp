@@ -0,0 +1,352 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-spatial-filter.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+#include <vector>
+
+namespace librealsense
+{
+    namespace
+    {
+        inline void transpose_8x8(uint16x8_t r[8])
+        {
+            uint16x8x2_t t01 = vtrnq_u16(r[0], r[1]);
+            uint16x8x2_t t23 = vtrnq_u16(r[2], r[3]);
+            uint16x8x2_t t45 = vtrnq_u16(r[4], r[5]);
+            uint16x8x2_t t67 = vtrnq_u16(r[6], r[7]);
+
+            // Columns 0/4 and 2/6 of rows 0-3 and 4-7, then columns 1/5 and 3/7
+            uint32x4x2_t c0246_0123 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[0]), vreinterpretq_u32_u16(t23.val[0]));
+            uint32x4x2_t c0246_4567 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[0]), vreinterpretq_u32_u16(t67.val[0]));
+            uint32x4x2_t c1357_0123 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[1]), vreinterpretq_u32_u16(t23.val[1]));
+            uint32x4x2_t c1357_4567 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[1]), vreinterpretq_u32_u16(t67.val[1]));
+
+            r[0] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0246_0123.val[0]), vget_low_u32(c0246_4567.val[0])));
+            r[4] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0246_0123.val[0]), vget_high_u32(c0246_4567.val[0])));
+            r[2] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c0246_0123.val[1]), vget_low_u32(c0246_4567.val[1])));
+            r[6] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c0246_0123.val[1]), vget_high_u32(c0246_4567.val[1])));
+            r[1] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1357_0123.val[0]), vget_low_u32(c1357_4567.val[0])));
+            r[5] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1357_0123.val[0]), vget_high_u32(c1357_4567.val[0])));
+            r[3] = vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(c1357_0123.val[1]), vget_low_u32(c1357_4567.val[1])));
+            r[7] = vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(c1357_0123.val[1]), vget_high_u32(c1357_4567.val[1])));
+        }
+
+        inline void transpose_4x4(float32x4_t & r0, float32x4_t & r1, float32x4_t & r2, float32x4_t & r3)
+        {
+            float32x4x2_t t01 = vtrnq_f32(r0, r1);
+            float32x4x2_t t23 = vtrnq_f32(r2, r3);
+            r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+            r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+            r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+            r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+        }
+
+        // The parameters and the arithmetic of the Z16 filter, on 8 lanes
+        struct z16_filter
+        {
+            float32x4_t alpha;
+            float32x4_t one_minus_alpha;
+            float32x4_t round;
+            uint16x8_t delta_z;
+            uint16x8_t radius;
+
+            z16_filter(float alpha_, float deltaZ, uint8_t holes_filling_radius)
+                : alpha(vdupq_n_f32(alpha_))
+                , one_minus_alpha(vdupq_n_f32(1.f - alpha_))
+                , round(vdupq_n_f32(0.5f))
+                , delta_z(vdupq_n_u16(static_cast<uint16_t>(deltaZ)))
+                , radius(vdupq_n_u16(holes_filling_radius))
+            {
+            }
+
+            // static_cast<uint16_t>(a * alpha + b * (1 - alpha) + 0.5f), with the same (unfused) float operations
+            uint16x8_t blend(uint16x8_t a, uint16x8_t b) const
+            {
+                float32x4_t lo = vaddq_f32(vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(a))), alpha),
+                                                     vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(b))), one_minus_alpha)),
+                                           round);
+                float32x4_t hi = vaddq_f32(vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(a))), alpha),
+                                                     vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(b))), one_minus_alpha)),
+                                           round);
+                return vcombine_u16(vmovn_u32(vcvtq_u32_f32(lo)), vmovn_u32(vcvtq_u32_f32(hi)));
+            }
+
+            // The 'inertial' hole filling counter: reset when both pixels are valid, counted up while filling
+            uint16x8_t count_fill(uint16x8_t cur_fill, uint16x8_t both_valid, uint16x8_t filling) const
+            {
+                cur_fill = vbicq_u16(cur_fill, both_valid);
+                return vqaddq_u16(cur_fill, vandq_u16(filling, vdupq_n_u16(1)));
+            }
+        };
+
+        // Both directions of the horizontal pass over a band of 8 rows, transposed so that each element of 'col'
+        // holds a column of the band
+        void filter_band(uint16_t * col, size_t width, z16_filter const & f, bool holes_filling)
+        {
+            const uint16x8_t zero = vdupq_n_u16(0);
+            const uint16x8_t one = vdupq_n_u16(1);
+
+            // left to right
+            uint16x8_t val0 = vld1q_u16(col);
+            uint16x8_t cur_fill = zero;
+            for (size_t u = 1; u < width - 1; u++)
+            {
+                uint16_t * im = col + u * 8;
+                uint16x8_t val1 = vld1q_u16(im);
+
+                uint16x8_t valid0 = vtstq_u16(val0, val0);
+                uint16x8_t valid1 = vtstq_u16(val1, val1);
+                uint16x8_t both_valid = vandq_u16(valid0, valid1);
+                uint16x8_t diff = vabdq_u16(val1, val0);
+                uint16x8_t smooth = vandq_u16(both_valid, vandq_u16(vtstq_u16(diff, diff), vcleq_u16(diff, f.delta_z)));
+                uint16x8_t out = vbslq_u16(smooth, f.blend(val1, val0), val1);
+                if (holes_filling)
+                {
+                    uint16x8_t filling = vbicq_u16(valid0, valid1);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = vbslq_u16(vandq_u16(filling, vcltq_u16(cur_fill, f.radius)), val0, out);
+                }
+
+                vst1q_u16(im, out);
+                val0 = out;
+            }
+
+            // right to left
+            uint16x8_t val1 = vld1q_u16(col + (width - 1) * 8);
+            cur_fill = zero;
+            for (size_t u = width - 1; u > 0; u--)
+            {
+                uint16_t * im = col + (u - 1) * 8;
+                uint16x8_t val0 = vld1q_u16(im);
+
+                uint16x8_t valid1 = vtstq_u16(val1, val1);
+                uint16x8_t valid0 = vcgtq_u16(val0, one);
+                uint16x8_t both_valid = vandq_u16(valid0, valid1);
+                uint16x8_t smooth = vandq_u16(both_valid, vcleq_u16(vabdq_u16(val1, val0), f.delta_z));
+                uint16x8_t out = vbslq_u16(smooth, f.blend(val0, val1), val0);
+                if (holes_filling)
+                {
+                    uint16x8_t filling = vbicq_u16(valid1, valid0);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = vbslq_u16(vandq_u16(filling, vcltq_u16(cur_fill, f.radius)), val1, out);
+                }
+
+                vst1q_u16(im, out);
+                val1 = out;
+            }
+        }
+
+        // One step of the disparity filter recursion, on 4 lanes.
+        // The scalar state machine boils down to: the state is valid iff the last innovation was valid; a valid
+        // innovation that follows a valid one, close enough to it, is smoothed into the state.
+        struct fp_filter
+        {
+            float32x4_t alpha;
+            float32x4_t one_minus_alpha;
+            float32x4_t delta_z;
+            float32x4_t minus_delta_z;
+
+            fp_filter(float alpha_, float deltaZ)
+                : alpha(vdupq_n_f32(alpha_))
+                , one_minus_alpha(vdupq_n_f32(1.0f - alpha_))
+                , delta_z(vdupq_n_f32(deltaZ))
+                , minus_delta_z(vdupq_n_f32(-deltaZ))
+            {
+            }
+
+            static uint32x4_t is_valid(float32x4_t x)
+            {
+                return vcgtq_s32(vreinterpretq_s32_f32(x), vdupq_n_s32(0));
+            }
+
+            // Returns the filtered innovation
+            float32x4_t step(float32x4_t innovation, float32x4_t & state, float32x4_t & previous_innovation, uint32x4_t & valid) const
+            {
+                uint32x4_t innovation_valid = is_valid(innovation);
+                float32x4_t delta = vsubq_f32(previous_innovation, innovation);
+                uint32x4_t small_difference = vandq_u32(vcltq_f32(delta, delta_z), vcgtq_f32(delta, minus_delta_z));
+                uint32x4_t smooth = vandq_u32(vandq_u32(valid, innovation_valid), small_difference);
+                float32x4_t filtered = vaddq_f32(vmulq_f32(innovation, alpha), vmulq_f32(state, one_minus_alpha));
+
+                state = vbslq_f32(smooth, filtered, vbslq_f32(innovation_valid, innovation, state));
+                previous_innovation = innovation;
+                valid = innovation_valid;
+                return vbslq_f32(smooth, filtered, innovation);
+            }
+        };
+
+        void filter_band(float * col, size_t width, fp_filter const & f)
+        {
+            // left to right
+            float32x4_t state = vld1q_f32(col);
+            float32x4_t previous_innovation = state;
+            uint32x4_t valid = fp_filter::is_valid(state);
+            for (size_t u = 1; u < width; u++)
+                vst1q_f32(col + u * 4, f.step(vld1q_f32(col + u * 4), state, previous_innovation, valid));
+
+            // right to left
+            state = vld1q_f32(col + (width - 1) * 4);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t u = width - 1; u > 0; u--)
+                vst1q_f32(col + (u - 1) * 4, f.step(vld1q_f32(col + (u - 1) * 4), state, previous_innovation, valid));
+        }
+    }
+
+    void recursive_filter_horizontal_rows_neon(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                               float alpha, float deltaZ, uint8_t holes_filling_radius)
+    {
+        const z16_filter f(alpha, deltaZ, holes_filling_radius);
+        std::vector<uint16_t> columns(width * 8);
+        uint16_t * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 8)
+        {
+            uint16_t * rows = image + v * width;
+            uint16x8_t block[8];
+
+            size_t u = 0;
+            for (; u + 8 <= width; u += 8)
+            {
+                for (int i = 0; i < 8; ++i)
+                    block[i] = vld1q_u16(rows + i * width + u);
+                transpose_8x8(block);
+                for (int i = 0; i < 8; ++i)
+                    vst1q_u16(col + (u + i) * 8, block[i]);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    col[u * 8 + i] = rows[i * width + u];
+
+            filter_band(col, width, f, holes_filling_radius != 0);
+
+            for (u = 0; u + 8 <= width; u += 8)
+            {
+                for (int i = 0; i < 8; ++i)
+                    block[i] = vld1q_u16(col + (u + i) * 8);
+                transpose_8x8(block);
+                for (int i = 0; i < 8; ++i)
+                    vst1q_u16(rows + i * width + u, block[i]);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    rows[i * width + u] = col[u * 8 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_neon(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                float alpha, float deltaZ)
+    {
+        const z16_filter f(alpha, deltaZ, 0);
+
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            // top to bottom
+            uint16x8_t im0 = vld1q_u16(image + u);
+            for (size_t v = 1; v < height; v++)
+            {
+                uint16_t * im = image + v * width + u;
+                uint16x8_t imw = vld1q_u16(im);
+                uint16x8_t smooth = vcltq_u16(vabdq_u16(im0, imw), f.delta_z);
+                im0 = vbslq_u16(smooth, f.blend(imw, im0), imw);
+                vst1q_u16(im, im0);
+            }
+
+            // bottom to top
+            uint16x8_t imw = im0;
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                uint16_t * im = image + (v - 1) * width + u;
+                im0 = vld1q_u16(im);
+                uint16x8_t valid = vandq_u16(vtstq_u16(im0, im0), vtstq_u16(imw, imw));
+                uint16x8_t smooth = vandq_u16(valid, vcltq_u16(vabdq_u16(im0, imw), f.delta_z));
+                imw = vbslq_u16(smooth, f.blend(im0, imw), im0);
+                vst1q_u16(im, imw);
+            }
+        }
+    }
+
+    void recursive_filter_horizontal_rows_fp_neon(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                  float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+        std::vector<float> columns(width * 4);
+        float * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 4)
+        {
+            float * rows = image + v * width;
+
+            size_t u = 0;
+            for (; u + 4 <= width; u += 4)
+            {
+                float32x4_t r0 = vld1q_f32(rows + u);
+                float32x4_t r1 = vld1q_f32(rows + width + u);
+                float32x4_t r2 = vld1q_f32(rows + 2 * width + u);
+                float32x4_t r3 = vld1q_f32(rows + 3 * width + u);
+                transpose_4x4(r0, r1, r2, r3);
+                vst1q_f32(col + u * 4, r0);
+                vst1q_f32(col + u * 4 + 4, r1);
+                vst1q_f32(col + u * 4 + 8, r2);
+                vst1q_f32(col + u * 4 + 12, r3);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 4; ++i)
+                    col[u * 4 + i] = rows[i * width + u];
+
+            filter_band(col, width, f);
+
+            for (u = 0; u + 4 <= width; u += 4)
+            {
+                float32x4_t r0 = vld1q_f32(col + u * 4);
+                float32x4_t r1 = vld1q_f32(col + u * 4 + 4);
+                float32x4_t r2 = vld1q_f32(col + u * 4 + 8);
+                float32x4_t r3 = vld1q_f32(col + u * 4 + 12);
+                transpose_4x4(r0, r1, r2, r3);
+                vst1q_f32(rows + u, r0);
+                vst1q_f32(rows + width + u, r1);
+                vst1q_f32(rows + 2 * width + u, r2);
+                vst1q_f32(rows + 3 * width + u, r3);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 4; ++i)
+                    rows[i * width + u] = col[u * 4 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_fp_neon(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                   float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+
+        for (size_t u = u_begin; u < u_end; u += 4)
+        {
+            // top to bottom
+            float32x4_t state = vld1q_f32(image + u);
+            float32x4_t previous_innovation = state;
+            uint32x4_t valid = fp_filter::is_valid(state);
+            for (size_t v = 1; v < height; v++)
+            {
+                float * im = image + v * width + u;
+                vst1q_f32(im, f.step(vld1q_f32(im), state, previous_innovation, valid));
+            }
+
+            // bottom to top
+            state = vld1q_f32(image + (height - 1) * width + u);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                float * im = image + (v - 1) * width + u;
+                vst1q_f32(im, f.step(vld1q_f32(im), state, previous_innovation, valid));
+            }
+        }
+    }
+}
+
+#endif
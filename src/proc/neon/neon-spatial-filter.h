@@ -0,0 +1,26 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON versions of the spatial filter passes in spatial-filter.h, producing identical results.
+    // Each vector lane follows the recursion of a single row (horizontal passes) or column (vertical passes): ranges
+    // must hold a multiple of 8 rows/columns for Z16 data, and of 4 for disparity.
+    void recursive_filter_horizontal_rows_neon(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                               float alpha, float deltaZ, uint8_t holes_filling_radius);
+    void recursive_filter_vertical_columns_neon(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                float alpha, float deltaZ);
+    void recursive_filter_horizontal_rows_fp_neon(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                  float alpha, float deltaZ);
+    void recursive_filter_vertical_columns_fp_neon(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                   float alpha, float deltaZ);
+#endif
+#endif
+}
@@ -0,0 +1,150 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "neon-temporal-filter.h"
+
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+
+#include <arm_neon.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        // Whether persistence_map[history] has the bit of the current phase, looked up for 16 history bytes at once:
+        // the low nibble of the history selects a byte in one of two tables, and the high nibble a bit in that byte
+        class credibility
+        {
+            uint8x16_t _low_table;     // histories 0x00-0x7f
+            uint8x16_t _high_table;    // histories 0x80-0xff
+
+        public:
+            credibility(const uint8_t * persistence_map, uint8_t phase)
+            {
+                uint8_t tables[2][16] = {};
+                for (int h = 0; h < 256; ++h)
+                    if (persistence_map[h] & (1 << phase))
+                        tables[h >> 7][h & 0x0f] |= uint8_t(1 << ((h >> 4) & 7));
+                _low_table = vld1q_u8(tables[0]);
+                _high_table = vld1q_u8(tables[1]);
+            }
+
+            // 0xff for credible histories, 0 otherwise
+            uint8x16_t operator()(uint8x16_t history) const
+            {
+                static const uint8_t bit_table[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+
+                uint8x16_t low = vandq_u8(history, vdupq_n_u8(0x0f));
+                uint8x16_t high = vshrq_n_u8(history, 4);
+                uint8x16_t bits = vqtbl1q_u8(vld1q_u8(bit_table), high);
+                uint8x16_t table = vbslq_u8(vcgtq_u8(high, vdupq_n_u8(7)),
+                                            vqtbl1q_u8(_high_table, low),
+                                            vqtbl1q_u8(_low_table, low));
+                return vtstq_u8(table, bits);
+            }
+        };
+
+        // The new history of 16 pixels, given which have a value and which of those agree with the last one
+        inline uint8x16_t update_history(uint8x16_t history, uint8x16_t mask, uint8x16_t cur_valid, uint8x16_t agree)
+        {
+            return vbslq_u8(cur_valid, vbslq_u8(agree, vorrq_u8(history, mask), mask), vbicq_u8(history, mask));
+        }
+    }
+
+    void temporal_filter_pixels_neon(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const uint8x16_t mask = vdupq_n_u8(uint8_t(1 << phase));
+        const uint16x8_t delta_z = vdupq_n_u16(delta);
+        const float32x4_t alpha_ = vdupq_n_f32(alpha);
+        const float32x4_t one_minus_alpha = vdupq_n_f32(1.f - alpha);
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16_t h = vld1q_u8(history + i);
+            uint8x16_t credible = is_credible(h);
+            uint16x8_t cur_valid[2], agree[2];
+
+            for (int k = 0; k < 2; ++k)
+            {
+                uint16_t * cur_ptr = frame + i + k * 8;
+                uint16_t * prev_ptr = last_frame + i + k * 8;
+                uint16x8_t cur = vld1q_u16(cur_ptr);
+                uint16x8_t prev = vld1q_u16(prev_ptr);
+
+                cur_valid[k] = vtstq_u16(cur, cur);
+                uint16x8_t prev_valid = vtstq_u16(prev, prev);
+                uint16x8_t close = vcltq_u16(vabdq_u16(cur, prev), delta_z);
+                agree[k] = vandq_u16(vandq_u16(cur_valid[k], prev_valid), close);
+
+                // static_cast<uint16_t>(alpha * cur + (1 - alpha) * prev), with the same (unfused) float operations
+                float32x4_t lo = vaddq_f32(vmulq_f32(alpha_, vcvtq_f32_u32(vmovl_u16(vget_low_u16(cur)))),
+                                           vmulq_f32(one_minus_alpha, vcvtq_f32_u32(vmovl_u16(vget_low_u16(prev)))));
+                float32x4_t hi = vaddq_f32(vmulq_f32(alpha_, vcvtq_f32_u32(vmovl_u16(vget_high_u16(cur)))),
+                                           vmulq_f32(one_minus_alpha, vcvtq_f32_u32(vmovl_u16(vget_high_u16(prev)))));
+                uint16x8_t filtered = vcombine_u16(vmovn_u32(vcvtq_u32_f32(lo)), vmovn_u32(vcvtq_u32_f32(hi)));
+
+                uint16x8_t updated = vbslq_u16(agree[k], filtered, cur);
+                uint16x8_t credible16 = vreinterpretq_u16_u8(k ? vzip2q_u8(credible, credible) : vzip1q_u8(credible, credible));
+                uint16x8_t filled = vbslq_u16(vandq_u16(prev_valid, credible16), prev, cur);
+                vst1q_u16(cur_ptr, vbslq_u16(cur_valid[k], updated, filled));
+                vst1q_u16(prev_ptr, vbslq_u16(cur_valid[k], updated, prev));
+            }
+
+            vst1q_u8(history + i, update_history(h, mask,
+                                                 vcombine_u8(vmovn_u16(cur_valid[0]), vmovn_u16(cur_valid[1])),
+                                                 vcombine_u8(vmovn_u16(agree[0]), vmovn_u16(agree[1]))));
+        }
+    }
+
+    void temporal_filter_pixels_neon(float * frame, float * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const uint8x16_t mask = vdupq_n_u8(uint8_t(1 << phase));
+        const float32x4_t delta_z = vdupq_n_f32(static_cast<float>(delta));
+        const float32x4_t alpha_ = vdupq_n_f32(alpha);
+        const float32x4_t one_minus_alpha = vdupq_n_f32(1.f - alpha);
+        const float32x4_t zero = vdupq_n_f32(0.f);
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            uint8x16_t h = vld1q_u8(history + i);
+            uint8x16_t credible = is_credible(h);
+            uint16x8_t credible16[2] = { vreinterpretq_u16_u8(vzip1q_u8(credible, credible)),
+                                         vreinterpretq_u16_u8(vzip2q_u8(credible, credible)) };
+            uint32x4_t cur_valid[4], agree[4];
+
+            for (int k = 0; k < 4; ++k)
+            {
+                float * cur_ptr = frame + i + k * 4;
+                float * prev_ptr = last_frame + i + k * 4;
+                float32x4_t cur = vld1q_f32(cur_ptr);
+                float32x4_t prev = vld1q_f32(prev_ptr);
+
+                // x != 0, including for NaNs
+                cur_valid[k] = vmvnq_u32(vceqq_f32(cur, zero));
+                uint32x4_t prev_valid = vmvnq_u32(vceqq_f32(prev, zero));
+                uint32x4_t close = vcltq_f32(vabsq_f32(vsubq_f32(cur, prev)), delta_z);
+                agree[k] = vandq_u32(vandq_u32(cur_valid[k], prev_valid), close);
+                float32x4_t filtered = vaddq_f32(vmulq_f32(alpha_, cur), vmulq_f32(one_minus_alpha, prev));
+
+                float32x4_t updated = vbslq_f32(agree[k], filtered, cur);
+                uint32x4_t credible32 = vreinterpretq_u32_u16(k & 1 ? vzip2q_u16(credible16[k / 2], credible16[k / 2])
+                                                                    : vzip1q_u16(credible16[k / 2], credible16[k / 2]));
+                float32x4_t filled = vbslq_f32(vandq_u32(prev_valid, credible32), prev, cur);
+                vst1q_f32(cur_ptr, vbslq_f32(cur_valid[k], updated, filled));
+                vst1q_f32(prev_ptr, vbslq_f32(cur_valid[k], updated, prev));
+            }
+
+            vst1q_u8(history + i, update_history(h, mask,
+                                                 vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(cur_valid[0]), vmovn_u32(cur_valid[1]))),
+                                                             vmovn_u16(vcombine_u16(vmovn_u32(cur_valid[2]), vmovn_u32(cur_valid[3])))),
+                                                 vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(agree[0]), vmovn_u32(agree[1]))),
+                                                             vmovn_u16(vcombine_u16(vmovn_u32(agree[2]), vmovn_u32(agree[3]))))));
+        }
+    }
+}
+
+#endif
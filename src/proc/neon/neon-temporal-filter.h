@@ -0,0 +1,22 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifndef ANDROID
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON)
+    // NEON versions of temporal_filter_pixels() in temporal-filter.h, producing identical results.
+    // Pixels are filtered 16 at a time, so the range must hold a multiple of 16; 'phase' is the bit of the current
+    // frame in the history.
+    void temporal_filter_pixels_neon(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map);
+    void temporal_filter_pixels_neon(float * frame, float * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map);
+#endif
+#endif
+}
@@ -3,6 +3,7 @@
 
 #include "pointcloud.h"
 #include "occlusion-filter.h"
+#include "simd-dispatch.h"
 #include <src/environment.h>
 #include <src/core/depth-frame.h>
 #include <src/option.h>
@@ -17,6 +18,8 @@
 #include <rsutils/string/from.h>
 #include <rsutils/easylogging/easyloggingpp.h>
 
+#include <cstring>
+
 #ifdef RS2_USE_CUDA
 #include "proc/cuda/cuda-pointcloud.h"
 #include "rsutils/accelerators/gpu.h"
@@ -29,26 +32,45 @@
 
 namespace librealsense
 {
-    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, MAP_DEPTH map_depth)
+    void compute_pixel_rays(const rs2_intrinsics& intrin, float* rays_x, float* rays_y, float offset)
     {
         for (int y = 0; y < intrin.height; ++y)
         {
             for (int x = 0; x < intrin.width; ++x)
             {
-                const float pixel[] = { (float)x, (float)y };
-                rs2_deproject_pixel_to_point(points, &intrin, pixel, map_depth(*depth++));
-                points += 3;
+                const float pixel[] = { (float)x + offset, (float)y + offset };
+                float ray[3];
+                rs2_deproject_pixel_to_point(ray, &intrin, pixel, 1.f);
+                *rays_x++ = ray[0];
+                *rays_y++ = ray[1];
             }
         }
     }
 
+    size_t compact_points(float3* vertices, float2* texcoords, size_t n)
+    {
+        // Texture coordinates first, while the vertices still tell which points remain
+        size_t count = 0;
+        for (size_t i = 0; i < n; ++i)
+            if (vertices[i].z)
+                texcoords[count++] = texcoords[i];
+
+        count = 0;
+        for (size_t i = 0; i < n; ++i)
+            if (vertices[i].z)
+                vertices[count++] = vertices[i];
+
+        memmove(vertices + count, texcoords, count * sizeof(float2));
+        return count;
+    }
+
     const float3 * pointcloud::depth_to_points(rs2::points output, 
         const rs2_intrinsics &depth_intrinsics, const rs2::depth_frame& depth_frame)
     {
-        auto image = output.get_vertices();
-        auto depth_scale = depth_frame.get_units();
-        deproject_depth((float*)image, depth_intrinsics, (const uint16_t*)depth_frame.get_data(), [depth_scale](uint16_t z) { return depth_scale * z; });
-        return (float3*)image;
+        auto image = (float3*)output.get_vertices();
+        deproject_depth_pixels(image, (const uint16_t*)depth_frame.get_data(), _pre_compute_map_x.data(), _pre_compute_map_y.data(),
+                               0, size_t(depth_intrinsics.width) * depth_intrinsics.height, depth_frame.get_units());
+        return image;
     }
 
     float3 transform(const rs2_extrinsics *extrin, const float3 &point) { float3 p = {}; rs2_transform_point_to_point(&p.x, extrin, &point.x); return p; }
@@ -94,6 +116,7 @@ namespace librealsense
                 _pixels_map.resize(_depth_intrinsics->height*_depth_intrinsics->width);
                 _occlusion_filter->set_depth_intrinsics(_depth_intrinsics.value());
 
+                pre_compute_x_y_map();
                 preprocess();
 
                 found_depth_intrinsics = true;
@@ -103,6 +126,13 @@ namespace librealsense
         set_extrinsics();
     }
 
+    void pointcloud::pre_compute_x_y_map()
+    {
+        _pre_compute_map_x.resize(_depth_intrinsics->width*_depth_intrinsics->height);
+        _pre_compute_map_y.resize(_depth_intrinsics->width*_depth_intrinsics->height);
+        compute_pixel_rays(*_depth_intrinsics, _pre_compute_map_x.data(), _pre_compute_map_y.data());
+    }
+
     template< class callback >
     rs2_calibration_change_callback_sptr create_calibration_change_callback_ptr( callback&& cb )
     {
@@ -288,6 +318,10 @@ namespace librealsense
                 _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map, depth);
             }
         }
+
+        if (_compact_points)
+            pframe->resize(compact_points(pframe->get_vertices(), pframe->get_texture_coordinates(), pframe->get_vertex_count()));
+
         return res;
     }
 
@@ -296,8 +330,10 @@ namespace librealsense
     {}
 
     pointcloud::pointcloud(const char* name)
-        : stream_filter_processing_block(name)
+        : stream_filter_processing_block(name),
+        _compact_points(false)
     {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(simd_level::scalar));
         _occlusion_filter = std::make_shared<occlusion_filter>();
 
         auto occlusion_invalidation = std::make_shared<ptr_option<uint8_t>>(
@@ -325,6 +361,10 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Off");
         occlusion_invalidation->set_description(2.f, "On");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+
+        auto compact = std::make_shared<ptr_option<bool>>(false, true, true, false, &_compact_points,
+            "Emit only the points with a valid depth, packed together instead of following the depth image");
+        register_option(RS2_OPTION_COMPACT_POINTS, compact);
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
@@ -405,15 +445,20 @@ namespace librealsense
         }
         #endif
         #ifdef __SSSE3__
+        if (simd_enabled(simd_level::ssse3))
+        {
             LOG_INFO("Using SSE-optimized pointcloud implementation");
             return std::make_shared<librealsense::pointcloud_sse>();
+        }
         #elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+        {
             LOG_INFO("Using NEON-optimized pointcloud implementation");
             return std::make_shared<librealsense::pointcloud_neon>();
-        #else
-            LOG_INFO("Using generic (non-SIMD) pointcloud implementation");
-            return std::make_shared<librealsense::pointcloud>();
+        }
         #endif
+        LOG_INFO("Using generic (non-SIMD) pointcloud implementation");
+        return std::make_shared<librealsense::pointcloud>();
     }
 
     bool pointcloud::run__occlusion_filter(const rs2_extrinsics& extr)
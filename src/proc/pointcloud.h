@@ -10,6 +10,27 @@ namespace librealsense
 {
     class occlusion_filter;
 
+    // The ray through each pixel of the image, as rs2_deproject_pixel_to_point() finds it for any distortion model: the
+    // pixel at depth z is deprojected to (z * rays_x[i], z * rays_y[i], z). With an offset, the rays go through the
+    // points (x + offset, y + offset) instead, such as the corners of the pixels.
+    void compute_pixel_rays(const rs2_intrinsics& intrin, float* rays_x, float* rays_y, float offset = 0.f);
+
+    // Deprojects pixels [begin, end) of a Z16 image through their rays, with the same results as
+    // rs2_deproject_pixel_to_point()
+    inline void deproject_depth_pixels(float3* points, const uint16_t* depth, const float* rays_x, const float* rays_y,
+                                       size_t begin, size_t end, float depth_scale)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            float z = depth_scale * depth[i];
+            points[i] = { z * rays_x[i], z * rays_y[i], z };
+        }
+    }
+
+    // Moves the 'n' vertices that are not at the origin, and their texture coordinates, to the front, keeping their
+    // order. The texture coordinates then follow the remaining vertices, which are counted in the return value.
+    size_t compact_points(float3* vertices, float2* texcoords, size_t n);
+
     class LRS_EXTENSION_API pointcloud : public stream_filter_processing_block
     {
     public:
@@ -48,6 +69,12 @@ namespace librealsense
         // Intermediate translation table of (depth_x*depth_y) with actual texel coordinates per depth pixel
         std::vector<float2>                    _pixels_map;
 
+        // The ray through each depth pixel, see compute_pixel_rays()
+        std::vector<float>                     _pre_compute_map_x;
+        std::vector<float>                     _pre_compute_map_y;
+
+        bool                                   _compact_points;
+
         rs2::stream_profile _output_stream;
         rs2::frame _other_stream;
         rs2::frame _depth_stream;
@@ -56,6 +83,7 @@ namespace librealsense
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
         void set_extrinsics();
+        void pre_compute_x_y_map();
 
         stream_filter _prev_stream_filter;
         std::shared_ptr< pointcloud > _registered_auto_calib_cb;
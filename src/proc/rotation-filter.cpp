@@ -6,8 +6,17 @@
 #include "stream.h"
 #include "core/video.h"
 #include "proc/rotation-filter.h"
+#include "proc/simd-dispatch.h"
+#include "proc/worker-pool.h"
 #include <rsutils/easylogging/easyloggingpp.h>
 
+#if defined(__SSSE3__)
+#include "proc/sse/sse-rotation.h"
+#endif
+#include "proc/neon/neon-rotation.h"
+
+#include <algorithm>
+
 namespace librealsense {
 
     const int rotation_min_val = -90;
@@ -30,7 +39,11 @@ namespace librealsense {
         , _rotated_width( 0 )
         , _rotated_height( 0 )
         , _value( 0 )
+        , _workers( worker_pool::get() )
+        , _max_threads( 0 )
     {
+        register_info( RS2_CAMERA_INFO_SIMD_LEVEL, get_string( select_simd_level( { simd_level::ssse3, simd_level::neon } ) ) );
+
         auto rotation_control = std::make_shared< ptr_option< int > >( rotation_min_val,
                                                                        rotation_max_val,
                                                                        rotation_step,
@@ -54,6 +67,10 @@ namespace librealsense {
             } );
 
         register_option( RS2_OPTION_ROTATION, rotation_control );
+
+        auto max_threads_opt = std::make_shared< ptr_option< int > >( 0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool" );
+        register_option( RS2_OPTION_MAX_THREADS, max_threads_opt );
     }
 
     rs2::frame rotation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -85,9 +102,9 @@ namespace librealsense {
         if (auto tgt = prepare_target_frame( f, source, target_profile, tgt_type ))
         {
             auto format = profile.format();
-            if( format == RS2_FORMAT_YUYV && ( local_value == 90 || local_value == -90 ) )
+            if( format == RS2_FORMAT_YUYV && ( local_value == 90 || local_value == -90 ) && src.get_height() % 2 )
             {
-                LOG_ERROR( "Rotating YUYV format is disabled for 90 or -90 degrees" );
+                LOG_ERROR( "Rotating YUYV format by 90 or -90 degrees needs an even height" );
                 return f;
             }
 
@@ -96,7 +113,8 @@ namespace librealsense {
                 rotate_YUYV_frame( static_cast< uint8_t * >( const_cast< void * >( tgt.get_data() ) ),
                                    static_cast< const uint8_t * >( src.get_data() ),
                                    src.get_width(),
-                                   src.get_height() );
+                                   src.get_height(),
+                                   local_value );
             }
             else
             {
@@ -223,61 +241,225 @@ namespace librealsense {
         return ret;
     }
 
-    void rotation_filter::rotate_frame( uint8_t * const out, const uint8_t * source, int width, int height, int bpp, float & value )
+    void transpose_pixels( const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride, int bpp, int rows, int cols )
     {
-        if( value != 90 && value != -90 && value != 180 )
+        for( int i = 0; i < rows; ++i )
+            for( int j = 0; j < cols; ++j )
+                std::memcpy( dst + j * dst_stride + i * bpp, src + i * src_stride + j * bpp, bpp );
+    }
+
+    template< int N > struct bytes { uint8_t b[N]; };
+
+    // transpose_pixels for a fixed pixel size, which copies each pixel as a whole rather than through a memcpy call
+    template< int N >
+    static void transpose_block( const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride, int rows, int cols )
+    {
+        for( int i = 0; i < rows; ++i )
         {
-            throw std::invalid_argument( "Invalid rotation angle. Only 90, -90, and 180 degrees are supported." );
+            auto in = reinterpret_cast< const bytes< N > * >( src + i * src_stride );
+            for( int j = 0; j < cols; ++j )
+                *reinterpret_cast< bytes< N > * >( dst + j * dst_stride + i * N ) = in[j];
         }
+    }
 
-        // Define output dimensions
-        int width_out = ( value == 90 || value == -90 ) ? height : width;    // rotate by 180 will keep the values as is
-        int height_out = ( value == 90 || value == -90 ) ? width : height;  // rotate by 180 will keep the values as is
+    typedef void ( *transpose_8x8_fn )( const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride );
 
-        // Perform rotation
-        for( int i = 0; i < height; ++i )
+    // The SIMD kernel transposing 8x8 blocks of 'bpp'-byte pixels, if there is one
+    static transpose_8x8_fn simd_transpose_8x8( int bpp )
+    {
+#if defined( __SSSE3__ )
+        static const bool do_sse = simd_enabled( simd_level::ssse3 );
+        if( do_sse )
+        {
+            switch( bpp )
+            {
+            case 1: return transpose_8x8_u8_sse;
+            case 2: return transpose_8x8_u16_sse;
+            case 3: return transpose_8x8_u24_sse;
+            case 4: return transpose_8x8_u32_sse;
+            }
+        }
+#elif defined( __ARM_NEON ) && defined( BUILD_WITH_NEON ) && ! defined( ANDROID )
+        static const bool do_neon = simd_enabled( simd_level::neon );
+        if( do_neon )
         {
-            for( int j = 0; j < width; ++j )
+            switch( bpp )
             {
-                // Calculate source index
-                size_t src_index = ( i * width + j ) * bpp;
+            case 1: return transpose_8x8_u8_neon;
+            case 2: return transpose_8x8_u16_neon;
+            case 3: return transpose_8x8_u24_neon;
+            case 4: return transpose_8x8_u32_neon;
+            }
+        }
+#endif
+        return nullptr;
+    }
 
-                // Determine output index based on rotation angle
-                size_t out_index;
-                if( value == 90 )
+    // Output rows of a 90-degree rotation are worked on in bands of this many, so that the columns of the source they
+    // come from stay in cache
+    static const int rotation_band = 32;
+
+    // Rotates rows [begin, end) of the output by 90 degrees, clockwise or counterclockwise. The output is worked on in
+    // 8x8 blocks, each a transpose of a source block read upwards (clockwise) or written upwards (counterclockwise).
+    static void rotate_90_rows( uint8_t * out, const uint8_t * source, int width, int height, int bpp, bool clockwise,
+                                int begin, int end, transpose_8x8_fn transpose_8x8 )
+    {
+        ptrdiff_t const src_stride = ptrdiff_t( width ) * bpp;
+        ptrdiff_t const out_stride = ptrdiff_t( height ) * bpp;
+        for( int c = 0; c < height; c += 8 )
+        {
+            int const n_cols = std::min( 8, height - c );
+            for( int r = begin; r < end; r += 8 )
+            {
+                int const n_rows = std::min( 8, end - r );
+                const uint8_t * src;
+                uint8_t * dst;
+                ptrdiff_t ss, ds;
+                if( clockwise )
                 {
-                    out_index = ( j * height + ( height - i - 1 ) ) * bpp;
+                    // out( r + a, c + k ) = source( height - 1 - c - k, r + a )
+                    src = source + ( height - 1 - c ) * src_stride + r * bpp;
+                    ss = -src_stride;
+                    dst = out + r * out_stride + c * bpp;
+                    ds = out_stride;
                 }
-                else if( value == -90 )
+                else
                 {
-                    out_index = ( ( width - j - 1 ) * height + i ) * bpp;
+                    // out( r + a, c + k ) = source( c + k, width - 1 - r - a )
+                    src = source + c * src_stride + ( width - r - n_rows ) * bpp;
+                    ss = src_stride;
+                    dst = out + ( r + n_rows - 1 ) * out_stride + c * bpp;
+                    ds = -out_stride;
                 }
-                else  // 180 degrees
+                if( transpose_8x8 && n_rows == 8 && n_cols == 8 )
+                    transpose_8x8( src, ss, dst, ds );
+                else switch( bpp )
                 {
-                    out_index = ( ( height - i - 1 ) * width + ( width - j - 1 ) ) * bpp;
+                case 1: transpose_block< 1 >( src, ss, dst, ds, n_cols, n_rows ); break;
+                case 2: transpose_block< 2 >( src, ss, dst, ds, n_cols, n_rows ); break;
+                case 3: transpose_block< 3 >( src, ss, dst, ds, n_cols, n_rows ); break;
+                case 4: transpose_block< 4 >( src, ss, dst, ds, n_cols, n_rows ); break;
+                default: transpose_pixels( src, ss, dst, ds, bpp, n_cols, n_rows );
                 }
+            }
+        }
+    }
+
+    template< int N >
+    static void reverse_rows( uint8_t * out, const uint8_t * source, int width, int height, int begin, int end )
+    {
+        for( int i = begin; i < end; ++i )
+        {
+            auto src = reinterpret_cast< const bytes< N > * >( source ) + ptrdiff_t( i ) * width;
+            auto dst = reinterpret_cast< bytes< N > * >( out ) + ptrdiff_t( height - 1 - i ) * width;
+            std::reverse_copy( src, src + width, dst );
+        }
+    }
 
-                // Copy pixel data from source to destination
-                std::memcpy( &out[out_index], &source[src_index], bpp );
+    // Rotates rows [begin, end) of the source by 180 degrees, into the matching rows from the end of the output
+    static void rotate_180_rows( uint8_t * out, const uint8_t * source, int width, int height, int bpp, int begin, int end )
+    {
+        switch( bpp )
+        {
+        case 1: reverse_rows< 1 >( out, source, width, height, begin, end ); break;
+        case 2: reverse_rows< 2 >( out, source, width, height, begin, end ); break;
+        case 3: reverse_rows< 3 >( out, source, width, height, begin, end ); break;
+        case 4: reverse_rows< 4 >( out, source, width, height, begin, end ); break;
+        default:
+            for( int i = begin; i < end; ++i )
+                for( int j = 0; j < width; ++j )
+                    std::memcpy( out + ( ( height - 1 - i ) * width + ( width - 1 - j ) ) * bpp,
+                                 source + ( i * width + j ) * bpp,
+                                 bpp );
+        }
+    }
+
+    void rotation_filter::rotate_frame( uint8_t * const out, const uint8_t * source, int width, int height, int bpp, float & value )
+    {
+        if( value != 90 && value != -90 && value != 180 )
+        {
+            throw std::invalid_argument( "Invalid rotation angle. Only 90, -90, and 180 degrees are supported." );
+        }
+
+        if( value == 180 )
+        {
+            size_t const bands = _workers->get_concurrency() * 4;
+            _workers->parallel_for( height, ( height + bands - 1 ) / bands, [&]( size_t begin, size_t end )
+            {
+                rotate_180_rows( out, source, width, height, bpp, int( begin ), int( end ) );
+            }, _max_threads );
+            return;
+        }
+
+        // The output has a row per source column
+        auto transpose_8x8 = simd_transpose_8x8( bpp );
+        bool const clockwise = value == 90;
+        _workers->parallel_for( width, rotation_band, [&]( size_t begin, size_t end )
+        {
+            rotate_90_rows( out, source, width, height, bpp, clockwise, int( begin ), int( end ), transpose_8x8 );
+        }, _max_threads );
+    }
+
+    // Rotates rows [begin, end) of the output of a YUYV image by 90 degrees. The two pixels of each output pair come
+    // from consecutive source rows, and share the average of their chroma.
+    static void rotate_yuyv_90_rows( uint8_t * out, const uint8_t * source, int width, int height, bool clockwise, int begin, int end )
+    {
+        int const out_width = height;
+        for( int m = 0; m < out_width / 2; ++m )
+        {
+            int const y0 = clockwise ? height - 1 - 2 * m : 2 * m;
+            int const y1 = clockwise ? height - 2 - 2 * m : 2 * m + 1;
+            const uint8_t * row0 = source + ptrdiff_t( y0 ) * width * 2;
+            const uint8_t * row1 = source + ptrdiff_t( y1 ) * width * 2;
+            for( int r = begin; r < end; ++r )
+            {
+                int const x = clockwise ? r : width - 1 - r;
+                const uint8_t * p0 = row0 + ( x & ~1 ) * 2;  // Y0 U Y1 V of the source pixels
+                const uint8_t * p1 = row1 + ( x & ~1 ) * 2;
+                uint8_t * o = out + ( ptrdiff_t( r ) * out_width + 2 * m ) * 2;
+                o[0] = p0[( x & 1 ) * 2];
+                o[1] = uint8_t( ( p0[1] + p1[1] + 1 ) / 2 );
+                o[2] = p1[( x & 1 ) * 2];
+                o[3] = uint8_t( ( p0[3] + p1[3] + 1 ) / 2 );
             }
         }
     }
 
+    // Rotates rows [begin, end) of a YUYV image by 180 degrees: pairs are reversed, and so are the pixels in them
+    static void rotate_yuyv_180_rows( uint8_t * out, const uint8_t * source, int width, int height, int begin, int end )
+    {
+        int const pairs = width / 2;
+        for( int i = begin; i < end; ++i )
+        {
+            const uint8_t * src = source + ptrdiff_t( i ) * width * 2;
+            uint8_t * dst = out + ( ptrdiff_t( height - i ) * width * 2 ) - 4;
+            for( int k = 0; k < pairs; ++k, src += 4, dst -= 4 )
+            {
+                dst[0] = src[2];  // Y1
+                dst[1] = src[1];  // U
+                dst[2] = src[0];  // Y0
+                dst[3] = src[3];  // V
+            }
+        }
+    }
 
-    void rotation_filter::rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height ) 
+    void rotation_filter::rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height, float & value )
     {
-        int frame_size = width * height * 2;  // YUYV has 2 bytes per pixel
-        for( int i = 0; i < frame_size; i += 4 )
+        if( value == 180 )
         {
-            // Find the corresponding flipped position in the output
-            int flipped_index = frame_size - 4 - i;
-
-            // Copy YUYV pixels in reverse order to rotate 180 degrees
-            out[flipped_index] = source[i];          // Y1
-            out[flipped_index + 1] = source[i + 1];  // U
-            out[flipped_index + 2] = source[i + 2];  // Y2
-            out[flipped_index + 3] = source[i + 3];  // V
+            size_t const bands = _workers->get_concurrency() * 4;
+            _workers->parallel_for( height, ( height + bands - 1 ) / bands, [&]( size_t begin, size_t end )
+            {
+                rotate_yuyv_180_rows( out, source, width, height, int( begin ), int( end ) );
+            }, _max_threads );
+            return;
         }
+
+        bool const clockwise = value == 90;
+        _workers->parallel_for( width, rotation_band, [&]( size_t begin, size_t end )
+        {
+            rotate_yuyv_90_rows( out, source, width, height, clockwise, int( begin ), int( end ) );
+        }, _max_threads );
     }
 
     void rotation_filter::set_streams_to_rotate(const std::vector<rs2_stream>& streams_to_rotate)
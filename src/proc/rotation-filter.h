@@ -9,6 +9,12 @@
 
 namespace librealsense
 {
+    class worker_pool;
+
+    // Copies a block of 'rows' rows of 'cols' pixels of 'bpp' bytes, transposed: pixel (i, j) of src goes to pixel
+    // (j, i) of dst. Strides are in bytes, and may be negative to flip the block as well.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void transpose_pixels( const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride, int bpp, int rows, int cols );
 
     class rotation_filter : public stream_filter_processing_block
     {
@@ -23,7 +29,7 @@ namespace librealsense
                                          const rs2::stream_profile & target_profile,
                                          rs2_extension tgt_type );
         void rotate_frame( uint8_t * const out, const uint8_t * source, int width, int height, int bpp, float & value );
-        void rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height );
+        void rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height, float & value );
 
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
         bool should_process( const rs2::frame & frame ) override;
@@ -41,6 +47,8 @@ namespace librealsense
         std::map< std::pair< rs2_stream, int >, float > _last_rotation_values;
         std::map< std::pair< rs2_stream, int >, rs2::stream_profile > _target_stream_profiles;
         std::map< std::pair< rs2_stream, int >, rs2::stream_profile > _source_stream_profiles;
+        std::shared_ptr< worker_pool > _workers;
+        int _max_threads;
     };
     MAP_EXTENSION( RS2_EXTENSION_ROTATION_FILTER, librealsense::rotation_filter );
     }
@@ -0,0 +1,96 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "simd-dispatch.h"
+#include "proc/sse/cpu-features.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace librealsense
+{
+    const char * get_string(simd_level level)
+    {
+        switch (level)
+        {
+        case simd_level::scalar: return "Scalar";
+        case simd_level::ssse3: return "SSSE3";
+        case simd_level::avx2: return "AVX2";
+        case simd_level::neon: return "NEON";
+        }
+        return "Unknown";
+    }
+
+    static simd_level detect_simd_level()
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        if (has_avx2())
+            return simd_level::avx2;
+#endif
+        return simd_level::ssse3;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        return simd_level::neon;
+#else
+        return simd_level::scalar;
+#endif
+    }
+
+    // Whether kernels for 'level' can run when 'best' is the fastest available
+    static bool extends(simd_level best, simd_level level)
+    {
+        return level == simd_level::scalar || level == best || (level == simd_level::ssse3 && best == simd_level::avx2);
+    }
+
+    static simd_level read_simd_level()
+    {
+        auto level = detect_simd_level();
+        if (auto content = getenv("LRS_SIMD_LEVEL"))
+        {
+            std::string requested(content);
+            std::transform(requested.begin(), requested.end(), requested.begin(), ::tolower);
+            bool found = false;
+            for (auto candidate : { simd_level::scalar, simd_level::ssse3, simd_level::avx2, simd_level::neon })
+            {
+                std::string name = get_string(candidate);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                if (requested != name)
+                    continue;
+                found = true;
+                if (extends(level, candidate))
+                    level = candidate;
+                else
+                    LOG_WARNING("LRS_SIMD_LEVEL=" << content << " is not supported here; using " << get_string(level));
+            }
+            if (!found)
+                LOG_WARNING("Unknown LRS_SIMD_LEVEL=" << content << "; using " << get_string(level));
+        }
+        LOG_INFO("Image processing kernels use " << get_string(level));
+        return level;
+    }
+
+    simd_level get_simd_level()
+    {
+        static const simd_level level = read_simd_level();
+        return level;
+    }
+
+    bool simd_enabled(simd_level level)
+    {
+        return extends(get_simd_level(), level);
+    }
+
+    simd_level select_simd_level(std::initializer_list<simd_level> levels)
+    {
+        // Every architecture's own levels are ordered, so the largest enabled one is the fastest
+        auto rv = simd_level::scalar;
+        for (auto level : levels)
+            if (simd_enabled(level) && level > rv)
+                rv = level;
+        return rv;
+    }
+}
@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <initializer_list>
+
+namespace librealsense
+{
+    // The instruction sets the image kernels are written for. Each architecture only has its own, from the slowest.
+    enum class simd_level
+    {
+        scalar,
+        ssse3,
+        avx2,
+        neon,
+    };
+
+    const char * get_string(simd_level level);
+
+    // The fastest instruction set the kernels may use: the best one this build has kernels for and the CPU supports,
+    // detected on first use. Setting the LRS_SIMD_LEVEL environment variable to the name of a slower one (e.g.
+    // "scalar" or "ssse3") forces that one instead, to compare the implementations.
+    simd_level get_simd_level();
+
+    // Whether kernels for 'level' may run, i.e. 'level' is scalar, get_simd_level() or an instruction set it extends
+    bool simd_enabled(simd_level level);
+
+    // Picks the fastest of the instruction sets a processing block has kernels for that may run, or scalar.
+    // Blocks report it as RS2_CAMERA_INFO_SIMD_LEVEL.
+    simd_level select_simd_level(std::initializer_list<simd_level> levels);
+}
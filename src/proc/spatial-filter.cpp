@@ -8,6 +8,11 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/worker-pool.h"
+#include "proc/sse/sse-spatial-filter.h"
+#include "proc/sse/avx-spatial-filter.h"
+#include "proc/neon/neon-spatial-filter.h"
+#include "proc/simd-dispatch.h"
 
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
@@ -64,8 +69,11 @@ namespace librealsense
         _focal_lenght_mm(0.f),
         _stereo_baseline_mm(0.f),
         _holes_filling_mode(holes_fill_def),
-        _holes_filling_radius(0)
+        _holes_filling_radius(0),
+        _workers(worker_pool::get()),
+        _max_threads(0)
     {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
 
@@ -157,32 +165,36 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         rs2::frame tgt;
 
-        update_configuration(f);
+        update_configuration(f, f.get_profile(), f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME);
         tgt = prepare_target_frame(f, source);
 
         // Spatial domain transform edge-preserving filter
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            dxf_smooth<float>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            dxf_smooth(static_cast<float*>(const_cast<void*>(tgt.get_data())), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
         else
-            dxf_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            dxf_smooth(static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
 
         return tgt;
     }
 
-    void  spatial_filter::update_configuration(const rs2::frame& f)
+    void  spatial_filter::update_configuration(const rs2::frame& f, const rs2::stream_profile& profile, rs2_extension type)
     {
-        if (f.get_profile().get() != _source_stream_profile.get())
+        if (profile.get() != _source_stream_profile.get())
         {
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
 
-            _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+            _extension_type = type;
             _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _focal_lenght_mm = vp.get_intrinsics().fx;
@@ -229,6 +241,27 @@ namespace librealsense
         }
     }
 
+    bool spatial_filter::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        if (!should_process_profile(image.profile))
+            return false;
+
+        update_configuration(f, image.profile, image.type);
+        image.profile = _target_stream_profile;
+        return true;
+    }
+
+    void spatial_filter::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        if (out != in)
+            memcpy(out, in, _current_frm_size_pixels * _bpp);
+
+        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+            dxf_smooth(static_cast<float*>(out), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+        else
+            dxf_smooth(static_cast<uint16_t*>(out), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+    }
+
     rs2::frame spatial_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
         // Allocate and copy the content of the original Depth data to the target
@@ -238,21 +271,204 @@ namespace librealsense
         return tgt;
     }
 
-    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
+    // The SIMD kernels filter several rows (or columns) at once, in the lanes of a vector register: they are given
+    // bands with a multiple of that many rows, and the rest is left to the scalar kernels
+#if defined(__SSSE3__)
+    static const size_t z16_lanes = 8;
+    static const size_t fp_lanes = 4;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+    static const size_t z16_lanes = 8;
+    static const size_t fp_lanes = 4;
+#else
+    static const size_t z16_lanes = 1;
+    static const size_t fp_lanes = 1;
+#endif
+
+    // AVX2 doubles the lanes; bands handed to the threads are whole bands of the widest kernel
+#if defined(__SSSE3__) && defined(BUILD_WITH_AVX2)
+    static const size_t band_lanes = 2 * z16_lanes;
+#else
+    static const size_t band_lanes = z16_lanes;
+#endif
+
+    // Returns the end of the range that was filtered with SIMD
+    static size_t simd_filter_horizontal(uint16_t * image, size_t width, size_t begin, size_t end, float alpha, float deltaZ, uint8_t radius)
+    {
+#if defined(__SSSE3__) && defined(BUILD_WITH_AVX2)
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t const avx2_end = begin + (end - begin) / (2 * z16_lanes) * (2 * z16_lanes);
+            recursive_filter_horizontal_rows_avx2(image, width, begin, avx2_end, alpha, deltaZ, radius);
+            begin = avx2_end;
+        }
+#endif
+        end = begin + (end - begin) / z16_lanes * z16_lanes;
+#if defined(__SSSE3__)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+        recursive_filter_horizontal_rows_sse(image, width, begin, end, alpha, deltaZ, radius);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        recursive_filter_horizontal_rows_neon(image, width, begin, end, alpha, deltaZ, radius);
+        return end;
+#else
+        return begin;
+#endif
+    }
+
+    static size_t simd_filter_horizontal(float * image, size_t width, size_t begin, size_t end, float alpha, float deltaZ)
+    {
+#if defined(__SSSE3__) && defined(BUILD_WITH_AVX2)
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t const avx2_end = begin + (end - begin) / (2 * fp_lanes) * (2 * fp_lanes);
+            recursive_filter_horizontal_rows_fp_avx2(image, width, begin, avx2_end, alpha, deltaZ);
+            begin = avx2_end;
+        }
+#endif
+        end = begin + (end - begin) / fp_lanes * fp_lanes;
+#if defined(__SSSE3__)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+        recursive_filter_horizontal_rows_fp_sse(image, width, begin, end, alpha, deltaZ);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        recursive_filter_horizontal_rows_fp_neon(image, width, begin, end, alpha, deltaZ);
+        return end;
+#else
+        return begin;
+#endif
+    }
+
+    static size_t simd_filter_vertical(uint16_t * image, size_t width, size_t height, size_t begin, size_t end, float alpha, float deltaZ)
     {
-        float *image = reinterpret_cast<float*>(image_data);
+#if defined(__SSSE3__) && defined(BUILD_WITH_AVX2)
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t const avx2_end = begin + (end - begin) / (2 * z16_lanes) * (2 * z16_lanes);
+            recursive_filter_vertical_columns_avx2(image, width, height, begin, avx2_end, alpha, deltaZ);
+            begin = avx2_end;
+        }
+#endif
+        end = begin + (end - begin) / z16_lanes * z16_lanes;
+#if defined(__SSSE3__)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+        recursive_filter_vertical_columns_sse(image, width, height, begin, end, alpha, deltaZ);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        recursive_filter_vertical_columns_neon(image, width, height, begin, end, alpha, deltaZ);
+        return end;
+#else
+        return begin;
+#endif
+    }
 
+    static size_t simd_filter_vertical(float * image, size_t width, size_t height, size_t begin, size_t end, float alpha, float deltaZ)
+    {
+#if defined(__SSSE3__) && defined(BUILD_WITH_AVX2)
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t const avx2_end = begin + (end - begin) / (2 * fp_lanes) * (2 * fp_lanes);
+            recursive_filter_vertical_columns_fp_avx2(image, width, height, begin, avx2_end, alpha, deltaZ);
+            begin = avx2_end;
+        }
+#endif
+        end = begin + (end - begin) / fp_lanes * fp_lanes;
+#if defined(__SSSE3__)
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+        recursive_filter_vertical_columns_fp_sse(image, width, height, begin, end, alpha, deltaZ);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        recursive_filter_vertical_columns_fp_neon(image, width, height, begin, end, alpha, deltaZ);
+        return end;
+#else
+        return begin;
+#endif
+    }
+
+    void spatial_filter::recursive_filter_horizontal(uint16_t * image, float alpha, float deltaZ)
+    {
+        parallel_for(_height, [&](size_t begin, size_t end)
+        {
+            begin = simd_filter_horizontal(image, _width, begin, end, alpha, deltaZ, _holes_filling_radius);
+            recursive_filter_horizontal_rows(image, _width, begin, end, alpha, deltaZ, _holes_filling_radius);
+        });
+    }
+
+    void spatial_filter::recursive_filter_horizontal(float * image, float alpha, float deltaZ)
+    {
+        parallel_for(_height, [&](size_t begin, size_t end)
+        {
+            begin = simd_filter_horizontal(image, _width, begin, end, alpha, deltaZ);
+            recursive_filter_horizontal_rows_fp(image, _width, begin, end, alpha, deltaZ);
+        });
+    }
+
+    void spatial_filter::recursive_filter_vertical(uint16_t * image, float alpha, float deltaZ)
+    {
+        parallel_for(_width, [&](size_t begin, size_t end)
+        {
+            begin = simd_filter_vertical(image, _width, _height, begin, end, alpha, deltaZ);
+            recursive_filter_vertical_columns(image, _width, _height, begin, end, alpha, deltaZ);
+        });
+    }
+
+    void spatial_filter::recursive_filter_vertical(float * image, float alpha, float deltaZ)
+    {
+        parallel_for(_width, [&](size_t begin, size_t end)
+        {
+            begin = simd_filter_vertical(image, _width, _height, begin, end, alpha, deltaZ);
+            recursive_filter_vertical_columns_fp(image, _width, _height, begin, end, alpha, deltaZ);
+        });
+    }
+
+    void spatial_filter::parallel_for(size_t n, std::function<void(size_t begin, size_t end)> const & fn)
+    {
+        // A few bands per thread evens out the load, while keeping whole SIMD bands
+        size_t const bands = _workers->get_concurrency() * 4;
+        size_t chunk = (n + bands - 1) / bands;
+        chunk = (chunk + band_lanes - 1) / band_lanes * band_lanes;
+        _workers->parallel_for(n, chunk, fn, _max_threads);
+    }
+
+    template void recursive_filter_horizontal_rows<uint16_t>(uint16_t *, size_t, size_t, size_t, float, float, uint8_t);
+    template void recursive_filter_vertical_columns<uint16_t>(uint16_t *, size_t, size_t, size_t, size_t, float, float);
+
+    void recursive_filter_horizontal_rows_fp(float * image, size_t width, size_t v_begin, size_t v_end, float alpha, float deltaZ)
+    {
         int v, u;
 
-        for (v = 0; v < _height;) {
+        for (v = int(v_begin); v < int(v_end);) {
             // left to right
-            float *im = image + v * _width;
+            float *im = image + v * width;
             float state = *im;
             float previousInnovation = state;
 
             im++;
             float innovation = *im;
-            u = int(_width) - 1;
+            u = int(width) - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidLR;
             // else fall through
@@ -307,9 +523,9 @@ namespace librealsense
         DoneLR:
 
             // right to left
-            im = image + (v + 1) * _width - 2;  // end of row - two pixels
+            im = image + (v + 1) * width - 2;  // end of row - two pixels
             previousInnovation = state = im[1];
-            u = int(_width) - 1;
+            u = int(width) - 1;
             innovation = *im;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidRL;
@@ -366,22 +582,20 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void recursive_filter_vertical_columns_fp(float * image, size_t width, size_t height, size_t u_begin, size_t u_end, float alpha, float deltaZ)
     {
-        float *image = reinterpret_cast<float*>(image_data);
-
         int v, u;
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = int(u_begin); u < int(u_end);) {
 
             float *im = image + u;
             float state = im[0];
             float previousInnovation = state;
 
-            v = int(_height) - 1;
-            im += _width;
+            v = int(height) - 1;
+            im += width;
             float innovation = *im;
 
             if (!(*(int*)&previousInnovation > 0))
@@ -405,7 +619,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -413,7 +627,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyInvalidTB;
                 }
@@ -426,22 +640,22 @@ namespace librealsense
                     goto DoneTB;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyValidTB;
                 }
                 else {
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
             }
         DoneTB:
 
-            im = image + u + (_height - 2) * _width;
-            state = im[_width];
+            im = image + u + (height - 2) * width;
+            state = im[width];
             previousInnovation = state;
             innovation = *im;
-            v = int(_height) - 1;
+            v = int(height) - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidBT;
             // else fall through
@@ -462,7 +676,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -470,7 +684,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyInvalidBT;
                 }
@@ -483,12 +697,12 @@ namespace librealsense
                     goto DoneBT;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyValidBT;
                 }
                 else {
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
             }
@@ -9,261 +9,290 @@
 #include <map>
 #include <vector>
 #include <cmath>
+#include <memory>
+#include <functional>
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include "fused-filter.h"
 
 namespace librealsense
 {
-    class spatial_filter : public depth_processing_block
-    {
-    public:
-        spatial_filter();
-
-    protected:
-        void    update_configuration(const rs2::frame& f);
+    class worker_pool;
 
-        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
-        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+    // The filter passes, over a range of rows (horizontal) or columns (vertical) of a width x height image.
+    // Rows are independent of each other in the horizontal passes and columns in the vertical ones, so ranges can be
+    // filtered concurrently. These are the reference implementations: SIMD versions must produce identical results.
 
-        template <typename T>
-        void dxf_smooth(void *frame_data, float alpha, float delta, int iterations)
-        {
-            static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
-            const bool fp = (std::is_floating_point<T>::value);
+    template <typename T>
+    void recursive_filter_horizontal_rows(T * image, size_t width, size_t v_begin, size_t v_end,
+                                          float alpha, float deltaZ, uint8_t holes_filling_radius)
+    {
+        size_t v{}, u{};
 
-            for (int i = 0; i < iterations; i++)
-            {
-                if (fp)
-                {
-                    recursive_filter_horizontal_fp(frame_data, alpha, delta);
-                    recursive_filter_vertical_fp(frame_data, alpha, delta);
-                }
-                else
-                {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
-                }
-            }
+        // Handle conversions for invalid input data
+        const bool fp = (std::is_floating_point<T>::value);
 
-            // Disparity domain hole filling requires a second pass over the frame data
-            // For depth domain a more efficient in-place hole filling is performed
-            // No need to lock the '_holes_filling_mode' or '_holes_filling_radius' as they are locked at the processing block scope
-            if (_holes_filling_mode && fp)
-                intertial_holes_fill<T>(static_cast<T*>(frame_data));
-        }
+        // Filtering integer values requires round-up to the nearest discrete value
+        const float round = fp ? 0.f : 0.5f;
+        // define invalid inputs
+        const T valid_threshold = fp ? static_cast<T>(std::numeric_limits<T>::epsilon()) : static_cast<T>(1);
+        const T delta_z = static_cast<T>(deltaZ);
 
-        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
-        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
+        size_t cur_fill = 0;
 
-        template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        for (v = v_begin; v < v_end; v++)
         {
-            size_t v{}, u{};
-
-            // Handle conversions for invalid input data
-            const bool fp = (std::is_floating_point<T>::value);
-
-            // Filtering integer values requires round-up to the nearest discrete value
-            const float round = fp ? 0.f : 0.5f;
-            // define invalid inputs
-            const T valid_threshold = fp ? static_cast<T>(std::numeric_limits<T>::epsilon()) : static_cast<T>(1);
-            const T delta_z = static_cast<T>(deltaZ);
-
-            auto image = reinterpret_cast<T*>(image_data);
-            size_t cur_fill = 0;
+            // left to right
+            T *im = image + v * width;
+            T val0 = im[0];
+            cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (u = 1; u < width - 1; u++)
             {
-                // left to right
-                T *im = image + v * _width;
-                T val0 = im[0];
-                cur_fill = 0;
+                T val1 = im[1];
 
-                for (u = 1; u < _width - 1; u++)
+                if (fabs(val0) >= valid_threshold)
                 {
-                    T val1 = im[1];
-
-                    if (fabs(val0) >= valid_threshold)
+                    if (fabs(val1) >= valid_threshold)
                     {
-                        if (fabs(val1) >= valid_threshold)
+                        cur_fill = 0;
+                        T diff = static_cast<T>(fabs(val1 - val0));
+
+                        if (diff >= valid_threshold && diff <= delta_z)
                         {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
-
-                            if (diff >= valid_threshold && diff <= delta_z)
-                            {
-                                float filtered = val1 * alpha + val0 * (1.0f - alpha);
-                                val1 = static_cast<T>(filtered + round);
-                                im[1] = val1;
-                            }
+                            float filtered = val1 * alpha + val0 * (1.0f - alpha);
+                            val1 = static_cast<T>(filtered + round);
+                            im[1] = val1;
                         }
-                        else // Only the old value is valid - appy holes filling
+                    }
+                    else // Only the old value is valid - appy holes filling
+                    {
+                        if (holes_filling_radius)
                         {
-                            if (_holes_filling_radius)
-                            {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[1] = val1 = val0;
-                            }
+                            if (++cur_fill < holes_filling_radius)
+                                im[1] = val1 = val0;
                         }
                     }
-
-                    val0 = val1;
-                    im += 1;
                 }
 
-                // right to left
-                im = image + (v + 1) * _width - 2;  // end of row - two pixels
-                T val1 = im[1];
-                cur_fill = 0;
+                val0 = val1;
+                im += 1;
+            }
 
-                for (u = _width - 1; u > 0; u--)
-                {
-                    T val0 = im[0];
+            // right to left
+            im = image + (v + 1) * width - 2;  // end of row - two pixels
+            T val1 = im[1];
+            cur_fill = 0;
 
-                    if (val1 >= valid_threshold)
+            for (u = width - 1; u > 0; u--)
+            {
+                T val0 = im[0];
+
+                if (val1 >= valid_threshold)
+                {
+                    if (val0 > valid_threshold)
                     {
-                        if (val0 > valid_threshold)
+                        cur_fill = 0;
+                        T diff = static_cast<T>(fabs(val1 - val0));
+
+                        if (diff <= delta_z)
                         {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
-
-                            if (diff <= delta_z)
-                            {
-                                float filtered = val0 * alpha + val1 * (1.0f - alpha);
-                                val0 = static_cast<T>(filtered + round);
-                                im[0] = val0;
-                            }
+                            float filtered = val0 * alpha + val1 * (1.0f - alpha);
+                            val0 = static_cast<T>(filtered + round);
+                            im[0] = val0;
                         }
-                        else // 'inertial' hole filling
+                    }
+                    else // 'inertial' hole filling
+                    {
+                        if (holes_filling_radius)
                         {
-                            if (_holes_filling_radius)
-                            {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[0] = val0 = val1;
-                            }
+                            if (++cur_fill < holes_filling_radius)
+                                im[0] = val0 = val1;
                         }
                     }
-
-                    val1 = val0;
-                    im -= 1;
                 }
+
+                val1 = val0;
+                im -= 1;
             }
         }
+    }
 
-        template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
-        {
-            size_t v{}, u{};
-
-            // Handle conversions for invalid input data
-            const bool fp = (std::is_floating_point<T>::value);
+    template <typename T>
+    void recursive_filter_vertical_columns(T * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                           float alpha, float deltaZ)
+    {
+        size_t v{}, u{};
 
-            // Filtering integer values requires round-up to the nearest discrete value
-            const float round = fp ? 0.f : 0.5f;
-            // define invalid range
-            const T valid_threshold = fp ? static_cast<T>(std::numeric_limits<T>::epsilon()) : static_cast<T>(1);
-            const T delta_z = static_cast<T>(deltaZ);
+        // Handle conversions for invalid input data
+        const bool fp = (std::is_floating_point<T>::value);
 
-            auto image = reinterpret_cast<T*>(image_data);
+        // Filtering integer values requires round-up to the nearest discrete value
+        const float round = fp ? 0.f : 0.5f;
+        // define invalid range
+        const T valid_threshold = fp ? static_cast<T>(std::numeric_limits<T>::epsilon()) : static_cast<T>(1);
+        const T delta_z = static_cast<T>(deltaZ);
 
-            // we'll do one row at a time, top to bottom, then bottom to top
+        // we'll do one row at a time, top to bottom, then bottom to top
 
-            // top to bottom
+        // top to bottom
 
-            T *im = image;
-            T im0{};
-            T imw{};
-            for (v = 1; v < _height; v++)
+        T *im;
+        T im0{};
+        T imw{};
+        for (v = 1; v < height; v++)
+        {
+            im = image + (v - 1) * width + u_begin;
+            for (u = u_begin; u < u_end; u++)
             {
-                for (u = 0; u < _width; u++)
-                {
-                    im0 = im[0];
-                    imw = im[_width];
+                im0 = im[0];
+                imw = im[width];
 
-                    //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                {
+                    T diff = static_cast<T>(fabs(im0 - imw));
+                    if (diff < delta_z)
                     {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
-                        {
-                            float filtered = imw * alpha + im0 * (1.f - alpha);
-                            im[_width] = static_cast<T>(filtered + round);
-                        }
+                        float filtered = imw * alpha + im0 * (1.f - alpha);
+                        im[width] = static_cast<T>(filtered + round);
                     }
-                    im += 1;
                 }
+                im += 1;
             }
+        }
 
-            // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+        // bottom to top
+        for (v = 1; v < height; v++)
+        {
+            im = image + (height - 1 - v) * width + u_begin;
+            for (u = u_begin; u < u_end; u++)
             {
-                for (u = 0; u < _width; u++)
-                {
-                    im0 = im[0];
-                    imw = im[_width];
+                im0 = im[0];
+                imw = im[width];
 
-                    if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                {
+                    T diff = static_cast<T>(fabs(im0 - imw));
+                    if (diff < delta_z)
                     {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
-                        {
-                            float filtered = im0 * alpha + imw * (1.f - alpha);
-                            im[0] = static_cast<T>(filtered + round);
-                        }
+                        float filtered = im0 * alpha + imw * (1.f - alpha);
+                        im[0] = static_cast<T>(filtered + round);
                     }
-                    im += 1;
                 }
+                im += 1;
             }
         }
+    }
 
-        template<typename T>
-        inline void intertial_holes_fill(T* image_data)
-        {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
+    // Instantiated along with the rest of the filter, which is built without fused multiply-adds
+    extern template void recursive_filter_horizontal_rows<uint16_t>(uint16_t *, size_t, size_t, size_t, float, float, uint8_t);
+    extern template void recursive_filter_vertical_columns<uint16_t>(uint16_t *, size_t, size_t, size_t, size_t, float, float);
 
-            size_t cur_fill = 0;
+    void recursive_filter_horizontal_rows_fp(float * image, size_t width, size_t v_begin, size_t v_end,
+                                             float alpha, float deltaZ);
+    void recursive_filter_vertical_columns_fp(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                              float alpha, float deltaZ);
 
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
-            {
-                ++p;
-                cur_fill = 0;
+    template<typename T>
+    inline void intertial_holes_fill_rows(T * image_data, size_t width, size_t v_begin, size_t v_end,
+                                          uint8_t holes_filling_radius)
+    {
+        std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
+        std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
+        auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-                //Left to Right
-                for (size_t i = 1; i < _width; ++i)
-                {
-                    if (empty(p))
-                    {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p - 1);
-                    }
-                    else
-                        cur_fill = 0;
+        size_t cur_fill = 0;
+
+        T* p = image_data + v_begin * width;
+        for (size_t j = v_begin; j < v_end; ++j)
+        {
+            ++p;
+            cur_fill = 0;
 
-                    ++p;
+            //Left to Right
+            for (size_t i = 1; i < width; ++i)
+            {
+                if (empty(p))
+                {
+                    if (++cur_fill < holes_filling_radius)
+                        *p = *(p - 1);
                 }
+                else
+                    cur_fill = 0;
 
-                --p;
-                cur_fill = 0;
-                //Right to left
-                for (size_t i = 1; i < _width; ++i)
+                ++p;
+            }
+
+            --p;
+            cur_fill = 0;
+            //Right to left
+            for (size_t i = 1; i < width; ++i)
+            {
+                if (empty(p))
                 {
-                    if (empty(p))
-                    {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p + 1);
-                    }
-                    else
-                        cur_fill = 0;
-                    --p;
+                    if (++cur_fill < holes_filling_radius)
+                        *p = *(p + 1);
                 }
-                p += _width;
+                else
+                    cur_fill = 0;
+                --p;
+            }
+            p += width;
+        }
+    }
+
+    class spatial_filter : public depth_processing_block, public fusable_filter
+    {
+    public:
+        spatial_filter();
+
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
+    protected:
+        // 'f' is the frame the image comes from, for its sensor: in a fused_filter, other filters may have run since
+        void    update_configuration(const rs2::frame& f, const rs2::stream_profile& profile, rs2_extension type);
+
+        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+        template <typename T>
+        void dxf_smooth(T * image, float alpha, float delta, int iterations)
+        {
+            static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
+
+            for (int i = 0; i < iterations; i++)
+            {
+                recursive_filter_horizontal(image, alpha, delta);
+                recursive_filter_vertical(image, alpha, delta);
             }
+
+            // Disparity domain hole filling requires a second pass over the frame data
+            // For depth domain a more efficient in-place hole filling is performed
+            // No need to lock the '_holes_filling_mode' or '_holes_filling_radius' as they are locked at the processing block scope
+            if (_holes_filling_mode && std::is_floating_point<T>::value)
+                intertial_holes_fill(image);
         }
 
+        // Each pass is split into bands of rows or columns that are filtered on the worker pool
+        void recursive_filter_horizontal(uint16_t * image, float alpha, float deltaZ);
+        void recursive_filter_horizontal(float * image, float alpha, float deltaZ);
+        void recursive_filter_vertical(uint16_t * image, float alpha, float deltaZ);
+        void recursive_filter_vertical(float * image, float alpha, float deltaZ);
+
+        template<typename T>
+        void intertial_holes_fill(T * image_data)
+        {
+            parallel_for(_height, [&](size_t begin, size_t end)
+            {
+                intertial_holes_fill_rows(image_data, _width, begin, end, _holes_filling_radius);
+            });
+        }
+
+        void parallel_for(size_t n, std::function<void(size_t begin, size_t end)> const & fn);
+
     private:
 
         float                   _spatial_alpha_param;
@@ -281,6 +310,8 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        std::shared_ptr<worker_pool> _workers;
+        int                     _max_threads;
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
@@ -0,0 +1,40 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-colorizer.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    void colorize_depth_pixels_avx2(uint8_t * rgb_data, const uint16_t * depth_data, const uint32_t * lut, size_t begin, size_t end)
+    {
+        // Drops the unused byte of each of 4 table entries in a lane, leaving their 12 color bytes first
+        const __m256i pack = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                                              0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        auto table = reinterpret_cast<const int *>(lut);
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m256i d0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(depth_data + i)));
+            __m256i d1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(depth_data + i + 8)));
+            __m256i c01 = _mm256_shuffle_epi8(_mm256_i32gather_epi32(table, d0, 4), pack);
+            __m256i c23 = _mm256_shuffle_epi8(_mm256_i32gather_epi32(table, d1, 4), pack);
+
+            __m128i c0 = _mm256_castsi256_si128(c01);
+            __m128i c1 = _mm256_extracti128_si256(c01, 1);
+            __m128i c2 = _mm256_castsi256_si128(c23);
+            __m128i c3 = _mm256_extracti128_si256(c23, 1);
+
+            // 48 bytes of 16 pixels
+            auto rgb = reinterpret_cast<__m128i *>(rgb_data + i * 3);
+            _mm_storeu_si128(rgb, _mm_or_si128(c0, _mm_slli_si128(c1, 12)));
+            _mm_storeu_si128(rgb + 1, _mm_or_si128(_mm_srli_si128(c1, 4), _mm_slli_si128(c2, 8)));
+            _mm_storeu_si128(rgb + 2, _mm_or_si128(_mm_srli_si128(c2, 8), _mm_slli_si128(c3, 4)));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,16 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 version of colorize_depth_pixels() in colorizer.h, producing identical results, which gathers the table
+    // entries of 8 pixels at once. The range must hold a multiple of 16. Only to be called when the CPU supports AVX2.
+    void colorize_depth_pixels_avx2(uint8_t * rgb_data, const uint16_t * depth_data, const uint32_t * lut, size_t begin, size_t end);
+#endif
+}
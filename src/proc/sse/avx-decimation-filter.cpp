@@ -0,0 +1,194 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-decimation-filter.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    static inline void sort2(__m256i & a, __m256i & b)
+    {
+        __m256i t = _mm256_min_epu16(a, b);
+        b = _mm256_max_epu16(a, b);
+        a = t;
+    }
+
+    static inline void sort4(__m256i * p)
+    {
+        sort2(p[0], p[1]); sort2(p[2], p[3]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]);
+        sort2(p[1], p[2]);
+    }
+
+    // R.W. Floyd's 25-comparator network. Only the lower half of the result is used, and the compiler drops the rest.
+    static inline void sort9(__m256i * p)
+    {
+        sort2(p[0], p[3]); sort2(p[1], p[7]); sort2(p[2], p[5]); sort2(p[4], p[8]);
+        sort2(p[0], p[7]); sort2(p[2], p[4]); sort2(p[3], p[8]); sort2(p[5], p[6]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]); sort2(p[4], p[5]); sort2(p[7], p[8]);
+        sort2(p[1], p[4]); sort2(p[3], p[6]); sort2(p[5], p[7]);
+        sort2(p[0], p[1]); sort2(p[2], p[4]); sort2(p[3], p[5]); sort2(p[6], p[8]);
+        sort2(p[2], p[3]); sort2(p[4], p[5]); sort2(p[6], p[7]);
+        sort2(p[1], p[2]); sort2(p[3], p[4]); sort2(p[5], p[6]);
+    }
+
+    // The median of the non-zero values among p[0..n) in each lane, as picked by the scalar version: the lower of the
+    // middle two for even counts, and 0 when there are none
+    static inline __m256i masked_median(__m256i * p, int n)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+
+        __m256i count = _mm256_set1_epi16(short(n));
+        for (int i = 0; i < n; i++)
+        {
+            __m256i invalid = _mm256_cmpeq_epi16(p[i], zero);
+            count = _mm256_add_epi16(count, invalid);
+            // Zeros become the largest value, so the valid ones are sorted first
+            p[i] = _mm256_or_si256(p[i], invalid);
+        }
+
+        if (n == 4)
+            sort4(p);
+        else
+            sort9(p);
+
+        // The median of 'count' values is the ((count - 1) / 2)-th smallest
+        __m256i res = p[0];
+        for (int i = 1; 2 * i < n; i++)
+            res = _mm256_blendv_epi8(res, p[i], _mm256_cmpgt_epi16(count, _mm256_set1_epi16(short(2 * i))));
+        return _mm256_andnot_si256(_mm256_cmpeq_epi16(count, zero), res);
+    }
+
+    // The columns of 16 patches are gathered 8 patches at a time, within 128-bit lanes, as in the SSE version
+    static inline __m256i combine(__m128i lo, __m128i hi)
+    {
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+
+    static inline void split2(const uint16_t * row, __m256i & even, __m256i & odd)
+    {
+        const __m256i split = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                               0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        // Pixels 0-7 and 16-23, then 8-15 and 24-31, each lane split into its even and odd columns
+        __m256i a = _mm256_shuffle_epi8(combine(_mm_loadu_si128((const __m128i *)row),
+                                                _mm_loadu_si128((const __m128i *)(row + 16))), split);
+        __m256i b = _mm256_shuffle_epi8(combine(_mm_loadu_si128((const __m128i *)(row + 8)),
+                                                _mm_loadu_si128((const __m128i *)(row + 24))), split);
+        even = _mm256_unpacklo_epi64(a, b);
+        odd = _mm256_unpackhi_epi64(a, b);
+    }
+
+    static inline void split3(const uint16_t * row, __m256i * p)
+    {
+        static const int8_t masks[3][3][16] = {
+            { { 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11 } },
+            { { 2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13 } },
+            { { 4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15 } } };
+
+        // Pixels 0-7 and 24-31, 8-15 and 32-39, then 16-23 and 40-47
+        __m256i a = combine(_mm_loadu_si128((const __m128i *)row), _mm_loadu_si128((const __m128i *)(row + 24)));
+        __m256i b = combine(_mm_loadu_si128((const __m128i *)(row + 8)), _mm_loadu_si128((const __m128i *)(row + 32)));
+        __m256i c = combine(_mm_loadu_si128((const __m128i *)(row + 16)), _mm_loadu_si128((const __m128i *)(row + 40)));
+        for (int m = 0; m < 3; m++)
+        {
+            p[m] = _mm256_or_si256(_mm256_or_si256(
+                _mm256_shuffle_epi8(a, _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks[m][0]))),
+                _mm256_shuffle_epi8(b, _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks[m][1])))),
+                _mm256_shuffle_epi8(c, _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks[m][2]))));
+        }
+    }
+
+    void decimate_depth_median_avx2(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        __m256i p[9];
+        for (size_t u = u_begin; u < u_end; u += 16)
+        {
+            auto patch = in + u * scale;
+            if (scale == 2)
+            {
+                split2(patch, p[0], p[1]);
+                split2(patch + width_in, p[2], p[3]);
+                _mm256_storeu_si256((__m256i *)(out + u), masked_median(p, 4));
+            }
+            else
+            {
+                split3(patch, p);
+                split3(patch + width_in, p + 3);
+                split3(patch + 2 * width_in, p + 6);
+                _mm256_storeu_si256((__m256i *)(out + u), masked_median(p, 9));
+            }
+        }
+    }
+
+    void decimate_depth_mean_avx2(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi32(1);
+
+        // Per input column of the 16 patches
+        int32_t col_sums[128];
+        int16_t col_zeros[128];
+
+        for (size_t u = u_begin; u < u_end; u += 16)
+        {
+            auto patch = in + u * scale;
+
+            // Add up the 'scale' rows of each column. Zeros don't change the sum, they are only counted.
+            for (size_t c = 0; c < 16 * scale; c += 16)
+            {
+                __m256i lo = zero, hi = zero, zeros = zero;
+                for (size_t r = 0; r < scale; r++)
+                {
+                    auto row = patch + r * width_in + c;
+                    __m128i p0 = _mm_loadu_si128((const __m128i *)row);
+                    __m128i p1 = _mm_loadu_si128((const __m128i *)(row + 8));
+                    lo = _mm256_add_epi32(lo, _mm256_cvtepu16_epi32(p0));
+                    hi = _mm256_add_epi32(hi, _mm256_cvtepu16_epi32(p1));
+                    zeros = _mm256_sub_epi16(zeros, _mm256_cmpeq_epi16(combine(p0, p1), zero));
+                }
+                _mm256_storeu_si256((__m256i *)(col_sums + c), lo);
+                _mm256_storeu_si256((__m256i *)(col_sums + c + 8), hi);
+                _mm256_storeu_si256((__m256i *)(col_zeros + c), zeros);
+            }
+
+            // Then the columns of each patch
+            int32_t sums[16], counts[16];
+            for (size_t j = 0; j < 16; j++)
+            {
+                int32_t sum = 0;
+                int32_t count = int32_t(scale * scale);
+                for (size_t k = j * scale; k < (j + 1) * scale; k++)
+                {
+                    sum += col_sums[k];
+                    count -= col_zeros[k];
+                }
+                sums[j] = sum;
+                counts[j] = count;
+            }
+
+            // Divided as floats, exactly as in the SSE version
+            __m256i res[2];
+            for (int h = 0; h < 2; h++)
+            {
+                __m256i sum = _mm256_loadu_si256((const __m256i *)(sums + 8 * h));
+                __m256i count = _mm256_loadu_si256((const __m256i *)(counts + 8 * h));
+                count = _mm256_or_si256(count, _mm256_and_si256(_mm256_cmpeq_epi32(count, zero), one));
+                res[h] = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(sum), _mm256_cvtepi32_ps(count)));
+            }
+            // Packing works within 128-bit lanes: put the low lanes' results before the high ones'
+            __m256i packed = _mm256_packus_epi32(res[0], res[1]);
+            _mm256_storeu_si256((__m256i *)(out + u), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+    }
+}
+
+#endif
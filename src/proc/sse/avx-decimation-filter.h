@@ -0,0 +1,17 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the decimation kernels in sse-decimation-filter.h, producing identical results. They compute
+    // 16 output pixels at a time, so the range must hold a multiple of 16. Only to be called when the CPU supports AVX2.
+    void decimate_depth_median_avx2(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end);
+    void decimate_depth_mean_avx2(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end);
+#endif
+}
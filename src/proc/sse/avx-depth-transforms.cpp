@@ -0,0 +1,84 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-depth-transforms.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    // 16 depth values, as two registers of 8 floats
+    static inline void load_depth(const uint16_t * p, __m256i & z, __m256 & lo, __m256 & hi)
+    {
+        z = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        lo = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(z)));
+        hi = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(z, 1)));
+    }
+
+    // Packs the 32-bit values of lo then hi into 16 bits, in order: the pack works within 128-bit lanes, which leaves
+    // their 64-bit quarters out of order
+    static inline __m256i pack(__m256i lo, __m256i hi)
+    {
+        return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+    }
+
+    void threshold_depth_pixels_avx2(const uint16_t * in, uint16_t * out, float units, float min, float max,
+                                     size_t begin, size_t end)
+    {
+        const __m256 u = _mm256_set1_ps(units);
+        const __m256 lo_dist = _mm256_set1_ps(min);
+        const __m256 hi_dist = _mm256_set1_ps(max);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m256i z;
+            __m256 lo, hi;
+            load_depth(in + i, z, lo, hi);
+            lo = _mm256_mul_ps(lo, u);
+            hi = _mm256_mul_ps(hi, u);
+            __m256 keep_lo = _mm256_and_ps(_mm256_cmp_ps(lo, lo_dist, _CMP_GE_OQ), _mm256_cmp_ps(lo, hi_dist, _CMP_LE_OQ));
+            __m256 keep_hi = _mm256_and_ps(_mm256_cmp_ps(hi, lo_dist, _CMP_GE_OQ), _mm256_cmp_ps(hi, hi_dist, _CMP_LE_OQ));
+            __m256i keep = pack(_mm256_castps_si256(keep_lo), _mm256_castps_si256(keep_hi));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_and_si256(z, keep));
+        }
+    }
+
+    void depth_to_meters_pixels_avx2(const uint16_t * in, float * out, float units, size_t begin, size_t end)
+    {
+        const __m256 u = _mm256_set1_ps(units);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m256i z;
+            __m256 lo, hi;
+            load_depth(in + i, z, lo, hi);
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(lo, u));
+            _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(hi, u));
+        }
+    }
+
+    // As in the SSE version
+    static inline __m256i to_depth(__m256 d, __m256 factor)
+    {
+        const __m256i abs_bits = _mm256_and_si256(_mm256_castps_si256(d), _mm256_set1_epi32(0x7FFFFFFF));
+        const __m256i normal = _mm256_andnot_si256(_mm256_cmpgt_epi32(abs_bits, _mm256_set1_epi32(0x7F7FFFFF)),
+                                                   _mm256_cmpgt_epi32(abs_bits, _mm256_set1_epi32(0x007FFFFF)));
+        __m256i z = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(factor, d), _mm256_set1_ps(0.5f)));
+        z = _mm256_srai_epi32(_mm256_slli_epi32(z, 16), 16);
+        return _mm256_and_si256(z, normal);
+    }
+
+    void disparity_to_depth_pixels_avx2(const float * in, uint16_t * out, float d2d_convert_factor,
+                                        size_t begin, size_t end)
+    {
+        const __m256 factor = _mm256_set1_ps(d2d_convert_factor);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m256i lo = to_depth(_mm256_loadu_ps(in + i), factor);
+            __m256i hi = to_depth(_mm256_loadu_ps(in + i + 8), factor);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), pack(lo, hi));
+        }
+    }
+}
+
+#endif
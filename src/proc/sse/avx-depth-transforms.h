@@ -0,0 +1,20 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the kernels in sse-depth-transforms.h, producing identical results. They convert 16 pixels at
+    // a time: the range must hold a multiple of 16. Only to be called when the CPU supports AVX2.
+    void threshold_depth_pixels_avx2(const uint16_t * in, uint16_t * out, float units, float min, float max,
+                                     size_t begin, size_t end);
+    void depth_to_meters_pixels_avx2(const uint16_t * in, float * out, float units, size_t begin, size_t end);
+    void disparity_to_depth_pixels_avx2(const float * in, uint16_t * out, float d2d_convert_factor,
+                                        size_t begin, size_t end);
+#endif
+}
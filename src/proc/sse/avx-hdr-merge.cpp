@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-hdr-merge.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    static inline __m256i load(const uint16_t * p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+
+    // 16 IR bytes, widened to 16 bits
+    static inline __m256i load(const uint8_t * p)
+    {
+        return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+    }
+
+    // All ones where lo <= ir <= hi
+    static inline __m256i in_range(__m256i ir, __m256i lo, __m256i hi)
+    {
+        return _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(ir, lo), ir),
+                                _mm256_cmpeq_epi16(_mm256_min_epu16(ir, hi), ir));
+    }
+
+    // The depth of the first frame where it is valid and non-zero: 'a' and 'b' already hold 0 where it is not valid
+    static inline __m256i merge(__m256i a, __m256i b)
+    {
+        return _mm256_or_si256(a, _mm256_and_si256(_mm256_cmpeq_epi16(a, _mm256_setzero_si256()), b));
+    }
+
+    void hdr_merge_depth_pixels_avx2(const uint16_t * d0, const uint16_t * d1, uint16_t * out, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), merge(load(d0 + i), load(d1 + i)));
+    }
+
+    template<class T>
+    static inline void merge_ir(const uint16_t * d0, const uint16_t * d1, const T * ir0, const T * ir1,
+                                int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        // Valid IR values are strictly between ir_min and ir_max
+        const __m256i lo = _mm256_set1_epi16(short(ir_min + 1));
+        const __m256i hi = _mm256_set1_epi16(short(ir_max - 1));
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m256i a = _mm256_and_si256(load(d0 + i), in_range(load(ir0 + i), lo, hi));
+            __m256i b = _mm256_and_si256(load(d1 + i), in_range(load(ir1 + i), lo, hi));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), merge(a, b));
+        }
+    }
+
+    void hdr_merge_y8_pixels_avx2(const uint16_t * d0, const uint16_t * d1, const uint8_t * ir0, const uint8_t * ir1,
+                                  int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+
+    void hdr_merge_y16_pixels_avx2(const uint16_t * d0, const uint16_t * d1, const uint16_t * ir0, const uint16_t * ir1,
+                                   int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+}
+
+#endif
@@ -0,0 +1,20 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the kernels in sse-hdr-merge.h, producing identical results. They merge 16 pixels at a time:
+    // the range must hold a multiple of 16. Only to be called when the CPU supports AVX2.
+    void hdr_merge_depth_pixels_avx2(const uint16_t * d0, const uint16_t * d1, uint16_t * out, size_t begin, size_t end);
+    void hdr_merge_y8_pixels_avx2(const uint16_t * d0, const uint16_t * d1, const uint8_t * ir0, const uint8_t * ir1,
+                                  int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end);
+    void hdr_merge_y16_pixels_avx2(const uint16_t * d0, const uint16_t * d1, const uint16_t * ir0, const uint16_t * ir1,
+                                   int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end);
+#endif
+}
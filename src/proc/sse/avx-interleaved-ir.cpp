@@ -0,0 +1,127 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-interleaved-ir.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    static inline __m256i scale_to_16_bits(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_slli_epi16(x, 6), _mm256_srli_epi16(x, 4));
+    }
+
+    static inline __m256i load(const uint8_t * p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+
+    // Two 16-byte loads, into the low and high lanes
+    static inline __m256i load2(const uint8_t * lo, const uint8_t * hi)
+    {
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lo))),
+                                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi)), 1);
+    }
+
+    static inline void store(void * p, __m256i x)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x);
+    }
+
+    // Each lane of a and b holds its left values in its lower 8 bytes, and its right values in its upper 8 bytes.
+    // Unpacking the 64-bit halves gathers them out of order, which a permutation of the 64-bit quarters undoes.
+    static inline void gather_halves(__m256i a, __m256i b, __m256i & left, __m256i & right)
+    {
+        left = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+        right = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+    }
+
+    static inline void split_y8(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end, __m256i mask)
+    {
+        for (size_t i = begin; i < end; i += 32)
+        {
+            const uint8_t * in = source + i * 2;
+            __m256i l, r;
+            gather_halves(_mm256_shuffle_epi8(load(in), mask), _mm256_shuffle_epi8(load(in + 32), mask), l, r);
+            store(left + i, l);
+            store(right + i, r);
+        }
+    }
+
+    void split_y8i_pixels_avx2(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        const __m256i mask = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                              0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        split_y8(source, left, right, begin, end, mask);
+    }
+
+    void split_y8i_mipi_pixels_avx2(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        const __m256i mask = _mm256_setr_epi8(2, 0, 6, 4, 10, 8, 14, 12, 1, 3, 5, 7, 9, 11, 13, 15,
+                                              2, 0, 6, 4, 10, 8, 14, 12, 1, 3, 5, 7, 9, 11, 13, 15);
+        split_y8(source, left, right, begin, end, mask);
+    }
+
+    static inline void store_y12(__m256i r, __m256i l, uint16_t * left, uint16_t * right)
+    {
+        r = _mm256_and_si256(r, _mm256_set1_epi16(0x0FFF));
+        l = _mm256_srli_epi16(l, 4);
+        store(left, scale_to_16_bits(l));
+        store(right, scale_to_16_bits(r));
+    }
+
+    void split_y12i_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        // Each lane works on 8 pixels, as the SSSE3 version does
+        const __m256i r_lo = _mm256_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m256i r_hi = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14,
+                                              -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14);
+        const __m256i l_lo = _mm256_setr_epi8(1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m256i l_hi = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15,
+                                              -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            const uint8_t * in = source + i * 3;
+            __m256i lo = load2(in, in + 24);
+            __m256i hi = load2(in + 8, in + 32);
+            __m256i r = _mm256_or_si256(_mm256_shuffle_epi8(lo, r_lo), _mm256_shuffle_epi8(hi, r_hi));
+            __m256i l = _mm256_or_si256(_mm256_shuffle_epi8(lo, l_lo), _mm256_shuffle_epi8(hi, l_hi));
+            store_y12(r, l, left + i, right + i);
+        }
+    }
+
+    void split_y12i_mipi_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        // Each lane gathers the right values of its 4 pixels in its lower 8 bytes, and the left ones in its upper 8
+        const __m256i r_l = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 1, 2, 5, 6, 9, 10, 13, 14,
+                                             0, 1, 4, 5, 8, 9, 12, 13, 1, 2, 5, 6, 9, 10, 13, 14);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            const uint8_t * in = source + i * 4;
+            __m256i r, l;
+            gather_halves(_mm256_shuffle_epi8(load(in), r_l), _mm256_shuffle_epi8(load(in + 32), r_l), r, l);
+            store_y12(r, l, left + i, right + i);
+        }
+    }
+
+    void split_y16i_10msb_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        const __m256i mask = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                              0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            const uint8_t * in = source + i * 4;
+            __m256i l, r;
+            gather_halves(_mm256_shuffle_epi8(load(in), mask), _mm256_shuffle_epi8(load(in + 32), mask), l, r);
+            store(left + i, scale_to_16_bits(l));
+            store(right + i, scale_to_16_bits(r));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,21 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the kernels in sse-interleaved-ir.h, producing identical results. The Y8I kernels split 32
+    // pixels at a time and the others 16: the range must hold a multiple of that. Only to be called when the CPU
+    // supports AVX2.
+    void split_y8i_pixels_avx2(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end);
+    void split_y8i_mipi_pixels_avx2(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end);
+    void split_y12i_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+    void split_y12i_mipi_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+    void split_y16i_10msb_pixels_avx2(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+#endif
+}
@@ -0,0 +1,42 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-pointcloud.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    void deproject_depth_pixels_avx2(float3 * points, const uint16_t * depth, const float * rays_x, const float * rays_y,
+                                     size_t begin, size_t end, float depth_scale)
+    {
+        const __m256 scale = _mm256_set1_ps(depth_scale);
+
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m256 z = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(depth + i))));
+            z = _mm256_mul_ps(z, scale);
+            __m256 x = _mm256_mul_ps(z, _mm256_loadu_ps(rays_x + i));
+            __m256 y = _mm256_mul_ps(z, _mm256_loadu_ps(rays_y + i));
+
+            // Interleave the 4 points of each 128-bit lane, as in the SSE version
+            __m256 x_y = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));     // x0 x2 y0 y2
+            __m256 z_x = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));     // z0 z2 x1 x3
+            __m256 y_z = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));     // y1 y3 z1 z3
+
+            __m256 xyz0 = _mm256_shuffle_ps(x_y, z_x, _MM_SHUFFLE(2, 0, 2, 0));    // x0 y0 z0 x1
+            __m256 xyz1 = _mm256_shuffle_ps(y_z, x_y, _MM_SHUFFLE(3, 1, 2, 0));    // y1 z1 x2 y2
+            __m256 xyz2 = _mm256_shuffle_ps(z_x, y_z, _MM_SHUFFLE(3, 1, 3, 1));    // z2 x3 y3 z3
+
+            // Then put the points of the low lanes before those of the high lanes
+            auto point = reinterpret_cast<float *>(points + i);
+            _mm256_storeu_ps(point, _mm256_permute2f128_ps(xyz0, xyz1, 0x20));
+            _mm256_storeu_ps(point + 8, _mm256_permute2f128_ps(xyz2, xyz0, 0x30));
+            _mm256_storeu_ps(point + 16, _mm256_permute2f128_ps(xyz1, xyz2, 0x31));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,19 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <src/float3.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 version of deproject_depth_pixels() in pointcloud.h, producing identical results. Pixels are deprojected
+    // 8 at a time, so the range must hold a multiple of 8. Only to be called when the CPU supports AVX2.
+    void deproject_depth_pixels_avx2(float3 * points, const uint16_t * depth, const float * rays_x, const float * rays_y,
+                                     size_t begin, size_t end, float depth_scale);
+#endif
+}
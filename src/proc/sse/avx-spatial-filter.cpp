@@ -0,0 +1,376 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-spatial-filter.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+#include <vector>
+
+namespace librealsense
+{
+    namespace
+    {
+        inline __m256i select(__m256i mask, __m256i a, __m256i b)
+        {
+            return _mm256_blendv_epi8(b, a, mask);
+        }
+
+        inline __m256 select(__m256 mask, __m256 a, __m256 b)
+        {
+            return _mm256_blendv_ps(b, a, mask);
+        }
+
+        inline __m256i is_zero(__m256i a)
+        {
+            return _mm256_cmpeq_epi16(a, _mm256_setzero_si256());
+        }
+
+        inline __m256i is_not(__m256i mask)
+        {
+            return _mm256_xor_si256(mask, _mm256_set1_epi32(-1));
+        }
+
+        // |a - b| of unsigned 16-bit lanes
+        inline __m256i abs_diff(__m256i a, __m256i b)
+        {
+            return _mm256_or_si256(_mm256_subs_epu16(a, b), _mm256_subs_epu16(b, a));
+        }
+
+        // a <= b of unsigned 16-bit lanes
+        inline __m256i less_equal(__m256i a, __m256i b)
+        {
+            return is_zero(_mm256_subs_epu16(a, b));
+        }
+
+        // a < b of unsigned 16-bit lanes
+        inline __m256i less(__m256i a, __m256i b)
+        {
+            return is_not(is_zero(_mm256_subs_epu16(b, a)));
+        }
+
+        // Transposes 8 rows of 8 pixels from 'src' into 8 groups of 8 lanes in 'dst', 'dst_stride' pixels apart (or back)
+        inline void transpose_8x8(const uint16_t * src, size_t src_stride, uint16_t * dst, size_t dst_stride)
+        {
+            __m128i r[8];
+            for (int i = 0; i < 8; ++i)
+                r[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * src_stride));
+
+            __m128i a[8], b[8];
+            for (int i = 0; i < 4; ++i)
+            {
+                a[2 * i] = _mm_unpacklo_epi16(r[2 * i], r[2 * i + 1]);
+                a[2 * i + 1] = _mm_unpackhi_epi16(r[2 * i], r[2 * i + 1]);
+            }
+            for (int i = 0; i < 2; ++i)
+            {
+                b[2 * i] = _mm_unpacklo_epi32(a[i], a[i + 2]);
+                b[2 * i + 1] = _mm_unpackhi_epi32(a[i], a[i + 2]);
+                b[2 * i + 4] = _mm_unpacklo_epi32(a[i + 4], a[i + 6]);
+                b[2 * i + 5] = _mm_unpackhi_epi32(a[i + 4], a[i + 6]);
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i * dst_stride), _mm_unpacklo_epi64(b[i], b[i + 4]));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + (2 * i + 1) * dst_stride), _mm_unpackhi_epi64(b[i], b[i + 4]));
+            }
+        }
+
+        // Same for 4 rows of 4 floats
+        inline void transpose_4x4(const float * src, size_t src_stride, float * dst, size_t dst_stride)
+        {
+            __m128 r0 = _mm_loadu_ps(src);
+            __m128 r1 = _mm_loadu_ps(src + src_stride);
+            __m128 r2 = _mm_loadu_ps(src + 2 * src_stride);
+            __m128 r3 = _mm_loadu_ps(src + 3 * src_stride);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst, r0);
+            _mm_storeu_ps(dst + dst_stride, r1);
+            _mm_storeu_ps(dst + 2 * dst_stride, r2);
+            _mm_storeu_ps(dst + 3 * dst_stride, r3);
+        }
+
+        // The parameters and the arithmetic of the Z16 filter, on 16 lanes
+        struct z16_filter
+        {
+            __m256 alpha;
+            __m256 one_minus_alpha;
+            __m256 round;
+            __m256i delta_z;
+            __m256i radius;
+
+            z16_filter(float alpha_, float deltaZ, uint8_t holes_filling_radius)
+                : alpha(_mm256_set1_ps(alpha_))
+                , one_minus_alpha(_mm256_set1_ps(1.f - alpha_))
+                , round(_mm256_set1_ps(0.5f))
+                , delta_z(_mm256_set1_epi16(short(static_cast<uint16_t>(deltaZ))))
+                , radius(_mm256_set1_epi16(holes_filling_radius))
+            {
+            }
+
+            __m256 blend(__m128i a, __m128i b) const
+            {
+                return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(a)), alpha),
+                                                   _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(b)), one_minus_alpha)),
+                                     round);
+            }
+
+            // static_cast<uint16_t>(a * alpha + b * (1 - alpha) + 0.5f), with the same float operations
+            __m256i blend(__m256i a, __m256i b) const
+            {
+                __m256 lo = blend(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+                __m256 hi = blend(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+                // The pack works within each half
+                return _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_cvttps_epi32(lo), _mm256_cvttps_epi32(hi)), 0xd8);
+            }
+
+            // The 'inertial' hole filling counter: reset when both pixels are valid, counted up while filling
+            __m256i count_fill(__m256i cur_fill, __m256i both_valid, __m256i filling) const
+            {
+                cur_fill = _mm256_andnot_si256(both_valid, cur_fill);
+                return _mm256_adds_epu16(cur_fill, _mm256_and_si256(filling, _mm256_set1_epi16(1)));
+            }
+        };
+
+        // Both directions of the horizontal pass over a band of 16 rows, transposed so that each element of 'col'
+        // holds a column of the band
+        void filter_band(uint16_t * col, size_t width, z16_filter const & f, bool holes_filling)
+        {
+            const __m256i one = _mm256_set1_epi16(1);
+            const __m256i none = _mm256_setzero_si256();
+
+            // left to right
+            __m256i val0 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(col));
+            __m256i cur_fill = none;
+            for (size_t u = 1; u < width - 1; u++)
+            {
+                __m256i * im = reinterpret_cast<__m256i *>(col + u * 16);
+                __m256i val1 = _mm256_loadu_si256(im);
+
+                __m256i invalid0 = is_zero(val0);
+                __m256i invalid1 = is_zero(val1);
+                __m256i both_valid = is_not(_mm256_or_si256(invalid0, invalid1));
+                __m256i diff = abs_diff(val1, val0);
+                __m256i smooth = _mm256_and_si256(both_valid, _mm256_andnot_si256(is_zero(diff), less_equal(diff, f.delta_z)));
+                __m256i out = select(smooth, f.blend(val1, val0), val1);
+                if (holes_filling)
+                {
+                    __m256i filling = _mm256_andnot_si256(invalid0, invalid1);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = select(_mm256_and_si256(filling, less(cur_fill, f.radius)), val0, out);
+                }
+
+                _mm256_storeu_si256(im, out);
+                val0 = out;
+            }
+
+            // right to left
+            __m256i val1 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(col + (width - 1) * 16));
+            cur_fill = none;
+            for (size_t u = width - 1; u > 0; u--)
+            {
+                __m256i * im = reinterpret_cast<__m256i *>(col + (u - 1) * 16);
+                __m256i val0 = _mm256_loadu_si256(im);
+
+                __m256i invalid1 = is_zero(val1);
+                __m256i invalid0 = less_equal(val0, one);
+                __m256i both_valid = is_not(_mm256_or_si256(invalid0, invalid1));
+                __m256i smooth = _mm256_and_si256(both_valid, less_equal(abs_diff(val1, val0), f.delta_z));
+                __m256i out = select(smooth, f.blend(val0, val1), val0);
+                if (holes_filling)
+                {
+                    __m256i filling = _mm256_andnot_si256(invalid1, invalid0);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = select(_mm256_and_si256(filling, less(cur_fill, f.radius)), val1, out);
+                }
+
+                _mm256_storeu_si256(im, out);
+                val1 = out;
+            }
+        }
+
+        // One step of the disparity filter recursion, on 8 lanes; see sse-spatial-filter.cpp
+        struct fp_filter
+        {
+            __m256 alpha;
+            __m256 one_minus_alpha;
+            __m256 delta_z;
+            __m256 minus_delta_z;
+
+            fp_filter(float alpha_, float deltaZ)
+                : alpha(_mm256_set1_ps(alpha_))
+                , one_minus_alpha(_mm256_set1_ps(1.0f - alpha_))
+                , delta_z(_mm256_set1_ps(deltaZ))
+                , minus_delta_z(_mm256_set1_ps(-deltaZ))
+            {
+            }
+
+            static __m256 is_valid(__m256 x)
+            {
+                return _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_castps_si256(x), _mm256_setzero_si256()));
+            }
+
+            // Returns the filtered innovation
+            __m256 step(__m256 innovation, __m256 & state, __m256 & previous_innovation, __m256 & valid) const
+            {
+                __m256 innovation_valid = is_valid(innovation);
+                __m256 delta = _mm256_sub_ps(previous_innovation, innovation);
+                // The same comparisons as _mm_cmplt_ps and _mm_cmpgt_ps
+                __m256 small_difference = _mm256_and_ps(_mm256_cmp_ps(delta, delta_z, _CMP_LT_OS),
+                                                        _mm256_cmp_ps(delta, minus_delta_z, _CMP_GT_OS));
+                __m256 smooth = _mm256_and_ps(_mm256_and_ps(valid, innovation_valid), small_difference);
+                __m256 filtered = _mm256_add_ps(_mm256_mul_ps(innovation, alpha), _mm256_mul_ps(state, one_minus_alpha));
+
+                state = select(smooth, filtered, select(innovation_valid, innovation, state));
+                previous_innovation = innovation;
+                valid = innovation_valid;
+                return select(smooth, filtered, innovation);
+            }
+        };
+
+        void filter_band(float * col, size_t width, fp_filter const & f)
+        {
+            // left to right
+            __m256 state = _mm256_loadu_ps(col);
+            __m256 previous_innovation = state;
+            __m256 valid = fp_filter::is_valid(state);
+            for (size_t u = 1; u < width; u++)
+                _mm256_storeu_ps(col + u * 8, f.step(_mm256_loadu_ps(col + u * 8), state, previous_innovation, valid));
+
+            // right to left
+            state = _mm256_loadu_ps(col + (width - 1) * 8);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t u = width - 1; u > 0; u--)
+                _mm256_storeu_ps(col + (u - 1) * 8, f.step(_mm256_loadu_ps(col + (u - 1) * 8), state, previous_innovation, valid));
+        }
+    }
+
+    void recursive_filter_horizontal_rows_avx2(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                               float alpha, float deltaZ, uint8_t holes_filling_radius)
+    {
+        const z16_filter f(alpha, deltaZ, holes_filling_radius);
+        std::vector<uint16_t> columns(width * 16);
+        uint16_t * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 16)
+        {
+            uint16_t * rows = image + v * width;
+
+            // Rows 0-7 of the band go to lanes 0-7 of each column, and rows 8-15 to lanes 8-15
+            size_t u = 0;
+            for (; u + 8 <= width; u += 8)
+                for (size_t half = 0; half < 2; ++half)
+                    transpose_8x8(rows + half * 8 * width + u, width, col + u * 16 + half * 8, 16);
+            for (; u < width; ++u)
+                for (int i = 0; i < 16; ++i)
+                    col[u * 16 + i] = rows[i * width + u];
+
+            filter_band(col, width, f, holes_filling_radius != 0);
+
+            for (u = 0; u + 8 <= width; u += 8)
+                for (size_t half = 0; half < 2; ++half)
+                    transpose_8x8(col + u * 16 + half * 8, 16, rows + half * 8 * width + u, width);
+            for (; u < width; ++u)
+                for (int i = 0; i < 16; ++i)
+                    rows[i * width + u] = col[u * 16 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_avx2(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                float alpha, float deltaZ)
+    {
+        const z16_filter f(alpha, deltaZ, 0);
+
+        for (size_t u = u_begin; u < u_end; u += 16)
+        {
+            // top to bottom
+            __m256i * im = reinterpret_cast<__m256i *>(image + u);
+            __m256i im0 = _mm256_loadu_si256(im);
+            for (size_t v = 1; v < height; v++)
+            {
+                im = reinterpret_cast<__m256i *>(image + v * width + u);
+                __m256i imw = _mm256_loadu_si256(im);
+                __m256i smooth = less(abs_diff(im0, imw), f.delta_z);
+                im0 = select(smooth, f.blend(imw, im0), imw);
+                _mm256_storeu_si256(im, im0);
+            }
+
+            // bottom to top
+            __m256i imw = im0;
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                im = reinterpret_cast<__m256i *>(image + (v - 1) * width + u);
+                im0 = _mm256_loadu_si256(im);
+                __m256i valid = is_not(_mm256_or_si256(is_zero(im0), is_zero(imw)));
+                __m256i smooth = _mm256_and_si256(valid, less(abs_diff(im0, imw), f.delta_z));
+                imw = select(smooth, f.blend(im0, imw), im0);
+                _mm256_storeu_si256(im, imw);
+            }
+        }
+    }
+
+    void recursive_filter_horizontal_rows_fp_avx2(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                  float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+        std::vector<float> columns(width * 8);
+        float * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 8)
+        {
+            float * rows = image + v * width;
+
+            // Rows 0-3 of the band go to lanes 0-3 of each column, and rows 4-7 to lanes 4-7
+            size_t u = 0;
+            for (; u + 4 <= width; u += 4)
+                for (size_t half = 0; half < 2; ++half)
+                    transpose_4x4(rows + half * 4 * width + u, width, col + u * 8 + half * 4, 8);
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    col[u * 8 + i] = rows[i * width + u];
+
+            filter_band(col, width, f);
+
+            for (u = 0; u + 4 <= width; u += 4)
+                for (size_t half = 0; half < 2; ++half)
+                    transpose_4x4(col + u * 8 + half * 4, 8, rows + half * 4 * width + u, width);
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    rows[i * width + u] = col[u * 8 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_fp_avx2(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                   float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            // top to bottom
+            __m256 state = _mm256_loadu_ps(image + u);
+            __m256 previous_innovation = state;
+            __m256 valid = fp_filter::is_valid(state);
+            for (size_t v = 1; v < height; v++)
+            {
+                float * im = image + v * width + u;
+                _mm256_storeu_ps(im, f.step(_mm256_loadu_ps(im), state, previous_innovation, valid));
+            }
+
+            // bottom to top
+            state = _mm256_loadu_ps(image + (height - 1) * width + u);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                float * im = image + (v - 1) * width + u;
+                _mm256_storeu_ps(im, f.step(_mm256_loadu_ps(im), state, previous_innovation, valid));
+            }
+        }
+    }
+}
+
+#endif
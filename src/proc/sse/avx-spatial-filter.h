@@ -0,0 +1,24 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the spatial filter passes in sse-spatial-filter.h, producing identical results. With twice the
+    // lanes, ranges must hold a multiple of 16 rows/columns for Z16 data, and of 8 for disparity. Only to be called
+    // when the CPU supports AVX2.
+    void recursive_filter_horizontal_rows_avx2(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                               float alpha, float deltaZ, uint8_t holes_filling_radius);
+    void recursive_filter_vertical_columns_avx2(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                float alpha, float deltaZ);
+    void recursive_filter_horizontal_rows_fp_avx2(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                  float alpha, float deltaZ);
+    void recursive_filter_vertical_columns_fp_avx2(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                   float alpha, float deltaZ);
+#endif
+}
@@ -0,0 +1,183 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-temporal-filter.h"
+
+#if defined(BUILD_WITH_AVX2) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        inline __m256i select(__m256i mask, __m256i a, __m256i b)
+        {
+            return _mm256_blendv_epi8(b, a, mask);
+        }
+
+        inline __m256i is_not_zero(__m256i a)
+        {
+            return _mm256_xor_si256(_mm256_cmpeq_epi16(a, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+        }
+
+        // As in sse-temporal-filter.cpp: whether persistence_map[history] has the bit of the current phase, for 32
+        // history bytes at once. The byte shuffles work within each half, so both hold the same tables.
+        class credibility
+        {
+            __m256i _low_table;     // histories 0x00-0x7f
+            __m256i _high_table;    // histories 0x80-0xff
+
+        public:
+            credibility(const uint8_t * persistence_map, uint8_t phase)
+            {
+                uint8_t tables[2][16] = {};
+                for (int h = 0; h < 256; ++h)
+                    if (persistence_map[h] & (1 << phase))
+                        tables[h >> 7][h & 0x0f] |= uint8_t(1 << ((h >> 4) & 7));
+                _low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(tables[0])));
+                _high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(tables[1])));
+            }
+
+            // 0xff for credible histories, 0 otherwise
+            __m256i operator()(__m256i history) const
+            {
+                const __m256i nibble = _mm256_set1_epi8(0x0f);
+                const __m256i bit = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                                     1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+                __m256i low = _mm256_and_si256(history, nibble);
+                __m256i high = _mm256_and_si256(_mm256_srli_epi16(history, 4), nibble);
+                __m256i bits = _mm256_shuffle_epi8(bit, high);
+                __m256i table = select(_mm256_cmpgt_epi8(high, _mm256_set1_epi8(7)),
+                                       _mm256_shuffle_epi8(_high_table, low),
+                                       _mm256_shuffle_epi8(_low_table, low));
+                return _mm256_cmpeq_epi8(_mm256_and_si256(table, bits), bits);
+            }
+        };
+
+        // The new history of 32 pixels, given which have a value and which of those agree with the last one
+        inline __m256i update_history(__m256i history, __m256i mask, __m256i cur_valid, __m256i agree)
+        {
+            return select(cur_valid, select(agree, _mm256_or_si256(history, mask), mask), _mm256_andnot_si256(mask, history));
+        }
+
+        // Packs two vectors of 16-bit masks into one of 8-bit masks, in order (the packs work within each half)
+        inline __m256i pack_masks(__m256i a, __m256i b)
+        {
+            return _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xd8);
+        }
+
+        // Same, from four vectors of 32-bit masks
+        inline __m256i pack_masks(__m256i a, __m256i b, __m256i c, __m256i d)
+        {
+            __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+            return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        }
+    }
+
+    void temporal_filter_pixels_avx2(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const __m256i mask = _mm256_set1_epi8(char(1 << phase));
+        const __m256i delta_z = _mm256_set1_epi16(delta);
+        const __m256 alpha_ = _mm256_set1_ps(alpha);
+        const __m256 one_minus_alpha = _mm256_set1_ps(1.f - alpha);
+
+        for (size_t i = begin; i < end; i += 32)
+        {
+            __m256i * hist = reinterpret_cast<__m256i *>(history + i);
+            __m256i h = _mm256_loadu_si256(hist);
+            __m256i credible = is_credible(h);
+            __m256i cur_valid[2], agree[2];
+
+            for (int k = 0; k < 2; ++k)
+            {
+                __m256i * cur_ptr = reinterpret_cast<__m256i *>(frame + i + k * 16);
+                __m256i * prev_ptr = reinterpret_cast<__m256i *>(last_frame + i + k * 16);
+                __m256i cur = _mm256_loadu_si256(cur_ptr);
+                __m256i prev = _mm256_loadu_si256(prev_ptr);
+
+                cur_valid[k] = is_not_zero(cur);
+                __m256i prev_valid = is_not_zero(prev);
+                __m256i diff = _mm256_or_si256(_mm256_subs_epu16(cur, prev), _mm256_subs_epu16(prev, cur));
+                __m256i close = is_not_zero(_mm256_subs_epu16(delta_z, diff));  // diff < delta_z
+                agree[k] = _mm256_and_si256(_mm256_and_si256(cur_valid[k], prev_valid), close);
+
+                // static_cast<uint16_t>(alpha * cur + (1 - alpha) * prev), with the same float operations
+                __m256 lo = _mm256_add_ps(
+                    _mm256_mul_ps(alpha_, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(cur)))),
+                    _mm256_mul_ps(one_minus_alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(prev)))));
+                __m256 hi = _mm256_add_ps(
+                    _mm256_mul_ps(alpha_, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(cur, 1)))),
+                    _mm256_mul_ps(one_minus_alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(prev, 1)))));
+                __m256i filtered = _mm256_permute4x64_epi64(
+                    _mm256_packus_epi32(_mm256_cvttps_epi32(lo), _mm256_cvttps_epi32(hi)), 0xd8);
+
+                __m256i updated = select(agree[k], filtered, cur);
+                __m256i credible16 = _mm256_cvtepi8_epi16(k ? _mm256_extracti128_si256(credible, 1)
+                                                            : _mm256_castsi256_si128(credible));
+                __m256i filled = select(_mm256_and_si256(prev_valid, credible16), prev, cur);
+                _mm256_storeu_si256(cur_ptr, select(cur_valid[k], updated, filled));
+                _mm256_storeu_si256(prev_ptr, select(cur_valid[k], updated, prev));
+            }
+
+            _mm256_storeu_si256(hist, update_history(h, mask,
+                                                     pack_masks(cur_valid[0], cur_valid[1]),
+                                                     pack_masks(agree[0], agree[1])));
+        }
+    }
+
+    void temporal_filter_pixels_avx2(float * frame, float * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const __m256i mask = _mm256_set1_epi8(char(1 << phase));
+        const __m256 delta_z = _mm256_set1_ps(static_cast<float>(delta));
+        const __m256 alpha_ = _mm256_set1_ps(alpha);
+        const __m256 one_minus_alpha = _mm256_set1_ps(1.f - alpha);
+        const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        const __m256 zero = _mm256_setzero_ps();
+
+        for (size_t i = begin; i < end; i += 32)
+        {
+            __m256i * hist = reinterpret_cast<__m256i *>(history + i);
+            __m256i h = _mm256_loadu_si256(hist);
+            __m256i credible = is_credible(h);
+            __m128i credible_halves[2] = { _mm256_castsi256_si128(credible), _mm256_extracti128_si256(credible, 1) };
+            __m256i cur_valid[4], agree[4];
+
+            for (int k = 0; k < 4; ++k)
+            {
+                float * cur_ptr = frame + i + k * 8;
+                float * prev_ptr = last_frame + i + k * 8;
+                __m256 cur = _mm256_loadu_ps(cur_ptr);
+                __m256 prev = _mm256_loadu_ps(prev_ptr);
+
+                // The same comparisons as _mm_cmpneq_ps and _mm_cmplt_ps
+                __m256 cur_valid_ps = _mm256_cmp_ps(cur, zero, _CMP_NEQ_UQ);
+                __m256 prev_valid = _mm256_cmp_ps(prev, zero, _CMP_NEQ_UQ);
+                __m256 diff = _mm256_and_ps(_mm256_sub_ps(cur, prev), abs_mask);
+                __m256 agree_ps = _mm256_and_ps(_mm256_and_ps(cur_valid_ps, prev_valid), _mm256_cmp_ps(diff, delta_z, _CMP_LT_OS));
+                __m256 filtered = _mm256_add_ps(_mm256_mul_ps(alpha_, cur), _mm256_mul_ps(one_minus_alpha, prev));
+
+                __m256 updated = _mm256_blendv_ps(cur, filtered, agree_ps);
+                __m128i credible8 = k & 1 ? _mm_srli_si128(credible_halves[k / 2], 8) : credible_halves[k / 2];
+                __m256 credible32 = _mm256_castsi256_ps(_mm256_cvtepi8_epi32(credible8));
+                __m256 filled = _mm256_blendv_ps(cur, prev, _mm256_and_ps(prev_valid, credible32));
+                _mm256_storeu_ps(cur_ptr, _mm256_blendv_ps(filled, updated, cur_valid_ps));
+                _mm256_storeu_ps(prev_ptr, _mm256_blendv_ps(prev, updated, cur_valid_ps));
+
+                cur_valid[k] = _mm256_castps_si256(cur_valid_ps);
+                agree[k] = _mm256_castps_si256(agree_ps);
+            }
+
+            _mm256_storeu_si256(hist, update_history(h, mask,
+                                                     pack_masks(cur_valid[0], cur_valid[1], cur_valid[2], cur_valid[3]),
+                                                     pack_masks(agree[0], agree[1], agree[2], agree[3])));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,19 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef BUILD_WITH_AVX2
+    // AVX2 versions of the temporal filter kernels in sse-temporal-filter.h, producing identical results. Pixels are
+    // filtered 32 at a time, so the range must hold a multiple of 32. Only to be called when the CPU supports AVX2.
+    void temporal_filter_pixels_avx2(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map);
+    void temporal_filter_pixels_avx2(float * frame, float * last_frame, uint8_t * history, size_t begin, size_t end,
+                                     float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map);
+#endif
+}
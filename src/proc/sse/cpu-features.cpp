@@ -0,0 +1,34 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "cpu-features.h"
+
+#ifdef __SSSE3__
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    bool has_avx2()
+    {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+        __cpuid(info, 1);
+        const int osxsave_avx = (1 << 27) | (1 << 28);
+        if ((info[2] & osxsave_avx) != osxsave_avx || (_xgetbv(0) & 6) != 6)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+}
+
+#endif
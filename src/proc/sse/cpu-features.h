@@ -0,0 +1,12 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    // Whether the CPU can run AVX2 code, and the OS saves the AVX registers
+    bool has_avx2();
+#endif
+}
@@ -11,11 +11,10 @@
 #include "proc/synthetic-stream.h"
 #include "environment.h"
 #include "stream.h"
+#include "proc/worker-pool.h"
 
 using namespace librealsense;
 
-template<int N> struct bytes { uint8_t b[N]; };
-
 bool is_special_resolution(const rs2_intrinsics& depth, const rs2_intrinsics& to)
 {
     if ((depth.width == 640 && depth.height == 240 && to.width == 320 && to.height == 180) ||
@@ -62,7 +61,7 @@ inline void distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(const __m128& x,
 template<rs2_distortion dist>
 inline void get_texture_map_sse(const uint16_t * depth,
     float depth_scale,
-    const unsigned int size,
+    size_t begin, size_t end,
     const float * pre_compute_x, const float * pre_compute_y,
     uint8_t * pixels_ptr_int,
     const rs2_intrinsics& to,
@@ -79,7 +78,7 @@ inline void get_texture_map_sse(const uint16_t * depth,
     auto mapx = pre_compute_x;
     auto mapy = pre_compute_y;
 
-    auto res = reinterpret_cast<__m128i*>(pixels_ptr_int);
+    auto res = reinterpret_cast<__m128i*>(pixels_ptr_int) + begin / 2;
 
     __m128 r[9];
     __m128 t[3];
@@ -103,7 +102,7 @@ inline void get_texture_map_sse(const uint16_t * depth,
     auto ppx = _mm_set_ps1(to.ppx);
     auto ppy = _mm_set_ps1(to.ppy);
 
-    for (unsigned int i = 0; i < size; i += 8)
+    for (size_t i = begin; i < end; i += 8)
     {
         auto x0 = _mm_load_ps(mapx + i);
         auto x1 = _mm_load_ps(mapx + i + 4);
@@ -191,16 +190,33 @@ inline void get_texture_map_sse(const uint16_t * depth,
         _mm_stream_si128(&res[1], res2_int1);
         res += 2;
     }
+    // The stores above are not ordered with the others: they must be done before other threads read the pixels
+    _mm_sfence();
 }
 
-image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
+image_transform::image_transform(const rs2_intrinsics& from, float depth_scale, std::shared_ptr<worker_pool> workers)
     :_depth(from),
     _depth_scale(depth_scale),
+    _workers(std::move(workers)),
     _pixel_top_left_int(from.width*from.height),
     _pixel_bottom_right_int(from.width*from.height)
 {
 }
 
+template<rs2_distortion dist>
+void image_transform::get_texture_map(int max_threads, const uint16_t* z_pixels, const std::vector<float>& pre_compute_map_x,
+    const std::vector<float>& pre_compute_map_y, std::vector<int2>& pixels, const rs2_intrinsics& to, const rs2_extrinsics& from_to_other)
+{
+    // The kernel works on groups of 8 pixels, in bands of groups
+    size_t const groups = (pixels.size() + 7) / 8;
+    size_t const bands = _workers->get_concurrency() * 4;
+    _workers->parallel_for(groups, (groups + bands - 1) / bands, [&](size_t begin, size_t end)
+    {
+        get_texture_map_sse<dist>(z_pixels, _depth_scale, begin * 8, end * 8, pre_compute_map_x.data(),
+            pre_compute_map_y.data(), (uint8_t *)pixels.data(), to, from_to_other);
+    }, max_threads);
+}
+
 void image_transform::pre_compute_x_y_map_corners()
 {
     pre_compute_x_y_map(_pre_compute_map_x_top_left, _pre_compute_map_y_top_left, -0.5f);
@@ -239,70 +255,41 @@ void image_transform::pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
     }
 }
 
-void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, int bpp, const rs2_intrinsics& depth, const rs2_intrinsics& to,
+void image_transform::align_depth_to_other(int max_threads, const uint16_t* z_pixels, uint16_t* dest, int bpp, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
     switch (to.model)
     {
     case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
-        align_depth_to_other_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, dest, depth, to, from_to_other);
+        align_depth_to_other_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(max_threads, z_pixels, dest, depth, to, from_to_other);
         break;
     default:
-        align_depth_to_other_sse(z_pixels, dest, depth, to, from_to_other);
+        align_depth_to_other_sse(max_threads, z_pixels, dest, depth, to, from_to_other);
         break;
     }
 }
 
-inline void image_transform::move_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, const rs2_intrinsics& to,
-    const std::vector<librealsense::int2>& pixel_top_left_int,
-    const std::vector<librealsense::int2>& pixel_bottom_right_int)
-{
-    for (int y = 0; y < _depth.height; ++y)
-    {
-        for (int x = 0; x < _depth.width; ++x)
-        {
-            auto depth_pixel_index = y * _depth.width + x;
-            // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-            if (z_pixels[depth_pixel_index])
-            {
-                for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
-                {
-                    for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
-                    {
-                        if (other_x < 0 || other_y < 0 || other_x >= to.width || other_y >= to.height)
-                            continue;
-                        auto other_ind = other_y * to.width + other_x;
-
-                        dest[other_ind] = dest[other_ind] ? std::min(dest[other_ind], z_pixels[depth_pixel_index]) : z_pixels[depth_pixel_index];
-                    }
-                }
-            }
-        }
-    }
-}
-
-void image_transform::align_other_to_depth(const uint16_t* z_pixels, const uint8_t * source, uint8_t * dest, int bpp, const rs2_intrinsics& to,
+void image_transform::align_other_to_depth(int max_threads, const uint16_t* z_pixels, const uint8_t * source, uint8_t * dest, rs2_format format, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
     switch (to.model)
     {
     case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
     case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
-        align_other_to_depth_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, source, dest, bpp, to, from_to_other);
+        align_other_to_depth_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(max_threads, z_pixels, source, dest, format, bpp, to, from_to_other);
         break;
     default:
-        align_other_to_depth_sse(z_pixels, source, dest, bpp, to, from_to_other);
+        align_other_to_depth_sse(max_threads, z_pixels, source, dest, format, bpp, to, from_to_other);
         break;
     }
 }
 
 
 template<rs2_distortion dist>
-inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
+inline void image_transform::align_depth_to_other_sse(int max_threads, const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+    get_texture_map<dist>(max_threads, z_pixels, _pre_compute_map_x_top_left, _pre_compute_map_y_top_left, _pixel_top_left_int, to, from_to_other);
 
     float fov[2];
     rs2_fov(&depth, fov);
@@ -313,87 +300,33 @@ inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels,
 
     if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        get_texture_map<dist>(max_threads, z_pixels, _pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right, _pixel_bottom_right_int, to, from_to_other);
 
-        move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
+        scatter_depth_to_other(*_workers, max_threads, dest, to, z_pixels, _depth, _pixel_top_left_int.data(), _pixel_bottom_right_int.data());
     }
     else
     {
-        move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_top_left_int);
+        scatter_depth_to_other(*_workers, max_threads, dest, to, z_pixels, _depth, _pixel_top_left_int.data(), _pixel_top_left_int.data());
     }
 
 }
 
 template<rs2_distortion dist>
-inline void image_transform::align_other_to_depth_sse(const uint16_t * z_pixels, const uint8_t * source, uint8_t * dest, int bpp, const rs2_intrinsics& to,
+inline void image_transform::align_other_to_depth_sse(int max_threads, const uint16_t * z_pixels, const uint8_t * source, uint8_t * dest, rs2_format format, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+    get_texture_map<dist>(max_threads, z_pixels, _pre_compute_map_x_top_left, _pre_compute_map_y_top_left, _pixel_top_left_int, to, from_to_other);
 
     std::vector<int2>& bottom_right = _pixel_top_left_int;
     if (to.height < _depth.height && to.width < _depth.width)
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        get_texture_map<dist>(max_threads, z_pixels, _pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right, _pixel_bottom_right_int, to, from_to_other);
 
         bottom_right = _pixel_bottom_right_int;
     }
 
-    switch (bpp)
-    {
-    case 1:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<1>*>(source), reinterpret_cast<bytes<1>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 2:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<2>*>(source), reinterpret_cast<bytes<2>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 3:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<3>*>(source), reinterpret_cast<bytes<3>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 4:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<4>*>(source), reinterpret_cast<bytes<4>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    default:
-        break;
-    }
-}
-
-template<class T >
-void image_transform::move_other_to_depth(const uint16_t* z_pixels,
-    const T* source,
-    T* dest, const rs2_intrinsics& to,
-    const std::vector<librealsense::int2>& pixel_top_left_int,
-    const std::vector<librealsense::int2>& pixel_bottom_right_int)
-{
-    // Iterate over the pixels of the depth image
-    for (int y = 0; y < _depth.height; ++y)
-    {
-        for (int x = 0; x < _depth.width; ++x)
-        {
-            auto depth_pixel_index = y * _depth.width + x;
-            // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-            if (z_pixels[depth_pixel_index])
-            {
-                for (int other_y = pixel_top_left_int[depth_pixel_index].y; other_y <= pixel_bottom_right_int[depth_pixel_index].y; ++other_y)
-                {
-                    for (int other_x = pixel_top_left_int[depth_pixel_index].x; other_x <= pixel_bottom_right_int[depth_pixel_index].x; ++other_x)
-                    {
-                        if (other_x < 0 || other_y < 0 || other_x >= to.width || other_y >= to.height)
-                            continue;
-                        auto other_ind = other_y * to.width + other_x;
-
-                        dest[depth_pixel_index] = source[other_ind];
-                    }
-                }
-            }
-        }
-    }
+    gather_other_to_depth(*_workers, max_threads, dest, source, format, bpp, to, z_pixels, _depth,
+        _pixel_top_left_int.data(), bottom_right.data());
 }
 
 void align_sse::reset_cache(rs2_stream from, rs2_stream to)
@@ -417,10 +350,10 @@ void align_sse::align_z_to_other(rs2::video_frame& aligned, const rs2::video_fra
 
     if (_stream_transform == nullptr)
     {
-        _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
+        _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale, _workers);
         _stream_transform->pre_compute_x_y_map_corners();
     }
-    _stream_transform->align_depth_to_other(z_pixels, reinterpret_cast<uint16_t*>(aligned_data), 2, z_intrin, other_intrin, z_to_other);
+    _stream_transform->align_depth_to_other(_max_threads, z_pixels, reinterpret_cast<uint16_t*>(aligned_data), 2, z_intrin, other_intrin, z_to_other);
 }
 
 void align_sse::align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale)
@@ -441,10 +374,11 @@ void align_sse::align_other_to_z(rs2::video_frame& aligned, const rs2::video_fra
 
     if (_stream_transform == nullptr)
     {
-        _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
+        _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale, _workers);
         _stream_transform->pre_compute_x_y_map_corners();
     }
 
-    _stream_transform->align_other_to_depth(z_pixels, other_pixels, aligned_data, other.get_bytes_per_pixel(), other_intrin, z_to_other);
+    _stream_transform->align_other_to_depth(_max_threads, z_pixels, other_pixels, aligned_data, other_profile.format(),
+        other.get_bytes_per_pixel(), other_intrin, z_to_other);
 }
 #endif
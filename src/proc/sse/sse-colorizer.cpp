@@ -0,0 +1,34 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-colorizer.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    void colorize_depth_pixels_sse(uint8_t * rgb_data, const uint16_t * depth_data, const uint32_t * lut, size_t begin, size_t end)
+    {
+        // Drops the unused byte of each of 4 table entries, leaving their 12 color bytes first
+        const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            auto d = depth_data + i;
+            __m128i c0 = _mm_shuffle_epi8(_mm_setr_epi32(int(lut[d[0]]), int(lut[d[1]]), int(lut[d[2]]), int(lut[d[3]])), pack);
+            __m128i c1 = _mm_shuffle_epi8(_mm_setr_epi32(int(lut[d[4]]), int(lut[d[5]]), int(lut[d[6]]), int(lut[d[7]])), pack);
+            __m128i c2 = _mm_shuffle_epi8(_mm_setr_epi32(int(lut[d[8]]), int(lut[d[9]]), int(lut[d[10]]), int(lut[d[11]])), pack);
+            __m128i c3 = _mm_shuffle_epi8(_mm_setr_epi32(int(lut[d[12]]), int(lut[d[13]]), int(lut[d[14]]), int(lut[d[15]])), pack);
+
+            // 48 bytes of 16 pixels
+            auto rgb = reinterpret_cast<__m128i *>(rgb_data + i * 3);
+            _mm_storeu_si128(rgb, _mm_or_si128(c0, _mm_slli_si128(c1, 12)));
+            _mm_storeu_si128(rgb + 1, _mm_or_si128(_mm_srli_si128(c1, 4), _mm_slli_si128(c2, 8)));
+            _mm_storeu_si128(rgb + 2, _mm_or_si128(_mm_srli_si128(c2, 8), _mm_slli_si128(c3, 4)));
+        }
+    }
+}
+
+#endif
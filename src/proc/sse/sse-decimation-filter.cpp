@@ -0,0 +1,191 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-decimation-filter.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    // SSSE3 only has signed 16-bit min/max: the sorted values are biased by 0x8000, which keeps their order
+    static inline void sort2(__m128i & a, __m128i & b)
+    {
+        __m128i t = _mm_min_epi16(a, b);
+        b = _mm_max_epi16(a, b);
+        a = t;
+    }
+
+    static inline void sort4(__m128i * p)
+    {
+        sort2(p[0], p[1]); sort2(p[2], p[3]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]);
+        sort2(p[1], p[2]);
+    }
+
+    // R.W. Floyd's 25-comparator network. Only the lower half of the result is used, and the compiler drops the rest.
+    static inline void sort9(__m128i * p)
+    {
+        sort2(p[0], p[3]); sort2(p[1], p[7]); sort2(p[2], p[5]); sort2(p[4], p[8]);
+        sort2(p[0], p[7]); sort2(p[2], p[4]); sort2(p[3], p[8]); sort2(p[5], p[6]);
+        sort2(p[0], p[2]); sort2(p[1], p[3]); sort2(p[4], p[5]); sort2(p[7], p[8]);
+        sort2(p[1], p[4]); sort2(p[3], p[6]); sort2(p[5], p[7]);
+        sort2(p[0], p[1]); sort2(p[2], p[4]); sort2(p[3], p[5]); sort2(p[6], p[8]);
+        sort2(p[2], p[3]); sort2(p[4], p[5]); sort2(p[6], p[7]);
+        sort2(p[1], p[2]); sort2(p[3], p[4]); sort2(p[5], p[6]);
+    }
+
+    // The median of the non-zero values among p[0..n) in each lane, as picked by the scalar version: the lower of the
+    // middle two for even counts, and 0 when there are none
+    static inline __m128i masked_median(__m128i * p, int n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bias = _mm_set1_epi16((short)0x8000);
+
+        __m128i count = _mm_set1_epi16(short(n));
+        for (int i = 0; i < n; i++)
+        {
+            __m128i invalid = _mm_cmpeq_epi16(p[i], zero);
+            count = _mm_add_epi16(count, invalid);
+            // Zeros become the largest value, so the valid ones are sorted first
+            p[i] = _mm_xor_si128(_mm_or_si128(p[i], invalid), bias);
+        }
+
+        if (n == 4)
+            sort4(p);
+        else
+            sort9(p);
+
+        // The median of 'count' values is the ((count - 1) / 2)-th smallest
+        __m128i res = p[0];
+        for (int i = 1; 2 * i < n; i++)
+        {
+            __m128i pick = _mm_cmpgt_epi16(count, _mm_set1_epi16(short(2 * i)));
+            res = _mm_or_si128(_mm_and_si128(pick, p[i]), _mm_andnot_si128(pick, res));
+        }
+        return _mm_andnot_si128(_mm_cmpeq_epi16(count, zero), _mm_xor_si128(res, bias));
+    }
+
+    // Splits 16 consecutive pixels into those of the even columns (first) and of the odd ones
+    static inline void split2(const uint16_t * row, __m128i & even, __m128i & odd)
+    {
+        const __m128i split = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)row), split);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(row + 8)), split);
+        even = _mm_unpacklo_epi64(a, b);
+        odd = _mm_unpackhi_epi64(a, b);
+    }
+
+    // Splits 24 consecutive pixels into 3 vectors, the m-th holding pixels 3 * j + m
+    static inline void split3(const uint16_t * row, __m128i * p)
+    {
+        // For each m, the bytes taken from each 8 pixels
+        static const int8_t masks[3][3][16] = {
+            { { 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11 } },
+            { { 2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13 } },
+            { { 4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1 },
+              { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15 } } };
+
+        __m128i a = _mm_loadu_si128((const __m128i *)row);
+        __m128i b = _mm_loadu_si128((const __m128i *)(row + 8));
+        __m128i c = _mm_loadu_si128((const __m128i *)(row + 16));
+        for (int m = 0; m < 3; m++)
+        {
+            p[m] = _mm_or_si128(_mm_or_si128(
+                _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i *)masks[m][0])),
+                _mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i *)masks[m][1]))),
+                _mm_shuffle_epi8(c, _mm_loadu_si128((const __m128i *)masks[m][2])));
+        }
+    }
+
+    void decimate_depth_median_sse(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        __m128i p[9];
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            auto patch = in + u * scale;
+            if (scale == 2)
+            {
+                split2(patch, p[0], p[1]);
+                split2(patch + width_in, p[2], p[3]);
+                _mm_storeu_si128((__m128i *)(out + u), masked_median(p, 4));
+            }
+            else
+            {
+                split3(patch, p);
+                split3(patch + width_in, p + 3);
+                split3(patch + 2 * width_in, p + 6);
+                _mm_storeu_si128((__m128i *)(out + u), masked_median(p, 9));
+            }
+        }
+    }
+
+    void decimate_depth_mean_sse(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i low_halves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+
+        // Per input column of the 8 patches
+        int32_t col_sums[64];
+        int16_t col_zeros[64];
+
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            auto patch = in + u * scale;
+
+            // Add up the 'scale' rows of each column. Zeros don't change the sum, they are only counted.
+            for (size_t c = 0; c < 8 * scale; c += 8)
+            {
+                __m128i lo = zero, hi = zero, zeros = zero;
+                for (size_t r = 0; r < scale; r++)
+                {
+                    __m128i p = _mm_loadu_si128((const __m128i *)(patch + r * width_in + c));
+                    lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(p, zero));
+                    hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(p, zero));
+                    zeros = _mm_sub_epi16(zeros, _mm_cmpeq_epi16(p, zero));
+                }
+                _mm_storeu_si128((__m128i *)(col_sums + c), lo);
+                _mm_storeu_si128((__m128i *)(col_sums + c + 4), hi);
+                _mm_storeu_si128((__m128i *)(col_zeros + c), zeros);
+            }
+
+            // Then the columns of each patch
+            int32_t sums[8], counts[8];
+            for (size_t j = 0; j < 8; j++)
+            {
+                int32_t sum = 0;
+                int32_t count = int32_t(scale * scale);
+                for (size_t k = j * scale; k < (j + 1) * scale; k++)
+                {
+                    sum += col_sums[k];
+                    count -= col_zeros[k];
+                }
+                sums[j] = sum;
+                counts[j] = count;
+            }
+
+            // The sums are below 2^22 and the counts at most 64, so both are exact as floats. Their quotient keeps
+            // at least 8 fractional bits, finer than its distance of 1/count or more from the next integer, so it is
+            // truncated to the same integer as the integer division. Empty patches are divided by 1 instead of 0.
+            __m128i res[2];
+            for (int h = 0; h < 2; h++)
+            {
+                __m128i sum = _mm_loadu_si128((const __m128i *)(sums + 4 * h));
+                __m128i count = _mm_loadu_si128((const __m128i *)(counts + 4 * h));
+                count = _mm_or_si128(count, _mm_and_si128(_mm_cmpeq_epi32(count, zero), one));
+                __m128 mean = _mm_div_ps(_mm_cvtepi32_ps(sum), _mm_cvtepi32_ps(count));
+                res[h] = _mm_shuffle_epi8(_mm_cvttps_epi32(mean), low_halves);
+            }
+            _mm_storeu_si128((__m128i *)(out + u), _mm_unpacklo_epi64(res[0], res[1]));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,18 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    // SSSE3 versions of decimate_depth_pixels() in decimation-filter.h, producing identical results, for the median
+    // (scales 2 and 3) and the mean (scales 4 to 8). Each vector lane computes one output pixel: the range must hold
+    // a multiple of 8 pixels.
+    void decimate_depth_median_sse(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end);
+    void decimate_depth_mean_sse(const uint16_t * in, size_t width_in, uint16_t * out, size_t scale, size_t u_begin, size_t u_end);
+#endif
+}
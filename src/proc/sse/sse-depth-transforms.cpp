@@ -0,0 +1,81 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-depth-transforms.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    // 8 depth values, as two registers of 4 floats
+    static inline void load_depth(const uint16_t * p, __m128i & z, __m128 & lo, __m128 & hi)
+    {
+        z = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(z, _mm_setzero_si128()));
+        hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(z, _mm_setzero_si128()));
+    }
+
+    void threshold_depth_pixels_sse(const uint16_t * in, uint16_t * out, float units, float min, float max,
+                                    size_t begin, size_t end)
+    {
+        const __m128 u = _mm_set1_ps(units);
+        const __m128 lo_dist = _mm_set1_ps(min);
+        const __m128 hi_dist = _mm_set1_ps(max);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m128i z;
+            __m128 lo, hi;
+            load_depth(in + i, z, lo, hi);
+            lo = _mm_mul_ps(lo, u);
+            hi = _mm_mul_ps(hi, u);
+            __m128 keep_lo = _mm_and_ps(_mm_cmpge_ps(lo, lo_dist), _mm_cmple_ps(lo, hi_dist));
+            __m128 keep_hi = _mm_and_ps(_mm_cmpge_ps(hi, lo_dist), _mm_cmple_ps(hi, hi_dist));
+            // The masks are all ones or zero, which saturate to the same 16 bits
+            __m128i keep = _mm_packs_epi32(_mm_castps_si128(keep_lo), _mm_castps_si128(keep_hi));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_and_si128(z, keep));
+        }
+    }
+
+    void depth_to_meters_pixels_sse(const uint16_t * in, float * out, float units, size_t begin, size_t end)
+    {
+        const __m128 u = _mm_set1_ps(units);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m128i z;
+            __m128 lo, hi;
+            load_depth(in + i, z, lo, hi);
+            _mm_storeu_ps(out + i, _mm_mul_ps(lo, u));
+            _mm_storeu_ps(out + i + 4, _mm_mul_ps(hi, u));
+        }
+    }
+
+    // factor / d rounded and converted as static_cast<uint16_t> does on x86, keeping the low 16 bits of its 32-bit
+    // conversion, where d is a normal number; 0 elsewhere
+    static inline __m128i to_depth(__m128 d, __m128 factor)
+    {
+        // Normal numbers have an exponent that is neither all zeros nor all ones
+        const __m128i abs_bits = _mm_and_si128(_mm_castps_si128(d), _mm_set1_epi32(0x7FFFFFFF));
+        const __m128i normal = _mm_and_si128(_mm_cmpgt_epi32(abs_bits, _mm_set1_epi32(0x007FFFFF)),
+                                             _mm_cmplt_epi32(abs_bits, _mm_set1_epi32(0x7F800000)));
+        __m128i z = _mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(factor, d), _mm_set1_ps(0.5f)));
+        // Sign-extending the low 16 bits makes the saturating pack below keep them as they are
+        z = _mm_srai_epi32(_mm_slli_epi32(z, 16), 16);
+        return _mm_and_si128(z, normal);
+    }
+
+    void disparity_to_depth_pixels_sse(const float * in, uint16_t * out, float d2d_convert_factor,
+                                       size_t begin, size_t end)
+    {
+        const __m128 factor = _mm_set1_ps(d2d_convert_factor);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m128i lo = to_depth(_mm_loadu_ps(in + i), factor);
+            __m128i hi = to_depth(_mm_loadu_ps(in + i + 4), factor);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packs_epi32(lo, hi));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-hdr-merge.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    static inline __m128i load(const uint16_t * p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+
+    // 8 IR bytes, widened to 16 bits
+    static inline __m128i load(const uint8_t * p)
+    {
+        return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)), _mm_setzero_si128());
+    }
+
+    // All ones where lo <= ir <= hi. SSE has no unsigned 16-bit comparisons, but a saturating subtraction is 0 exactly
+    // when the first value is not above the second.
+    static inline __m128i in_range(__m128i ir, __m128i lo, __m128i hi)
+    {
+        __m128i out = _mm_or_si128(_mm_subs_epu16(lo, ir), _mm_subs_epu16(ir, hi));
+        return _mm_cmpeq_epi16(out, _mm_setzero_si128());
+    }
+
+    // The depth of the first frame where it is valid and non-zero: 'a' and 'b' already hold 0 where it is not valid
+    static inline __m128i merge(__m128i a, __m128i b)
+    {
+        return _mm_or_si128(a, _mm_and_si128(_mm_cmpeq_epi16(a, _mm_setzero_si128()), b));
+    }
+
+    void hdr_merge_depth_pixels_sse(const uint16_t * d0, const uint16_t * d1, uint16_t * out, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 8)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), merge(load(d0 + i), load(d1 + i)));
+    }
+
+    template<class T>
+    static inline void merge_ir(const uint16_t * d0, const uint16_t * d1, const T * ir0, const T * ir1,
+                                int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        // Valid IR values are strictly between ir_min and ir_max
+        const __m128i lo = _mm_set1_epi16(short(ir_min + 1));
+        const __m128i hi = _mm_set1_epi16(short(ir_max - 1));
+        for (size_t i = begin; i < end; i += 8)
+        {
+            __m128i a = _mm_and_si128(load(d0 + i), in_range(load(ir0 + i), lo, hi));
+            __m128i b = _mm_and_si128(load(d1 + i), in_range(load(ir1 + i), lo, hi));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), merge(a, b));
+        }
+    }
+
+    void hdr_merge_y8_pixels_sse(const uint16_t * d0, const uint16_t * d1, const uint8_t * ir0, const uint8_t * ir1,
+                                 int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+
+    void hdr_merge_y16_pixels_sse(const uint16_t * d0, const uint16_t * d1, const uint16_t * ir0, const uint16_t * ir1,
+                                  int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end)
+    {
+        merge_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, begin, end);
+    }
+}
+
+#endif
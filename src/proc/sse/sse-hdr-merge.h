@@ -0,0 +1,20 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    // SSE versions of hdr_merge_depth_pixels() and hdr_merge_ir_pixels() in hdr-merge.h, producing identical results.
+    // They merge 8 pixels at a time: the range must hold a multiple of 8.
+    void hdr_merge_depth_pixels_sse(const uint16_t * d0, const uint16_t * d1, uint16_t * out, size_t begin, size_t end);
+    void hdr_merge_y8_pixels_sse(const uint16_t * d0, const uint16_t * d1, const uint8_t * ir0, const uint8_t * ir1,
+                                 int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end);
+    void hdr_merge_y16_pixels_sse(const uint16_t * d0, const uint16_t * d1, const uint16_t * ir0, const uint16_t * ir1,
+                                  int ir_min, int ir_max, uint16_t * out, size_t begin, size_t end);
+#endif
+}
@@ -0,0 +1,109 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-interleaved-ir.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    // x << 6 | x >> 4, truncated to 16 bits: scales 10-bit values up to 16 bits
+    static inline __m128i scale_to_16_bits(__m128i x)
+    {
+        return _mm_or_si128(_mm_slli_epi16(x, 6), _mm_srli_epi16(x, 4));
+    }
+
+    // Left and right, of 16 pixels of 2 bytes
+    static inline void split_y8(const uint8_t * in, __m128i mask, __m128i & left, __m128i & right)
+    {
+        // Each register gets the left bytes of its 8 pixels in its lower half, and the right ones in its upper half
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)), mask);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)), mask);
+        left = _mm_unpacklo_epi64(a, b);
+        right = _mm_unpackhi_epi64(a, b);
+    }
+
+    void split_y8i_pixels_sse(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        const __m128i mask = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m128i l, r;
+            split_y8(source + i * 2, mask, l, r);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(left + i), l);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(right + i), r);
+        }
+    }
+
+    void split_y8i_mipi_pixels_sse(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        // The left bytes of each pair of pixels are swapped
+        const __m128i mask = _mm_setr_epi8(2, 0, 6, 4, 10, 8, 14, 12, 1, 3, 5, 7, 9, 11, 13, 15);
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m128i l, r;
+            split_y8(source + i * 2, mask, l, r);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(left + i), l);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(right + i), r);
+        }
+    }
+
+    // Y12I pixels pack the 12-bit right value in the low bits of their first two bytes, and the left value in the high
+    // bits of the last two. Each value is shuffled into a 16-bit lane from the two bytes holding it, then masked or
+    // shifted into place.
+    static inline void store_y12(__m128i r, __m128i l, uint16_t * left, uint16_t * right)
+    {
+        r = _mm_and_si128(r, _mm_set1_epi16(0x0FFF));
+        l = _mm_srli_epi16(l, 4);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(left), scale_to_16_bits(l));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(right), scale_to_16_bits(r));
+    }
+
+    void split_y12i_pixels_sse(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        // 8 pixels are 24 bytes: the first 4 are read from bytes [0, 16), and the others from bytes [8, 24)
+        const __m128i r_lo = _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i r_hi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14);
+        const __m128i l_lo = _mm_setr_epi8(1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i l_hi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            const uint8_t * in = source + i * 3;
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 8));
+            __m128i r = _mm_or_si128(_mm_shuffle_epi8(lo, r_lo), _mm_shuffle_epi8(hi, r_hi));
+            __m128i l = _mm_or_si128(_mm_shuffle_epi8(lo, l_lo), _mm_shuffle_epi8(hi, l_hi));
+            store_y12(r, l, left + i, right + i);
+        }
+    }
+
+    void split_y12i_mipi_pixels_sse(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        // As Y12I, with a padding byte after each pixel: 4 pixels are shuffled into the right values, then the left ones
+        const __m128i mask = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 1, 2, 5, 6, 9, 10, 13, 14);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            const uint8_t * in = source + i * 4;
+            __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)), mask);
+            __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)), mask);
+            store_y12(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b), left + i, right + i);
+        }
+    }
+
+    void split_y16i_10msb_pixels_sse(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        const __m128i mask = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        for (size_t i = begin; i < end; i += 8)
+        {
+            const uint8_t * in = source + i * 4;
+            __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)), mask);
+            __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)), mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(left + i), scale_to_16_bits(_mm_unpacklo_epi64(a, b)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(right + i), scale_to_16_bits(_mm_unpackhi_epi64(a, b)));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,36 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-motion-transform.h"
+
+#ifdef __SSSE3__
+
+#include <xmmintrin.h> // For SSE intrinsics
+
+namespace librealsense
+{
+    // One output axis of 4 samples: row . v - bias, added up in the order of the scalar version
+    static inline __m128 correct_axis(__m128 vx, __m128 vy, __m128 vz, float mx, float my, float mz, float bias)
+    {
+        __m128 r = _mm_mul_ps(_mm_set1_ps(mx), vx);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(my), vy));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(mz), vz));
+        return _mm_sub_ps(r, _mm_set1_ps(bias));
+    }
+
+    void correct_motion_samples_sse(float * x, float * y, float * z, const float3x3 & m, const float3 & bias,
+                                    size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i += 4)
+        {
+            const __m128 vx = _mm_loadu_ps(x + i);
+            const __m128 vy = _mm_loadu_ps(y + i);
+            const __m128 vz = _mm_loadu_ps(z + i);
+            _mm_storeu_ps(x + i, correct_axis(vx, vy, vz, m.x.x, m.y.x, m.z.x, bias.x));
+            _mm_storeu_ps(y + i, correct_axis(vx, vy, vz, m.x.y, m.y.y, m.z.y, bias.y));
+            _mm_storeu_ps(z + i, correct_axis(vx, vy, vz, m.x.z, m.y.z, m.z.z, bias.z));
+        }
+    }
+}
+
+#endif
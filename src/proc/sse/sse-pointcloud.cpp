@@ -7,6 +7,8 @@
 #include "../../environment.h"
 #include "../occlusion-filter.h"
 #include "sse-pointcloud.h"
+#include "avx-pointcloud.h"
+#include "../simd-dispatch.h"
 #include "../../option.h"
 
 #include <iostream>
@@ -19,74 +21,27 @@
 
 namespace librealsense
 {
-    pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)") {}
-
-    void pointcloud_sse::preprocess()
-    {
-        _pre_compute_map_x.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-        _pre_compute_map_y.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-
-        for (int h = 0; h < _depth_intrinsics->height; ++h)
-        {
-            for (int w = 0; w < _depth_intrinsics->width; ++w)
-            {
-                const float pixel[] = { (float)w, (float)h };
-
-                float x = (pixel[0] - _depth_intrinsics->ppx) / _depth_intrinsics->fx;
-                float y = (pixel[1] - _depth_intrinsics->ppy) / _depth_intrinsics->fy;
-
-
-                if (_depth_intrinsics->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-                {
-                    float r2 = x * x + y * y;
-                    float f = 1 + _depth_intrinsics->coeffs[0] * r2 + _depth_intrinsics->coeffs[1] * r2*r2 + _depth_intrinsics->coeffs[4] * r2*r2*r2;
-                    float ux = x * f + 2 * _depth_intrinsics->coeffs[2] * x*y + _depth_intrinsics->coeffs[3] * (r2 + 2 * x*x);
-                    float uy = y * f + 2 * _depth_intrinsics->coeffs[3] * x*y + _depth_intrinsics->coeffs[2] * (r2 + 2 * y*y);
-                    x = ux;
-                    y = uy;
-                }
-
-                _pre_compute_map_x[h*_depth_intrinsics->width + w] = x;
-                _pre_compute_map_y[h*_depth_intrinsics->width + w] = y;
-            }
-        }
-    }
-
-    const float3* pointcloud_sse::depth_to_points(rs2::points output,
-            const rs2_intrinsics &depth_intrinsics, 
-            const rs2::depth_frame& depth_frame)
-    {
 #ifdef __SSSE3__
-
-        auto depth_image = (const uint16_t*)depth_frame.get_data();
-
-        float* pre_compute_x = _pre_compute_map_x.data();
-        float* pre_compute_y = _pre_compute_map_y.data();
-
-        uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
-
-        auto point = (float*)output.get_vertices();
-
+    void deproject_depth_pixels_sse(float3 * points, const uint16_t * depth, const float * rays_x, const float * rays_y,
+                                    size_t begin, size_t end, float depth_scale)
+    {
         //mask for shuffle
         const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
             (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
         const __m128i mask1 = _mm_set_epi8((char)0xff, (char)0xff, (char)15, (char)14, (char)0xff, (char)0xff, (char)13, (char)12,
             (char)0xff, (char)0xff, (char)11, (char)10, (char)0xff, (char)0xff, (char)9, (char)8);
 
-        auto scale = _mm_set_ps1(depth_frame.get_units());
-
-        auto mapx = pre_compute_x;
-        auto mapy = pre_compute_y;
+        auto scale = _mm_set_ps1(depth_scale);
 
-        for (unsigned int i = 0; i < size; i += 8)
+        for (size_t i = begin; i < end; i += 8)
         {
-            auto x0 = _mm_load_ps(mapx + i);
-            auto x1 = _mm_load_ps(mapx + i + 4);
+            auto x0 = _mm_loadu_ps(rays_x + i);
+            auto x1 = _mm_loadu_ps(rays_x + i + 4);
 
-            auto y0 = _mm_load_ps(mapy + i);
-            auto y1 = _mm_load_ps(mapy + i + 4);
+            auto y0 = _mm_loadu_ps(rays_y + i);
+            auto y1 = _mm_loadu_ps(rays_y + i + 4);
 
-            __m128i d = _mm_load_si128((__m128i const*)(depth_image + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
+            __m128i d = _mm_loadu_si128((__m128i const*)(depth + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
 
                                                                             //split the depth pixel to 2 registers of 4 floats each
             __m128i d0 = _mm_shuffle_epi8(d, mask0);        // 00 00 d3 d3 00 00 d2 d2 00 00 d1 d1 00 00 d0 d0
@@ -121,18 +76,46 @@ namespace librealsense
             auto xyz12 = _mm_shuffle_ps(y_z1, x_y1, _MM_SHUFFLE(3, 1, 2, 0));
             auto xyz13 = _mm_shuffle_ps(z_x1, y_z1, _MM_SHUFFLE(3, 1, 3, 1));
 
-
             //store 8 points of x y z
-            _mm_stream_ps(&point[0], xyz01);
-            _mm_stream_ps(&point[4], xyz02);
-            _mm_stream_ps(&point[8], xyz03);
-            _mm_stream_ps(&point[12], xyz11);
-            _mm_stream_ps(&point[16], xyz12);
-            _mm_stream_ps(&point[20], xyz13);
-            point += 24;
+            auto point = reinterpret_cast<float*>(points + i);
+            _mm_storeu_ps(&point[0], xyz01);
+            _mm_storeu_ps(&point[4], xyz02);
+            _mm_storeu_ps(&point[8], xyz03);
+            _mm_storeu_ps(&point[12], xyz11);
+            _mm_storeu_ps(&point[16], xyz12);
+            _mm_storeu_ps(&point[20], xyz13);
         }
+    }
+#endif
+
+    pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)")
+    {
+        update_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3 })));
+    }
+
+    const float3* pointcloud_sse::depth_to_points(rs2::points output,
+            const rs2_intrinsics &depth_intrinsics, 
+            const rs2::depth_frame& depth_frame)
+    {
+        auto points = (float3*)output.get_vertices();
+        auto depth = (const uint16_t*)depth_frame.get_data();
+        auto rays_x = _pre_compute_map_x.data();
+        auto rays_y = _pre_compute_map_y.data();
+        auto depth_scale = depth_frame.get_units();
+        size_t size = size_t(depth_intrinsics.height) * depth_intrinsics.width;
+        size_t done = 0;
+#ifdef __SSSE3__
+        done = size / 8 * 8;
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+            deproject_depth_pixels_avx2(points, depth, rays_x, rays_y, 0, done, depth_scale);
+        else
+#endif
+            deproject_depth_pixels_sse(points, depth, rays_x, rays_y, 0, done, depth_scale);
 #endif
-        return (float3*)output.get_vertices();
+        deproject_depth_pixels(points, depth, rays_x, rays_y, done, size, depth_scale);
+        return points;
     }
 
     void pointcloud_sse::get_texture_map_sse( float2 * texture_map,
@@ -6,6 +6,13 @@
 
 namespace librealsense
 {
+#ifdef __SSSE3__
+    // SSSE3 version of deproject_depth_pixels() in pointcloud.h, producing identical results. Pixels are deprojected
+    // 8 at a time, so the range must hold a multiple of 8.
+    void deproject_depth_pixels_sse(float3 * points, const uint16_t * depth, const float * rays_x, const float * rays_y,
+                                    size_t begin, size_t end, float depth_scale);
+#endif
+
     class pointcloud_sse : public pointcloud
     {
     public:
@@ -20,7 +27,6 @@ namespace librealsense
             float2 * pixels_ptr);
 
     private:
-        void preprocess() override;
         const float3 * depth_to_points(
             rs2::points output,
             const rs2_intrinsics &depth_intrinsics, 
@@ -33,10 +39,5 @@ namespace librealsense
             const rs2_intrinsics &other_intrinsics,
             const rs2_extrinsics& extr,
             float2* pixels_ptr) override;
-
-        std::vector<float> _pre_compute_map_x;
-        std::vector<float> _pre_compute_map_y;
-
-        void pre_compute_x_y_map();
     };
 }
@@ -0,0 +1,144 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-rotation.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    static inline __m128i load(const uint8_t * p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+
+    static inline void store(uint8_t * p, __m128i x)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), x);
+    }
+
+    void transpose_8x8_u8_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        __m128i r[8];
+        for (int i = 0; i < 8; ++i)
+            r[i] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i * src_stride));
+
+        // Interleaving pairs of rows, then pairs of those, gathers each column in 8 consecutive bytes
+        __m128i a0 = _mm_unpacklo_epi8(r[0], r[1]);
+        __m128i a1 = _mm_unpacklo_epi8(r[2], r[3]);
+        __m128i a2 = _mm_unpacklo_epi8(r[4], r[5]);
+        __m128i a3 = _mm_unpacklo_epi8(r[6], r[7]);
+        __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+        __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+        __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+        __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+        __m128i c[4] = { _mm_unpacklo_epi32(b0, b2), _mm_unpackhi_epi32(b0, b2),
+                         _mm_unpacklo_epi32(b1, b3), _mm_unpackhi_epi32(b1, b3) };
+
+        for (int i = 0; i < 4; ++i)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + 2 * i * dst_stride), c[i]);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + (2 * i + 1) * dst_stride), _mm_unpackhi_epi64(c[i], c[i]));
+        }
+    }
+
+    void transpose_8x8_u16_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        __m128i r[8];
+        for (int i = 0; i < 8; ++i)
+            r[i] = load(src + i * src_stride);
+
+        __m128i a[8];
+        for (int i = 0; i < 4; ++i)
+        {
+            a[2 * i] = _mm_unpacklo_epi16(r[2 * i], r[2 * i + 1]);
+            a[2 * i + 1] = _mm_unpackhi_epi16(r[2 * i], r[2 * i + 1]);
+        }
+        // b[i] holds columns 2i and 2i+1 of rows 0-3, and b[i + 4] those of rows 4-7
+        __m128i b[8];
+        for (int i = 0; i < 2; ++i)
+        {
+            b[2 * i] = _mm_unpacklo_epi32(a[i], a[i + 2]);
+            b[2 * i + 1] = _mm_unpackhi_epi32(a[i], a[i + 2]);
+            b[2 * i + 4] = _mm_unpacklo_epi32(a[i + 4], a[i + 6]);
+            b[2 * i + 5] = _mm_unpackhi_epi32(a[i + 4], a[i + 6]);
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            store(dst + 2 * i * dst_stride, _mm_unpacklo_epi64(b[i], b[i + 4]));
+            store(dst + (2 * i + 1) * dst_stride, _mm_unpackhi_epi64(b[i], b[i + 4]));
+        }
+    }
+
+    static inline void transpose_4x4_epi32(__m128i & r0, __m128i & r1, __m128i & r2, __m128i & r3)
+    {
+        __m128i a0 = _mm_unpacklo_epi32(r0, r1);
+        __m128i a1 = _mm_unpackhi_epi32(r0, r1);
+        __m128i a2 = _mm_unpacklo_epi32(r2, r3);
+        __m128i a3 = _mm_unpackhi_epi32(r2, r3);
+        r0 = _mm_unpacklo_epi64(a0, a2);
+        r1 = _mm_unpackhi_epi64(a0, a2);
+        r2 = _mm_unpacklo_epi64(a1, a3);
+        r3 = _mm_unpackhi_epi64(a1, a3);
+    }
+
+    void transpose_8x8_u24_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        // Each row of 8 3-byte pixels is widened to 4-byte pixels, transposed like transpose_8x8_u32_sse() and narrowed
+        // back. lo[i] and hi[i] hold pixels 0-3 and 4-7 of row i.
+        const __m128i widen = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i narrow = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        __m128i lo[8], hi[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            const uint8_t * s = src + i * src_stride;
+            __m128i a = load(s);
+            __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(s + 16));
+            lo[i] = _mm_shuffle_epi8(a, widen);
+            hi[i] = _mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), widen);
+        }
+
+        // Afterwards, lo[i] and lo[i + 4] hold row i of the result, and hi[i] and hi[i + 4] row i + 4
+        transpose_4x4_epi32(lo[0], lo[1], lo[2], lo[3]);
+        transpose_4x4_epi32(lo[4], lo[5], lo[6], lo[7]);
+        transpose_4x4_epi32(hi[0], hi[1], hi[2], hi[3]);
+        transpose_4x4_epi32(hi[4], hi[5], hi[6], hi[7]);
+
+        for (int i = 0; i < 8; ++i)
+        {
+            __m128i const * half = i < 4 ? lo : hi;
+            __m128i x = _mm_shuffle_epi8(half[i % 4], narrow);
+            __m128i y = _mm_shuffle_epi8(half[i % 4 + 4], narrow);
+            uint8_t * d = dst + i * dst_stride;
+            store(d, _mm_or_si128(x, _mm_slli_si128(y, 12)));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(d + 16), _mm_srli_si128(y, 4));
+        }
+    }
+
+    void transpose_8x8_u32_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride)
+    {
+        // Four 4x4 blocks, each transposed into the place of its mirror
+        for (int bi = 0; bi < 2; ++bi)
+            for (int bj = 0; bj < 2; ++bj)
+            {
+                const uint8_t * s = src + 4 * bi * src_stride + 16 * bj;
+                uint8_t * d = dst + 4 * bj * dst_stride + 16 * bi;
+                __m128i r0 = load(s);
+                __m128i r1 = load(s + src_stride);
+                __m128i r2 = load(s + 2 * src_stride);
+                __m128i r3 = load(s + 3 * src_stride);
+                __m128i a0 = _mm_unpacklo_epi32(r0, r1);
+                __m128i a1 = _mm_unpackhi_epi32(r0, r1);
+                __m128i a2 = _mm_unpacklo_epi32(r2, r3);
+                __m128i a3 = _mm_unpackhi_epi32(r2, r3);
+                store(d, _mm_unpacklo_epi64(a0, a2));
+                store(d + dst_stride, _mm_unpackhi_epi64(a0, a2));
+                store(d + 2 * dst_stride, _mm_unpacklo_epi64(a1, a3));
+                store(d + 3 * dst_stride, _mm_unpackhi_epi64(a1, a3));
+            }
+    }
+}
+
+#endif
@@ -0,0 +1,18 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    // SSE versions of transpose_pixels() for 8x8 blocks of 1, 2, 3 and 4-byte pixels, producing identical results
+    void transpose_8x8_u8_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride);
+    void transpose_8x8_u16_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride);
+    void transpose_8x8_u24_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride);
+    void transpose_8x8_u32_sse(const uint8_t * src, ptrdiff_t src_stride, uint8_t * dst, ptrdiff_t dst_stride);
+#endif
+}
@@ -0,0 +1,390 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h>
+
+#include <vector>
+
+namespace librealsense
+{
+    namespace
+    {
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        inline __m128 select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        inline __m128i is_zero(__m128i a)
+        {
+            return _mm_cmpeq_epi16(a, _mm_setzero_si128());
+        }
+
+        // |a - b| of unsigned 16-bit lanes
+        inline __m128i abs_diff(__m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_subs_epu16(a, b), _mm_subs_epu16(b, a));
+        }
+
+        // a <= b of unsigned 16-bit lanes
+        inline __m128i less_equal(__m128i a, __m128i b)
+        {
+            return is_zero(_mm_subs_epu16(a, b));
+        }
+
+        // a < b of unsigned 16-bit lanes
+        inline __m128i less(__m128i a, __m128i b)
+        {
+            return _mm_xor_si128(is_zero(_mm_subs_epu16(b, a)), _mm_set1_epi32(-1));
+        }
+
+        inline void transpose_8x8(__m128i r[8])
+        {
+            __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+            __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+            __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+            __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+            __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+            __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+            __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+            __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+            __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+            __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+            __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+            __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+            __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+            __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+            __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+            __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+            r[0] = _mm_unpacklo_epi64(b0, b4);
+            r[1] = _mm_unpackhi_epi64(b0, b4);
+            r[2] = _mm_unpacklo_epi64(b1, b5);
+            r[3] = _mm_unpackhi_epi64(b1, b5);
+            r[4] = _mm_unpacklo_epi64(b2, b6);
+            r[5] = _mm_unpackhi_epi64(b2, b6);
+            r[6] = _mm_unpacklo_epi64(b3, b7);
+            r[7] = _mm_unpackhi_epi64(b3, b7);
+        }
+
+        // The parameters and the arithmetic of the Z16 filter, on 8 lanes
+        struct z16_filter
+        {
+            __m128 alpha;
+            __m128 one_minus_alpha;
+            __m128 round;
+            __m128i delta_z;
+            __m128i radius;
+
+            z16_filter(float alpha_, float deltaZ, uint8_t holes_filling_radius)
+                : alpha(_mm_set1_ps(alpha_))
+                , one_minus_alpha(_mm_set1_ps(1.f - alpha_))
+                , round(_mm_set1_ps(0.5f))
+                , delta_z(_mm_set1_epi16(short(static_cast<uint16_t>(deltaZ))))
+                , radius(_mm_set1_epi16(holes_filling_radius))
+            {
+            }
+
+            // static_cast<uint16_t>(a * alpha + b * (1 - alpha) + 0.5f), with the same float operations
+            __m128i blend(__m128i a, __m128i b) const
+            {
+                const __m128i zero = _mm_setzero_si128();
+                __m128 lo = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(a, zero)), alpha),
+                                                  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(b, zero)), one_minus_alpha)),
+                                       round);
+                __m128 hi = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(a, zero)), alpha),
+                                                  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(b, zero)), one_minus_alpha)),
+                                       round);
+
+                // Pack to unsigned 16 bits without SSE4.1, through the signed range
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                const __m128i bias16 = _mm_set1_epi16(short(0x8000));
+                return _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(_mm_cvttps_epi32(lo), bias32),
+                                                     _mm_sub_epi32(_mm_cvttps_epi32(hi), bias32)),
+                                     bias16);
+            }
+
+            // The 'inertial' hole filling counter: reset when both pixels are valid, counted up while filling
+            __m128i count_fill(__m128i cur_fill, __m128i both_valid, __m128i filling) const
+            {
+                cur_fill = _mm_andnot_si128(both_valid, cur_fill);
+                return _mm_adds_epu16(cur_fill, _mm_and_si128(filling, _mm_set1_epi16(1)));
+            }
+        };
+
+        // Both directions of the horizontal pass over a band of 8 rows, transposed so that each element of 'col'
+        // holds a column of the band
+        void filter_band(uint16_t * col, size_t width, z16_filter const & f, bool holes_filling)
+        {
+            const __m128i one = _mm_set1_epi16(1);
+            const __m128i none = _mm_setzero_si128();
+
+            // left to right
+            __m128i val0 = _mm_loadu_si128(reinterpret_cast<__m128i *>(col));
+            __m128i cur_fill = none;
+            for (size_t u = 1; u < width - 1; u++)
+            {
+                __m128i * im = reinterpret_cast<__m128i *>(col + u * 8);
+                __m128i val1 = _mm_loadu_si128(im);
+
+                __m128i invalid0 = is_zero(val0);
+                __m128i invalid1 = is_zero(val1);
+                __m128i both_valid = _mm_andnot_si128(_mm_or_si128(invalid0, invalid1), _mm_set1_epi32(-1));
+                __m128i diff = abs_diff(val1, val0);
+                __m128i smooth = _mm_and_si128(both_valid, _mm_andnot_si128(is_zero(diff), less_equal(diff, f.delta_z)));
+                __m128i out = select(smooth, f.blend(val1, val0), val1);
+                if (holes_filling)
+                {
+                    __m128i filling = _mm_andnot_si128(invalid0, invalid1);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = select(_mm_and_si128(filling, less(cur_fill, f.radius)), val0, out);
+                }
+
+                _mm_storeu_si128(im, out);
+                val0 = out;
+            }
+
+            // right to left
+            __m128i val1 = _mm_loadu_si128(reinterpret_cast<__m128i *>(col + (width - 1) * 8));
+            cur_fill = none;
+            for (size_t u = width - 1; u > 0; u--)
+            {
+                __m128i * im = reinterpret_cast<__m128i *>(col + (u - 1) * 8);
+                __m128i val0 = _mm_loadu_si128(im);
+
+                __m128i invalid1 = is_zero(val1);
+                __m128i invalid0 = less_equal(val0, one);
+                __m128i both_valid = _mm_andnot_si128(_mm_or_si128(invalid0, invalid1), _mm_set1_epi32(-1));
+                __m128i smooth = _mm_and_si128(both_valid, less_equal(abs_diff(val1, val0), f.delta_z));
+                __m128i out = select(smooth, f.blend(val0, val1), val0);
+                if (holes_filling)
+                {
+                    __m128i filling = _mm_andnot_si128(invalid1, invalid0);
+                    cur_fill = f.count_fill(cur_fill, both_valid, filling);
+                    out = select(_mm_and_si128(filling, less(cur_fill, f.radius)), val1, out);
+                }
+
+                _mm_storeu_si128(im, out);
+                val1 = out;
+            }
+        }
+
+        // One step of the disparity filter recursion, on 4 lanes.
+        // The scalar state machine boils down to: the state is valid iff the last innovation was valid; a valid
+        // innovation that follows a valid one, close enough to it, is smoothed into the state.
+        struct fp_filter
+        {
+            __m128 alpha;
+            __m128 one_minus_alpha;
+            __m128 delta_z;
+            __m128 minus_delta_z;
+
+            fp_filter(float alpha_, float deltaZ)
+                : alpha(_mm_set1_ps(alpha_))
+                , one_minus_alpha(_mm_set1_ps(1.0f - alpha_))
+                , delta_z(_mm_set1_ps(deltaZ))
+                , minus_delta_z(_mm_set1_ps(-deltaZ))
+            {
+            }
+
+            static __m128 is_valid(__m128 x)
+            {
+                return _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_castps_si128(x), _mm_setzero_si128()));
+            }
+
+            // Returns the filtered innovation
+            __m128 step(__m128 innovation, __m128 & state, __m128 & previous_innovation, __m128 & valid) const
+            {
+                __m128 innovation_valid = is_valid(innovation);
+                __m128 delta = _mm_sub_ps(previous_innovation, innovation);
+                __m128 small_difference = _mm_and_ps(_mm_cmplt_ps(delta, delta_z), _mm_cmpgt_ps(delta, minus_delta_z));
+                __m128 smooth = _mm_and_ps(_mm_and_ps(valid, innovation_valid), small_difference);
+                __m128 filtered = _mm_add_ps(_mm_mul_ps(innovation, alpha), _mm_mul_ps(state, one_minus_alpha));
+
+                state = select(smooth, filtered, select(innovation_valid, innovation, state));
+                previous_innovation = innovation;
+                valid = innovation_valid;
+                return select(smooth, filtered, innovation);
+            }
+        };
+
+        void filter_band(float * col, size_t width, fp_filter const & f)
+        {
+            // left to right
+            __m128 state = _mm_loadu_ps(col);
+            __m128 previous_innovation = state;
+            __m128 valid = fp_filter::is_valid(state);
+            for (size_t u = 1; u < width; u++)
+                _mm_storeu_ps(col + u * 4, f.step(_mm_loadu_ps(col + u * 4), state, previous_innovation, valid));
+
+            // right to left
+            state = _mm_loadu_ps(col + (width - 1) * 4);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t u = width - 1; u > 0; u--)
+                _mm_storeu_ps(col + (u - 1) * 4, f.step(_mm_loadu_ps(col + (u - 1) * 4), state, previous_innovation, valid));
+        }
+    }
+
+    void recursive_filter_horizontal_rows_sse(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                              float alpha, float deltaZ, uint8_t holes_filling_radius)
+    {
+        const z16_filter f(alpha, deltaZ, holes_filling_radius);
+        std::vector<uint16_t> columns(width * 8);
+        uint16_t * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 8)
+        {
+            uint16_t * rows = image + v * width;
+            __m128i block[8];
+
+            size_t u = 0;
+            for (; u + 8 <= width; u += 8)
+            {
+                for (int i = 0; i < 8; ++i)
+                    block[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rows + i * width + u));
+                transpose_8x8(block);
+                for (int i = 0; i < 8; ++i)
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(col + (u + i) * 8), block[i]);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    col[u * 8 + i] = rows[i * width + u];
+
+            filter_band(col, width, f, holes_filling_radius != 0);
+
+            for (u = 0; u + 8 <= width; u += 8)
+            {
+                for (int i = 0; i < 8; ++i)
+                    block[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(col + (u + i) * 8));
+                transpose_8x8(block);
+                for (int i = 0; i < 8; ++i)
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(rows + i * width + u), block[i]);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 8; ++i)
+                    rows[i * width + u] = col[u * 8 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_sse(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                               float alpha, float deltaZ)
+    {
+        const z16_filter f(alpha, deltaZ, 0);
+
+        for (size_t u = u_begin; u < u_end; u += 8)
+        {
+            // top to bottom
+            __m128i * im = reinterpret_cast<__m128i *>(image + u);
+            __m128i im0 = _mm_loadu_si128(im);
+            for (size_t v = 1; v < height; v++)
+            {
+                im = reinterpret_cast<__m128i *>(image + v * width + u);
+                __m128i imw = _mm_loadu_si128(im);
+                __m128i smooth = less(abs_diff(im0, imw), f.delta_z);
+                im0 = select(smooth, f.blend(imw, im0), imw);
+                _mm_storeu_si128(im, im0);
+            }
+
+            // bottom to top
+            __m128i imw = im0;
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                im = reinterpret_cast<__m128i *>(image + (v - 1) * width + u);
+                im0 = _mm_loadu_si128(im);
+                __m128i valid = _mm_andnot_si128(_mm_or_si128(is_zero(im0), is_zero(imw)), _mm_set1_epi32(-1));
+                __m128i smooth = _mm_and_si128(valid, less(abs_diff(im0, imw), f.delta_z));
+                imw = select(smooth, f.blend(im0, imw), im0);
+                _mm_storeu_si128(im, imw);
+            }
+        }
+    }
+
+    void recursive_filter_horizontal_rows_fp_sse(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                 float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+        std::vector<float> columns(width * 4);
+        float * col = columns.data();
+
+        for (size_t v = v_begin; v < v_end; v += 4)
+        {
+            float * rows = image + v * width;
+
+            size_t u = 0;
+            for (; u + 4 <= width; u += 4)
+            {
+                __m128 r0 = _mm_loadu_ps(rows + u);
+                __m128 r1 = _mm_loadu_ps(rows + width + u);
+                __m128 r2 = _mm_loadu_ps(rows + 2 * width + u);
+                __m128 r3 = _mm_loadu_ps(rows + 3 * width + u);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _mm_storeu_ps(col + u * 4, r0);
+                _mm_storeu_ps(col + u * 4 + 4, r1);
+                _mm_storeu_ps(col + u * 4 + 8, r2);
+                _mm_storeu_ps(col + u * 4 + 12, r3);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 4; ++i)
+                    col[u * 4 + i] = rows[i * width + u];
+
+            filter_band(col, width, f);
+
+            for (u = 0; u + 4 <= width; u += 4)
+            {
+                __m128 r0 = _mm_loadu_ps(col + u * 4);
+                __m128 r1 = _mm_loadu_ps(col + u * 4 + 4);
+                __m128 r2 = _mm_loadu_ps(col + u * 4 + 8);
+                __m128 r3 = _mm_loadu_ps(col + u * 4 + 12);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _mm_storeu_ps(rows + u, r0);
+                _mm_storeu_ps(rows + width + u, r1);
+                _mm_storeu_ps(rows + 2 * width + u, r2);
+                _mm_storeu_ps(rows + 3 * width + u, r3);
+            }
+            for (; u < width; ++u)
+                for (int i = 0; i < 4; ++i)
+                    rows[i * width + u] = col[u * 4 + i];
+        }
+    }
+
+    void recursive_filter_vertical_columns_fp_sse(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                  float alpha, float deltaZ)
+    {
+        const fp_filter f(alpha, deltaZ);
+
+        for (size_t u = u_begin; u < u_end; u += 4)
+        {
+            // top to bottom
+            __m128 state = _mm_loadu_ps(image + u);
+            __m128 previous_innovation = state;
+            __m128 valid = fp_filter::is_valid(state);
+            for (size_t v = 1; v < height; v++)
+            {
+                float * im = image + v * width + u;
+                _mm_storeu_ps(im, f.step(_mm_loadu_ps(im), state, previous_innovation, valid));
+            }
+
+            // bottom to top
+            state = _mm_loadu_ps(image + (height - 1) * width + u);
+            previous_innovation = state;
+            valid = fp_filter::is_valid(state);
+            for (size_t v = height - 1; v > 0; v--)
+            {
+                float * im = image + (v - 1) * width + u;
+                _mm_storeu_ps(im, f.step(_mm_loadu_ps(im), state, previous_innovation, valid));
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,24 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    // SSSE3 versions of the spatial filter passes in spatial-filter.h, producing identical results.
+    // Each vector lane follows the recursion of a single row (horizontal passes) or column (vertical passes): ranges
+    // must hold a multiple of 8 rows/columns for Z16 data, and of 4 for disparity.
+    void recursive_filter_horizontal_rows_sse(uint16_t * image, size_t width, size_t v_begin, size_t v_end,
+                                              float alpha, float deltaZ, uint8_t holes_filling_radius);
+    void recursive_filter_vertical_columns_sse(uint16_t * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                               float alpha, float deltaZ);
+    void recursive_filter_horizontal_rows_fp_sse(float * image, size_t width, size_t v_begin, size_t v_end,
+                                                 float alpha, float deltaZ);
+    void recursive_filter_vertical_columns_fp_sse(float * image, size_t width, size_t height, size_t u_begin, size_t u_end,
+                                                  float alpha, float deltaZ);
+#endif
+}
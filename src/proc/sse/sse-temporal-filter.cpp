@@ -0,0 +1,176 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "sse-temporal-filter.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        inline __m128i is_zero(__m128i a)
+        {
+            return _mm_cmpeq_epi16(a, _mm_setzero_si128());
+        }
+
+        inline __m128i is_not_zero(__m128i a)
+        {
+            return _mm_xor_si128(is_zero(a), _mm_set1_epi32(-1));
+        }
+
+        // Whether persistence_map[history] has the bit of the current phase, looked up for 16 history bytes at once:
+        // the low nibble of the history selects a byte in one of two tables, and the high nibble a bit in that byte
+        class credibility
+        {
+            __m128i _low_table;     // histories 0x00-0x7f
+            __m128i _high_table;    // histories 0x80-0xff
+
+        public:
+            credibility(const uint8_t * persistence_map, uint8_t phase)
+            {
+                uint8_t tables[2][16] = {};
+                for (int h = 0; h < 256; ++h)
+                    if (persistence_map[h] & (1 << phase))
+                        tables[h >> 7][h & 0x0f] |= uint8_t(1 << ((h >> 4) & 7));
+                _low_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tables[0]));
+                _high_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tables[1]));
+            }
+
+            // 0xff for credible histories, 0 otherwise
+            __m128i operator()(__m128i history) const
+            {
+                const __m128i nibble = _mm_set1_epi8(0x0f);
+                const __m128i bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+                __m128i low = _mm_and_si128(history, nibble);
+                __m128i high = _mm_and_si128(_mm_srli_epi16(history, 4), nibble);
+                __m128i bits = _mm_shuffle_epi8(bit, high);
+                __m128i table = select(_mm_cmpgt_epi8(high, _mm_set1_epi8(7)),
+                                       _mm_shuffle_epi8(_high_table, low),
+                                       _mm_shuffle_epi8(_low_table, low));
+                return _mm_cmpeq_epi8(_mm_and_si128(table, bits), bits);
+            }
+        };
+
+        // The new history of 16 pixels, given which have a value and which of those agree with the last one
+        inline __m128i update_history(__m128i history, __m128i mask, __m128i cur_valid, __m128i agree)
+        {
+            return select(cur_valid, select(agree, _mm_or_si128(history, mask), mask), _mm_andnot_si128(mask, history));
+        }
+    }
+
+    void temporal_filter_pixels_sse(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t begin, size_t end,
+                                    float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const __m128i mask = _mm_set1_epi8(char(1 << phase));
+        const __m128i delta_z = _mm_set1_epi16(delta);
+        const __m128 alpha_ = _mm_set1_ps(alpha);
+        const __m128 one_minus_alpha = _mm_set1_ps(1.f - alpha);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m128i * hist = reinterpret_cast<__m128i *>(history + i);
+            __m128i h = _mm_loadu_si128(hist);
+            __m128i credible = is_credible(h);
+            __m128i cur_valid[2], agree[2];
+
+            for (int k = 0; k < 2; ++k)
+            {
+                __m128i * cur_ptr = reinterpret_cast<__m128i *>(frame + i + k * 8);
+                __m128i * prev_ptr = reinterpret_cast<__m128i *>(last_frame + i + k * 8);
+                __m128i cur = _mm_loadu_si128(cur_ptr);
+                __m128i prev = _mm_loadu_si128(prev_ptr);
+
+                cur_valid[k] = is_not_zero(cur);
+                __m128i prev_valid = is_not_zero(prev);
+                __m128i diff = _mm_or_si128(_mm_subs_epu16(cur, prev), _mm_subs_epu16(prev, cur));
+                __m128i close = is_not_zero(_mm_subs_epu16(delta_z, diff));  // diff < delta_z
+                agree[k] = _mm_and_si128(_mm_and_si128(cur_valid[k], prev_valid), close);
+
+                // static_cast<uint16_t>(alpha * cur + (1 - alpha) * prev), with the same float operations
+                __m128 lo = _mm_add_ps(_mm_mul_ps(alpha_, _mm_cvtepi32_ps(_mm_unpacklo_epi16(cur, zero))),
+                                       _mm_mul_ps(one_minus_alpha, _mm_cvtepi32_ps(_mm_unpacklo_epi16(prev, zero))));
+                __m128 hi = _mm_add_ps(_mm_mul_ps(alpha_, _mm_cvtepi32_ps(_mm_unpackhi_epi16(cur, zero))),
+                                       _mm_mul_ps(one_minus_alpha, _mm_cvtepi32_ps(_mm_unpackhi_epi16(prev, zero))));
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                __m128i filtered = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(_mm_cvttps_epi32(lo), bias32),
+                                                                 _mm_sub_epi32(_mm_cvttps_epi32(hi), bias32)),
+                                                 _mm_set1_epi16(short(0x8000)));
+
+                __m128i updated = select(agree[k], filtered, cur);
+                __m128i credible16 = k ? _mm_unpackhi_epi8(credible, credible) : _mm_unpacklo_epi8(credible, credible);
+                __m128i filled = select(_mm_and_si128(prev_valid, credible16), prev, cur);
+                _mm_storeu_si128(cur_ptr, select(cur_valid[k], updated, filled));
+                _mm_storeu_si128(prev_ptr, select(cur_valid[k], updated, prev));
+            }
+
+            _mm_storeu_si128(hist, update_history(h, mask,
+                                                  _mm_packs_epi16(cur_valid[0], cur_valid[1]),
+                                                  _mm_packs_epi16(agree[0], agree[1])));
+        }
+    }
+
+    void temporal_filter_pixels_sse(float * frame, float * last_frame, uint8_t * history, size_t begin, size_t end,
+                                    float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+        const credibility is_credible(persistence_map, phase);
+        const __m128i mask = _mm_set1_epi8(char(1 << phase));
+        const __m128 delta_z = _mm_set1_ps(static_cast<float>(delta));
+        const __m128 alpha_ = _mm_set1_ps(alpha);
+        const __m128 one_minus_alpha = _mm_set1_ps(1.f - alpha);
+        const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 zero = _mm_setzero_ps();
+
+        for (size_t i = begin; i < end; i += 16)
+        {
+            __m128i * hist = reinterpret_cast<__m128i *>(history + i);
+            __m128i h = _mm_loadu_si128(hist);
+            __m128i credible = is_credible(h);
+            __m128i credible16[2] = { _mm_unpacklo_epi8(credible, credible), _mm_unpackhi_epi8(credible, credible) };
+            __m128i cur_valid[4], agree[4];
+
+            for (int k = 0; k < 4; ++k)
+            {
+                float * cur_ptr = frame + i + k * 4;
+                float * prev_ptr = last_frame + i + k * 4;
+                __m128 cur = _mm_loadu_ps(cur_ptr);
+                __m128 prev = _mm_loadu_ps(prev_ptr);
+
+                __m128 cur_valid_ps = _mm_cmpneq_ps(cur, zero);
+                __m128 prev_valid = _mm_cmpneq_ps(prev, zero);
+                __m128 diff = _mm_and_ps(_mm_sub_ps(cur, prev), abs_mask);
+                __m128 agree_ps = _mm_and_ps(_mm_and_ps(cur_valid_ps, prev_valid), _mm_cmplt_ps(diff, delta_z));
+                __m128 filtered = _mm_add_ps(_mm_mul_ps(alpha_, cur), _mm_mul_ps(one_minus_alpha, prev));
+
+                __m128 updated = _mm_or_ps(_mm_and_ps(agree_ps, filtered), _mm_andnot_ps(agree_ps, cur));
+                __m128 credible32 = _mm_castsi128_ps(k & 1 ? _mm_unpackhi_epi16(credible16[k / 2], credible16[k / 2])
+                                                           : _mm_unpacklo_epi16(credible16[k / 2], credible16[k / 2]));
+                __m128 fill = _mm_and_ps(prev_valid, credible32);
+                __m128 filled = _mm_or_ps(_mm_and_ps(fill, prev), _mm_andnot_ps(fill, cur));
+                _mm_storeu_ps(cur_ptr, _mm_or_ps(_mm_and_ps(cur_valid_ps, updated), _mm_andnot_ps(cur_valid_ps, filled)));
+                _mm_storeu_ps(prev_ptr, _mm_or_ps(_mm_and_ps(cur_valid_ps, updated), _mm_andnot_ps(cur_valid_ps, prev)));
+
+                cur_valid[k] = _mm_castps_si128(cur_valid_ps);
+                agree[k] = _mm_castps_si128(agree_ps);
+            }
+
+            _mm_storeu_si128(hist, update_history(h, mask,
+                                                  _mm_packs_epi16(_mm_packs_epi32(cur_valid[0], cur_valid[1]),
+                                                                  _mm_packs_epi32(cur_valid[2], cur_valid[3])),
+                                                  _mm_packs_epi16(_mm_packs_epi32(agree[0], agree[1]),
+                                                                  _mm_packs_epi32(agree[2], agree[3]))));
+        }
+    }
+}
+
+#endif
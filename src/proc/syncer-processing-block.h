@@ -43,7 +43,7 @@ namespace librealsense
         std::shared_ptr<matcher> _matcher;
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
 
-        single_consumer_frame_queue<frame_holder> _matches;
+        lock_free_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
     };
 }
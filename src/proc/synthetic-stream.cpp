@@ -71,6 +71,10 @@ namespace librealsense
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // Checked before the copies below take references of their own
+            auto input = dynamic_cast<frame*>((frame_interface*)f.get());
+            _input_unique = input && !f.is<rs2::frameset>() && input->is_unique();
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -296,11 +300,8 @@ namespace librealsense
         return false;
     }
 
-    bool depth_processing_block::should_process(const rs2::frame& frame)
+    bool depth_processing_block::should_process_profile(const rs2::stream_profile& profile)
     {
-        if (!frame || frame.is<rs2::frameset>())
-            return false;
-        auto profile = frame.get_profile();
         rs2_stream stream = profile.stream_type();
         rs2_format format = profile.format();
         int index = profile.stream_index();
@@ -327,8 +328,12 @@ namespace librealsense
     {
         if (!frame || frame.is<rs2::frameset>())
             return false;
-        auto profile = frame.get_profile();
-        return _stream_filter.match(frame);
+        return should_process_profile(frame.get_profile());
+    }
+
+    bool stream_filter_processing_block::should_process_profile(const rs2::stream_profile& profile)
+    {
+        return _stream_filter.match(stream_filter(profile.stream_type(), profile.format(), profile.stream_index()));
     }
 
     synthetic_source::synthetic_source( frame_source & actual )
@@ -451,7 +456,8 @@ namespace librealsense
 
     frame_interface* synthetic_source::allocate_motion_frame(std::shared_ptr<stream_profile_interface> stream,
         frame_interface* original,
-        rs2_extension frame_type)
+        rs2_extension frame_type,
+        size_t data_size)
     {
         auto of = dynamic_cast<frame*>(original);
         if (!of)
@@ -459,7 +465,7 @@ namespace librealsense
 
         frame_additional_data data = of->additional_data;
         auto res = _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), frame_type },
-                                               of->get_frame_data_size(),
+                                               data_size ? data_size : of->get_frame_data_size(),
                                                std::move( data ),
                                                true );
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
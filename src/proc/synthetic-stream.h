@@ -34,7 +34,8 @@ namespace librealsense
 
         frame_interface* allocate_motion_frame(std::shared_ptr<stream_profile_interface> stream,
             frame_interface* original,
-            rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) override;
+            rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME,
+            size_t data_size = 0) override;
 
         frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
 
@@ -79,6 +80,13 @@ namespace librealsense
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // Whether the frame being processed was handed to the block with no other reference to it, so that it may be
+        // written over and returned instead of allocating a new frame. Never true of the frames of a frameset.
+        bool is_input_unique() const { return _input_unique; }
+
+    private:
+        bool _input_unique = false;
     };
 
     struct stream_filter
@@ -141,6 +149,8 @@ namespace librealsense
         stream_filter _stream_filter;
 
         bool should_process(const rs2::frame& frame) override;
+        // Whether frames of the profile pass the stream filter
+        virtual bool should_process_profile(const rs2::stream_profile& profile);
     };
 
     // process frames with a given function
@@ -206,7 +216,7 @@ namespace librealsense
         virtual ~depth_processing_block() { _source.flush(); }
 
     protected:
-        bool should_process(const rs2::frame& frame) override;
+        bool should_process_profile(const rs2::stream_profile& profile) override;
     };
 
 }
@@ -8,6 +8,11 @@
 #include "environment.h"
 #include "proc/synthetic-stream.h"
 #include "proc/temporal-filter.h"
+#include "proc/worker-pool.h"
+#include "proc/sse/sse-temporal-filter.h"
+#include "proc/sse/avx-temporal-filter.h"
+#include "proc/neon/neon-temporal-filter.h"
+#include "proc/simd-dispatch.h"
 
 #include <rsutils/string/from.h>
 
@@ -41,8 +46,13 @@ namespace librealsense
         _delta_param(temp_delta_default),
         _width(0), _height(0), _stride(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
-        _current_frm_size_pixels(0)
+        _current_frm_size_pixels(0),
+        _frame_alpha(temp_alpha_default),
+        _frame_delta(temp_delta_default),
+        _workers(worker_pool::get()),
+        _max_threads(0)
     {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
 
@@ -112,6 +122,10 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, temporal_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, temporal_filter_delta);
 
+        auto max_threads_opt = std::make_shared<ptr_option<int>>(0, _workers->get_concurrency(), 1, 0, &_max_threads,
+            "Largest number of threads working on a frame at once; 0 lets all those of the shared pool");
+        register_option(RS2_OPTION_MAX_THREADS, max_threads_opt);
+
         on_set_persistence_control(_persistence_param);
         on_set_delta(_delta_param);
         on_set_alpha(_alpha_param);
@@ -119,14 +133,14 @@ namespace librealsense
 
     rs2::frame temporal_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
-        update_configuration(f);
+        update_configuration(f.get_profile(), f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME);
         auto tgt = prepare_target_frame(f, source);
 
         // Temporal filter execution
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            temp_jw_smooth<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temp_jw_smooth(static_cast<float*>(const_cast<void*>(tgt.get_data())), reinterpret_cast<float*>(_last_frame.data()), _history.data());
         else
-            temp_jw_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temp_jw_smooth(static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())), reinterpret_cast<uint16_t*>(_last_frame.data()), _history.data());
 
         return tgt;
     }
@@ -159,15 +173,15 @@ namespace librealsense
         _history.clear();
     }
 
-    void  temporal_filter::update_configuration(const rs2::frame& f)
+    void  temporal_filter::update_configuration(const rs2::stream_profile& profile, rs2_extension type)
     {
-        if (f.get_profile().get() != _source_stream_profile.get())
+        if (profile.get() != _source_stream_profile.get())
         {
-            _source_stream_profile = f.get_profile();
+            _source_stream_profile = profile;
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
 
             //TODO - reject any frame other than depth/disparity
-            _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+            _extension_type = type;
             _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
@@ -176,11 +190,14 @@ namespace librealsense
             _current_frm_size_pixels = _width * _height;
 
             _last_frame.clear();
-            _last_frame.resize(_current_frm_size_pixels*_bpp);
-
             _history.clear();
-            _history.resize(_current_frm_size_pixels*_bpp);
+        }
 
+        // Also after the options were changed, which clears the filter's state
+        if (_last_frame.empty())
+        {
+            _last_frame.resize(_current_frm_size_pixels*_bpp);
+            _history.resize(_current_frm_size_pixels);
         }
     }
 
@@ -193,6 +210,104 @@ namespace librealsense
         return tgt;
     }
 
+    template void temporal_filter_pixels<uint16_t>(uint16_t *, uint16_t *, uint8_t *, size_t, size_t, float, uint8_t, uint8_t, const uint8_t *);
+    template void temporal_filter_pixels<float>(float *, float *, uint8_t *, size_t, size_t, float, uint8_t, uint8_t, const uint8_t *);
+
+    // The SIMD kernels filter 16 pixels at a time (32 with AVX2); the rest of a band is left to the scalar kernel
+    static const size_t simd_pixels = 16;
+
+    // Returns the end of the range that was filtered with SIMD
+    template<typename T>
+    static size_t simd_filter(T * frame, T * last_frame, uint8_t * history, size_t begin, size_t end,
+                              float alpha, uint8_t delta, uint8_t phase, const uint8_t * persistence_map)
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            end = begin + (end - begin) / (2 * simd_pixels) * (2 * simd_pixels);
+            temporal_filter_pixels_avx2(frame, last_frame, history, begin, end, alpha, delta, phase, persistence_map);
+            return end;
+        }
+#endif
+        end = begin + (end - begin) / simd_pixels * simd_pixels;
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return begin;
+        temporal_filter_pixels_sse(frame, last_frame, history, begin, end, alpha, delta, phase, persistence_map);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        end = begin + (end - begin) / simd_pixels * simd_pixels;
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return begin;
+        temporal_filter_pixels_neon(frame, last_frame, history, begin, end, alpha, delta, phase, persistence_map);
+        return end;
+#else
+        return begin;
+#endif
+    }
+
+    template<typename T>
+    void temporal_filter::temp_jw_smooth(T * frame, T * last_frame, uint8_t * history)
+    {
+        snapshot_params();
+
+        // A few bands per thread evens out the load
+        size_t const bands = _workers->get_concurrency() * 4;
+        _workers->parallel_for(_height, (_height + bands - 1) / bands, [&](size_t begin, size_t end)
+        {
+            filter_rows(frame, last_frame, history, begin, end);
+        }, _max_threads);
+
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+    }
+
+    template<typename T>
+    void temporal_filter::filter_rows(T * frame, T * last_frame, uint8_t * history, size_t begin, size_t end)
+    {
+        uint8_t phase = _cur_frame_index;
+        begin *= _width;
+        end *= _width;
+        auto simd_end = simd_filter(frame, last_frame, history, begin, end, _frame_alpha, _frame_delta, phase, _persistence_map.data());
+        temporal_filter_pixels(frame, last_frame, history, simd_end, end, _frame_alpha, _frame_delta, uint8_t(1 << phase), _persistence_map.data());
+    }
+
+    void temporal_filter::snapshot_params()
+    {
+        // Copy locally, to remove need for a lock.
+        _frame_alpha = _alpha_param;
+        _frame_delta = _delta_param;
+    }
+
+    bool temporal_filter::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        if (!should_process_profile(image.profile))
+            return false;
+
+        update_configuration(image.profile, image.type);
+        snapshot_params();
+        image.profile = _target_stream_profile;
+        return true;
+    }
+
+    void temporal_filter::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        if (out != in)
+            memcpy(static_cast<uint8_t*>(out) + begin * _stride, static_cast<const uint8_t*>(in) + begin * _stride, (end - begin) * _stride);
+
+        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+            filter_rows(static_cast<float*>(out), reinterpret_cast<float*>(_last_frame.data()), _history.data(), begin, end);
+        else
+            filter_rows(static_cast<uint16_t*>(out), reinterpret_cast<uint16_t*>(_last_frame.data()), _history.data(), begin, end);
+    }
+
+    void temporal_filter::finish_fused()
+    {
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+    }
+
     void temporal_filter::recalc_persistence_map()
     {
         _persistence_map.fill(0);
@@ -3,88 +3,103 @@
 
 #pragma once
 #include "types.h"
+#include "fused-filter.h"
 
 namespace librealsense
 {
     const size_t PRESISTENCY_LUT_SIZE = 256;
 
-    class temporal_filter : public depth_processing_block
+    // The filter over pixels [begin, end), for the frame whose bit in the history is 'mask'. Pixels are independent of
+    // each other, so ranges can be filtered concurrently. This is the reference implementation: SIMD versions must
+    // produce identical results.
+    template<typename T>
+    void temporal_filter_pixels(T * frame, T * _last_frame, uint8_t * history, size_t begin, size_t end,
+                                float alpha, uint8_t delta, uint8_t mask, const uint8_t * persistence_map)
     {
-    public:
-        temporal_filter();
-
-    protected:
-        void    update_configuration(const rs2::frame& f);
-        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
 
-        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+        T delta_z = static_cast<T>(delta);
+        float one_minus_alpha = 1.f - alpha;
 
-        template<typename T>
-        void temp_jw_smooth(void* frame_data, void * _last_frame_data, uint8_t *history)
+        // pass one -- go through image and update all
+        for (size_t i = begin; i < end; i++)
         {
-            static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
-
-            const bool fp = (std::is_floating_point<T>::value);
-
-            T delta_z = static_cast<T>(_delta_param);
-
-            auto frame          = reinterpret_cast<T*>(frame_data);
-            auto _last_frame    = reinterpret_cast<T*>(_last_frame_data);
+            T cur_val = frame[i];
+            T prev_val = _last_frame[i];
 
-            unsigned char mask = 1 << _cur_frame_index;
-
-            // Copy locally, to remove need for a lock.
-            float alpha = _alpha_param;
-            float one_minus_alpha = 1.f - alpha;
-            // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            if (cur_val)
             {
-                T cur_val = frame[i];
-                T prev_val = _last_frame[i];
-
-                if (cur_val)
+                if (!prev_val)
                 {
-                    if (!prev_val)
+                    _last_frame[i] = cur_val;
+                    history[i] = mask;
+                }
+                else
+                {  // old and new val
+                    T diff = static_cast<T>(fabs(cur_val - prev_val));
+
+                    if (diff < delta_z)
+                    {  // old and new val agree
+                        history[i] |= mask;
+                        float filtered = alpha * cur_val + one_minus_alpha * prev_val;
+                        T result = static_cast<T>(filtered);
+                        frame[i] = result;
+                        _last_frame[i] = result;
+                    }
+                    else
                     {
                         _last_frame[i] = cur_val;
                         history[i] = mask;
                     }
-                    else
-                    {  // old and new val
-                        T diff = static_cast<T>(fabs(cur_val - prev_val));
-
-                        if (diff < delta_z)
-                        {  // old and new val agree
-                            history[i] |= mask;
-                            float filtered = alpha * cur_val + one_minus_alpha * prev_val;
-                            T result = static_cast<T>(filtered);
-                            frame[i] = result;
-                            _last_frame[i] = result;
-                        }
-                        else
-                        {
-                            _last_frame[i] = cur_val;
-                            history[i] = mask;
-                        }
-                    }
                 }
-                else
-                {  // no cur_val
-                    if (prev_val)
-                    { // only case we can help
-                        unsigned char hist = history[i];
-                        unsigned char classification = _persistence_map[hist];
-                        if (classification & mask)
-                        { // we have had enough samples lately
-                            frame[i] = prev_val;
-                        }
+            }
+            else
+            {  // no cur_val
+                if (prev_val)
+                { // only case we can help
+                    unsigned char hist = history[i];
+                    unsigned char classification = persistence_map[hist];
+                    if (classification & mask)
+                    { // we have had enough samples lately
+                        frame[i] = prev_val;
                     }
-                    history[i] &= ~mask;
                 }
+                history[i] &= ~mask;
             }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
+    }
+
+    // Instantiated along with the rest of the filter, which is built without fused multiply-adds
+    extern template void temporal_filter_pixels<uint16_t>(uint16_t *, uint16_t *, uint8_t *, size_t, size_t, float, uint8_t, uint8_t, const uint8_t *);
+    extern template void temporal_filter_pixels<float>(float *, float *, uint8_t *, size_t, size_t, float, uint8_t, uint8_t, const uint8_t *);
+
+    class worker_pool;
+
+    class temporal_filter : public depth_processing_block, public fusable_filter
+    {
+    public:
+        temporal_filter();
+
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        bool is_row_local() const override { return true; }
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        void finish_fused() override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
+    protected:
+        void    update_configuration(const rs2::stream_profile& profile, rs2_extension type);
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+
+        // Filters bands of rows on the worker pool
+        template<typename T>
+        void temp_jw_smooth(T * frame, T * last_frame, uint8_t * history);
+
+        // Filters rows [begin, end) for the current phase, with the parameters of snapshot_params()
+        template<typename T>
+        void filter_rows(T * frame, T * last_frame, uint8_t * history, size_t begin, size_t end);
+        void snapshot_params();
 
     private:
         void on_set_persistence_control(uint8_t val);
@@ -103,10 +118,14 @@ namespace librealsense
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         std::vector<uint8_t>    _last_frame;                // Hold the last frame received for the current profile
-        std::vector<uint8_t>    _history;                   // represents the history over the last 8 frames, 1 bit per frame
+        std::vector<uint8_t>    _history;                   // represents the history over the last 8 frames, 1 bit per frame, 1 byte per pixel
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
+        float                   _frame_alpha;               // The parameters of the frame being filtered
+        uint8_t                 _frame_delta;
+        std::shared_ptr<worker_pool> _workers;
+        int                     _max_threads;
     };
     MAP_EXTENSION(RS2_EXTENSION_TEMPORAL_FILTER, librealsense::temporal_filter);
 }
@@ -9,15 +9,32 @@
 #include "context.h"
 #include "environment.h"
 #include "option.h"
+#include "stream.h"
 #include "threshold.h"
 #include "image.h"
+#include "simd-dispatch.h"
+#include "sse/sse-depth-transforms.h"
+#include "sse/avx-depth-transforms.h"
+#include "neon/neon-depth-transforms.h"
 
 namespace librealsense
 {
-    threshold::threshold() : stream_filter_processing_block("Threshold Filter"),_min(0.1f), _max(4.f)
+    void threshold_depth_pixels(const uint16_t* in, uint16_t* out, float units, float min, float max,
+        size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            auto dist = units * in[i];
+            out[i] = (dist >= min && dist <= max) ? in[i] : 0;
+        }
+    }
+
+    threshold::threshold() : stream_filter_processing_block("Threshold Filter"),_min(0.1f), _max(4.f), _fused_units(0.f), _fused_width(0), _in_place(false)
     {
         _stream_filter.format = RS2_FORMAT_Z16;
         _stream_filter.stream = RS2_STREAM_DEPTH;
+
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
         
         auto min_opt = std::make_shared<ptr_option<float>>(0.f, 16.f, 0.1f, 0.1f, &_min, "Min range in meters");
 
@@ -32,21 +49,36 @@ namespace librealsense
             std::make_shared<min_distance_option>(
                 min_opt,
                 max_opt));
+
+        auto in_place_opt = std::make_shared<ptr_option<bool>>(false, true, true, false, &_in_place,
+            "Threshold a frame in its own buffer when nothing else holds it, instead of allocating a new frame");
+        register_option(RS2_OPTION_FILTER_IN_PLACE, in_place_opt);
     }
 
     rs2::frame threshold::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         if (!f.is<rs2::depth_frame>()) return f;
 
-        if (f.get_profile().get() != _source_stream_profile.get())
-        {
-            _source_stream_profile = f.get_profile();
-            _target_stream_profile = f.get_profile().clone(RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16);
-        }
+        update_target_profile(f.get_profile());
 
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
+
+        auto orig = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)f.get());
+        if (!orig)
+            throw std::runtime_error("Frame is not depth frame");
+
+        if (_in_place && is_input_unique() && orig->owns_data())
+        {
+            // No one else can see the frame change
+            auto data = static_cast<uint16_t*>(const_cast<void*>(vf.get_data()));
+            threshold_pixels(data, data, width * height, vf.get_units());
+            orig->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(
+                _target_stream_profile.get()->profile->shared_from_this()));
+            return f;
+        }
+
         auto new_f = source.allocate_video_frame(_target_stream_profile, f,
             vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
@@ -56,26 +88,78 @@ namespace librealsense
             if (!ptr)
                 throw std::runtime_error("Frame is not depth frame");
 
-            auto orig = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)f.get());
-            if (!orig)
-                throw std::runtime_error("Frame is not depth frame");
-
             auto depth_data = (uint16_t*)orig->get_frame_data();
             auto new_data = (uint16_t*)ptr->get_frame_data();
 
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-            for (int i = 0; i < width * height; i++)
-            {
-                auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
-            }
+            threshold_pixels(depth_data, new_data, width * height, du);
 
             return new_f;
         }
 
         return f;
     }
+
+    void threshold::update_target_profile(const rs2::stream_profile& profile)
+    {
+        if (profile.get() != _source_stream_profile.get())
+        {
+            _source_stream_profile = profile;
+            _target_stream_profile = profile.clone(RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16);
+        }
+    }
+
+    // The widest SIMD kernel enabled, or none
+    struct threshold_kernel
+    {
+        void (*pixels)(const uint16_t* in, uint16_t* out, float units, float min, float max, size_t begin, size_t end);
+        size_t step; // pixels thresholded at a time
+    };
+
+    static threshold_kernel select_threshold_kernel()
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        if (simd_enabled(simd_level::avx2))
+            return { threshold_depth_pixels_avx2, 16 };
+#endif
+        if (simd_enabled(simd_level::ssse3))
+            return { threshold_depth_pixels_sse, 8 };
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+            return { threshold_depth_pixels_neon, 8 };
+#endif
+        return { nullptr, 0 };
+    }
+
+    void threshold::threshold_pixels(const uint16_t* in, uint16_t* out, size_t n, float units) const
+    {
+        static const threshold_kernel simd = select_threshold_kernel();
+
+        size_t const simd_end = simd.step ? n / simd.step * simd.step : 0;
+        if (simd_end)
+            simd.pixels(in, out, units, _min, _max, 0, simd_end);
+        threshold_depth_pixels(in, out, units, _min, _max, simd_end, n);
+    }
+
+    bool threshold::configure_fused(const rs2::frame& f, fused_image& image)
+    {
+        if (image.type != RS2_EXTENSION_DEPTH_FRAME || !should_process_profile(image.profile))
+            return false;
+
+        update_target_profile(image.profile);
+        _fused_units = f.as<rs2::depth_frame>().get_units();
+        _fused_width = image.width;
+        image.profile = _target_stream_profile;
+        return true;
+    }
+
+    void threshold::process_fused(const void* in, void* out, size_t begin, size_t end)
+    {
+        threshold_pixels(static_cast<const uint16_t*>(in) + begin * _fused_width,
+                         static_cast<uint16_t*>(out) + begin * _fused_width,
+                         (end - begin) * _fused_width, _fused_units);
+    }
 }
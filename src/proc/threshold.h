@@ -4,6 +4,7 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "fused-filter.h"
 
 namespace rs2
 {
@@ -12,19 +13,37 @@ namespace rs2
 
 namespace librealsense 
 {
-    class threshold : public stream_filter_processing_block
+    // Keeps pixels [begin, end) of a Z16 image whose distance, units * z, lies within [min, max] meters, and zeroes
+    // the rest. The output may be the input.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void threshold_depth_pixels(const uint16_t* in, uint16_t* out, float units, float min, float max,
+        size_t begin, size_t end);
+
+    class threshold : public stream_filter_processing_block, public fusable_filter
     {
     public:
         threshold();
 
+        bool configure_fused(const rs2::frame& f, fused_image& image) override;
+        bool is_row_local() const override { return true; }
+        void process_fused(const void* in, void* out, size_t begin, size_t end) override;
+        std::mutex& get_fused_mutex() override { return _mutex; }
+
     protected:
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
+        void update_target_profile(const rs2::stream_profile& profile);
+        // Keeps the pixels within [_min, _max] meters, and zeroes the rest
+        void threshold_pixels(const uint16_t* in, uint16_t* out, size_t n, float units) const;
+
         rs2::stream_profile _target_stream_profile;
         rs2::stream_profile _source_stream_profile;
 
         float _min, _max;
+        float _fused_units;
+        size_t _fused_width;
+        bool _in_place;
     };
     MAP_EXTENSION(RS2_EXTENSION_THRESHOLD_FILTER, librealsense::threshold);
 }
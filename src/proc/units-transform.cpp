@@ -9,13 +9,48 @@
 #include "proc/synthetic-stream.h"
 #include "environment.h"
 #include "units-transform.h"
+#include "simd-dispatch.h"
+#include "sse/sse-depth-transforms.h"
+#include "sse/avx-depth-transforms.h"
+#include "neon/neon-depth-transforms.h"
 
 namespace librealsense
 {
+    void depth_to_meters_pixels(const uint16_t* in, float* out, float units, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            out[i] = units * in[i];
+    }
+
+    // The widest SIMD kernel enabled, or none
+    struct units_kernel
+    {
+        void (*pixels)(const uint16_t* in, float* out, float units, size_t begin, size_t end);
+        size_t step; // pixels converted at a time
+    };
+
+    static units_kernel select_units_kernel()
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        if (simd_enabled(simd_level::avx2))
+            return { depth_to_meters_pixels_avx2, 16 };
+#endif
+        if (simd_enabled(simd_level::ssse3))
+            return { depth_to_meters_pixels_sse, 8 };
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        if (simd_enabled(simd_level::neon))
+            return { depth_to_meters_pixels_neon, 8 };
+#endif
+        return { nullptr, 0 };
+    }
+
     units_transform::units_transform() : stream_filter_processing_block("Units Transform")
     {
         _stream_filter.format = RS2_FORMAT_DISTANCE;
         _stream_filter.stream = RS2_STREAM_DEPTH;
+
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
     }
 
     void units_transform::update_configuration(const rs2::frame& f)
@@ -71,12 +106,14 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, _width * _height * sizeof(float));
-            for (int i = 0; i < _width * _height; i++)
-            {
-                float dist = *_depth_units * depth_data[i];
-                new_data[i] = dist;
-            }
+            static const units_kernel simd = select_units_kernel();
+
+            // Every pixel is written
+            size_t const n = _width * _height;
+            size_t const simd_end = simd.step ? n / simd.step * simd.step : 0;
+            if (simd_end)
+                simd.pixels(depth_data, new_data, *_depth_units, 0, simd_end);
+            depth_to_meters_pixels(depth_data, new_data, *_depth_units, simd_end, n);
 
             return new_f;
         }
@@ -12,6 +12,10 @@ namespace rs2
 
 namespace librealsense 
 {
+    // Converts pixels [begin, end) of a Z16 image to meters, units * z.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void depth_to_meters_pixels(const uint16_t* in, float* out, float units, size_t begin, size_t end);
+
     class units_transform : public stream_filter_processing_block
     {
     public:
@@ -0,0 +1,272 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "worker-pool.h"
+
+#include <rsutils/shared-ptr-singleton.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <sstream>
+#include <string>
+
+#if defined( _WIN32 )
+#include <windows.h>
+#elif defined( __linux__ )
+#include <sched.h>
+#endif
+
+
+namespace librealsense {
+
+
+struct worker_pool::job
+{
+    range_fn const & fn;
+    size_t const n;
+    size_t const chunk;
+    int const max_threads;
+    int threads;  // guarded by the pool's mutex
+    std::atomic< size_t > next;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t done;
+    std::exception_ptr error;
+
+    job( range_fn const & fn_, size_t n_, size_t chunk_, int max_threads_ )
+        : fn( fn_ )
+        , n( n_ )
+        , chunk( chunk_ )
+        , max_threads( max_threads_ )
+        , threads( 1 )  // the caller's
+        , next( 0 )
+        , done( 0 )
+    {
+    }
+
+    // Whether another worker may work on it; called with the pool's mutex held
+    bool join()
+    {
+        if( next >= n || ( max_threads && threads >= max_threads ) )
+            return false;
+        ++threads;
+        return true;
+    }
+
+    // Process the next chunk; false if none are left to start
+    bool run_one()
+    {
+        auto const begin = next.fetch_add( chunk );
+        if( begin >= n )
+            return false;
+        auto const end = std::min( n, begin + chunk );
+
+        std::exception_ptr e;
+        try
+        {
+            fn( begin, end );
+        }
+        catch( ... )
+        {
+            e = std::current_exception();
+        }
+
+        std::lock_guard< std::mutex > lock( mutex );
+        if( e && ! error )
+            error = e;
+        done += end - begin;
+        if( done == n )
+            cv.notify_all();
+        return true;
+    }
+};
+
+
+worker_pool::worker_pool( int n_workers, std::vector< int > const & cpus )
+    : _stopping( false )
+{
+    for( int i = 0; i < n_workers; ++i )
+        _threads.emplace_back( [this, cpus]() { work( cpus ); } );
+}
+
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _cv.notify_all();
+    for( auto & thread : _threads )
+        thread.join();
+}
+
+
+// Parses a list of CPUs like "0-3,6"; empty if it isn't one
+static std::vector< int > parse_cpus( std::string const & list )
+{
+    std::vector< int > cpus;
+    std::istringstream ss( list );
+    std::string range;
+    while( std::getline( ss, range, ',' ) )
+    {
+        int first, last;
+        char dash, rest;
+        std::istringstream rs( range );
+        if( ! ( rs >> first ) || first < 0 )
+            return {};
+        last = first;
+        if( rs >> dash && ( dash != '-' || ! ( rs >> last ) || last < first ) )
+            return {};
+        if( rs >> rest )
+            return {};
+        for( int cpu = first; cpu <= last; ++cpu )
+            cpus.push_back( cpu );
+    }
+    return cpus;
+}
+
+
+struct pool_settings
+{
+    int n_threads;
+    std::vector< int > cpus;
+};
+
+
+static pool_settings read_settings()
+{
+    pool_settings settings;
+    if( auto content = getenv( "LRS_PROCESSING_AFFINITY" ) )
+    {
+        settings.cpus = parse_cpus( content );
+        if( settings.cpus.empty() )
+            LOG_WARNING( "Invalid LRS_PROCESSING_AFFINITY=" << content << "; expecting a list of CPUs like 0-3,6" );
+    }
+    settings.n_threads = settings.cpus.empty() ? int( std::thread::hardware_concurrency() ) : int( settings.cpus.size() );
+    if( auto content = getenv( "LRS_PROCESSING_THREADS" ) )
+    {
+        int n = atoi( content );
+        if( n > 0 )
+            settings.n_threads = n;
+        else
+            LOG_WARNING( "Invalid LRS_PROCESSING_THREADS=" << content << "; using " << settings.n_threads );
+    }
+    settings.n_threads = std::max( 1, settings.n_threads );
+    LOG_INFO( "Processing blocks share " << settings.n_threads << " threads" );
+    return settings;
+}
+
+
+static rsutils::shared_ptr_singleton< worker_pool > the_pool;
+
+
+std::shared_ptr< worker_pool > worker_pool::get()
+{
+    static const pool_settings settings = read_settings();
+    return the_pool.instance( settings.n_threads - 1, settings.cpus );
+}
+
+
+static void set_affinity( std::vector< int > const & cpus )
+{
+#if defined( _WIN32 )
+    DWORD_PTR mask = 0;
+    for( int cpu : cpus )
+        if( cpu < int( sizeof( mask ) * 8 ) )
+            mask |= DWORD_PTR( 1 ) << cpu;
+    if( ! mask || ! SetThreadAffinityMask( GetCurrentThread(), mask ) )
+        LOG_WARNING( "Failed to set the CPU affinity of a processing thread" );
+#elif defined( __linux__ )
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    for( int cpu : cpus )
+        if( cpu < CPU_SETSIZE )
+            CPU_SET( cpu, &set );
+    if( sched_setaffinity( 0, sizeof( set ), &set ) )
+        LOG_WARNING( "Failed to set the CPU affinity of a processing thread" );
+#else
+    LOG_WARNING( "Setting the CPU affinity of processing threads is not supported on this platform" );
+#endif
+}
+
+
+std::shared_ptr< worker_pool::job > worker_pool::next_job()
+{
+    for( auto & j : _jobs )
+        if( j->join() )
+            return j;
+    return nullptr;
+}
+
+
+void worker_pool::work( std::vector< int > const & cpus )
+{
+    if( ! cpus.empty() )
+        set_affinity( cpus );
+
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( true )
+    {
+        std::shared_ptr< job > j;
+        _cv.wait( lock, [&]() { return _stopping || ( j = next_job() ); } );
+        if( _stopping )
+            return;
+
+        lock.unlock();
+        while( j->run_one() )
+        {
+        }
+        lock.lock();
+
+        // Nothing left to start in this job: the others get our attention
+        auto it = std::find( _jobs.begin(), _jobs.end(), j );
+        if( it != _jobs.end() )
+            _jobs.erase( it );
+    }
+}
+
+
+void worker_pool::parallel_for( size_t n, size_t chunk, range_fn const & fn, int max_threads )
+{
+    if( ! chunk )
+        chunk = 1;
+    if( _threads.empty() || n <= chunk || max_threads == 1 )
+    {
+        for( size_t begin = 0; begin < n; begin += chunk )
+            fn( begin, std::min( n, begin + chunk ) );
+        return;
+    }
+
+    auto j = std::make_shared< job >( fn, n, chunk, std::max( 0, max_threads ) );
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _jobs.push_back( j );
+    }
+    _cv.notify_all();
+
+    while( j->run_one() )
+    {
+    }
+
+    // Workers may still be running our last chunks, but none will start a new one
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto it = std::find( _jobs.begin(), _jobs.end(), j );
+        if( it != _jobs.end() )
+            _jobs.erase( it );
+    }
+    {
+        std::unique_lock< std::mutex > lock( j->mutex );
+        j->cv.wait( lock, [&]() { return j->done == n; } );
+    }
+    if( j->error )
+        std::rethrow_exception( j->error );
+}
+
+
+}  // namespace librealsense
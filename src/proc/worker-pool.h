@@ -0,0 +1,64 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// Persistent threads for splitting the work of a processing block over several cores.
+// A parallel_for() is split into chunks that are taken, in order, by whichever workers are free and by the calling
+// thread itself. The caller therefore always makes progress, even when all workers are busy with other blocks' work
+// or when parallel_for() is called from within a worker.
+//
+// The pool shared by all processing blocks has a thread per core, the caller's included. The LRS_PROCESSING_THREADS
+// environment variable sets another number, and LRS_PROCESSING_AFFINITY the CPUs its workers may run on, as a list
+// like "0-3,6"; the number of threads then defaults to the number of CPUs listed.
+//
+class worker_pool
+{
+public:
+    using range_fn = std::function< void( size_t begin, size_t end ) >;
+
+    // Workers are restricted to the given CPUs, if any
+    explicit worker_pool( int n_workers, std::vector< int > const & cpus = {} );
+    ~worker_pool();
+
+    worker_pool( worker_pool const & ) = delete;
+    worker_pool & operator=( worker_pool const & ) = delete;
+
+    // The pool shared by all processing blocks
+    static std::shared_ptr< worker_pool > get();
+
+    // Number of threads that can work on a parallel_for() at once, including the caller
+    int get_concurrency() const { return int( _threads.size() ) + 1; }
+
+    // Calls fn( begin, end ) for consecutive ranges of [0, n), at most 'chunk' long, and returns once all have been
+    // processed. At most max_threads threads, the caller's included, work on them at once; 0 lets all of them. The
+    // first exception thrown by fn is rethrown here.
+    void parallel_for( size_t n, size_t chunk, range_fn const & fn, int max_threads = 0 );
+
+private:
+    struct job;
+
+    void work( std::vector< int > const & cpus );
+    std::shared_ptr< job > next_job();
+
+    std::vector< std::thread > _threads;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque< std::shared_ptr< job > > _jobs;
+    bool _stopping;
+};
+
+
+}  // namespace librealsense
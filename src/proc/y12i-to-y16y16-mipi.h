@@ -9,6 +9,11 @@
 
 namespace librealsense
 {
+    // Splits pixels [begin, end) of a MIPI Y12I image, where each pixel is padded to 4 bytes, into the left and right
+    // Y16 images, scaling the values up to 16 bits.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void split_y12i_mipi_pixels(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+
     class y12i_to_y16y16_mipi : public interleaved_functional_processing_block
     {
     public:
@@ -7,11 +7,54 @@
 #include "cuda/cuda-conversion.cuh"
 #include "rsutils/accelerators/gpu.h"
 #endif
+#include "proc/sse/sse-interleaved-ir.h"
+#include "proc/sse/avx-interleaved-ir.h"
+#include "proc/simd-dispatch.h"
+#include "proc/neon/neon-interleaved-ir.h"
 
 namespace librealsense
 {
     struct y12i_pixel { uint8_t rl : 8, rh : 4, ll : 4, lh : 8; int l() const { return lh << 4 | ll; } int r() const { return rh << 8 | rl; } };
 
+    void split_y12i_pixels(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end)
+    {
+        uint8_t * const dest[] = { reinterpret_cast<uint8_t *>(left + begin), reinterpret_cast<uint8_t *>(right + begin) };
+        split_frame(dest, int(end - begin), reinterpret_cast<const y12i_pixel*>(source) + begin,
+            [](const y12i_pixel & p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
+            [](const y12i_pixel & p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+    }
+
+    // Splits as many pixels as the SIMD kernels handle, returning the end of that range
+    static size_t simd_split_y12i_pixels(const uint8_t * source, uint16_t * left, uint16_t * right, size_t count)
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t end = count / 16 * 16;
+            split_y12i_pixels_avx2(source, left, right, 0, end);
+            return end;
+        }
+#endif
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return 0;
+        size_t end = count / 8 * 8;
+        split_y12i_pixels_sse(source, left, right, 0, end);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return 0;
+        size_t end = count / 16 * 16;
+        split_y12i_pixels_neon(source, left, right, 0, end);
+        return end;
+#else
+        return 0;
+#endif
+    }
+
     void unpack_y16_y16_from_y12i_10( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
         auto count = width * height;
@@ -22,9 +65,12 @@ namespace librealsense
             return;
         }
 #endif
-        split_frame(dest, count, reinterpret_cast<const y12i_pixel*>(source),
-            [](const y12i_pixel & p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
-            [](const y12i_pixel & p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+        if (!dest)
+            return;
+        auto left = reinterpret_cast<uint16_t *>(dest[0]);
+        auto right = reinterpret_cast<uint16_t *>(dest[1]);
+        size_t i = simd_split_y12i_pixels(source, left, right, count);
+        split_y12i_pixels(source, left, right, i, count);
     }
 
     y12i_to_y16y16::y12i_to_y16y16(int left_idx, int right_idx)
@@ -33,7 +79,9 @@ namespace librealsense
     y12i_to_y16y16::y12i_to_y16y16(const char * name, int left_idx, int right_idx)
         : interleaved_functional_processing_block(name, RS2_FORMAT_Y12I, RS2_FORMAT_Y16, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 1,
                                                                          RS2_FORMAT_Y16, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 2)
-    {}
+    {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
+    }
 
     void y12i_to_y16y16::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
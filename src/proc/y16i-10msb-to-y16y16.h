@@ -9,6 +9,11 @@
 
 namespace librealsense
 {
+    // Splits pixels [begin, end) of a Y16I image of 10-bit values into the left and right Y16 images, scaling the
+    // values up to 16 bits.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void split_y16i_10msb_pixels(const uint8_t * source, uint16_t * left, uint16_t * right, size_t begin, size_t end);
+
     class y16i_10msb_to_y16y16 : public interleaved_functional_processing_block
     {
     public:
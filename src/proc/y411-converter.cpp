@@ -298,10 +298,14 @@ namespace librealsense
     void unpack_y411( uint8_t * const dest[], const uint8_t * const s, int w, int h, int actual_size )
     {
 #if defined __SSSE3__ && ! defined ANDROID
-        unpack_y411_sse(dest[0], s, w, h, actual_size);
-#else
-        unpack_y411_native(dest[0], s, w, h, actual_size);
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (do_sse)
+        {
+            unpack_y411_sse(dest[0], s, w, h, actual_size);
+            return;
+        }
 #endif
+        unpack_y411_native(dest[0], s, w, h, actual_size);
     }
 
     void y411_converter::process_function( uint8_t * const dest[],
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "simd-dispatch.h"
 
 namespace librealsense
 {
@@ -11,7 +12,10 @@ namespace librealsense
     {
     public:
         y411_converter(rs2_format target_format)
-            : functional_processing_block("Y411 Transform", target_format) {};
+            : functional_processing_block("Y411 Transform", target_format)
+        {
+            register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::ssse3 })));
+        }
 
     protected:
         void process_function( uint8_t * const dest[],
@@ -11,9 +11,54 @@
 #include "rsutils/accelerators/gpu.h"
 #endif
 
+#include "proc/sse/sse-interleaved-ir.h"
+#include "proc/sse/avx-interleaved-ir.h"
+#include "proc/simd-dispatch.h"
+#include "proc/neon/neon-interleaved-ir.h"
+
 namespace librealsense
 {
     struct y8i_pixel_mipi { uint8_t l, r; };
+
+    void split_y8i_mipi_pixels(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end)
+    {
+        uint8_t * const dest[] = { left + begin, right + begin };
+        split_frame_mipi(dest, int(end - begin), reinterpret_cast<const y8i_pixel_mipi*>(source) + begin,
+            [](const y8i_pixel_mipi & p) -> uint8_t { return p.l; },
+            [](const y8i_pixel_mipi & p) -> uint8_t { return p.r; });
+    }
+
+    // Splits as many pixels as the SIMD kernels handle, returning the end of that range
+    static size_t simd_split_y8i_mipi_pixels(const uint8_t * source, uint8_t * left, uint8_t * right, size_t count)
+    {
+#if defined(__SSSE3__)
+#ifdef BUILD_WITH_AVX2
+        static const bool do_avx2 = simd_enabled(simd_level::avx2);
+        if (do_avx2)
+        {
+            size_t end = count / 32 * 32;
+            split_y8i_mipi_pixels_avx2(source, left, right, 0, end);
+            return end;
+        }
+#endif
+        static const bool do_sse = simd_enabled(simd_level::ssse3);
+        if (!do_sse)
+            return 0;
+        size_t end = count / 16 * 16;
+        split_y8i_mipi_pixels_sse(source, left, right, 0, end);
+        return end;
+#elif defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+        static const bool do_neon = simd_enabled(simd_level::neon);
+        if (!do_neon)
+            return 0;
+        size_t end = count / 16 * 16;
+        split_y8i_mipi_pixels_neon(source, left, right, 0, end);
+        return end;
+#else
+        return 0;
+#endif
+    }
+
     void unpack_y8_y8_from_y8i_mipi( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
         auto count = width * height;
@@ -24,9 +69,10 @@ namespace librealsense
             return;
         }
 #endif
-        split_frame_mipi(dest, count, reinterpret_cast<const y8i_pixel_mipi*>(source),
-            [](const y8i_pixel_mipi & p) -> uint8_t { return p.l; },
-            [](const y8i_pixel_mipi & p) -> uint8_t { return p.r; });
+        if (!dest)
+            return;
+        size_t i = simd_split_y8i_mipi_pixels(source, dest[0], dest[1], count);
+        split_y8i_mipi_pixels(source, dest[0], dest[1], i, count);
     }
 
     y8i_to_y8y8_mipi::y8i_to_y8y8_mipi(int left_idx, int right_idx) :
@@ -35,7 +81,9 @@ namespace librealsense
     y8i_to_y8y8_mipi::y8i_to_y8y8_mipi(const char * name, int left_idx, int right_idx)
         : interleaved_functional_processing_block(name, RS2_FORMAT_Y8I, RS2_FORMAT_Y8, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 1,
                                                                         RS2_FORMAT_Y8, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 2)
-    {}
+    {
+        register_info(RS2_CAMERA_INFO_SIMD_LEVEL, get_string(select_simd_level({ simd_level::avx2, simd_level::ssse3, simd_level::neon })));
+    }
 
     void y8i_to_y8y8_mipi::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
@@ -7,6 +7,11 @@
 
 namespace librealsense
 {
+    // Splits pixels [begin, end) of a MIPI Y8I image into the left and right Y8 images. The left pixels of each pair
+    // come swapped: the range must hold whole pairs.
+    // This is the reference implementation: SIMD versions must produce identical results.
+    void split_y8i_mipi_pixels(const uint8_t * source, uint8_t * left, uint8_t * right, size_t begin, size_t end);
+
     class LRS_EXTENSION_API y8i_to_y8y8_mipi : public interleaved_functional_processing_block
     {
     public:
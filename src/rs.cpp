@@ -38,6 +38,7 @@
 #include "proc/rates-printer.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
+#include "proc/fused-filter.h"
 #include "proc/decimation-embedded-filter.h"
 #include "proc/temporal-embedded-filter.h"
 #include "media/playback/playback_device.h"
@@ -229,7 +230,7 @@ struct rs2_frame_queue
     {
     }
 
-    single_consumer_frame_queue<librealsense::frame_holder> queue;
+    lock_free_frame_queue<librealsense::frame_holder> queue;
 };
 
 struct rs2_sensor_list
@@ -2164,6 +2165,15 @@ void rs2_playback_seek(const rs2_device* device, long long int time, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_playback_seek_to_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_index, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->seek_to_frame(*profile->profile, frame_index);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, profile, frame_index)
+
 unsigned long long int rs2_playback_get_position(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2284,6 +2294,16 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_ex2(const rs2_device* device, const char* file, int compression_enabled, int drop_frames_when_full, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file);
+
+    auto writer = create_writer_for_file(file, compression_enabled != 0, drop_frames_when_full != 0);
+    return new rs2_device({ std::make_shared<record_device>(device->device, writer) });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file, compression_enabled, drop_frames_when_full)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2308,6 +2328,20 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(stats);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    auto s = record_device->get_statistics();
+    stats->messages_written = s.messages_written;
+    stats->batches_written = s.batches_written;
+    stats->frames_dropped = s.frames_dropped;
+    stats->backpressure_waits = s.backpressure_waits;
+    stats->backpressure_time = std::chrono::duration< double, std::milli >( s.backpressure_time ).count();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stats)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -3054,6 +3088,23 @@ rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error) BEGIN_API
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_fused_filter_block(rs2_processing_block** filters, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(filters);
+    VALIDATE_RANGE(count, 1, std::numeric_limits<int>::max());
+
+    std::vector<std::shared_ptr<librealsense::processing_block_interface>> blocks;
+    for (int i = 0; i < count; i++)
+    {
+        VALIDATE_NOT_NULL(filters[i]);
+        blocks.push_back(filters[i]->block);
+    }
+    auto block = std::make_shared<librealsense::fused_filter>(blocks);
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, filters, count)
+
 float rs2_get_depth_scale(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -5021,3 +5072,18 @@ void rs2_get_frame_object_detection(const rs2_frame* frame, unsigned int index,
     detection->depth          = entry.distance;
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, index, output_arg(detection))
+
+void rs2_set_frame_allocator(rs2_frame_buffer_alloc_ptr alloc, rs2_frame_buffer_free_ptr free, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    if (alloc)
+        VALIDATE_NOT_NULL(free);
+    librealsense::set_frame_memory_allocator(alloc, free, user);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, alloc, free, user)
+
+void rs2_get_frame_buffer_pool_stats(rs2_frame_buffer_pool_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(stats);
+    *stats = librealsense::frame_buffer_pool::get_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, output_arg(stats))
@@ -428,6 +428,11 @@ void log_callback_end( uint32_t fps,
 
         auto& raw_fourcc_to_rs2_stream_map = _raw_sensor->get_fourcc_to_rs2_stream_map();
         raw_fourcc_to_rs2_stream_map = std::make_shared<std::map<uint32_t, rs2_stream>>(fourcc_to_rs2_stream_map);
+
+        // Zero-copy delivery is controlled by the raw sensor, which owns the backend buffers
+        if( _raw_sensor->supports_option( RS2_OPTION_MAX_ZERO_COPY_FRAMES ) )
+            sensor_base::register_option( RS2_OPTION_MAX_ZERO_COPY_FRAMES,
+                                          _raw_sensor->get_option_handler( RS2_OPTION_MAX_ZERO_COPY_FRAMES ) );
     }
 
     synthetic_sensor::~synthetic_sensor()
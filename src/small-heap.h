@@ -4,7 +4,9 @@
 #pragma once
 
 #include "librealsense-exception.h"
+#include "index-stack.h"
 
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
 
@@ -12,44 +14,65 @@
 namespace librealsense {
 
 
+// Fixed-capacity heap of T objects.
+// allocate() and deallocate() are lock-free: free slots are kept in an index_stack, and the number of allocated
+// items shares one atomic word with the stop flag so that, once stop_allocation() returns, no allocation can sneak in
+// behind a wait_until_empty(). The mutex is only taken by waiters and to wake them up.
+//
 template < class T, int C >
 class small_heap
 {
     T buffer[C];
-    bool is_free[C];
+    index_stack< C > free_slots;
+
+    // Number of allocations (including ones still looking for a free slot) + STOPPED flag
+    std::atomic< uint32_t > state;
+    static const uint32_t STOPPED = 0x80000000u;
+    static const uint32_t SIZE_MASK = ~STOPPED;
+
+    std::atomic< int > waiters;
     std::mutex mutex;
-    bool keep_allocating = true;
     std::condition_variable cv;
-    int size = 0;
+
+    void release_one()
+    {
+        if( ( state.fetch_sub( 1 ) & SIZE_MASK ) == 1 && waiters.load() > 0 )
+        {
+            // Take the lock so a waiter cannot miss this between checking the size and going to sleep
+            std::lock_guard< std::mutex > lock( mutex );
+            cv.notify_all();
+        }
+    }
 
 public:
     static const int CAPACITY = C;
 
     small_heap()
+        : state( 0 )
+        , waiters( 0 )
     {
         for( auto i = 0; i < C; i++ )
-        {
-            is_free[i] = true;
             buffer[i] = std::move( T() );
-        }
+        free_slots.fill();
     }
 
     T * allocate()
     {
-        std::unique_lock< std::mutex > lock( mutex );
-        if( ! keep_allocating )
-            return nullptr;
+        auto s = state.load();
+        do
+        {
+            if( s & STOPPED )
+                return nullptr;
+        }
+        while( ! state.compare_exchange_weak( s, s + 1 ) );
 
-        for( auto i = 0; i < C; i++ )
+        auto i = free_slots.pop();
+        if( i == free_slots.NONE )
         {
-            if( is_free[i] )
-            {
-                is_free[i] = false;
-                size++;
-                return &buffer[i];
-            }
+            release_one();
+            return nullptr;
         }
-        return nullptr;
+        return &buffer[i];
     }
 
     void deallocate( T * item )
@@ -62,44 +85,36 @@ public:
         auto old_value = std::move( buffer[i] );
         buffer[i] = std::move( T() );
 
-        {
-            std::unique_lock< std::mutex > lock( mutex );
-
-            is_free[i] = true;
-            size--;
-
-            if( size == 0 )
-            {
-                lock.unlock();
-                cv.notify_one();
-            }
-        }
+        free_slots.push( uint32_t( i ) );
+        release_one();
     }
 
     void stop_allocation()
     {
-        std::unique_lock< std::mutex > lock( mutex );
-        keep_allocating = false;
+        state.fetch_or( STOPPED );
     }
 
     void wait_until_empty()
     {
         std::unique_lock< std::mutex > lock( mutex );
+        ++waiters;
 
         const auto ready = [this]() {
             return is_empty();
         };
-        if( ! ready()
-            && ! cv.wait_for( lock,
-                              std::chrono::hours( 1000 ),
-                              ready ) )  // for some reason passing std::chrono::duration::max makes it return instantly
+        bool const emptied = ready()
+                          || cv.wait_for( lock,
+                                          std::chrono::hours( 1000 ),
+                                          ready );  // for some reason passing std::chrono::duration::max makes it return instantly
+        --waiters;
+        if( ! emptied )
         {
             throw invalid_value_exception( "Could not flush one of the user controlled objects!" );
         }
     }
 
-    bool is_empty() const { return size == 0; }
-    int get_size() const { return size; }
+    bool is_empty() const { return get_size() == 0; }
+    int get_size() const { return int( state.load() & SIZE_MASK ); }
 };
 
 
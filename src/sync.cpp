@@ -159,6 +159,34 @@ namespace librealsense
     {
     }
 
+    composite_matcher::matcher_queue & composite_matcher::get_queue( matcher * m )
+    {
+        auto it = std::lower_bound( _frames_queue.begin(),
+                                    _frames_queue.end(),
+                                    m,
+                                    []( matcher_slot const & slot, matcher * m )
+                                    { return std::less< matcher * >()( slot.m, m ); } );
+        if( it == _frames_queue.end() || it->m != m )
+            it = _frames_queue.insert( it, matcher_slot{ m, std::unique_ptr< matcher_queue >( new matcher_queue ) } );
+        return *it->queue;
+    }
+
+    composite_matcher::matcher_queue * composite_matcher::find_queue( matcher * m )
+    {
+        for( auto & slot : _frames_queue )
+            if( slot.m == m )
+                return slot.queue.get();
+        return nullptr;
+    }
+
+    void composite_matcher::erase_queue( matcher * m )
+    {
+        _frames_queue.erase( std::remove_if( _frames_queue.begin(),
+                                             _frames_queue.end(),
+                                             [m]( matcher_slot const & slot ) { return slot.m == m; } ),
+                             _frames_queue.end() );
+    }
+
 
     void composite_matcher::dispatch(frame_holder f, const syncronization_environment& env)
     {
@@ -195,7 +223,8 @@ namespace librealsense
                 if( ! matcher->get_active() )
                 {
                     matcher->set_active( true );
-                    _frames_queue[matcher.get()].q.start();
+                    std::lock_guard< std::mutex > lock( _mutex );  // stop() and sync() walk the queues
+                    get_queue( matcher.get() ).q.start();
                 }
                 return matcher;
             }
@@ -232,7 +261,8 @@ namespace librealsense
                 {
                     if (_matchers[stream])
                     {
-                        _frames_queue.erase(_matchers[stream].get());
+                        std::lock_guard< std::mutex > lock( _mutex );
+                        erase_queue(_matchers[stream].get());
                     }
                     _matchers[stream] = matcher;
                     _streams_id.push_back(stream);
@@ -288,8 +318,8 @@ namespace librealsense
         set_active( false );
 
         // Stop all our queues to wake up anyone waiting on them
-        for( auto & fq : _frames_queue )
-            fq.second.q.stop();
+        for( auto & slot : _frames_queue )
+            slot.queue->q.stop();
 
         // Trickle the stop down to any children
         for( auto m : _matchers )
@@ -312,10 +342,10 @@ namespace librealsense
         os << '[';
         for( auto m : matchers )
         {
-            auto const & q = _frames_queue[m].q;
-            q.peek( [&os]( frame_holder const & fh ) {
-                os << fh;
-                } );
+            if( auto queue = find_queue( m ) )
+                queue->q.peek( [&os]( frame_holder const & fh ) {
+                    os << fh;
+                    } );
         }
         os << ']';
         return os.str();
@@ -336,7 +366,12 @@ namespace librealsense
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].q.enqueue( std::move( f ) ) )
+        matcher_queue * queue;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            queue = &get_queue( matcher.get() );
+        }
+        if( ! queue->q.enqueue( std::move( f ) ) )
             // If we get stopped, nothing to do!
             return;
 
@@ -345,38 +380,32 @@ namespace librealsense
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
-
         while( true )
         {
-            missing_streams.clear();
-            frames_arrived_matchers.clear();
-            frames_arrived.clear();
-
             std::vector< frame_holder > match;
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
 
+                _missing.clear();
+                _arrived_queues.clear();
+                _arrived.clear();
+
                 // We want to release one frame from each matcher. If a matcher has nothing queued, it is "missing" and
                 // we need to consider waiting for it:
-                for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
+                for( auto & slot : _frames_queue )
                 {
-                    librealsense::matcher * const m = s->first;
-                    if( ! s->second.q.peek( [&]( frame_holder & fh ) {
+                    matcher_queue * const q = slot.queue.get();
+                    if( ! q->q.peek( [&]( frame_holder & fh ) {
                             LOG_IF_ENABLE( "... have " << *fh.frame, env );
-                            frames_arrived.push_back( &fh );
-                            frames_arrived_matchers.push_back( m );
+                            _arrived.push_back( &fh );
+                            _arrived_queues.push_back( q );
                         } ) )
                     {
-                        missing_streams.push_back( m );
+                        _missing.push_back( slot.m );
                     }
                 }
-                if( frames_arrived.empty() )
+                if( _arrived.empty() )
                 {
                     // LOG_IF_ENABLE( "... nothing more to do", env );
                     break;
@@ -386,37 +415,37 @@ namespace librealsense
                 // number, etc.) -- anything else we'll leave to the next iteration. The synced frames should be the
                 // earliest possible!
 
-                frame_holder * curr_sync = frames_arrived[0];
-                synced_frames.clear();
-                synced_frames.push_back( 0 );
+                frame_holder * curr_sync = _arrived[0];
+                _synced.clear();
+                _synced.push_back( 0 );
 
                 // Sometimes we have to release newly-arrived frames even before frames we already had previously
                 // queued. If we have something like this, 'have_unsynced_frames' will be true:
-                unsynced_frames.clear();
-                for( auto i = 1; i < frames_arrived.size(); i++ )
+                _unsynced.clear();
+                for( auto i = 1; i < _arrived.size(); i++ )
                 {
-                    if( are_equivalent( *curr_sync, *frames_arrived[i] ) )
+                    if( are_equivalent( *curr_sync, *_arrived[i] ) )
                     {
-                        synced_frames.push_back( i );
+                        _synced.push_back( i );
                     }
-                    else if( is_smaller_than( *frames_arrived[i], *curr_sync ) )
+                    else if( is_smaller_than( *_arrived[i], *curr_sync ) )
                     {
-                        unsynced_frames.insert( unsynced_frames.end(), synced_frames.begin(), synced_frames.end() );
-                        synced_frames.clear();
-                        synced_frames.push_back( i );
-                        curr_sync = frames_arrived[i];
+                        _unsynced.insert( _unsynced.end(), _synced.begin(), _synced.end() );
+                        _synced.clear();
+                        _synced.push_back( i );
+                        curr_sync = _arrived[i];
                     }
                     else
                     {
-                        unsynced_frames.push_back( i );
+                        _unsynced.push_back( i );
                     }
                 }
-                bool release_synced_frames = ( synced_frames.size() != 0 );
-                if( unsynced_frames.empty() )
+                bool release_synced_frames = ( _synced.size() != 0 );
+                if( _unsynced.empty() )
                 {
                     // Everything (could be only one!) matches together... but if we also have
                     // something missing, we can't release anything yet...
-                    for( auto i : missing_streams )
+                    for( auto i : _missing )
                     {
                         LOG_IF_ENABLE( "... missing " << i->get_name() << ", next expected @"
                                                       << rsutils::string::from( _next_expected[i].value ) << " (from "
@@ -434,36 +463,36 @@ namespace librealsense
                 }
                 else
                 {
-                    for( auto i : unsynced_frames )
+                    for( auto i : _unsynced )
                     {
-                        LOG_IF_ENABLE( "  - " << *frames_arrived[i]->frame << " is not in sync; won't be released", env );
+                        LOG_IF_ENABLE( "  - " << *_arrived[i]->frame << " is not in sync; won't be released", env );
                     }
                 }
                 if( ! release_synced_frames )
                     break;
 
-                match.reserve( synced_frames.size() );
-
-                for( auto index : synced_frames )
+                // The frameset should always be with the same order of streams (the first stream carries extra
+                // meaning because it decides the frameset properties) -- so we release them sorted, looking up
+                // each stream once
+                _release_order.clear();
+                for( auto index : _synced )
+                    _release_order.emplace_back( _arrived[index]->frame->get_stream()->get_unique_id(),
+                                                 _arrived_queues[index] );
+                std::sort( _release_order.begin(),
+                           _release_order.end(),
+                           []( std::pair< int, matcher_queue * > const & a, std::pair< int, matcher_queue * > const & b )
+                           { return a.first > b.first; } );
+
+                match.reserve( _release_order.size() );
+                for( auto & released : _release_order )
                 {
                     frame_holder frame;
                     int const timeout_ms = 5000;
-                    librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].q.dequeue( &frame, timeout_ms );
+                    released.second->q.dequeue( &frame, timeout_ms );
                     match.push_back( std::move( frame ) );
                 }
             }
 
-            // The frameset should always be with the same order of streams (the first stream carries extra
-            // meaning because it decides the frameset properties) -- so we sort them...
-            std::sort( match.begin(),
-                       match.end(),
-                       []( const frame_holder & f1, const frame_holder & f2 ) {
-                           return f1.frame->get_stream()->get_unique_id()
-                                > f2.frame->get_stream()->get_unique_id();
-                       } );
-
-
             frame_holder composite = env.source->allocate_composite_frame(std::move(match));
             if (composite.frame)
             {
@@ -513,9 +542,10 @@ namespace librealsense
             }
         }
 
+        std::lock_guard< std::mutex > lock( _mutex );
         for(auto id: inactive_matchers)
         {
-            _frames_queue[_matchers[id].get()].q.clear();
+            get_queue( _matchers[id].get() ).q.clear();
         }
     }
 
@@ -717,12 +747,9 @@ namespace librealsense
                                << rsutils::string::from( next_expected.value + threshold ) << "; deactivating matcher!",
                            env );
 
-            auto const q_it = _frames_queue.find( missing );
-            if( q_it != _frames_queue.end() )
-            {
-                if( q_it->second.q.empty() )
-                    _frames_queue.erase( q_it );
-            }
+            auto const queue = find_queue( missing );
+            if( queue && queue->q.empty() )
+                erase_queue( missing );
             missing->set_active( false );
             return true;
         }
@@ -22,7 +22,7 @@ namespace librealsense {
     struct syncronization_environment
     {
         syncronization_environment( synthetic_source_interface * source,
-                                    single_consumer_frame_queue< frame_holder >& matches,
+                                    lock_free_frame_queue< frame_holder >& matches,
                                     bool log )
             : source( source )
             , matches( matches )
@@ -30,7 +30,7 @@ namespace librealsense {
         {
         }
         synthetic_source_interface * source;
-        single_consumer_frame_queue< frame_holder > & matches;
+        lock_free_frame_queue< frame_holder > & matches;
         bool log = true;
     };
 
@@ -115,12 +115,29 @@ namespace librealsense {
 
         struct matcher_queue
         {
-            single_consumer_frame_queue< frame_holder > q;
+            lock_free_frame_queue< frame_holder > q;
 
             matcher_queue();
         };
 
-        std::map< matcher *, matcher_queue > _frames_queue;
+        // A queue per matcher, in a dense array ordered by matcher as a std::map would be: the order decides which frame
+        // a sync pass starts from. Queues cannot move, so each slot owns its own.
+        struct matcher_slot
+        {
+            matcher * m;
+            std::unique_ptr< matcher_queue > queue;
+        };
+        std::vector< matcher_slot > _frames_queue;  // only touched under _mutex
+        matcher_queue & get_queue( matcher * m );  // added if it's not there yet
+        matcher_queue * find_queue( matcher * m );
+        void erase_queue( matcher * m );
+
+        // Scratch space of sync(), only used under _mutex: kept between passes so that they don't allocate
+        std::vector< frame_holder * > _arrived;
+        std::vector< matcher_queue * > _arrived_queues;
+        std::vector< int > _synced, _unsynced;
+        std::vector< matcher * > _missing;
+        std::vector< std::pair< int, matcher_queue * > > _release_order;  // by stream unique ID
         std::map<stream_id, std::shared_ptr<matcher>> _matchers;
         struct next_expected_t
         {
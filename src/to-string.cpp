@@ -574,6 +574,12 @@ std::string const & get_string_( rs2_option value )
         CASE( SAFETY_MCU_TEMPERATURE )
         CASE( LEFT_IR_TEMPERATURE )
         CASE( EMBEDDED_FILTER_ENABLED )
+        CASE( MAX_ZERO_COPY_FRAMES )
+        CASE( COMPACT_POINTS )
+        CASE( HISTOGRAM_UPDATE_THRESHOLD )
+        CASE( MAX_THREADS )
+        CASE( FILTER_IN_PLACE )
+        CASE( MOTION_BATCH_WINDOW )
 #undef CASE
         return arr;
     }();
@@ -677,6 +683,7 @@ const char * get_string( rs2_format value )
     CASE( Y16I )
     CASE( M420 )
     CASE( NV12 )
+    CASE( MOTION_BATCH )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -726,6 +733,7 @@ const char * get_string( rs2_camera_info value )
     CASE( SMCU_FW_VERSION )
     CASE( IMU_TYPE )
     CASE( MIPI_DRIVER_VERSION )
+    CASE( SIMD_LEVEL )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -10,6 +10,7 @@
 #include "core/notification.h"
 #include "platform/uvc-option.h"
 #include "platform/stream-profile-impl.h"
+#include "option.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
 
@@ -35,11 +36,20 @@ uvc_sensor::uvc_sensor( std::string const & name,
     , _timestamp_reader( std::move( timestamp_reader ) )
     , _gyro_counter(0)
     , _accel_counter(0)
+    , _max_loaned_frames( std::make_shared< atomic_int_option >(
+          option_range{ 0, DEFAULT_V4L2_FRAME_BUFFERS - 1, 1, 0 },
+          "Max number of backend frame buffers that can be held by the user without copying. "
+          "Frames received when this number is reached are copied. 0 always copies" ) )
+    , _loaned_frames( std::make_shared< std::atomic< int > >( 0 ) )
 {
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
     register_metadata( RS2_FRAME_METADATA_RAW_FRAME_SIZE,
                        make_additional_data_parser( &frame_additional_data::raw_size ) );
+
+    // At least one buffer per stream must remain with the backend, or streaming would stall
+    if( _device->supports_frame_loans() )
+        register_option( RS2_OPTION_MAX_ZERO_COPY_FRAMES, _max_loaned_frames );
 }
 
 
@@ -196,17 +206,55 @@ void uvc_sensor::open( const stream_profiles & requests )
                     if( val_in_range( req_profile_base->get_format(), { RS2_FORMAT_MJPEG } ) )
                         expected_size = static_cast< int >( f.frame_size );
 
+                    // Loan the backend buffer to the frame instead of copying it, as long as the payload can be
+                    // used as-is and the user does not already hold the maximum number of loaned buffers
+                    bool loaned = false;
+                    int const max_loaned_frames = _max_loaned_frames->get();
+                    if( ! msp && f.frame_size == expected_size && max_loaned_frames > 0 )
+                    {
+                        if( _loaned_frames->fetch_add( 1 ) < max_loaned_frames )
+                            loaned = true;
+                        else
+                            --*_loaned_frames;
+                    }
+
                     auto extension = frame_source::stream_to_frame_types( req_profile_base->get_stream_type() );
                     frame_holder fh = _source.alloc_frame(
                         { req_profile_base->get_stream_type(), req_profile_base->get_stream_index(), extension },
-                        expected_size,
+                        loaned ? 0 : expected_size,
                         std::move( fr->additional_data ),
-                        true );
+                        ! loaned );
                     auto diff = time_service::get_time() - system_time;
                     if( diff > 10 )
                         LOG_DEBUG( "!! Frame allocation took " << diff << " msec" );
 
-                    if( fh.frame )
+                    if( fh.frame && loaned )
+                    {
+                        // The frame data is the backend buffer itself: it is handed back to the backend (and the
+                        // loan returned) only when the last reference to the frame is released, or when the frame is
+                        // kept and copies it
+                        auto loaned_frames = _loaned_frames;
+                        fh->attach_continuation( frame_continuation(
+                            [continuation, loaned_frames]()
+                            {
+                                continuation();
+                                --*loaned_frames;
+                            },
+                            f.pixels,
+                            expected_size,
+                            true ) );  // loaned: copied if the frame is kept
+                        continuation = nullptr;
+
+                        auto && video = dynamic_cast< video_frame * >( fh.frame );
+                        if( video )
+                        {
+                            video->assign( width, height, width * bpp / 8, bpp );
+                        }
+
+                        fh->set_timestamp_domain( timestamp_domain );
+                        fh->set_stream( req_profile_base );
+                    }
+                    else if( fh.frame )
                     {
                         // method should be limited to use of MIPI - not for USB
                         // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
@@ -247,7 +295,10 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                     // calling the continuation method, and releasing the backend frame buffer
                     // since the content of the OS frame buffer has been copied, it can released ASAP
-                    continuation();
+                    if( continuation )
+                        continuation();
+                    if( loaned && ! fh.frame )
+                        --*_loaned_frames;
 
                     if (!fh.frame)
                     {
@@ -10,6 +10,8 @@
 namespace librealsense {
 
 
+class atomic_int_option;
+
 class uvc_sensor : public raw_sensor_base
 {
     typedef raw_sensor_base super;
@@ -107,6 +109,11 @@ private:
     std::vector< platform::extension_unit > _xus;
     std::unique_ptr< power > _power;
     std::unique_ptr< frame_timestamp_reader > _timestamp_reader;
+
+    // Zero-copy delivery: up to _max_loaned_frames backend buffers may be wrapped by published frames at any time;
+    // the counter is shared with the frames themselves, as they may outlive the sensor
+    std::shared_ptr< atomic_int_option > _max_loaned_frames;
+    std::shared_ptr< std::atomic< int > > _loaned_frames;
 };
 
 
@@ -70,6 +70,8 @@ namespace librealsense
 
             bool is_platform_jetson() const override { return false;}
 
+            bool supports_frame_loans() const override { return false; }
+
         private:
             friend class source_reader_callback;
 
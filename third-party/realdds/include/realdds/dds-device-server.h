@@ -24,6 +24,7 @@ namespace realdds {
 // Forward declaration
 namespace topics {
 class flexible_msg;
+class metadata_msg;
 class device_info;
 namespace raw {
 class device_info;
@@ -75,6 +76,11 @@ public:
     void init( const std::vector< std::shared_ptr< dds_stream_server > > & streams,
                const dds_options & options, const extrinsics_map & extr );
 
+    // Offer metadata in binary form (see topics::metadata_msg), on top of the JSON, to clients that can take it. The
+    // device header advertises it, so this must be called before init().
+    void enable_binary_metadata();
+    bool binary_metadata_enabled() const { return _binary_metadata_enabled; }
+
     // After initialization, the device can be broadcast on the device-info topic
     void broadcast( topics::device_info const & );
 
@@ -90,8 +96,11 @@ public:
 
     void publish_notification( topics::flexible_msg && );
     void publish_metadata( rsutils::json && );
+    void publish_metadata( topics::metadata_msg const & );
 
+    // Each format has its own topic: publish only the ones that are read
     bool has_metadata_readers() const;
+    bool has_binary_metadata_readers() const;
 
     typedef std::function< void( const std::shared_ptr< realdds::dds_option > & option, rsutils::json & value ) > set_option_callback;
     typedef std::function< rsutils::json( const std::shared_ptr< realdds::dds_option > & option ) > query_option_callback;
@@ -126,6 +135,8 @@ private:
     std::shared_ptr< dds_notification_server > _notification_server;
     std::shared_ptr< dds_topic_reader > _control_reader;
     std::shared_ptr< dds_topic_writer > _metadata_writer;
+    std::shared_ptr< dds_topic_writer > _binary_metadata_writer;
+    bool _binary_metadata_enabled = false;
     std::shared_ptr< dds_device_broadcaster > _broadcaster;
     dispatcher _control_dispatcher;
 
@@ -18,6 +18,7 @@ namespace realdds {
 
 namespace topics {
 class device_info;
+class metadata_msg;
 }  // namespace topics
 
 
@@ -99,6 +100,13 @@ public:
     typedef std::function< void( std::shared_ptr< const rsutils::json > const & md ) > on_metadata_available_callback;
     rsutils::subscription on_metadata_available( on_metadata_available_callback && );
 
+    // When the server offers binary metadata, it is used instead of JSON and raised by on_binary_metadata_available
+    bool supports_binary_metadata() const;
+
+    typedef std::function< void( std::shared_ptr< const topics::metadata_msg > const & md ) >
+        on_binary_metadata_available_callback;
+    rsutils::subscription on_binary_metadata_available( on_binary_metadata_available_callback && );
+
     typedef std::function< void(
         dds_nsec timestamp, char type, std::string const & text, rsutils::json const & data ) >
         on_device_log_callback;
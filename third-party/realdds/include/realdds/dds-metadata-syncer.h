@@ -12,12 +12,15 @@
 
 
 namespace realdds {
+namespace topics {
+class metadata_msg;
+}  // namespace topics
 
 
 // Frame data and metadata are sent as two seperate streams which may need synchronizing and joining together.
 // 
-// This mechanism takes a generic "frame" (as a void*) and "metadata" (any json) and issues a callback whenever a match
-// occurs.
+// This mechanism takes a generic "frame" (as a void*) and "metadata" (any json, or the binary metadata message) and
+// issues a callback whenever a match occurs.
 // 
 // Note this means:
 //     - the callback is only called when a frame/metadata is fed to it (enqueued)
@@ -31,7 +34,8 @@ namespace realdds {
 //          - else no guarantee is made to callback ordering!
 //     - metadata is likely to arrive first because the messages are much smaller
 //
-class dds_metadata_syncer
+template< class Metadata >
+class basic_metadata_syncer
 {
 public:
     // We don't want the queue to get large, it means lots of drops and data that we store to (probably) throw later
@@ -53,8 +57,8 @@ public:
     typedef void ( *on_frame_release_callback )( frame_type * );
     typedef std::unique_ptr< frame_type, on_frame_release_callback > frame_holder;
 
-    // Metadata is intended to be JSON
-    typedef std::shared_ptr< const rsutils::json > metadata_type;
+    // Metadata is either JSON or binary; we only hold on to it
+    typedef std::shared_ptr< const Metadata > metadata_type;
 
     // So our main callback gets this generic frame and metadata:
     typedef std::function< void( frame_holder &&, metadata_type const & metadata ) > on_frame_ready_callback;
@@ -77,8 +81,8 @@ private:
     std::shared_ptr< bool > _is_alive; // Ensures object can be accessed
 
 public:
-    dds_metadata_syncer();
-    virtual ~dds_metadata_syncer();
+    basic_metadata_syncer();
+    virtual ~basic_metadata_syncer();
 
     void enqueue_frame( key_type, frame_holder && );
     void enqueue_metadata( key_type, metadata_type const & );
@@ -108,4 +112,11 @@ private:
 };
 
 
+extern template class basic_metadata_syncer< rsutils::json >;
+extern template class basic_metadata_syncer< topics::metadata_msg >;
+
+typedef basic_metadata_syncer< rsutils::json > dds_metadata_syncer;
+typedef basic_metadata_syncer< topics::metadata_msg > dds_binary_metadata_syncer;
+
+
 }  // namespace realdds
@@ -54,6 +54,9 @@ struct dds_video_encoding
 
     static dds_video_encoding from_rs2( int rs2_format );
     int to_rs2() const;
+
+    // The most bits a pixel can take (a JPEG is bounded by the raw YUYV it was compressed from)
+    int bits_per_pixel() const;
 };
 
 
@@ -52,7 +52,7 @@ public:
 
     bool is_open() const override { return !! _writer; }
     virtual void open( std::string const & topic_name, std::shared_ptr< dds_publisher > const & ) = 0;
-    void close();
+    virtual void close();
 
     bool is_streaming() const override { return _streaming; }
     virtual void stop_streaming();
@@ -64,6 +64,7 @@ public:
     typedef std::function< void( std::shared_ptr< dds_stream_server > const &, int n_readers ) >
         readers_changed_callback;
     void on_readers_changed( readers_changed_callback callback ) { _on_readers_changed = std::move( callback ); }
+    virtual int n_readers() const;
 
 protected:
     std::shared_ptr< dds_topic_writer > _writer;
@@ -72,6 +73,8 @@ protected:
 
     // Called at the end of open(), when the _writer has been initialized. Override to provide custom QOS etc...
     virtual void run_stream();
+    // Lets _on_readers_changed know whenever the writer's readers change
+    void watch_readers( dds_topic_writer & );
 
     void start_streaming();
 };
@@ -93,13 +96,33 @@ public:
     void stop_streaming() override;
     image_header const & get_image_header() const { return _image_header; }
 
+    // Offer flat images as well, for clients on the same host to read from shared memory without copies (see
+    // topics::flat_image_msg). Must be called before open(); the flat image size and depth are then known.
+    void enable_flat_images();
+    bool flat_images_enabled() const { return _flat_images_enabled; }
+    size_t flat_image_size() const { return _flat_image_size; }
+    // How many images are written before the memory of the oldest is reused
+    int flat_image_depth() const { return _flat_image_depth; }
+
     virtual void publish_image( topics::image_msg & );
+    // Publishes only to the formats that have readers: the data is copied into a flat image if there are flat
+    // readers, and into an image_msg if there are others
+    void publish_image_data( uint8_t const * data, size_t size, dds_time const & timestamp );
+
+    void close() override;
+    int n_readers() const override;
 
 private:
     void check_profile( std::shared_ptr< dds_stream_profile > const & ) const override;
+    void fill_image( topics::image_msg & );
+    void publish_flat_image( uint8_t const * data, size_t size, dds_time const & timestamp );
 
     std::set< video_intrinsics > _intrinsics;
     image_header _image_header;
+    bool _flat_images_enabled = false;
+    size_t _flat_image_size = 0;
+    int _flat_image_depth = 0;
+    std::shared_ptr< dds_topic_writer > _flat_writer;
 };
 
 
@@ -15,6 +15,7 @@
 namespace realdds {
 
 namespace topics {
+class flat_image_msg;
 class imu_msg;
 class string_msg;
 class flexible_msg;
@@ -71,12 +72,34 @@ public:
     typedef std::function< void( std::vector< uint8_t > &&, dds_time &&, dds_sample && ) > on_data_available_callback;
     void on_data_available( on_data_available_callback cb ) { _on_data_available = cb; }
 
+    // When the server offers flat images (see topics::flat_image_msg), open() reads those instead of the Image topic
+    // if device/flat-images/enabled is true. Images then arrive on loan, with no copies, if there's a callback for
+    // them; otherwise the data is copied out for on_data_available. Either way, images the server has already
+    // overwritten by the time they're read are dropped.
+    void enable_flat_images( size_t image_size, int depth )
+    {
+        _flat_image_size = image_size;
+        _flat_image_depth = depth;
+    }
+    size_t flat_image_size() const { return _flat_image_size; }  // 0 if not offered
+    // How many images the server writes before reusing the memory of the oldest: an image held for longer than it
+    // takes the server to write this many more can be overwritten
+    int flat_image_depth() const { return _flat_image_depth; }
+    bool is_reading_flat_images() const { return _reading_flat_images; }
+
+    typedef std::function< void( topics::flat_image_msg &&, dds_sample && ) > on_flat_image_available_callback;
+    void on_flat_image_available( on_flat_image_available_callback cb ) { _on_flat_image_available = cb; }
+
     void set_intrinsics( std::set< video_intrinsics > intrinsics ) { _intrinsics = std::move( intrinsics ); }
     const std::set< video_intrinsics > & get_intrinsics() const { return _intrinsics; }
 
 protected:
     void handle_data() override;
-    bool can_start_streaming() const override { return _on_data_available != nullptr; }
+    void handle_flat_images();
+    bool can_start_streaming() const override
+    {
+        return _on_data_available != nullptr || _reading_flat_images && _on_flat_image_available != nullptr;
+    }
 
     template< typename frame_type >
     void handle_image()
@@ -95,6 +118,10 @@ protected:
 
     std::set< video_intrinsics > _intrinsics;
     on_data_available_callback _on_data_available = nullptr;
+    size_t _flat_image_size = 0;
+    int _flat_image_depth = 0;
+    bool _reading_flat_images = false;
+    on_flat_image_available_callback _on_flat_image_available = nullptr;
 };
 
 class dds_depth_stream : public dds_video_stream
@@ -4,18 +4,21 @@
 
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include "dds-defines.h"
 
 #include <rsutils/json-fwd.h>
 #include <functional>
 #include <memory>
 #include <atomic>
+#include <mutex>
 
 
 namespace eprosima {
 namespace fastdds {
 namespace dds {
 class Subscriber;
+class LoanableCollection;
 }  // namespace dds
 }  // namespace fastdds
 }  // namespace eprosima
@@ -45,6 +48,12 @@ protected:
 
     std::atomic< int > _n_writers;
 
+    // The DataReader cannot be deleted while samples are loaned from it: when stopped with loans outstanding, the
+    // last loan returned deletes it
+    mutable std::mutex _loans_mutex;
+    int _n_loans = 0;
+    eprosima::fastdds::dds::DataReader * _stopped_reader = nullptr;
+
 public:
     dds_topic_reader( std::shared_ptr< dds_topic > const & topic );
     dds_topic_reader( std::shared_ptr< dds_topic > const & topic, std::shared_ptr< dds_subscriber > const & subscriber );
@@ -98,6 +107,12 @@ public:
     // Go back to a pre-run() state, such that is_running() returns false
     virtual void stop();
 
+    // Zero-copy reading (see topics::flat_image_msg): takes the next sample on loan, to be handed back with
+    // return_loan(). Returns false if no data is available.
+    bool take_loan( eprosima::fastdds::dds::LoanableCollection &, eprosima::fastdds::dds::SampleInfoSeq & );
+    void return_loan( eprosima::fastdds::dds::LoanableCollection &, eprosima::fastdds::dds::SampleInfoSeq & );
+    bool is_loan_current( void const * sample, dds_sample const & ) const;
+
     // DataReaderListener
 protected:
     void on_subscription_matched( eprosima::fastdds::dds::DataReader *,
@@ -23,8 +23,12 @@ constexpr char const * DEVICE_INFO_TOPIC_NAME = "realsense/device-info";
 constexpr char const * NOTIFICATION_TOPIC_NAME = "/notification";
 constexpr char const * CONTROL_TOPIC_NAME = "/control";
 constexpr char const * METADATA_TOPIC_NAME = "/metadata";
+constexpr char const * METADATA_BINARY_TOPIC_NAME = "/metadata-binary";
 constexpr char const * DFU_TOPIC_NAME = "/dfu";
 
+// Concatenated to a stream topic name, for its flat images (see flat_image_msg)
+constexpr char const * FLAT_IMAGE_TOPIC_SUFFIX = "/flat";
+
 
 namespace ros2 {
 
@@ -58,6 +62,7 @@ namespace notification {
         namespace key {
             extern std::string const n_streams;
             extern std::string const extrinsics;
+            extern std::string const binary_metadata;
         }
     }
     namespace device_options {
@@ -75,6 +80,8 @@ namespace notification {
             extern std::string const profiles;
             extern std::string const default_profile_index;
             extern std::string const metadata_enabled;
+            extern std::string const flat_image_size;
+            extern std::string const flat_image_depth;
         }
     }
     namespace stream_options {
@@ -0,0 +1,118 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <realdds/dds-defines.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <string>
+#include <memory>
+#include <functional>
+
+
+namespace realdds {
+
+
+class dds_participant;
+class dds_topic;
+class dds_topic_reader;
+class dds_topic_writer;
+
+
+namespace topics {
+
+
+// An image in a flat, fixed-size layout that Fast-DDS can place in shared memory as-is: a plain header followed by
+// the pixels. Unlike the ROS Image, which has to be serialized into (and out of) the DDS history, a flat image is
+// written directly into a sample loaned from the writer, and a reader on the same host is loaned that very memory:
+// no copies are made past the one that fills the loan.
+//
+// Because a plain type has a fixed size, the topic type is sized to the largest image the stream can send, and the
+// size is part of the type name so that readers and writers of different sizes never match.
+//
+// Readers are loaned memory the writer owns: once the writer has gone through its history depth in newer images, it
+// will reuse the memory of a loaned image. Use is_current() to check if what was read is still intact.
+//
+class flat_image_msg
+{
+public:
+    // 4-byte fields only: the sample follows the 4-byte encapsulation header in the payload
+    struct header
+    {
+        int32_t sec;
+        uint32_t nanosec;
+        uint32_t width;
+        uint32_t height;
+        uint32_t step;
+        uint32_t data_size;
+        char encoding[16];
+    };
+
+private:
+    // The loaned sample; its deleter returns (reader) or discards (writer) the loan
+    std::shared_ptr< header > _sample;
+    std::function< bool() > _is_current;
+
+    flat_image_msg( std::shared_ptr< header > sample )
+        : _sample( std::move( sample ) )
+    {
+    }
+
+public:
+    flat_image_msg() = default;
+
+    bool is_valid() const { return !! _sample; }
+    void invalidate() { _sample.reset(); _is_current = nullptr; }
+
+    // The loan is held for as long as there are copies of the shared_ptr, even if the message is destroyed
+    std::shared_ptr< void const > loan() const { return _sample; }
+
+    dds_time timestamp() const { return { _sample->sec, _sample->nanosec }; }
+    void set_timestamp( dds_time const & t ) { _sample->sec = t.seconds; _sample->nanosec = t.nanosec; }
+
+    uint32_t width() const { return _sample->width; }
+    void set_width( uint32_t w ) { _sample->width = w; }
+    uint32_t height() const { return _sample->height; }
+    void set_height( uint32_t h ) { _sample->height = h; }
+    uint32_t step() const { return _sample->step; }
+    void set_step( uint32_t step ) { _sample->step = step; }
+
+    std::string encoding() const;
+    void set_encoding( std::string const & );
+
+    uint8_t * data() { return reinterpret_cast< uint8_t * >( _sample.get() + 1 ); }
+    uint8_t const * data() const { return reinterpret_cast< uint8_t const * >( _sample.get() + 1 ); }
+    uint32_t data_size() const { return _sample->data_size; }
+    void set_data_size( uint32_t size ) { _sample->data_size = size; }
+
+    // For an image that was read: false once the writer has reused its memory for a newer image
+    bool is_current() const { return _is_current ? _is_current() : is_valid(); }
+
+    static std::string type_name( size_t max_data_size );
+
+    static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
+                                                      char const * topic_name,
+                                                      size_t max_data_size );
+
+    // Loans a sample from the writer, to be filled in and then written with write_to(); one that isn't written is
+    // discarded once it's released. The data size is up to the maximum the topic was created with.
+    // Will throw if the type is not plain or the writer has no samples left to loan.
+    //
+    static flat_image_msg loan_from( dds_topic_writer & );
+
+    // Writes the loaned sample, handing it back to the writer; the message is no longer valid afterwards
+    void write_to( dds_topic_writer & );
+
+    // This helper method will take the next sample from a reader, on loan: the loan is returned when the message (or
+    // the last copy of its loan()) is released. The reader is kept alive until then.
+    //
+    // Returns true if successful. Make sure you still check is_valid() in case the sample info isn't!
+    // Returns false if no more data is available.
+    // Will throw if an unexpected error occurs.
+    //
+    static bool take_next( dds_topic_reader &, flat_image_msg * output, dds_sample * optional_sample = nullptr );
+};
+
+
+}  // namespace topics
+}  // namespace realdds
@@ -0,0 +1,122 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <realdds/dds-defines.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+
+namespace realdds {
+
+
+class dds_participant;
+class dds_topic;
+class dds_topic_reader;
+class dds_topic_writer;
+
+
+namespace topics {
+
+
+class flexible_msg;
+
+
+// Per-frame metadata with a fixed binary layout, the alternative to the JSON metadata message for clients that can
+// take it: the header fields are stored as-is and the metadata as (integer key, value) pairs, so nothing needs to be
+// formatted or parsed as text on either side. The keys are opaque here; librealsense uses rs2_frame_metadata_value.
+//
+// It travels as CUSTOM data inside a flexible message, on its own topic (see METADATA_BINARY_TOPIC_NAME) so that a
+// server only pays for the format its clients actually read. Values are little-endian.
+//
+class metadata_msg
+{
+public:
+    // Bumped whenever the layout changes; readers reject other versions
+    static constexpr uint32_t VERSION = 1;
+
+    struct item
+    {
+        uint32_t key;
+        int64_t value;
+    };
+
+private:
+    enum flags : uint16_t
+    {
+        HAS_FRAME_NUMBER = 1,
+        HAS_TIMESTAMP_DOMAIN = 2,
+        HAS_DEPTH_UNITS = 4,
+    };
+
+    std::string _stream_name;
+    dds_nsec _timestamp = 0;
+    uint64_t _frame_number = 0;
+    int32_t _timestamp_domain = 0;
+    float _depth_units = 0.f;
+    uint16_t _flags = 0;
+    std::vector< item > _items;
+
+public:
+    metadata_msg() = default;
+    metadata_msg( std::string stream_name, dds_nsec timestamp )
+        : _stream_name( std::move( stream_name ) )
+        , _timestamp( timestamp )
+    {
+    }
+
+    bool is_valid() const { return ! _stream_name.empty(); }
+    void invalidate() { _stream_name.clear(); }
+
+    std::string const & stream_name() const { return _stream_name; }
+
+    // The syncer key: must match the image timestamp, bit-for-bit
+    dds_nsec timestamp() const { return _timestamp; }
+
+    bool has_frame_number() const { return _flags & HAS_FRAME_NUMBER; }
+    uint64_t frame_number() const { return _frame_number; }
+    void set_frame_number( uint64_t n ) { _frame_number = n; _flags |= HAS_FRAME_NUMBER; }
+
+    bool has_timestamp_domain() const { return _flags & HAS_TIMESTAMP_DOMAIN; }
+    int32_t timestamp_domain() const { return _timestamp_domain; }
+    void set_timestamp_domain( int32_t domain ) { _timestamp_domain = domain; _flags |= HAS_TIMESTAMP_DOMAIN; }
+
+    bool has_depth_units() const { return _flags & HAS_DEPTH_UNITS; }
+    float depth_units() const { return _depth_units; }
+    void set_depth_units( float units ) { _depth_units = units; _flags |= HAS_DEPTH_UNITS; }
+
+    std::vector< item > const & items() const { return _items; }
+    void reserve( size_t n ) { _items.reserve( n ); }
+    void add( uint32_t key, int64_t value ) { _items.push_back( { key, value } ); }
+
+    static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
+                                                      char const * topic_name );
+    static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
+                                                      std::string const & topic_name )
+    {
+        return create_topic( participant, topic_name.c_str() );
+    }
+
+    // Throws if the message is not binary metadata of our version
+    static metadata_msg from_flexible( flexible_msg const & );
+    flexible_msg to_flexible() const;
+
+    // This helper method will take the next sample from a reader.
+    //
+    // Returns true if successful. Make sure you still check is_valid() in case the sample info isn't!
+    // Returns false if no more data is available.
+    // Will throw if an unexpected error occurs.
+    //
+    static bool take_next( dds_topic_reader &,
+                           metadata_msg * output,
+                           dds_sample * optional_sample = nullptr );
+
+    // Returns some unique (to the writer) identifier for the sample that was sent, or 0 if unsuccessful
+    dds_sequence_number write_to( dds_topic_writer & ) const;
+};
+
+
+}  // namespace topics
+}  // namespace realdds
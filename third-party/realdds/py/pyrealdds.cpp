@@ -10,6 +10,7 @@
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/blob-msg.h>
 #include <realdds/topics/ros2/participant-entities-info-msg.h>
 #include <realdds/topics/blob/blobPubSubTypes.h>
@@ -925,6 +926,46 @@ PYBIND11_MODULE(NAME, m) {
         .def( "write_to", &imu_msg::write_to, py::call_guard< py::gil_scoped_release >() );
 
 
+    using metadata_msg = realdds::topics::metadata_msg;
+    py::class_< metadata_msg, std::shared_ptr< metadata_msg > >( message, "metadata" )
+        .def( py::init< std::string, dds_nsec >(), "stream_name"_a, "timestamp"_a )
+        .def_property_readonly( "stream_name", &metadata_msg::stream_name )
+        .def_property_readonly( "timestamp", &metadata_msg::timestamp )
+        .def_property(
+            "frame_number",
+            []( metadata_msg const & self )
+            { return self.has_frame_number() ? py::cast( self.frame_number() ) : py::object( py::none() ); },
+            &metadata_msg::set_frame_number )
+        .def_property(
+            "timestamp_domain",
+            []( metadata_msg const & self )
+            { return self.has_timestamp_domain() ? py::cast( self.timestamp_domain() ) : py::object( py::none() ); },
+            &metadata_msg::set_timestamp_domain )
+        .def_property(
+            "depth_units",
+            []( metadata_msg const & self )
+            { return self.has_depth_units() ? py::cast( self.depth_units() ) : py::object( py::none() ); },
+            &metadata_msg::set_depth_units )
+        .def( "add", &metadata_msg::add, "key"_a, "value"_a )
+        .def( "items",
+              []( metadata_msg const & self )
+              {
+                  std::vector< std::pair< uint32_t, int64_t > > items;
+                  for( auto const & i : self.items() )
+                      items.emplace_back( i.key, i.value );
+                  return items;
+              } )
+        .def( "__bool__", &metadata_msg::is_valid )
+        .def( "__repr__",
+              []( metadata_msg const & self )
+              {
+                  std::ostringstream os;
+                  os << "<" SNAME ".message.metadata '" << self.stream_name() << "' @" << self.timestamp() << " "
+                     << self.items().size() << " items>";
+                  return os.str();
+              } );
+
+
     using realdds::dds_device_broadcaster;
     py::class_< dds_device_broadcaster, std::shared_ptr< dds_device_broadcaster > >( m, "device_broadcaster" )
         .def( py::init<>( []( std::shared_ptr< dds_publisher > const & publisher, device_info const & device_info )
@@ -1090,6 +1131,10 @@ PYBIND11_MODULE(NAME, m) {
               []( dds_video_stream_server & self, dds_video_encoding encoding, int width, int height ) {
                   self.start_streaming( { encoding, height, width } );
               } )
+        .def( "enable_flat_images", &dds_video_stream_server::enable_flat_images )
+        .def( "flat_images_enabled", &dds_video_stream_server::flat_images_enabled )
+        .def( "flat_image_size", &dds_video_stream_server::flat_image_size )
+        .def( "flat_image_depth", &dds_video_stream_server::flat_image_depth )
         .def( "publish_image", &dds_video_stream_server::publish_image );
 
     using realdds::dds_depth_stream_server;
@@ -1164,7 +1209,13 @@ PYBIND11_MODULE(NAME, m) {
             "publish_notification",
             []( dds_device_server & self, json const & j ) { self.publish_notification( j ); },
             py::call_guard< py::gil_scoped_release >() )
-        .def( "publish_metadata", &dds_device_server::publish_metadata, py::call_guard< py::gil_scoped_release >() )
+        .def( "enable_binary_metadata", &dds_device_server::enable_binary_metadata )
+        .def( "publish_metadata",
+              static_cast< void ( dds_device_server::* )( metadata_msg const & ) >( &dds_device_server::publish_metadata ),
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "publish_metadata",
+              static_cast< void ( dds_device_server::* )( json && ) >( &dds_device_server::publish_metadata ),
+              py::call_guard< py::gil_scoped_release >() )
         .def( "broadcast", &dds_device_server::broadcast )
         .def( "broadcast_disconnect", &dds_device_server::broadcast_disconnect, py::arg( "ack-timeout" ) = dds_time() )
         .def( FN_FWD( dds_device_server, on_set_option,
@@ -1199,6 +1250,9 @@ PYBIND11_MODULE(NAME, m) {
     video_stream_client_base  //
         .def( "set_intrinsics", &dds_video_stream::set_intrinsics )
         .def( "get_intrinsics", &dds_video_stream::get_intrinsics )
+        .def( "flat_image_size", &dds_video_stream::flat_image_size )
+        .def( "flat_image_depth", &dds_video_stream::flat_image_depth )
+        .def( "is_reading_flat_images", &dds_video_stream::is_reading_flat_images )
         .def( FN_FWD( dds_video_stream,
                       on_data_available,
                       ( dds_video_stream *, std::vector< uint8_t > && image_buffer, dds_time && image_time, dds_sample && ),
@@ -1298,6 +1352,14 @@ PYBIND11_MODULE(NAME, m) {
                       [&self, callback]( std::shared_ptr< const json > const & pj )
                       { FN_FWD_CALL( dds_device, "on_metadata_available", callback( self, json_to_py( *pj ) ); ) } ) );
               } )
+        .def( "supports_binary_metadata", &dds_device::supports_binary_metadata )
+        .def( "on_binary_metadata_available",
+              []( dds_device & self, std::function< void( dds_device &, metadata_msg const & ) > callback )
+              {
+                  return std::make_shared< subscription >( self.on_binary_metadata_available(
+                      [&self, callback]( std::shared_ptr< const metadata_msg > const & md )
+                      { FN_FWD_CALL( dds_device, "on_binary_metadata_available", callback( self, *md ); ) } ) );
+              } )
         .def( "on_device_log",
               []( dds_device & self, std::function< void( dds_device &, dds_nsec, char, std::string const &, py::object && ) > callback )
               {
@@ -84,7 +84,7 @@ void dds_device::impl::set_state( state_t new_state )
             }
             else
             {
-                LOG_DEBUG( "[" << debug_name() << "] ... metadata is enabled" );
+                LOG_DEBUG( "[" << debug_name() << "] ... metadata is enabled" << ( _metadata_binary ? " (binary)" : "" ) );
                 dds_topic_reader::qos rqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );
                 rqos.history().depth = 10; // Support receive metadata from multiple streams
                 rqos.override_from_json( md_settings );
@@ -152,6 +152,8 @@ void dds_device::impl::reset()
     if( _metadata_reader )
         _metadata_reader->stop();
     _metadata_reader.reset();
+    _binary_metadata_version = 0;
+    _metadata_binary = false;
 }
 
 
@@ -733,6 +735,39 @@ void dds_device::impl::create_metadata_reader()
     if( _metadata_reader ) // We can be called multiple times, once per stream
         return;
 
+    // Binary metadata, when the server offers it, saves both sides the JSON; device/metadata/binary=false turns it off
+    _metadata_binary = _binary_metadata_version == topics::metadata_msg::VERSION
+                    && _device_settings.nested( "metadata", "binary" ).default_value( true );
+    if( _metadata_binary )
+    {
+        auto topic = topics::metadata_msg::create_topic( _participant,
+                                                         _info.topic_root() + topics::METADATA_BINARY_TOPIC_NAME );
+        _metadata_reader = std::make_shared< dds_topic_reader_thread >( topic, _subscriber );
+        _metadata_reader->on_data_available(
+            [this]()
+            {
+                topics::flexible_msg message;
+                while( topics::flexible_msg::take_next( *_metadata_reader, &message ) )
+                {
+                    if( message.is_valid() && _on_binary_metadata_available.size() )
+                    {
+                        try
+                        {
+                            auto sptr = std::make_shared< const topics::metadata_msg >(
+                                topics::metadata_msg::from_flexible( message ) );
+                            _on_binary_metadata_available.raise( sptr );
+                        }
+                        catch( std::exception const & e )
+                        {
+                            LOG_DEBUG( "[" << debug_name() << "] metadata exception: " << e.what() );
+                        }
+                    }
+                }
+            } );
+        // NOTE: the metadata thread is only run() when we've reached the READY state
+        return;
+    }
+
     auto topic = topics::flexible_msg::create_topic( _participant, _info.topic_root() + topics::METADATA_TOPIC_NAME );
     _metadata_reader = std::make_shared< dds_topic_reader_thread >( topic, _subscriber );
     _metadata_reader->on_data_available(
@@ -790,6 +825,9 @@ void dds_device::impl::on_device_header( json const & j, dds_sample const & samp
     _n_streams_expected = j.at( topics::notification::device_header::key::n_streams ).get< size_t >();
     LOG_DEBUG( "[" << debug_name() << "] ... " << topics::notification::device_header::id << ": " << _n_streams_expected << " streams expected" );
 
+    // Older servers do not offer binary metadata, and we fall back to JSON
+    j.nested( topics::notification::device_header::key::binary_metadata ).get_ex( _binary_metadata_version );
+
     if( auto extrinsics_j = j.nested( topics::notification::device_header::key::extrinsics ) )
     {
         for( auto & ex : extrinsics_j )
@@ -884,6 +922,15 @@ void dds_device::impl::on_stream_header( json const & j, dds_sample const & samp
         stream->enable_metadata();  // Call before init_profiles
     }
 
+    if( auto flat_image_size = j.nested( topics::notification::stream_header::key::flat_image_size ) )
+        if( auto video_stream = std::dynamic_pointer_cast< dds_video_stream >( stream ) )
+        {
+            // Without a depth, assume any image can be overwritten as soon as the next is written
+            int depth = 1;
+            j.nested( topics::notification::stream_header::key::flat_image_depth ).get_ex( depth );
+            video_stream->enable_flat_images( flat_image_size.get< size_t >(), depth );
+        }
+
     size_t default_profile_index = j.at( "default-profile-index" ).get< size_t >();
     if( default_profile_index < profiles.size() )
         stream->init_profiles( profiles, default_profile_index );
@@ -7,6 +7,7 @@
 #include <realdds/dds-utilities.h>
 #include <realdds/dds-option.h>
 #include <realdds/topics/device-info-msg.h>
+#include <realdds/topics/metadata-msg.h>
 
 #include <fastdds/rtps/common/Guid.h>
 
@@ -66,6 +67,8 @@ public:
 
     std::shared_ptr< dds_topic_reader > _notifications_reader;
     std::shared_ptr< dds_topic_reader > _metadata_reader;
+    uint32_t _binary_metadata_version = 0;  // offered by the server, or 0
+    bool _metadata_binary = false;          // whether _metadata_reader is on the binary topic
     std::shared_ptr< dds_topic_writer > _control_writer;
 
     dds_options _options;
@@ -104,6 +107,13 @@ public:
         return _on_metadata_available.subscribe( std::move( cb ) );
     }
 
+    using on_binary_metadata_available_signal = rsutils::signal< std::shared_ptr< const topics::metadata_msg > const & >;
+    using on_binary_metadata_available_callback = on_binary_metadata_available_signal::callback;
+    rsutils::subscription on_binary_metadata_available( on_binary_metadata_available_callback && cb )
+    {
+        return _on_binary_metadata_available.subscribe( std::move( cb ) );
+    }
+
     using on_device_log_signal = rsutils::signal< dds_nsec,                  // timestamp
                                                   char,                      // type
                                                   std::string const &,       // text
@@ -156,6 +166,7 @@ private:
     bool all_initialization_data_received() const;
 
     on_metadata_available_signal _on_metadata_available;
+    on_binary_metadata_available_signal _on_binary_metadata_available;
     on_device_log_signal _on_device_log;
     on_notification_signal _on_notification;
     on_calibration_changed_signal _on_calibration_changed;
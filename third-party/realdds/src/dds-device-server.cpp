@@ -15,6 +15,7 @@
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-writer.h>
 #include <realdds/dds-option.h>
@@ -74,6 +75,7 @@ dds_device_server::~dds_device_server()
 static void on_discovery_device_header( size_t const n_streams,
                                         const dds_options & options,
                                         const extrinsics_map & extr,
+                                        bool const binary_metadata,
                                         dds_notification_server & notifications )
 {
     auto extrinsics_json = json::array();
@@ -85,6 +87,8 @@ static void on_discovery_device_header( size_t const n_streams,
         { topics::notification::device_header::key::n_streams, n_streams },
         { topics::notification::device_header::key::extrinsics, std::move( extrinsics_json ) }
     };
+    if( binary_metadata )
+        j_device_header[topics::notification::device_header::key::binary_metadata] = topics::metadata_msg::VERSION;
     topics::flexible_msg device_header( j_device_header );
     LOG_DEBUG( "device-header " << std::setw( 4 ) << j_device_header << " size " << device_header._data.size() );
     notifications.add_discovery_notification( std::move( device_header ) );
@@ -115,6 +119,12 @@ static void on_discovery_stream_header( std::shared_ptr< dds_stream_server > con
         { topics::notification::stream_header::key::default_profile_index, stream->default_profile_index() },
         { topics::notification::stream_header::key::metadata_enabled, stream->metadata_enabled() },
     };
+    auto video_stream = std::dynamic_pointer_cast< dds_video_stream_server >( stream );
+    if( video_stream && video_stream->flat_images_enabled() )
+    {
+        j_stream_header[topics::notification::stream_header::key::flat_image_size] = video_stream->flat_image_size();
+        j_stream_header[topics::notification::stream_header::key::flat_image_depth] = video_stream->flat_image_depth();
+    }
     topics::flexible_msg stream_header_message( j_stream_header );
     LOG_DEBUG( stream->name() << " stream-header " << std::setw( 4 ) << j_stream_header << " size "
                               << stream_header_message._data.size() );
@@ -205,7 +215,7 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
         _stream_name_to_server.clear();
 
         _options = options;
-        on_discovery_device_header( streams.size(), options, extr, *_notification_server );
+        on_discovery_device_header( streams.size(), options, extr, _binary_metadata_enabled, *_notification_server );
         for( auto & stream : streams )
         {
             std::string topic_name = ros_friendly_topic_name( _topic_root + '/' + stream->name() );
@@ -222,6 +232,14 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
                 wqos.history().depth = 10;  // default is 1
                 _metadata_writer->override_qos_from_json( wqos, _subscriber->get_participant()->settings().nested( "device", "metadata" ) );
                 _metadata_writer->run( wqos );
+
+                if( _binary_metadata_enabled )
+                {
+                    topic = topics::metadata_msg::create_topic( _publisher->get_participant(),
+                                                                _topic_root + topics::METADATA_BINARY_TOPIC_NAME );
+                    _binary_metadata_writer = std::make_shared< dds_topic_writer >( topic, _publisher );
+                    _binary_metadata_writer->run( wqos );
+                }
             }
         }
 
@@ -249,6 +267,14 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
 }
 
 
+void dds_device_server::enable_binary_metadata()
+{
+    if( is_valid() )
+        DDS_THROW( runtime_error, "enable binary metadata of device server '" + _topic_root + "' before init()" );
+    _binary_metadata_enabled = true;
+}
+
+
 void dds_device_server::broadcast( topics::device_info const & device_info )
 {
     if( _broadcaster )
@@ -301,12 +327,27 @@ void dds_device_server::publish_metadata( json && md )
 }
 
 
+void dds_device_server::publish_metadata( topics::metadata_msg const & md )
+{
+    if( ! _binary_metadata_writer )
+        DDS_THROW( runtime_error, "device '" + _topic_root + "' has no binary metadata" );
+
+    md.write_to( *_binary_metadata_writer );
+}
+
+
 bool dds_device_server::has_metadata_readers() const
 {
     return _metadata_writer && _metadata_writer->has_readers();
 }
 
 
+bool dds_device_server::has_binary_metadata_readers() const
+{
+    return _binary_metadata_writer && _binary_metadata_writer->has_readers();
+}
+
+
 struct dds_device_server::control_sample
 {
     rsutils::json const json;
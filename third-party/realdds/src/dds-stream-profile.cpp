@@ -103,6 +103,36 @@ int dds_video_encoding::to_rs2() const
 }
 
 
+int dds_video_encoding::bits_per_pixel() const
+{
+    switch( to_rs2() )  // same as librealsense's get_image_bpp()
+    {
+    case RS2_FORMAT_Y8:
+    case RS2_FORMAT_RAW8:
+        return 8;
+    case RS2_FORMAT_YUYV:
+    case RS2_FORMAT_UYVY:
+    case RS2_FORMAT_Y8I:
+    case RS2_FORMAT_Y16:
+    case RS2_FORMAT_Z16:
+    case RS2_FORMAT_RAW16:
+    case RS2_FORMAT_RAW10:
+    case RS2_FORMAT_Y10BPACK:
+    case RS2_FORMAT_MJPEG:
+        return 16;
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8:
+        return 24;
+    case RS2_FORMAT_RGBA8:
+    case RS2_FORMAT_BGRA8:
+    case RS2_FORMAT_Y12I:
+    case RS2_FORMAT_W10:
+        return 32;
+    }
+    DDS_THROW( runtime_error, "unknown pixel size for encoding '" + to_string() + "'" );
+}
+
+
 dds_video_encoding dds_video_encoding::from_rs2( int rs2_format )
 {
     char const * encoding = nullptr;
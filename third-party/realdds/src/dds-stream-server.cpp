@@ -10,14 +10,20 @@
 #include <realdds/dds-publisher.h>
 #include <realdds/dds-utilities.h>
 #include <realdds/topics/image-msg.h>
+#include <realdds/topics/flat-image-msg.h>
+#include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/dds-time.h>
 
+#include <rsutils/json.h>
+
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 
+#include <cstring>
+
 
 namespace realdds {
 
@@ -95,35 +101,97 @@ void dds_video_stream_server::open( std::string const & topic_name, std::shared_
     auto topic = topics::image_msg::create_topic( publisher->get_participant(), topic_name.c_str() );
     _writer = std::make_shared< dds_topic_writer >( topic, publisher );
 
+    if( _flat_images_enabled )
+    {
+        _flat_image_size = 0;
+        for( auto & sp : profiles() )
+        {
+            auto vsp = std::static_pointer_cast< dds_video_stream_profile >( sp );
+            size_t size = size_t( vsp->width() ) * vsp->height() * vsp->encoding().bits_per_pixel() / 8;
+            _flat_image_size = std::max( _flat_image_size, size );
+        }
+        auto flat_topic = topics::flat_image_msg::create_topic( publisher->get_participant(),
+                                                                ( topic_name + topics::FLAT_IMAGE_TOPIC_SUFFIX ).c_str(),
+                                                                _flat_image_size );
+        _flat_writer = std::make_shared< dds_topic_writer >( flat_topic, publisher );
+        watch_readers( *_flat_writer );
+
+        dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+        // Same-host readers get the images through shared memory. Losing the first image to the handshake race (see
+        // dds_topic_writer::qos) is fine for a stream.
+        wqos.data_sharing().automatic();
+        wqos.endpoint().history_memory_policy = eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
+        // Readers are loaned the writer's memory: this is how many images can be held before the oldest is reused
+        wqos.history().depth = 4;
+        _flat_writer->override_qos_from_json( wqos,
+                                              publisher->get_participant()->settings().nested( "device", "flat-images" ) );
+        _flat_image_depth = wqos.history().depth;
+        _flat_writer->run( wqos );
+    }
 
     run_stream();
 }
 
+
+void dds_video_stream_server::enable_flat_images()
+{
+    if( is_open() )
+        DDS_THROW( runtime_error, "stream '" + name() + "' is already open" );
+    _flat_images_enabled = true;
+}
+
+
+void dds_video_stream_server::close()
+{
+    _flat_writer.reset();
+    super::close();
+}
+
+
+int dds_stream_server::n_readers() const
+{
+    return _writer ? _writer->n_readers() : 0;
+}
+
+
+int dds_video_stream_server::n_readers() const
+{
+    return super::n_readers() + ( _flat_writer ? _flat_writer->n_readers() : 0 );
+}
+
+
+void dds_stream_server::watch_readers( dds_topic_writer & writer )
+{
+    if( ! _on_readers_changed )
+        return;
+
+    std::weak_ptr< dds_stream_server > weak_this(
+        std::static_pointer_cast< dds_stream_server >( shared_from_this() ) );
+    writer.on_publication_matched(
+        [weak_this, on_readers_changed = _on_readers_changed](
+            eprosima::fastdds::dds::PublicationMatchedStatus const & )
+        {
+            if( auto self = weak_this.lock() )
+                try
+                {
+                    auto const n_readers = self->n_readers();
+                    LOG_DEBUG( n_readers << " total readers on '" << self->name() << "'" );
+                    on_readers_changed( self, n_readers );
+                }
+                catch( std::exception const & e )
+                {
+                    LOG_ERROR( "exception from 'on_readers_changed': " << e.what() );
+                }
+        } );
+}
+
+
 void dds_stream_server::run_stream()
 {
     if( ! _writer )
         DDS_THROW( runtime_error, "open() wasn't called before run_stream()" );
 
-    if( _on_readers_changed )
-    {
-        std::weak_ptr< dds_stream_server > weak_this(
-            std::static_pointer_cast< dds_stream_server >( shared_from_this() ) );
-        _writer->on_publication_matched(
-            [weak_this, on_readers_changed = _on_readers_changed](
-                eprosima::fastdds::dds::PublicationMatchedStatus const & status )
-            {
-                if( auto self = weak_this.lock() )
-                    try
-                    {
-                        LOG_DEBUG( status.current_count << " total readers on '" << self->name() << "'" );
-                        on_readers_changed( self, status.current_count );
-                    }
-                    catch( std::exception const & e )
-                    {
-                        LOG_ERROR( "exception from 'on_readers_changed': " << e.what() );
-                    }
-            } );
-    }
+    watch_readers( *_writer );
     
     _writer->run( dds_topic_writer::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
 }
@@ -197,7 +265,7 @@ void dds_stream_server::close()
     _writer.reset();
 }
 
-void dds_video_stream_server::publish_image( topics::image_msg & image )
+void dds_video_stream_server::fill_image( topics::image_msg & image )
 {
     if( ! is_streaming() )
         DDS_THROW( runtime_error, "stream '" << name() << "' cannot publish before start_streaming()" );
@@ -241,9 +309,64 @@ void dds_video_stream_server::publish_image( topics::image_msg & image )
         image.set_step( uint32_t( image.raw().data().size() / image.height() ) );
 
     assert( ! image.is_bigendian() );
+}
+
+
+void dds_video_stream_server::publish_image( topics::image_msg & image )
+{
+    fill_image( image );
+
+    if( _flat_writer && _flat_writer->has_readers() )
+        publish_flat_image( image.raw().data().data(), image.raw().data().size(), image.timestamp() );
+
+    // With flat images, the Image topic may well have no readers, and then we need not serialize anything
+    if( ! _flat_writer || _writer->has_readers() )
+    {
+        LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
+        DDS_API_CALL( _writer->get()->write( &image.raw() ) );
+    }
+}
 
-    LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
-    DDS_API_CALL( _writer->get()->write( &image.raw() ) );
+
+void dds_video_stream_server::publish_image_data( uint8_t const * data, size_t size, dds_time const & timestamp )
+{
+    if( ! is_streaming() )
+        DDS_THROW( runtime_error, "stream '" << name() << "' cannot publish before start_streaming()" );
+
+    if( _flat_writer && _flat_writer->has_readers() )
+        publish_flat_image( data, size, timestamp );
+
+    if( ! _flat_writer || _writer->has_readers() )
+    {
+        topics::image_msg image;
+        image.set_timestamp( timestamp );
+        image.raw().data().assign( data, data + size );
+        fill_image( image );
+        LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
+        DDS_API_CALL( _writer->get()->write( &image.raw() ) );
+    }
+}
+
+
+void dds_video_stream_server::publish_flat_image( uint8_t const * data, size_t size, dds_time const & timestamp )
+{
+    if( size > _flat_image_size )
+        DDS_THROW( runtime_error,
+                   "image of " << size << " bytes is too big for '" << name() << "' flat images of " << _flat_image_size );
+    if( _image_header.height <= 0 )
+        DDS_THROW( runtime_error, "invalid image height " << _image_header.height );
+
+    // The one copy: from the caller's buffer straight into the memory the readers will be loaned
+    auto image = topics::flat_image_msg::loan_from( *_flat_writer );
+    image.set_timestamp( timestamp );
+    image.set_width( _image_header.width );
+    image.set_height( _image_header.height );
+    image.set_step( uint32_t( size / _image_header.height ) );
+    image.set_encoding( _image_header.encoding.to_string() );
+    image.set_data_size( uint32_t( size ) );
+    std::memcpy( image.data(), data, size );
+    LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " flat image @ " << time_to_string( timestamp ) );
+    image.write_to( *_flat_writer );
 }
 
 
@@ -9,10 +9,15 @@
 #include <realdds/topics/compressed-image-msg.h>
 #include <realdds/topics/string-msg.h>
 #include <realdds/topics/image-msg.h>
+#include <realdds/topics/flat-image-msg.h>
+#include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/dds-exceptions.h>
 #include <realdds/dds-sample.h>
+#include <realdds/dds-participant.h>
+#include <realdds/dds-time.h>
+#include <realdds/dds-utilities.h>
 
 #include <rsutils/json.h>
 
@@ -40,9 +45,16 @@ void dds_video_stream::open( std::string const & topic_name, std::shared_ptr< dd
     if( profiles().empty() )
         DDS_THROW( runtime_error, "stream '" + name() + "' has no profiles" );
 
+    auto flat_settings = subscriber->get_participant()->settings().nested( "device", "flat-images" );
+    _reading_flat_images = _flat_image_size && ! _compressed && flat_settings.nested( "enabled" ).default_value( false );
+
     // Topics with same name and type can be created multiple times (multiple open() calls) without an error.
     std::shared_ptr< dds_topic > topic;
-    if( _compressed )
+    if( _reading_flat_images )
+        topic = topics::flat_image_msg::create_topic( subscriber->get_participant(),
+                                                      ( topic_name + topics::FLAT_IMAGE_TOPIC_SUFFIX ).c_str(),
+                                                      _flat_image_size );
+    else if( _compressed )
         topic = topics::compressed_image_msg::create_topic( subscriber->get_participant(), topic_name.c_str() );
     else
         topic = topics::image_msg::create_topic( subscriber->get_participant(), topic_name.c_str() );
@@ -51,7 +63,15 @@ void dds_video_stream::open( std::string const & topic_name, std::shared_ptr< dd
     // here and destroyed on close()
     _reader = std::make_shared< dds_topic_reader_thread >( topic, subscriber );
     _reader->on_data_available( [this]() { handle_data(); } );
-    _reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+    dds_topic_reader::qos rqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+    if( _reading_flat_images )
+    {
+        // Loaned straight from the server's shared memory when on the same host
+        rqos.data_sharing().automatic();
+        rqos.endpoint().history_memory_policy = eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
+        rqos.override_from_json( flat_settings );
+    }
+    _reader->run( rqos );
 }
 
 
@@ -114,13 +134,46 @@ void dds_stream::start_streaming()
 
 void dds_video_stream::handle_data()
 {
-    if( _compressed )
+    if( _reading_flat_images )
+        handle_flat_images();
+    else if( _compressed )
         handle_image< topics::compressed_image_msg >();
     else
         handle_image< topics::image_msg >();
 }
 
 
+void dds_video_stream::handle_flat_images()
+{
+    topics::flat_image_msg image;
+    dds_sample sample;
+    while( _reader && topics::flat_image_msg::take_next( *_reader, &image, &sample ) )
+    {
+        if( ! image.is_valid() || ! is_streaming() )
+            continue;
+
+        if( ! image.is_current() )
+        {
+            LOG_DEBUG( "[" << name() << "] dropping flat image @ " << time_to_string( image.timestamp() )
+                           << ": already overwritten" );
+            continue;
+        }
+
+        if( _on_flat_image_available )
+        {
+            _on_flat_image_available( std::move( image ), std::move( sample ) );
+        }
+        else if( _on_data_available )
+        {
+            std::vector< uint8_t > data( image.data(), image.data() + image.data_size() );
+            if( image.is_current() )  // the copy may have raced with the server overwriting it
+                _on_data_available( std::move( data ), image.timestamp(), std::move( sample ) );
+        }
+        image.invalidate();  // return the loan before waiting on the next
+    }
+}
+
+
 void dds_motion_stream::handle_data()
 {
     topics::imu_msg imu;
@@ -41,6 +41,7 @@ dds_topic_reader::dds_topic_reader( std::shared_ptr< dds_topic > const & topic,
 
 dds_topic_reader::~dds_topic_reader()
 {
+    assert( ! _n_loans );  // loans keep us alive
     if( _subscriber )
     {
         if( _reader )
@@ -143,7 +144,14 @@ void dds_topic_reader::stop()
     {
         if( _reader )
         {
-            DDS_API_CALL_NO_THROW( _subscriber->get()->delete_datareader( _reader ) );
+            std::lock_guard< std::mutex > lock( _loans_mutex );
+            if( _n_loans )
+            {
+                _reader->set_listener( nullptr );
+                _stopped_reader = _reader;
+            }
+            else
+                DDS_API_CALL_NO_THROW( _subscriber->get()->delete_datareader( _reader ) );
             _reader = nullptr;
         }
     }
@@ -151,6 +159,48 @@ void dds_topic_reader::stop()
 }
 
 
+bool dds_topic_reader::take_loan( eprosima::fastdds::dds::LoanableCollection & samples,
+                                  eprosima::fastdds::dds::SampleInfoSeq & infos )
+{
+    std::lock_guard< std::mutex > lock( _loans_mutex );
+    if( ! _reader )
+        return false;
+    auto status = _reader->take( samples, infos, 1 );
+    if( status == ReturnCode_t::RETCODE_OK )
+    {
+        ++_n_loans;
+        return true;
+    }
+    if( status == ReturnCode_t::RETCODE_NO_DATA )
+        return false;
+    DDS_API_CALL_THROW( "dds_topic_reader::take_loan", status );
+}
+
+
+void dds_topic_reader::return_loan( eprosima::fastdds::dds::LoanableCollection & samples,
+                                    eprosima::fastdds::dds::SampleInfoSeq & infos )
+{
+    std::lock_guard< std::mutex > lock( _loans_mutex );
+    auto reader = _reader ? _reader : _stopped_reader;
+    if( ! reader )
+        return;
+    DDS_API_CALL_NO_THROW( reader->return_loan( samples, infos ) );
+    if( ! --_n_loans && _stopped_reader )
+    {
+        DDS_API_CALL_NO_THROW( _subscriber->get()->delete_datareader( _stopped_reader ) );
+        _stopped_reader = nullptr;
+    }
+}
+
+
+bool dds_topic_reader::is_loan_current( void const * sample, dds_sample const & info ) const
+{
+    std::lock_guard< std::mutex > lock( _loans_mutex );
+    auto reader = _reader ? _reader : _stopped_reader;
+    return reader && reader->is_sample_valid( sample, &info );
+}
+
+
 void dds_topic_reader::on_subscription_matched(
     eprosima::fastdds::dds::DataReader *, eprosima::fastdds::dds::SubscriptionMatchedStatus const & info )
 {
@@ -17,6 +17,7 @@ namespace notification {
         namespace key {
             std::string const n_streams( "n-streams", 9 );
             std::string const extrinsics( "extrinsics", 10 );
+            std::string const binary_metadata( "binary-metadata", 15 );
         }
     }
     namespace device_options {
@@ -34,6 +35,8 @@ namespace notification {
             std::string const profiles( "profiles", 8 );
             std::string const default_profile_index( "default-profile-index", 21 );
             std::string const metadata_enabled( "metadata-enabled", 16 );
+            std::string const flat_image_size( "flat-image-size", 15 );
+            std::string const flat_image_depth( "flat-image-depth", 16 );
         }
     }
     namespace stream_options {
@@ -0,0 +1,230 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <realdds/topics/flat-image-msg.h>
+
+#include <realdds/dds-topic.h>
+#include <realdds/dds-topic-reader.h>
+#include <realdds/dds-topic-writer.h>
+#include <realdds/dds-utilities.h>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+
+#include <cstring>
+#include <new>
+
+
+using SerializedPayload_t = eprosima::fastrtps::rtps::SerializedPayload_t;
+using InstanceHandle_t = eprosima::fastrtps::rtps::InstanceHandle_t;
+
+
+namespace realdds {
+namespace topics {
+
+
+namespace {
+
+
+// There is no IDL for a flat image: a plain type cannot have a variable-length sequence in it, and its size has to
+// be known up front, so the type is written by hand and sized when created.
+//
+// In memory (and in shared memory, when data-sharing), a sample is the header followed by the maximum data size. On
+// the wire, only the header and the actual data are sent.
+//
+class flat_image_type : public eprosima::fastdds::dds::TopicDataType
+{
+    typedef flat_image_msg::header header;
+
+    static constexpr uint32_t encapsulation_size = 4;
+
+public:
+    flat_image_type( size_t max_data_size )
+    {
+        setName( flat_image_msg::type_name( max_data_size ).c_str() );
+        m_typeSize = static_cast< uint32_t >( encapsulation_size + sizeof( header ) + max_data_size );
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize( void * data, SerializedPayload_t * payload ) override
+    {
+        auto h = static_cast< header const * >( data );
+        uint32_t const size = encapsulation_size + sizeof( header ) + h->data_size;
+        if( size > m_typeSize || size > payload->max_size )
+            return false;
+        // Encapsulation: CDR_LE, no options
+        payload->data[0] = 0;
+        payload->data[1] = CDR_LE;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        payload->encapsulation = CDR_LE;
+        std::memcpy( payload->data + encapsulation_size, data, size - encapsulation_size );
+        payload->length = size;
+        return true;
+    }
+
+    bool deserialize( SerializedPayload_t * payload, void * data ) override
+    {
+        if( payload->length < encapsulation_size + sizeof( header ) || payload->length > m_typeSize )
+            return false;
+        if( payload->data[1] != CDR_LE )
+            return false;  // we only produce little-endian
+        uint32_t const size = payload->length - encapsulation_size;
+        std::memcpy( data, payload->data + encapsulation_size, size );
+        return static_cast< header const * >( data )->data_size <= size - sizeof( header );
+    }
+
+    std::function< uint32_t() > getSerializedSizeProvider( void * data ) override
+    {
+        return [data]() -> uint32_t
+        {
+            return encapsulation_size + sizeof( header ) + static_cast< header const * >( data )->data_size;
+        };
+    }
+
+    bool getKey( void *, InstanceHandle_t *, bool ) override { return false; }
+
+    void * createData() override
+    {
+        auto memory = ::operator new( m_typeSize - encapsulation_size );
+        construct_sample( memory );
+        return memory;
+    }
+
+    void deleteData( void * data ) override { ::operator delete( data ); }
+
+#ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+    inline bool is_bounded() const override { return true; }
+#endif
+
+#ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+    inline bool is_plain() const override { return true; }
+#endif
+
+#ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+    inline bool construct_sample( void * memory ) const override
+#else
+    inline bool construct_sample( void * memory ) const
+#endif
+    {
+        new( memory ) header();  // zeroed; the data is left as-is
+        return true;
+    }
+};
+
+
+// A sample taken on loan from a reader, returned when destroyed; it holds the reader until then
+struct reader_loan
+{
+    std::shared_ptr< dds_topic_reader > reader;
+    eprosima::fastdds::dds::LoanableSequence< flat_image_msg::header > samples;
+    eprosima::fastdds::dds::SampleInfoSeq infos;
+
+    ~reader_loan()
+    {
+        if( samples.length() )
+            reader->return_loan( samples, infos );
+    }
+};
+
+
+// Discards a sample loaned from a writer, unless it was written
+struct writer_loan_deleter
+{
+    eprosima::fastdds::dds::DataWriter * writer;
+
+    void operator()( flat_image_msg::header * sample )
+    {
+        if( writer )
+        {
+            void * p = sample;
+            DDS_API_CALL_NO_THROW( writer->discard_loan( p ) );
+        }
+    }
+};
+
+
+}  // namespace
+
+
+std::string flat_image_msg::encoding() const
+{
+    return std::string( _sample->encoding, strnlen( _sample->encoding, sizeof( _sample->encoding ) ) );
+}
+
+
+void flat_image_msg::set_encoding( std::string const & encoding )
+{
+    if( encoding.length() > sizeof( _sample->encoding ) )
+        DDS_THROW( runtime_error, "encoding '" << encoding << "' is too long for a flat image" );
+    std::memset( _sample->encoding, 0, sizeof( _sample->encoding ) );
+    std::memcpy( _sample->encoding, encoding.data(), encoding.length() );
+}
+
+
+/*static*/ std::string flat_image_msg::type_name( size_t max_data_size )
+{
+    return "realdds::flat_image_" + std::to_string( max_data_size );
+}
+
+
+/*static*/ std::shared_ptr< dds_topic > flat_image_msg::create_topic(
+    std::shared_ptr< dds_participant > const & participant, char const * topic_name, size_t max_data_size )
+{
+    return std::make_shared< dds_topic >( participant,
+                                          eprosima::fastdds::dds::TypeSupport( new flat_image_type( max_data_size ) ),
+                                          topic_name );
+}
+
+
+/*static*/ flat_image_msg flat_image_msg::loan_from( dds_topic_writer & writer )
+{
+    void * sample = nullptr;
+    DDS_API_CALL( writer->loan_sample( sample ) );
+    return flat_image_msg(
+        std::shared_ptr< header >( static_cast< header * >( sample ), writer_loan_deleter{ writer.get() } ) );
+}
+
+
+void flat_image_msg::write_to( dds_topic_writer & writer )
+{
+    auto deleter = std::get_deleter< writer_loan_deleter >( _sample );
+    if( ! deleter || deleter->writer != writer.get() )
+        DDS_THROW( runtime_error, "flat image was not loaned from this writer" );
+    DDS_API_CALL( writer->write( _sample.get() ) );
+    deleter->writer = nullptr;  // the writer has the sample back
+    invalidate();
+}
+
+
+/*static*/ bool flat_image_msg::take_next( dds_topic_reader & reader, flat_image_msg * output, dds_sample * sample )
+{
+    auto loan = std::make_shared< reader_loan >();
+    loan->reader = reader.shared_from_this();
+    if( ! reader.take_loan( loan->samples, loan->infos ) )
+        return false;
+
+    if( sample )
+        *sample = loan->infos[0];
+    if( output )
+    {
+        // Only samples for which valid_data is true should be accessed
+        if( ! loan->infos[0].valid_data )
+        {
+            output->invalidate();
+        }
+        else
+        {
+            output->_sample = std::shared_ptr< header >( loan, &loan->samples[0] );
+            output->_is_current = [loan]() { return loan->reader->is_loan_current( &loan->samples[0], loan->infos[0] ); };
+        }
+    }
+    return true;
+}
+
+
+}  // namespace topics
+}  // namespace realdds
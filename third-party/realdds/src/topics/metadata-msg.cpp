@@ -0,0 +1,151 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <realdds/topics/metadata-msg.h>
+#include <realdds/topics/flexible-msg.h>
+#include <realdds/dds-utilities.h>
+
+#include <cstring>
+
+
+namespace realdds {
+namespace topics {
+
+
+// The layout, all of it 8-byte aligned:
+//     int64   timestamp (ns)
+//     uint64  frame number
+//     int32   timestamp domain
+//     float   depth units
+//     uint16  flags (what of the above is present, other than the timestamp)
+//     uint16  number of items
+//     uint16  length of the stream name
+//     uint16  (reserved)
+//     char[]  stream name, not terminated, padded to 8 bytes
+//     items:  uint32 key, uint32 (reserved), int64 value
+//
+static constexpr size_t header_size = 32;
+static constexpr size_t item_size = 16;
+
+
+static size_t padded( size_t n )
+{
+    return ( n + 7 ) & ~size_t( 7 );
+}
+
+
+template< class T >
+static void put( uint8_t *& p, T const & value )
+{
+    std::memcpy( p, &value, sizeof( T ) );
+    p += sizeof( T );
+}
+
+
+template< class T >
+static void get( uint8_t const *& p, T & value )
+{
+    std::memcpy( &value, p, sizeof( T ) );
+    p += sizeof( T );
+}
+
+
+/*static*/ std::shared_ptr< dds_topic >
+metadata_msg::create_topic( std::shared_ptr< dds_participant > const & participant, char const * topic_name )
+{
+    return flexible_msg::create_topic( participant, topic_name );
+}
+
+
+flexible_msg metadata_msg::to_flexible() const
+{
+    if( _stream_name.length() > UINT16_MAX )
+        DDS_THROW( runtime_error, "stream name too long for binary metadata" );
+    if( _items.size() > UINT16_MAX )
+        DDS_THROW( runtime_error, "too many binary metadata items" );
+
+    flexible_msg msg;
+    msg._data_format = flexible_msg::data_format::CUSTOM;
+    msg._version = VERSION;
+    msg._data.resize( header_size + padded( _stream_name.length() ) + _items.size() * item_size );
+
+    uint8_t * p = msg._data.data();
+    put( p, _timestamp );
+    put( p, _frame_number );
+    put( p, _timestamp_domain );
+    put( p, _depth_units );
+    put( p, _flags );
+    put( p, static_cast< uint16_t >( _items.size() ) );
+    put( p, static_cast< uint16_t >( _stream_name.length() ) );
+    put( p, uint16_t( 0 ) );
+    std::memcpy( p, _stream_name.data(), _stream_name.length() );
+    p += padded( _stream_name.length() );  // the padding was zeroed by resize()
+    for( auto & i : _items )
+    {
+        put( p, i.key );
+        put( p, uint32_t( 0 ) );
+        put( p, i.value );
+    }
+    return msg;
+}
+
+
+/*static*/ metadata_msg metadata_msg::from_flexible( flexible_msg const & msg )
+{
+    if( msg._data_format != flexible_msg::data_format::CUSTOM || msg._version != VERSION )
+        DDS_THROW( runtime_error, "not binary metadata, or of an unknown version (" << msg._version << ")" );
+    if( msg._data.size() < header_size )
+        DDS_THROW( runtime_error, "binary metadata is too short (" << msg._data.size() << " bytes)" );
+
+    metadata_msg md;
+    uint16_t n_items, name_length, reserved;
+    uint8_t const * p = msg._data.data();
+    get( p, md._timestamp );
+    get( p, md._frame_number );
+    get( p, md._timestamp_domain );
+    get( p, md._depth_units );
+    get( p, md._flags );
+    get( p, n_items );
+    get( p, name_length );
+    get( p, reserved );
+    if( msg._data.size() != header_size + padded( name_length ) + n_items * item_size )
+        DDS_THROW( runtime_error,
+                   "binary metadata of " << msg._data.size() << " bytes cannot hold " << n_items << " items" );
+    md._stream_name.assign( reinterpret_cast< char const * >( p ), name_length );
+    p += padded( name_length );
+    md._items.resize( n_items );
+    for( auto & i : md._items )
+    {
+        uint32_t unused;
+        get( p, i.key );
+        get( p, unused );
+        get( p, i.value );
+    }
+    return md;
+}
+
+
+/*static*/ bool metadata_msg::take_next( dds_topic_reader & reader, metadata_msg * output, dds_sample * sample )
+{
+    flexible_msg msg;
+    if( ! flexible_msg::take_next( reader, output ? &msg : nullptr, sample ) )
+        return false;
+    if( output )
+    {
+        if( msg.is_valid() )
+            *output = from_flexible( msg );
+        else
+            output->invalidate();
+    }
+    return true;
+}
+
+
+dds_sequence_number metadata_msg::write_to( dds_topic_writer & writer ) const
+{
+    return to_flexible().write_to( writer );
+}
+
+
+}  // namespace topics
+}  // namespace realdds
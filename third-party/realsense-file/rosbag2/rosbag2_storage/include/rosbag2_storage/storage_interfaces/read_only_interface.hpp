@@ -43,6 +43,22 @@ public:
   virtual void set_filter(const StorageFilter & storage_filter) = 0;
 
   virtual void reset_filter() = 0;
+
+  /**
+   * Set the read head to the first message with a timestamp >= the given one (applies the filter, if any).
+   * \param timestamp The timestamp of the message to read next
+   */
+  virtual void seek(const rcutils_time_point_value_t & timestamp) = 0;
+
+  /**
+   * Get the timestamp of a topic's index-th message, counting from 0 in timestamp order.
+   * \param topic The topic name
+   * \param index The message index within the topic
+   * \param timestamp Receives the timestamp of the message
+   * \return false if the topic has no more than index messages
+   */
+  virtual bool get_message_timestamp(
+    const std::string & topic, uint64_t index, rcutils_time_point_value_t & timestamp) = 0;
 };
 
 }  // namespace storage_interfaces
@@ -16,6 +16,7 @@
 #define ROSBAG2_STORAGE_DEFAULT_PLUGINS__SQLITE__SQLITE_STORAGE_HPP_
 
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -83,6 +84,11 @@ public:
 
   void reset_filter() override;
 
+  void seek(const rcutils_time_point_value_t & timestamp) override;
+
+  bool get_message_timestamp(
+    const std::string & topic, uint64_t index, rcutils_time_point_value_t & timestamp) override;
+
 private:
   void initialize();
   void prepare_for_writing();
@@ -105,6 +111,7 @@ private:
   std::string relative_path_;
   std::atomic_bool active_transaction_ {false};
   rosbag2_storage::StorageFilter storage_filter_ {};
+  rcutils_time_point_value_t seek_time_ = std::numeric_limits<rcutils_time_point_value_t>::min();
 };
 
 }  // namespace rosbag2_storage_plugins
@@ -261,6 +261,8 @@ void SqliteStorage::prepare_for_writing()
 
 void SqliteStorage::prepare_for_reading()
 {
+  // The timestamp condition lets sqlite start from the timestamp index rather than scan from the start
+  std::string where = "WHERE messages.timestamp >= " + std::to_string(seek_time_) + " ";
   if (!storage_filter_.topics.empty()) {
     // Construct string for selected topics
     std::string topic_list{""};
@@ -270,18 +272,14 @@ void SqliteStorage::prepare_for_reading()
         topic_list += ",";
       }
     }
-
-    read_statement_ = database_->prepare_statement(
-      "SELECT data, timestamp, topics.name "
-      "FROM messages JOIN topics ON messages.topic_id = topics.id "
-      "WHERE topics.name IN (" + topic_list + ")"
-      "ORDER BY messages.timestamp;");
-  } else {
-    read_statement_ = database_->prepare_statement(
-      "SELECT data, timestamp, topics.name "
-      "FROM messages JOIN topics ON messages.topic_id = topics.id "
-      "ORDER BY messages.timestamp;");
+    where += "AND topics.name IN (" + topic_list + ") ";
   }
+
+  read_statement_ = database_->prepare_statement(
+    "SELECT data, timestamp, topics.name "
+    "FROM messages JOIN topics ON messages.topic_id = topics.id " +
+    where +
+    "ORDER BY messages.timestamp;");
   message_result_ = read_statement_->execute_query<
     std::shared_ptr<rcutils_uint8_array_t>, rcutils_time_point_value_t, std::string>();
   current_message_row_ = message_result_.begin();
@@ -370,6 +368,31 @@ void SqliteStorage::reset_filter()
   storage_filter_ = rosbag2_storage::StorageFilter();
 }
 
+void SqliteStorage::seek(const rcutils_time_point_value_t & timestamp)
+{
+  seek_time_ = timestamp;
+  prepare_for_reading();
+}
+
+bool SqliteStorage::get_message_timestamp(
+  const std::string & topic, uint64_t index, rcutils_time_point_value_t & timestamp)
+{
+  // Walks the timestamp index only: the message data is not read
+  auto statement = database_->prepare_statement(
+    "SELECT messages.timestamp "
+    "FROM messages JOIN topics ON messages.topic_id = topics.id "
+    "WHERE topics.name = ? "
+    "ORDER BY messages.timestamp LIMIT 1 OFFSET ?;");
+  statement->bind(topic, static_cast<rcutils_time_point_value_t>(index));
+  auto query_results = statement->execute_query<rcutils_time_point_value_t>();
+  auto result = query_results.begin();
+  if (result == query_results.end()) {
+    return false;
+  }
+  timestamp = std::get<0>(*result);
+  return true;
+}
+
 }  // namespace rosbag2_storage_plugins
 
 //#include "pluginlib/class_list_macros.hpp"  // NOLINT
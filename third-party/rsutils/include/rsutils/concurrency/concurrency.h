@@ -8,7 +8,14 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <memory>
+#include <chrono>
 #include <cassert>
+#include <cstdint>
+
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _M_IX86 ) || defined( _M_X64 )
+#include <emmintrin.h>  // For _mm_pause
+#endif
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -193,15 +200,415 @@ public:
     bool empty() const { return ! size(); }
 };
 
-// A single_consumer_queue meant to hold frame_holder objects
-template<class T>
+// A bounded, lock-free alternative to single_consumer_queue, with the same interface and drop-oldest semantics.
+//
+// Items live in a ring of 'cap' slots, each with a sequence number telling whether it is free or holds an item:
+// producers and consumers claim slots with a CAS on their own index, and never take a lock. Any number of threads may
+// enqueue; when the queue is full, enqueue() removes the oldest item itself, so dequeues may run concurrently.
+//
+// Waiting threads spin, then yield, then park on a condition variable: the other side only takes its mutex to wake
+// them when someone is parked. How long to spin adapts to whether items tend to come before parking.
+//
+// peek() moves the front item out of the ring and holds it until it is dequeued: it is never the one dropped.
+template< class T >
+class lock_free_queue
+{
+    struct slot
+    {
+        std::atomic< size_t > sequence;  // The index of the next enqueue into it, or of the next dequeue from it + 1
+        T item;
+    };
+
+    struct waiters
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic< int > parked{ 0 };
+        std::atomic< int > spins{ 0 };  // before yielding; none with a single CPU, where spinning only delays the others
+    };
+
+    // Producers and consumers each advance their own index: kept on separate cache lines
+    std::atomic< size_t > _tail;  // next enqueue
+    char _tail_padding[64];
+    std::atomic< size_t > _head;  // next dequeue
+    char _head_padding[64];
+
+    std::unique_ptr< slot[] > const _slots;
+    size_t const _size;
+
+    // Items enqueued and not yet dequeued, including the one held by peek() and those still being written
+    std::atomic< int > _count;
+    unsigned int const _cap;
+    std::atomic< bool > _accepting;
+    std::atomic< int > _enqueuing;  // producers past their check of _accepting
+
+    // Serializes dequeues, peeks and clears, which the front held by peek() takes part in. Only ever held briefly.
+    std::atomic< bool > _consumer_busy;
+    T _front;
+    bool _holding_front;
+
+    waiters _not_empty, _not_full;
+
+    std::function< void( T const & ) > const _on_drop_callback;
+
+    static constexpr int min_spins = 16;
+    static constexpr int max_spins = 4096;
+    static constexpr int yields = 8;
+
+public:
+    explicit lock_free_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
+                                   std::function< void( T const & ) > on_drop_callback = nullptr )
+        : _tail( 0 )
+        , _head( 0 )
+        , _slots( new slot[cap ? cap : 1] )
+        , _size( cap ? cap : 1 )
+        , _count( 0 )
+        , _cap( cap )
+        , _accepting( true )
+        , _enqueuing( 0 )
+        , _consumer_busy( false )
+        , _holding_front( false )
+        , _on_drop_callback( on_drop_callback )
+    {
+        for( size_t i = 0; i < _size; ++i )
+            _slots[i].sequence.store( i, std::memory_order_relaxed );
+        if( std::thread::hardware_concurrency() > 1 )
+        {
+            _not_empty.spins = min_spins;
+            _not_full.spins = min_spins;
+        }
+    }
+
+    // Enqueue an item onto the queue.
+    // If the queue grows beyond capacity, the oldest item will be removed, losing whatever was there!
+    bool enqueue( T && item )
+    {
+        if( ! begin_enqueue() )
+        {
+            if( _on_drop_callback )
+                _on_drop_callback( item );
+            return false;
+        }
+        _count.fetch_add( 1 );
+        push( item );
+        end_enqueue();
+        return true;
+    }
+
+    // Enqueue an item, but wait for room if there isn't any
+    // Returns true if the enqueue succeeded
+    bool blocking_enqueue( T && item )
+    {
+        // Room is reserved in _count before the item goes into the ring
+        bool reserved = false;
+        wait( _not_full,
+              [&]()
+              {
+                  int count = _count.load();
+                  while( count < int( _cap ) )
+                      if( _count.compare_exchange_weak( count, count + 1 ) )
+                          return reserved = true;
+                  return ! _accepting.load();
+              },
+              std::chrono::steady_clock::time_point::max() );
+        if( ! reserved || ! begin_enqueue() )
+        {
+            // We shouldn't be adding anything to the queue when we're stopping
+            if( reserved )
+                _count.fetch_sub( 1 );
+            if( _on_drop_callback )
+                _on_drop_callback( item );
+            return false;
+        }
+        push( item );
+        end_enqueue();
+        return true;
+    }
+
+    // Remove one item; if unavailable, wait for it
+    // Return true if an item was removed -- otherwise, false
+    bool dequeue( T * item, unsigned int timeout_ms )
+    {
+        bool dequeued = false;
+        wait( _not_empty,
+              [&]() { return ( dequeued = try_dequeue( item ) ) || ! _accepting.load(); },
+              std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout_ms ) );
+        return dequeued;
+    }
+
+    // Remove one item if available; do not wait for one
+    // Return true if an item was removed -- otherwise, false
+    bool try_dequeue( T * item )
+    {
+        {
+            consumer_lock lock( *this );
+            if( _holding_front )
+            {
+                *item = std::move( _front );
+                _front = T();
+                _holding_front = false;
+                _count.fetch_sub( 1 );
+            }
+            else
+            {
+                // Uncounted before its slot is freed: a producer that finds the ring full meanwhile then waits for
+                // the slot rather than drop an item there's room for (see push())
+                if( ! can_pop() )
+                    return false;
+                _count.fetch_sub( 1 );
+                if( ! pop( *item ) )
+                {
+                    _count.fetch_add( 1 );  // a producer dropped it, and there's nothing after it
+                    return false;
+                }
+            }
+        }
+
+        // We've made room -- let whoever is waiting for room know about it
+        notify( _not_full );
+        return true;
+    }
+
+    template< class Fn >
+    bool peek( Fn fn ) const
+    {
+        // Only moves the front where it stays first in line
+        return const_cast< lock_free_queue * >( this )->peek( [&]( T const & item ) { fn( item ); } );
+    }
+
+    template< class Fn >
+    bool peek( Fn fn )
+    {
+        consumer_lock lock( *this );
+        if( ! _holding_front )
+        {
+            if( ! pop( _front ) )
+                return false;
+            _holding_front = true;
+        }
+        fn( _front );
+        return true;
+    }
+
+    void stop()
+    {
+        // We no longer accept any more items! Those already on their way in are cleared along with the rest.
+        _accepting = false;
+        while( _enqueuing.load() )
+            std::this_thread::yield();
+        clear();
+    }
+
+    void clear()
+    {
+        {
+            consumer_lock lock( *this );
+            T item;
+            while( pop( item ) )
+                _count.fetch_sub( 1 );
+            if( _holding_front )
+            {
+                _front = T();
+                _holding_front = false;
+                _count.fetch_sub( 1 );
+            }
+        }
+
+        // Wake up anyone who is waiting for room to enqueue, or waiting for something to dequeue -- there's nothing now
+        notify( _not_full, true );
+        notify( _not_empty, true );
+    }
+
+    void start() { _accepting = true; }
+
+    bool started() const { return _accepting; }
+    bool stopped() const { return ! started(); }
+
+    size_t size() const
+    {
+        int count = _count.load();
+        return count > 0 ? size_t( count ) : 0;
+    }
+
+    bool empty() const { return ! size(); }
+
+private:
+    class consumer_lock
+    {
+        lock_free_queue & _q;
+
+    public:
+        consumer_lock( lock_free_queue & q )
+            : _q( q )
+        {
+            while( _q._consumer_busy.exchange( true, std::memory_order_acquire ) )
+                pause();
+        }
+        ~consumer_lock() { _q._consumer_busy.store( false, std::memory_order_release ); }
+    };
+
+    static void pause()
+    {
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _M_IX86 ) || defined( _M_X64 )
+        _mm_pause();
+#elif defined( __GNUC__ ) && ( defined( __aarch64__ ) || defined( __arm__ ) )
+        __asm__ __volatile__( "yield" );
+#endif
+    }
+
+    // Stop waits for the producers that saw we were accepting
+    bool begin_enqueue()
+    {
+        _enqueuing.fetch_add( 1 );
+        if( _accepting.load() )
+            return true;
+        _enqueuing.fetch_sub( 1 );
+        return false;
+    }
+
+    void end_enqueue()
+    {
+        _enqueuing.fetch_sub( 1 );
+        // We pushed something -- let others know there's something to dequeue
+        notify( _not_empty );
+    }
+
+    // Puts an item counted in _count into the ring, dropping the oldest ones while there's no room for it
+    void push( T & item )
+    {
+        T oldest;
+        while( ! try_push( item ) )
+        {
+            // The ring also looks full while a consumer that took the oldest item has yet to free its slot: only make
+            // room if we're really over capacity
+            if( _count.load() > int( _cap ) && pop( oldest ) )
+                drop( oldest );
+            else
+                pause();  // The oldest is still being written, or its slot is being freed
+        }
+        while( _count.load() > int( _cap ) && pop( oldest ) )
+            drop( oldest );
+    }
+
+    void drop( T & item )
+    {
+        _count.fetch_sub( 1 );
+        if( _on_drop_callback )
+            _on_drop_callback( item );
+        item = T();
+    }
+
+    bool try_push( T & item )
+    {
+        size_t pos = _tail.load( std::memory_order_relaxed );
+        for( ;; )
+        {
+            slot & s = _slots[pos % _size];
+            auto diff = intptr_t( s.sequence.load( std::memory_order_acquire ) ) - intptr_t( pos );
+            if( diff == 0 )
+            {
+                if( _tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    s.item = std::move( item );
+                    s.sequence.store( pos + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if( diff < 0 )
+                return false;  // full
+            else
+                pos = _tail.load( std::memory_order_relaxed );
+        }
+    }
+
+    // Whether the oldest item in the ring is there for the taking
+    bool can_pop() const
+    {
+        size_t pos = _head.load( std::memory_order_relaxed );
+        return _slots[pos % _size].sequence.load( std::memory_order_acquire ) == pos + 1;
+    }
+
+    bool pop( T & item )
+    {
+        size_t pos = _head.load( std::memory_order_relaxed );
+        for( ;; )
+        {
+            slot & s = _slots[pos % _size];
+            auto diff = intptr_t( s.sequence.load( std::memory_order_acquire ) ) - intptr_t( pos + 1 );
+            if( diff == 0 )
+            {
+                if( _head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    item = std::move( s.item );
+                    s.item = T();
+                    s.sequence.store( pos + _size, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if( diff < 0 )
+                return false;  // empty, or the front is still being written
+            else
+                pos = _head.load( std::memory_order_relaxed );
+        }
+    }
+
+    // Returns ready() once it is true, or false when the deadline passes first
+    template< class Pred >
+    bool wait( waiters & w, Pred ready, std::chrono::steady_clock::time_point deadline )
+    {
+        int const spins = w.spins.load( std::memory_order_relaxed );
+        for( int i = 0; i < spins; ++i )
+        {
+            if( ready() )
+            {
+                if( spins < max_spins )
+                    w.spins.store( spins * 2, std::memory_order_relaxed );
+                return true;
+            }
+            pause();
+        }
+        for( int i = 0; i < yields; ++i )
+        {
+            if( ready() )
+                return true;
+            std::this_thread::yield();
+        }
+
+        std::unique_lock< std::mutex > lock( w.mutex );
+        w.parked.fetch_add( 1 );
+        // Either we see what was done before notify(), or notify() sees us parked and waits for the mutex
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        bool const result = w.cv.wait_until( lock, deadline, ready );
+        w.parked.fetch_sub( 1 );
+        if( spins > min_spins )
+            w.spins.store( spins / 2, std::memory_order_relaxed );
+        return result;
+    }
+
+    void notify( waiters & w, bool all = false )
+    {
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if( ! w.parked.load( std::memory_order_relaxed ) )
+            return;
+        {
+            std::lock_guard< std::mutex > lock( w.mutex );
+        }
+        if( all )
+            w.cv.notify_all();
+        else
+            w.cv.notify_one();
+    }
+};
+
+// A single_consumer_queue, or lock_free_queue, meant to hold frame_holder objects
+template< class T, class Queue = single_consumer_queue< T > >
 class single_consumer_frame_queue
 {
-    single_consumer_queue<T> _queue;
+    Queue _queue;
 
 public:
-    single_consumer_frame_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
-                                      std::function< void( T const & ) > on_drop_callback = nullptr )
+    single_consumer_frame_queue( unsigned int cap = QUEUE_MAX_SIZE,
+                                 std::function< void( T const & ) > on_drop_callback = nullptr )
         : _queue( cap, on_drop_callback )
     {
     }
@@ -265,6 +672,9 @@ public:
     bool stopped() const { return _queue.stopped(); }
 };
 
+template< class T >
+using lock_free_frame_queue = single_consumer_frame_queue< T, lock_free_queue< T > >;
+
 // The dispatcher is responsible for dispatching generic 'actions': any thread can queue an action
 // (lambda) for dispatch, while the dispatcher maintains a single thread that runs these actions one
 // at a time.
@@ -387,7 +797,7 @@ private:
 
     friend cancellable_timer;
 
-    single_consumer_queue<std::function<void(cancellable_timer)>> _queue;
+    lock_free_queue<std::function<void(cancellable_timer)>> _queue;
     std::thread _thread;
 
     std::atomic<bool> _was_stopped;
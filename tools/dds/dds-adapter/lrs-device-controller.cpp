@@ -10,6 +10,7 @@
 #include <realdds/topics/blob-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/dds-device-server.h>
 #include <realdds/dds-stream-server.h>
@@ -324,6 +325,11 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
             // Must be done before calling init_profiles()
             if( _md_enabled )
                 server->enable_metadata();
+            // Same-host clients can read from shared memory instead; the memory is set aside per stream, so it's
+            // opt-in. Must be done before the server is opened by init()
+            auto & settings = _dds_device_server->participant()->settings();
+            if( settings.nested( "device", "flat-images", "enabled" ).default_value( false ) )
+                video_server->enable_flat_images();
         }
 
         server->init_profiles( profiles, default_profile_index );
@@ -737,13 +743,10 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         dds_time const timestamp  // in sec.nsec
                             ( static_cast< long double >( f.get_timestamp() ) * MILLISEC_TO_SEC );
 
-                        realdds::topics::image_msg image;
-                        image.set_height( video->get_image_header().height );
-                        image.set_width( video->get_image_header().width );
-                        image.set_timestamp( timestamp );
-                        auto data = static_cast< const uint8_t * >( f.get_data() );
-                        image.raw().data().assign( data, data + f.get_data_size() );
-                        video->publish_image( image );
+                        // Copied only into what the readers need: a flat image and/or an Image message
+                        video->publish_image_data( static_cast< const uint8_t * >( f.get_data() ),
+                                                   f.get_data_size(),
+                                                   timestamp );
 
                         publish_frame_metadata( f, timestamp );
                     } );
@@ -789,6 +792,10 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
 
     extrinsics = get_extrinsics_map( dev );
 
+    // Clients that can take it get the metadata in binary form, without the JSON
+    if( _md_enabled )
+        _dds_device_server->enable_binary_metadata();
+
     // Initialize the DDS device server with the supported streams
     _dds_device_server->init( supported_streams, options, extrinsics );
 
@@ -1087,7 +1094,31 @@ bool lrs_device_controller::on_open_streams( json const & control, json & reply
 
 void lrs_device_controller::publish_frame_metadata( const rs2::frame & f, realdds::dds_time const & timestamp )
 {
-    if( ! _dds_device_server->has_metadata_readers() )
+    // Each format is published only if someone reads it
+    bool const json_readers = _dds_device_server->has_metadata_readers();
+    bool const binary_readers = _dds_device_server->has_binary_metadata_readers();
+    if( ! json_readers && ! binary_readers )
+        return;
+
+    if( binary_readers )
+    {
+        // The timestamp is the syncer key, as in the JSON header below
+        topics::metadata_msg md( stream_name_from_rs2( f.get_profile() ), timestamp.to_ns() );
+        md.set_frame_number( f.get_frame_number() );
+        md.set_timestamp_domain( f.get_frame_timestamp_domain() );
+        if( f.is< rs2::depth_frame >() )
+            md.set_depth_units( f.as< rs2::depth_frame >().get_units() );
+        md.reserve( RS2_FRAME_METADATA_COUNT );
+        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+        {
+            rs2_frame_metadata_value val = static_cast< rs2_frame_metadata_value >( i );
+            if( f.supports_frame_metadata( val ) )
+                md.add( static_cast< uint32_t >( val ), f.get_frame_metadata( val ) );
+        }
+        _dds_device_server->publish_metadata( md );
+    }
+
+    if( ! json_readers )
         return;
 
     json md_header = json::object( {
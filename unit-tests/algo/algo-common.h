@@ -16,3 +16,18 @@
 #include "../approx.h"
 
 #include "../trace.h"
+
+
+// For tests of the SIMD kernels against the scalar ones:
+//     SIMD( kernel ) names the kernel for the architecture's baseline (kernel_sse or kernel_neon), if there is one;
+//     AVX2_KERNELS is defined where there are AVX2 kernels too, which may only run if has_avx2()
+#if defined( __SSSE3__ )
+#define SIMD( kernel ) kernel##_sse
+#elif defined( __ARM_NEON ) && defined( BUILD_WITH_NEON ) && ! defined( ANDROID )
+#define SIMD( kernel ) kernel##_neon
+#endif
+
+#if defined( BUILD_WITH_AVX2 ) && defined( __SSSE3__ )
+#include <src/proc/sse/cpu-features.h>
+#define AVX2_KERNELS
+#endif
@@ -0,0 +1,270 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <librealsense2/rsutil.h>
+#include <src/proc/align.h>
+#include <src/proc/pointcloud.h>
+#include <src/proc/worker-pool.h>
+
+#include <numeric>
+#include <random>
+
+using namespace librealsense;
+
+static rs2_intrinsics make_depth_intrinsics( rs2_distortion model )
+{
+    rs2_intrinsics intrin = { 213, 121, 105.3f, 61.7f, 190.4f, 190.9f, model, { 0, 0, 0, 0, 0 } };
+    if( model == RS2_DISTORTION_BROWN_CONRADY || model == RS2_DISTORTION_INVERSE_BROWN_CONRADY )
+    {
+        float const coeffs[] = { 0.180086836f, -0.534179211f, -0.00139013783f, 0.000118769123f, 0.470662683f };
+        std::copy( std::begin( coeffs ), std::end( coeffs ), intrin.coeffs );
+    }
+    return intrin;
+}
+
+// Both smaller and larger than the depth image, so that depth pixels cover one or several pixels of it
+static rs2_intrinsics make_other_intrinsics( int width, int height )
+{
+    rs2_intrinsics intrin = { width, height, width / 2.f + 0.3f, height / 2.f - 0.6f, width * 0.9f, width * 0.9f,
+                              RS2_DISTORTION_MODIFIED_BROWN_CONRADY, { 0.02f, -0.05f, 0.001f, -0.002f, 0.01f } };
+    return intrin;
+}
+
+static rs2_extrinsics const depth_to_other = { { 0.9999f, 0.0100f, -0.0050f,
+                                                 -0.0101f, 0.9999f, -0.0030f,
+                                                 0.0050f, 0.0031f, 0.9999f },
+                                               { 0.015f, -0.0002f, 0.0004f } };
+
+static std::vector< uint16_t > make_depth( size_t pixels, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > z( 200, 3000 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< uint16_t > depth( pixels );
+    for( auto & d : depth )
+        d = uint16_t( kind( gen ) < 20 ? 0 : z( gen ) );
+    return depth;
+}
+
+// The per-pixel generic align that the tables replace: both corners of each depth pixel are deprojected, transformed
+// and projected, and pixels whose rectangle is not entirely inside the other image are skipped
+template< class TRANSFER_PIXEL >
+static void align_images( const rs2_intrinsics & depth_intrin, const uint16_t * z_pixels, float z_scale,
+                          const rs2_intrinsics & other_intrin, TRANSFER_PIXEL transfer_pixel )
+{
+    for( int depth_y = 0; depth_y < depth_intrin.height; ++depth_y )
+    {
+        int depth_pixel_index = depth_y * depth_intrin.width;
+        for( int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index )
+        {
+            if( float depth = z_scale * z_pixels[depth_pixel_index] )
+            {
+                float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
+                rs2_deproject_pixel_to_point( depth_point, &depth_intrin, depth_pixel, depth );
+                rs2_transform_point_to_point( other_point, &depth_to_other, depth_point );
+                rs2_project_point_to_pixel( other_pixel, &other_intrin, other_point );
+                const int other_x0 = static_cast< int >( other_pixel[0] + 0.5f );
+                const int other_y0 = static_cast< int >( other_pixel[1] + 0.5f );
+
+                depth_pixel[0] = depth_x + 0.5f;
+                depth_pixel[1] = depth_y + 0.5f;
+                rs2_deproject_pixel_to_point( depth_point, &depth_intrin, depth_pixel, depth );
+                rs2_transform_point_to_point( other_point, &depth_to_other, depth_point );
+                rs2_project_point_to_pixel( other_pixel, &other_intrin, other_point );
+                const int other_x1 = static_cast< int >( other_pixel[0] + 0.5f );
+                const int other_y1 = static_cast< int >( other_pixel[1] + 0.5f );
+
+                if( other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height )
+                    continue;
+                for( int y = other_y0; y <= other_y1; ++y )
+                    for( int x = other_x0; x <= other_x1; ++x )
+                        transfer_pixel( depth_pixel_index, y * other_intrin.width + x );
+            }
+        }
+    }
+}
+
+// The rectangles of the depth pixels through the ray tables, emptied where align skips them
+struct rectangles
+{
+    std::vector< int2 > top_left, bottom_right;
+
+    rectangles( const rs2_intrinsics & depth, const std::vector< uint16_t > & z_pixels, float z_scale,
+                const rs2_intrinsics & other, bool skip_outside )
+    {
+        size_t const pixels = depth.width * depth.height;
+        std::vector< float > x0( pixels ), y0( pixels ), x1( pixels ), y1( pixels );
+        compute_pixel_rays( depth, x0.data(), y0.data(), -0.5f );
+        compute_pixel_rays( depth, x1.data(), y1.data(), 0.5f );
+        top_left.resize( pixels );
+        bottom_right.resize( pixels );
+        map_depth_pixels( top_left.data(), z_pixels.data(), z_scale, x0.data(), y0.data(), depth_to_other, other, 0, pixels );
+        map_depth_pixels( bottom_right.data(), z_pixels.data(), z_scale, x1.data(), y1.data(), depth_to_other, other, 0, pixels );
+        for( size_t i = 0; skip_outside && i < pixels; ++i )
+            if( z_pixels[i] && ( top_left[i].x < 0 || top_left[i].y < 0 || bottom_right[i].x >= other.width
+                                 || bottom_right[i].y >= other.height ) )
+                bottom_right[i] = { -1, -1 };
+    }
+};
+
+static rs2_distortion const models[] = { RS2_DISTORTION_NONE,
+                                         RS2_DISTORTION_BROWN_CONRADY,
+                                         RS2_DISTORTION_INVERSE_BROWN_CONRADY };
+
+static std::pair< int, int > const other_sizes[] = { { 160, 90 }, { 424, 240 }, { 640, 360 } };
+
+TEST_CASE( "depth aligned through the tables is identical to the per-pixel align", "[align]" )
+{
+    worker_pool pool( 3 );
+    float const z_scale = 0.001f;
+    for( auto model : models )
+        for( auto size : other_sizes )
+        {
+            CAPTURE( model, size.first );
+            auto const depth = make_depth_intrinsics( model );
+            auto const other = make_other_intrinsics( size.first, size.second );
+            auto const z_pixels = make_depth( depth.width * depth.height, unsigned( model ) );
+
+            std::vector< uint16_t > expected( other.width * other.height, 0 );
+            align_images( depth, z_pixels.data(), z_scale, other, [&]( int z, int o )
+            {
+                expected[o] = expected[o] ? std::min( expected[o], z_pixels[z] ) : z_pixels[z];
+            } );
+
+            rectangles r( depth, z_pixels, z_scale, other, true );
+            for( int max_threads : { 0, 1, 2 } )
+            {
+                CAPTURE( max_threads );
+                std::vector< uint16_t > aligned( other.width * other.height, 0 );
+                scatter_depth_to_other( pool, max_threads, aligned.data(), other, z_pixels.data(), depth,
+                                        r.top_left.data(), r.bottom_right.data() );
+                CHECK( aligned == expected );
+            }
+        }
+}
+
+template< int N >
+static void check_gather( rs2_format format )
+{
+    worker_pool pool( 3 );
+    float const z_scale = 0.001f;
+    std::mt19937 gen( N );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    for( auto model : models )
+        for( auto size : other_sizes )
+        {
+            CAPTURE( model, size.first );
+            auto const depth = make_depth_intrinsics( model );
+            auto const other = make_other_intrinsics( size.first, size.second );
+            auto const z_pixels = make_depth( depth.width * depth.height, unsigned( model ) );
+            std::vector< uint8_t > source( other.width * other.height * N );
+            for( auto & b : source )
+                b = uint8_t( byte( gen ) );
+
+            std::vector< uint8_t > expected( depth.width * depth.height * N, 0 );
+            align_images( depth, z_pixels.data(), z_scale, other, [&]( int z, int o )
+            {
+                std::copy( &source[o * N], &source[o * N] + N, &expected[z * N] );
+            } );
+
+            rectangles r( depth, z_pixels, z_scale, other, true );
+            for( int max_threads : { 0, 1, 2 } )
+            {
+                CAPTURE( max_threads );
+                std::vector< uint8_t > aligned( expected.size(), 0 );
+                gather_other_to_depth( pool, max_threads, aligned.data(), source.data(), format, N, other,
+                                       z_pixels.data(), depth, r.top_left.data(), r.bottom_right.data() );
+                CHECK( aligned == expected );
+            }
+        }
+}
+
+TEST_CASE( "other streams aligned through the tables are identical to the per-pixel align", "[align]" )
+{
+    check_gather< 1 >( RS2_FORMAT_Y8 );
+    check_gather< 2 >( RS2_FORMAT_Y16 );
+    check_gather< 3 >( RS2_FORMAT_RGB8 );
+    check_gather< 4 >( RS2_FORMAT_BGRA8 );
+}
+
+TEST_CASE( "rectangles partly outside the other image are clipped", "[align]" )
+{
+    // As the SSE and NEON versions map them, without skipping the depth pixels whose rectangle is partly outside
+    worker_pool pool( 3 );
+    float const z_scale = 0.001f;
+    auto const depth = make_depth_intrinsics( RS2_DISTORTION_NONE );
+    auto const other = make_other_intrinsics( 424, 240 );
+    auto const z_pixels = make_depth( depth.width * depth.height, 7 );
+    rectangles r( depth, z_pixels, z_scale, other, false );
+
+    std::vector< uint16_t > expected_z( other.width * other.height, 0 );
+    std::vector< uint16_t > source( other.width * other.height );
+    std::iota( source.begin(), source.end(), uint16_t( 1 ) );
+    std::vector< uint16_t > expected_other( depth.width * depth.height, 0 );
+    for( int i = 0; i < depth.width * depth.height; ++i )
+    {
+        if( ! z_pixels[i] )
+            continue;
+        for( int y = r.top_left[i].y; y <= r.bottom_right[i].y; ++y )
+            for( int x = r.top_left[i].x; x <= r.bottom_right[i].x; ++x )
+            {
+                if( x < 0 || y < 0 || x >= other.width || y >= other.height )
+                    continue;
+                auto & d = expected_z[y * other.width + x];
+                d = d ? std::min( d, z_pixels[i] ) : z_pixels[i];
+                expected_other[i] = source[y * other.width + x];
+            }
+    }
+
+    std::vector< uint16_t > aligned_z( expected_z.size(), 0 );
+    scatter_depth_to_other( pool, 0, aligned_z.data(), other, z_pixels.data(), depth, r.top_left.data(),
+                            r.bottom_right.data() );
+    CHECK( aligned_z == expected_z );
+
+    std::vector< uint16_t > aligned_other( expected_other.size(), 0 );
+    gather_other_to_depth( pool, 0, reinterpret_cast< uint8_t * >( aligned_other.data() ),
+                           reinterpret_cast< const uint8_t * >( source.data() ), RS2_FORMAT_Z16, 2, other,
+                           z_pixels.data(), depth, r.top_left.data(), r.bottom_right.data() );
+    CHECK( aligned_other == expected_other );
+}
+
+TEST_CASE( "YUYV keeps the chroma of each pixel's own position", "[align]" )
+{
+    worker_pool pool( 3 );
+    float const z_scale = 0.001f;
+    auto const depth = make_depth_intrinsics( RS2_DISTORTION_NONE );
+    auto const other = make_other_intrinsics( 640, 360 );
+    auto const z_pixels = make_depth( depth.width * depth.height, 3 );
+    rectangles r( depth, z_pixels, z_scale, other, true );
+
+    // Each pixel holds its index in its luma, and its pair holds U and V values that tell them apart
+    std::vector< uint8_t > source( other.width * other.height * 2 );
+    for( size_t i = 0; i < source.size() / 2; ++i )
+    {
+        source[2 * i] = uint8_t( i );
+        source[2 * i + 1] = uint8_t( ( i & 1 ) ? 200 : 100 );
+    }
+
+    // Luma is copied as the whole pixels would be
+    std::vector< uint8_t > whole( depth.width * depth.height * 2, 0 );
+    gather_other_to_depth( pool, 0, whole.data(), source.data(), RS2_FORMAT_RAW16, 2, other, z_pixels.data(), depth,
+                           r.top_left.data(), r.bottom_right.data() );
+
+    std::vector< uint8_t > yuyv( whole.size(), 0 );
+    gather_other_to_depth( pool, 0, yuyv.data(), source.data(), RS2_FORMAT_YUYV, 2, other, z_pixels.data(), depth,
+                           r.top_left.data(), r.bottom_right.data() );
+    int copied = 0;
+    for( size_t i = 0; i < whole.size() / 2; ++i )
+    {
+        CHECK( yuyv[2 * i] == whole[2 * i] );
+        if( whole[2 * i + 1] )
+        {
+            CHECK( yuyv[2 * i + 1] == ( ( i & 1 ) ? 200 : 100 ) );
+            ++copied;
+        }
+    }
+    CHECK( copied > 0 );
+}
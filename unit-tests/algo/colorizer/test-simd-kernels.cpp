@@ -0,0 +1,125 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/colorizer.h>
+#include <src/proc/sse/sse-colorizer.h>
+#include <src/proc/sse/avx-colorizer.h>
+#include <src/proc/neon/neon-colorizer.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// Not a multiple of 16, so the SIMD kernels leave a tail to the scalar one
+static size_t const pixels = 641 * 37;
+
+static std::vector< uint16_t > make_depth( unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > z( 0, 65535 );
+    std::uniform_int_distribution< int > near( 300, 3000 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< uint16_t > depth( pixels );
+    for( auto & d : depth )
+    {
+        auto k = kind( gen );
+        d = uint16_t( k < 20 ? 0 : k < 80 ? near( gen ) : z( gen ) );
+    }
+    return depth;
+}
+
+static color_map const jet{ { { 0, 0, 255 }, { 0, 255, 255 }, { 255, 255, 0 }, { 255, 0, 0 }, { 50, 0, 0 } } };
+
+// What colorizer::colorize_pixel() writes
+template< class F >
+static std::vector< uint8_t > colorize_per_pixel( std::vector< uint16_t > const & depth, F coloring_func )
+{
+    std::vector< uint8_t > rgb( depth.size() * 3 );
+    for( size_t i = 0; i < depth.size(); ++i )
+    {
+        if( ! depth[i] )
+            continue;
+        auto c = jet.get( coloring_func( depth[i] ) );
+        rgb[i * 3 + 0] = (uint8_t)c.x;
+        rgb[i * 3 + 1] = (uint8_t)c.y;
+        rgb[i * 3 + 2] = (uint8_t)c.z;
+    }
+    return rgb;
+}
+
+template< class F >
+static std::vector< uint8_t > colorize_through_lut( std::vector< uint16_t > const & depth, F coloring_func )
+{
+    std::vector< uint32_t > lut( colorizer::MAX_DEPTH );
+    colorizer::make_lut( lut.data(), jet, coloring_func, 0, colorizer::MAX_DEPTH );
+    std::vector< uint8_t > rgb( depth.size() * 3 );
+    colorize_depth_pixels( rgb.data(), depth.data(), lut.data(), 0, depth.size() );
+    return rgb;
+}
+
+TEST_CASE( "colors from the lookup table are those of each pixel", "[colorizer]" )
+{
+    auto const depth = make_depth( 1 );
+
+    std::vector< int > hist( colorizer::MAX_DEPTH );
+    colorizer::update_histogram( hist.data(), depth.data(), int( pixels ), 1 );
+    auto equalized = [&]( float data ) {
+        return hist[(int)data] / (float)hist[colorizer::MAX_DEPTH - 1];
+    };
+    CHECK( colorize_through_lut( depth, equalized ) == colorize_per_pixel( depth, equalized ) );
+
+    float const depth_units = 0.001f;
+    for( float max : { 6.f, 1.5f, 0.2f } )
+    {
+        CAPTURE( max );
+        float const min = 0.3f;
+        auto cropped = [&]( float data ) {
+            if( min >= max )
+                return 0.f;
+            return ( data * depth_units - min ) / ( max - min );
+        };
+        CHECK( colorize_through_lut( depth, cropped ) == colorize_per_pixel( depth, cropped ) );
+    }
+}
+
+// Runs a SIMD kernel over the whole multiple of 16 pixels, and the scalar one over the rest
+template< class KERNEL >
+static void check_kernel( KERNEL kernel )
+{
+    std::mt19937 gen( 2 );
+    std::vector< uint32_t > lut( colorizer::MAX_DEPTH );
+    for( auto & c : lut )
+        c = gen() & 0xffffff;
+    auto const depth = make_depth( 3 );
+
+    std::vector< uint8_t > scalar( pixels * 3 ), simd( pixels * 3 );
+    colorize_depth_pixels( scalar.data(), depth.data(), lut.data(), 0, pixels );
+    size_t const end = pixels / 16 * 16;
+    kernel( simd.data(), depth.data(), lut.data(), 0, end );
+    colorize_depth_pixels( simd.data(), depth.data(), lut.data(), end, pixels );
+    CHECK( scalar == simd );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD colorizing is identical to scalar", "[colorizer]" )
+{
+    check_kernel( SIMD( colorize_depth_pixels ) );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 colorizing is identical to scalar", "[colorizer]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernel( colorize_depth_pixels_avx2 );
+}
+
+#endif
@@ -0,0 +1,121 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/decimation-filter.h>
+#include <src/proc/sse/sse-decimation-filter.h>
+#include <src/proc/sse/avx-decimation-filter.h>
+#include <src/proc/neon/neon-decimation-filter.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace librealsense;
+
+// Odd sizes, so no scale divides them and the SIMD kernels leave a tail to the scalar one
+static size_t const width = 647;
+static size_t const height = 43;
+
+// Depth with holes, either anywhere in the range or in a narrow one where many values are equal
+static std::vector< uint16_t > make_depth( unsigned seed, int hole_percent, int range )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > z( 65535 - range, 65535 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< uint16_t > depth( width * height );
+    for( auto & d : depth )
+        d = uint16_t( kind( gen ) < hole_percent ? 0 : z( gen ) );
+    return depth;
+}
+
+// What decimate_depth_pixels() is documented to compute
+static uint16_t expected_pixel( std::vector< uint16_t > const & depth, size_t scale, size_t u, size_t v )
+{
+    std::vector< uint16_t > valid;
+    for( size_t y = v * scale; y < ( v + 1 ) * scale; ++y )
+        for( size_t x = u * scale; x < ( u + 1 ) * scale; ++x )
+            if( depth[y * width + x] )
+                valid.push_back( depth[y * width + x] );
+    if( valid.empty() )
+        return 0;
+    if( scale == 2 || scale == 3 )
+    {
+        std::sort( valid.begin(), valid.end() );
+        return valid[( valid.size() - 1 ) / 2];
+    }
+    int sum = 0;
+    for( auto d : valid )
+        sum += d;
+    return uint16_t( sum / int( valid.size() ) );
+}
+
+TEST_CASE( "decimation picks the median or the mean of the valid pixels", "[decimation]" )
+{
+    for( size_t scale = 1; scale <= 8; ++scale )
+        for( int holes : { 0, 30, 80 } )
+        {
+            CAPTURE( scale, holes );
+            auto const depth = make_depth( unsigned( scale ), holes, holes == 30 ? 3 : 65535 );
+            size_t const width_out = width / scale;
+            std::vector< uint16_t > out( width_out );
+            for( size_t v = 0; v < height / scale; ++v )
+            {
+                decimate_depth_pixels( depth.data() + v * scale * width, width, out.data(), scale, 0, width_out );
+                for( size_t u = 0; u < width_out; ++u )
+                {
+                    CAPTURE( u, v );
+                    REQUIRE( out[u] == expected_pixel( depth, scale, u, v ) );
+                }
+            }
+        }
+}
+
+// Runs a SIMD kernel over as many whole groups of 'lanes' pixels as fit in each row, and the scalar one over the rest
+template< class MEDIAN, class MEAN >
+static void check_kernels( MEDIAN median, MEAN mean, size_t lanes )
+{
+    for( size_t scale = 2; scale <= 8; ++scale )
+        for( int holes : { 0, 30, 80, 100 } )
+            for( int range : { 3, 65535 } )
+            {
+                CAPTURE( scale, holes, range );
+                auto const depth = make_depth( unsigned( scale * holes + range ), holes, range );
+                size_t const width_out = width / scale;
+                size_t const end = width_out / lanes * lanes;
+                std::vector< uint16_t > scalar( width_out ), simd( width_out );
+                for( size_t v = 0; v < height / scale; ++v )
+                {
+                    auto in = depth.data() + v * scale * width;
+                    decimate_depth_pixels( in, width, scalar.data(), scale, 0, width_out );
+                    if( scale <= 3 )
+                        median( in, width, simd.data(), scale, 0, end );
+                    else
+                        mean( in, width, simd.data(), scale, 0, end );
+                    decimate_depth_pixels( in, width, simd.data(), scale, end, width_out );
+                    CAPTURE( v );
+                    REQUIRE( scalar == simd );
+                }
+            }
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD decimation is identical to scalar", "[decimation]" )
+{
+    check_kernels( SIMD( decimate_depth_median ), SIMD( decimate_depth_mean ), 8 );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 decimation is identical to scalar", "[decimation]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernels( decimate_depth_median_avx2, decimate_depth_mean_avx2, 16 );
+}
+
+#endif
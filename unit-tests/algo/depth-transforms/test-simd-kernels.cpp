@@ -0,0 +1,168 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/threshold.h>
+#include <src/proc/units-transform.h>
+#include <src/proc/disparity-transform.h>
+#include <src/proc/sse/sse-depth-transforms.h>
+#include <src/proc/sse/avx-depth-transforms.h>
+#include <src/proc/neon/neon-depth-transforms.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace librealsense;
+
+// No whole number of SIMD groups: the kernels leave a tail to the scalar one
+static size_t const count = 1003;
+
+static float const units = 0.001f;
+static float const min_distance = 0.1f, max_distance = 4.f;
+static float const d2d_convert_factor = 1e6f;
+
+typedef void ( *threshold_function )( const uint16_t *, uint16_t *, float, float, float, size_t, size_t );
+typedef void ( *units_function )( const uint16_t *, float *, float, size_t, size_t );
+typedef void ( *to_depth_function )( const float *, uint16_t *, float, size_t, size_t );
+
+// Random depth, a tenth of it 0 and a tenth around each threshold
+static std::vector< uint16_t > make_depth( std::mt19937 & gen )
+{
+    std::uniform_int_distribution< int > value( 0, 0xFFFF );
+    std::uniform_int_distribution< int > offset( -2, 2 );
+    std::vector< uint16_t > depth( count );
+    for( auto & d : depth )
+    {
+        switch( value( gen ) % 10 )
+        {
+        case 0: d = 0; break;
+        case 1: d = uint16_t( 100 + offset( gen ) ); break;
+        case 2: d = uint16_t( 4000 + offset( gen ) ); break;
+        default: d = uint16_t( value( gen ) );
+        }
+    }
+    return depth;
+}
+
+// Random disparities whose depth fits 16 bits, a fifth of them 0, denormal, infinite or NaN
+static std::vector< float > make_disparity( std::mt19937 & gen )
+{
+    std::uniform_real_distribution< float > value( 16.f, 4000.f );
+    std::uniform_int_distribution< int > kind( 0, 24 );
+    std::vector< float > disparity( count );
+    for( auto & d : disparity )
+    {
+        switch( kind( gen ) )
+        {
+        case 0: d = 0; break;
+        case 1: d = std::numeric_limits< float >::denorm_min(); break;
+        case 2: d = std::numeric_limits< float >::min() / 2; break;
+        case 3: d = std::numeric_limits< float >::infinity(); break;
+        case 4: d = std::numeric_limits< float >::quiet_NaN(); break;
+        default: d = value( gen );
+        }
+    }
+    return disparity;
+}
+
+// Each check runs a SIMD kernel over as many whole groups of 'lanes' pixels as fit, and the scalar one over the rest
+static void check_kernel( threshold_function simd, size_t lanes )
+{
+    std::mt19937 gen( static_cast< unsigned >( lanes ) );
+    auto depth = make_depth( gen );
+
+    std::vector< uint16_t > out( count ), simd_out( count );
+    threshold_depth_pixels( depth.data(), out.data(), units, min_distance, max_distance, 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( depth.data(), simd_out.data(), units, min_distance, max_distance, 0, end );
+    threshold_depth_pixels( depth.data(), simd_out.data(), units, min_distance, max_distance, end, count );
+    CHECK( out == simd_out );
+
+    // In place, as threshold_filter does with frames nothing else holds
+    simd( depth.data(), depth.data(), units, min_distance, max_distance, 0, end );
+    threshold_depth_pixels( depth.data(), depth.data(), units, min_distance, max_distance, end, count );
+    CHECK( depth == out );
+}
+
+static void check_kernel( units_function simd, size_t lanes )
+{
+    std::mt19937 gen( static_cast< unsigned >( lanes ) );
+    auto depth = make_depth( gen );
+
+    std::vector< float > out( count ), simd_out( count );
+    depth_to_meters_pixels( depth.data(), out.data(), units, 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( depth.data(), simd_out.data(), units, 0, end );
+    depth_to_meters_pixels( depth.data(), simd_out.data(), units, end, count );
+    CHECK( std::memcmp( out.data(), simd_out.data(), count * sizeof( float ) ) == 0 );
+}
+
+static void check_kernel( to_depth_function simd, size_t lanes )
+{
+    std::mt19937 gen( static_cast< unsigned >( lanes ) );
+    auto disparity = make_disparity( gen );
+
+    std::vector< uint16_t > out( count ), simd_out( count );
+    disparity_to_depth_pixels( disparity.data(), out.data(), d2d_convert_factor, 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( disparity.data(), simd_out.data(), d2d_convert_factor, 0, end );
+    disparity_to_depth_pixels( disparity.data(), simd_out.data(), d2d_convert_factor, end, count );
+    CHECK( out == simd_out );
+}
+
+TEST_CASE( "Threshold keeps the depth between its distances", "[depth-transforms]" )
+{
+    uint16_t const depth[] = { 0, 99, 100, 2000, 4000, 4001 };
+    uint16_t out[6];
+    threshold_depth_pixels( depth, out, units, min_distance, max_distance, 0, 6 );
+    CHECK( std::vector< uint16_t >( out, out + 6 ) == std::vector< uint16_t >{ 0, 0, 100, 2000, 4000, 0 } );
+}
+
+TEST_CASE( "Disparity reciprocals are the divisions they replace", "[depth-transforms]" )
+{
+    std::vector< float > reciprocals( 0x10000 );
+    fill_disparity_reciprocals( reciprocals.data(), d2d_convert_factor );
+
+    std::vector< uint16_t > depth( 0x10000 );
+    for( size_t z = 0; z < depth.size(); z++ )
+        depth[z] = uint16_t( z );
+    std::vector< float > disparity( depth.size() );
+    depth_to_disparity_pixels( depth.data(), disparity.data(), reciprocals.data(), 0, depth.size() );
+
+    CHECK( disparity[0] == 0 );
+    for( size_t z = 1; z < depth.size(); z++ )
+        CHECK( disparity[z] == d2d_convert_factor / float( z ) );
+
+    // And back, to the same depth wherever the division is exact enough
+    std::vector< uint16_t > back( depth.size() );
+    disparity_to_depth_pixels( disparity.data(), back.data(), d2d_convert_factor, 0, depth.size() );
+    for( size_t z = 0; z < 1000; z++ )
+        CHECK( back[z] == depth[z] );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD depth transforms are identical to scalar", "[depth-transforms]" )
+{
+    check_kernel( SIMD( threshold_depth_pixels ), 8 );
+    check_kernel( SIMD( depth_to_meters_pixels ), 8 );
+    check_kernel( SIMD( disparity_to_depth_pixels ), 8 );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 depth transforms are identical to scalar", "[depth-transforms]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernel( threshold_depth_pixels_avx2, 16 );
+    check_kernel( depth_to_meters_pixels_avx2, 16 );
+    check_kernel( disparity_to_depth_pixels_avx2, 16 );
+}
+
+#endif
@@ -0,0 +1,124 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/hdr-merge.h>
+#include <src/proc/sse/sse-hdr-merge.h>
+#include <src/proc/sse/avx-hdr-merge.h>
+#include <src/proc/neon/neon-hdr-merge.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// No whole number of SIMD groups: the kernels leave a tail to the scalar one
+static size_t const count = 1003;
+
+// The IR thresholds of hdr_merge
+static int const y8_min = 5, y8_max = 250;
+static int const y16_min = 20, y16_max = 1003;
+
+typedef void ( *depth_function )( const uint16_t *, const uint16_t *, uint16_t *, size_t, size_t );
+
+template< class T >
+using ir_function = void ( * )( const uint16_t *, const uint16_t *, const T *, const T *, int, int, uint16_t *, size_t, size_t );
+
+// Random depth, a third of it 0
+static std::vector< uint16_t > make_depth( std::mt19937 & gen )
+{
+    std::uniform_int_distribution< int > value( 0, 0xFFFF );
+    std::vector< uint16_t > depth( count );
+    for( auto & d : depth )
+        d = value( gen ) % 3 ? uint16_t( value( gen ) ) : 0;
+    return depth;
+}
+
+// Random IR, half of it around the thresholds
+template< class T >
+static std::vector< T > make_ir( std::mt19937 & gen, int ir_min, int ir_max )
+{
+    std::uniform_int_distribution< int > value( 0, std::numeric_limits< T >::max() );
+    std::uniform_int_distribution< int > offset( -2, 2 );
+    std::vector< T > ir( count );
+    for( auto & v : ir )
+    {
+        switch( value( gen ) % 4 )
+        {
+        case 0: v = T( ir_min + offset( gen ) ); break;
+        case 1: v = T( ir_max + offset( gen ) ); break;
+        default: v = T( value( gen ) );
+        }
+    }
+    return ir;
+}
+
+// Runs a SIMD kernel over as many whole groups of 'lanes' pixels as fit, and the scalar one over the rest
+static void check_kernel( depth_function simd, size_t lanes )
+{
+    std::mt19937 gen( static_cast< unsigned >( lanes ) );
+    auto d0 = make_depth( gen ), d1 = make_depth( gen );
+
+    std::vector< uint16_t > out( count ), simd_out( count );
+    hdr_merge_depth_pixels( d0.data(), d1.data(), out.data(), 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( d0.data(), d1.data(), simd_out.data(), 0, end );
+    hdr_merge_depth_pixels( d0.data(), d1.data(), simd_out.data(), end, count );
+    CHECK( out == simd_out );
+}
+
+template< class T >
+static void check_kernel( ir_function< T > simd, int ir_min, int ir_max, size_t lanes )
+{
+    std::mt19937 gen( unsigned( sizeof( T ) * lanes ) );
+    auto d0 = make_depth( gen ), d1 = make_depth( gen );
+    auto ir0 = make_ir< T >( gen, ir_min, ir_max ), ir1 = make_ir< T >( gen, ir_min, ir_max );
+
+    std::vector< uint16_t > out( count ), simd_out( count );
+    hdr_merge_ir_pixels( d0.data(), d1.data(), ir0.data(), ir1.data(), ir_min, ir_max, out.data(), 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( d0.data(), d1.data(), ir0.data(), ir1.data(), ir_min, ir_max, simd_out.data(), 0, end );
+    hdr_merge_ir_pixels( d0.data(), d1.data(), ir0.data(), ir1.data(), ir_min, ir_max, simd_out.data(), end, count );
+    CHECK( out == simd_out );
+}
+
+TEST_CASE( "HDR merge takes the first valid depth", "[hdr-merge]" )
+{
+    uint16_t const d0[] = { 10, 0, 0, 10, 10, 10 };
+    uint16_t const d1[] = { 20, 20, 0, 20, 20, 0 };
+    uint8_t const ir0[] = { 100, 100, 100, 5, 250, 5 };
+    uint8_t const ir1[] = { 100, 100, 100, 6, 249, 100 };
+    uint16_t out[6];
+
+    hdr_merge_depth_pixels( d0, d1, out, 0, 6 );
+    CHECK( std::vector< uint16_t >( out, out + 6 ) == std::vector< uint16_t >{ 10, 20, 0, 10, 10, 10 } );
+
+    // Saturated IR in the first frame falls back to the second, whose depth may be 0 too
+    hdr_merge_ir_pixels( d0, d1, ir0, ir1, y8_min, y8_max, out, 0, 6 );
+    CHECK( std::vector< uint16_t >( out, out + 6 ) == std::vector< uint16_t >{ 10, 20, 0, 20, 20, 0 } );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD HDR merge is identical to scalar", "[hdr-merge]" )
+{
+    check_kernel( SIMD( hdr_merge_depth_pixels ), 8 );
+    check_kernel< uint8_t >( SIMD( hdr_merge_y8_pixels ), y8_min, y8_max, 8 );
+    check_kernel< uint16_t >( SIMD( hdr_merge_y16_pixels ), y16_min, y16_max, 8 );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 HDR merge is identical to scalar", "[hdr-merge]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernel( hdr_merge_depth_pixels_avx2, 16 );
+    check_kernel< uint8_t >( hdr_merge_y8_pixels_avx2, y8_min, y8_max, 16 );
+    check_kernel< uint16_t >( hdr_merge_y16_pixels_avx2, y16_min, y16_max, 16 );
+}
+
+#endif
@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/y8i-to-y8y8.h>
+#include <src/proc/y8i-to-y8y8-mipi.h>
+#include <src/proc/y12i-to-y16y16.h>
+#include <src/proc/y12i-to-y16y16-mipi.h>
+#include <src/proc/y16i-10msb-to-y16y16.h>
+#include <src/proc/sse/sse-interleaved-ir.h>
+#include <src/proc/sse/avx-interleaved-ir.h>
+#include <src/proc/neon/neon-interleaved-ir.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// Whole MIPI pairs, but no whole number of SIMD groups: the kernels leave a tail to the scalar one
+static size_t const count = 1002;
+
+template< class OUT >
+using split_function = void ( * )( const uint8_t *, OUT *, OUT *, size_t, size_t );
+
+// Runs a SIMD kernel over as many whole groups of 'lanes' pixels as fit, and the scalar one over the rest, on random
+// pixels of 'bytes_per_pixel'
+template< class OUT >
+static void check_kernel( split_function< OUT > scalar, split_function< OUT > simd, size_t bytes_per_pixel, size_t lanes )
+{
+    std::mt19937 gen( unsigned( bytes_per_pixel * lanes ) );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    std::vector< uint8_t > source( count * bytes_per_pixel );
+    for( auto & b : source )
+        b = uint8_t( byte( gen ) );
+
+    std::vector< OUT > left( count ), right( count ), simd_left( count ), simd_right( count );
+    scalar( source.data(), left.data(), right.data(), 0, count );
+    size_t const end = count / lanes * lanes;
+    simd( source.data(), simd_left.data(), simd_right.data(), 0, end );
+    scalar( source.data(), simd_left.data(), simd_right.data(), end, count );
+    CHECK( left == simd_left );
+    CHECK( right == simd_right );
+}
+
+TEST_CASE( "Y12I pixels are split into scaled left and right values", "[interleaved-ir]" )
+{
+    // Left 0x3FF in the high bits of the last two bytes, right 0x001 in the low bits of the first two
+    uint8_t const pixel[] = { 0x01, 0xF0, 0x3F };
+    uint16_t left, right;
+    split_y12i_pixels( pixel, &left, &right, 0, 1 );
+    CHECK( left == 0xFFFF );
+    CHECK( right == 0x0040 );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD interleaved IR splitting is identical to scalar", "[interleaved-ir]" )
+{
+    check_kernel< uint8_t >( split_y8i_pixels, SIMD( split_y8i_pixels ), 2, 16 );
+    check_kernel< uint8_t >( split_y8i_mipi_pixels, SIMD( split_y8i_mipi_pixels ), 2, 16 );
+    check_kernel< uint16_t >( split_y12i_pixels, SIMD( split_y12i_pixels ), 3, 16 );
+    check_kernel< uint16_t >( split_y12i_mipi_pixels, SIMD( split_y12i_mipi_pixels ), 4, 16 );
+    check_kernel< uint16_t >( split_y16i_10msb_pixels, SIMD( split_y16i_10msb_pixels ), 4, 8 );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 interleaved IR splitting is identical to scalar", "[interleaved-ir]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernel< uint8_t >( split_y8i_pixels, split_y8i_pixels_avx2, 2, 32 );
+    check_kernel< uint8_t >( split_y8i_mipi_pixels, split_y8i_mipi_pixels_avx2, 2, 32 );
+    check_kernel< uint16_t >( split_y12i_pixels, split_y12i_pixels_avx2, 3, 16 );
+    check_kernel< uint16_t >( split_y12i_mipi_pixels, split_y12i_mipi_pixels_avx2, 4, 16 );
+    check_kernel< uint16_t >( split_y16i_10msb_pixels, split_y16i_10msb_pixels_avx2, 4, 16 );
+}
+
+#endif
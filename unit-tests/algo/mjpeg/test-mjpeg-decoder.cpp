@@ -0,0 +1,257 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/mjpeg-decoder.h>
+
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include <third-party/stb_image.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// Writes baseline JPEGs of random blocks, each with a DC and three AC coefficients, with any sampling factors and
+// restart interval. stb_image_write can't do either.
+class jpeg_writer
+{
+public:
+    struct component
+    {
+        int h, v;
+    };
+
+    std::vector< uint8_t > write( int width, int height, std::vector< component > const & comps, int restart_interval,
+                                  unsigned seed, bool with_tables = true )
+    {
+        _out.clear();
+        put16( 0xFFD8 );
+
+        // A single quantization table, and Huffman tables with a code of 4 bits for every symbol
+        put16( 0xFFDB );
+        put16( 67 );
+        _out.push_back( 0 );
+        for( int i = 0; i < 64; ++i )
+            _out.push_back( uint8_t( 4 + i / 8 ) );
+        if( with_tables )
+        {
+            put16( 0xFFC4 );
+            put16( 2 + 2 * 17 + 12 + 9 );
+            _out.push_back( 0x00 );    // DC: sizes 0-11
+            put_counts( 12 );
+            for( int i = 0; i < 12; ++i )
+                _out.push_back( uint8_t( i ) );
+            _out.push_back( 0x10 );    // AC: EOB and run 0 with sizes 1-8
+            put_counts( 9 );
+            for( int i = 0; i < 9; ++i )
+                _out.push_back( uint8_t( i ) );
+        }
+
+        put16( 0xFFC0 );
+        put16( uint16_t( 8 + 3 * comps.size() ) );
+        _out.push_back( 8 );
+        put16( uint16_t( height ) );
+        put16( uint16_t( width ) );
+        _out.push_back( uint8_t( comps.size() ) );
+        int h_max = 1, v_max = 1;
+        for( size_t i = 0; i < comps.size(); ++i )
+        {
+            _out.push_back( uint8_t( i + 1 ) );
+            _out.push_back( uint8_t( comps[i].h << 4 | comps[i].v ) );
+            _out.push_back( 0 );
+            h_max = std::max( h_max, comps[i].h );
+            v_max = std::max( v_max, comps[i].v );
+        }
+
+        if( restart_interval )
+        {
+            put16( 0xFFDD );
+            put16( 4 );
+            put16( uint16_t( restart_interval ) );
+        }
+
+        put16( 0xFFDA );
+        put16( uint16_t( 6 + 2 * comps.size() ) );
+        _out.push_back( uint8_t( comps.size() ) );
+        for( size_t i = 0; i < comps.size(); ++i )
+        {
+            _out.push_back( uint8_t( i + 1 ) );
+            _out.push_back( 0x00 );
+        }
+        _out.push_back( 0 );
+        _out.push_back( 63 );
+        _out.push_back( 0 );
+
+        // A single component is not interleaved: every block is an MCU
+        int mcus_x, mcus_y;
+        if( comps.size() == 1 )
+            mcus_x = ( width + 7 ) / 8, mcus_y = ( height + 7 ) / 8;
+        else
+            mcus_x = ( width + 8 * h_max - 1 ) / ( 8 * h_max ), mcus_y = ( height + 8 * v_max - 1 ) / ( 8 * v_max );
+
+        std::mt19937 gen( seed );
+        std::vector< int > dc( comps.size() );
+        _bits = _n_bits = 0;
+        int restarts = 0;
+        for( int m = 0; m < mcus_x * mcus_y; ++m )
+        {
+            if( restart_interval && m && m % restart_interval == 0 )
+            {
+                flush();
+                put16( uint16_t( 0xFFD0 + restarts++ % 8 ) );
+                std::fill( dc.begin(), dc.end(), 0 );
+            }
+            for( size_t i = 0; i < comps.size(); ++i )
+            {
+                int const blocks = comps.size() == 1 ? 1 : comps[i].h * comps[i].v;
+                for( int b = 0; b < blocks; ++b )
+                {
+                    int const value = std::uniform_int_distribution< int >( -120, 120 )( gen );
+                    put_coefficient( value - dc[i] );
+                    dc[i] = value;
+                    for( int k = 0; k < 3; ++k )
+                    {
+                        int const ac = std::uniform_int_distribution< int >( -20, 20 )( gen ) | 1;
+                        put_coefficient( ac );
+                    }
+                    put_bits( 0, 4 );    // EOB
+                }
+            }
+        }
+        flush();
+        put16( 0xFFD9 );
+        return _out;
+    }
+
+private:
+    void put16( uint16_t x )
+    {
+        _out.push_back( uint8_t( x >> 8 ) );
+        _out.push_back( uint8_t( x ) );
+    }
+
+    void put_counts( int n_codes )
+    {
+        for( int length = 1; length <= 16; ++length )
+            _out.push_back( uint8_t( length == 4 ? n_codes : 0 ) );
+    }
+
+    void put_bits( uint32_t code, int n )
+    {
+        _bits = _bits << n | ( code & ( ( 1u << n ) - 1 ) );
+        _n_bits += n;
+        while( _n_bits >= 8 )
+        {
+            uint8_t const byte = uint8_t( _bits >> ( _n_bits - 8 ) );
+            _out.push_back( byte );
+            if( byte == 0xFF )
+                _out.push_back( 0 );
+            _n_bits -= 8;
+        }
+    }
+
+    // The symbol of a DC coefficient is its size; AC ones are preceded by no zeros, so their symbol is also the size
+    void put_coefficient( int value )
+    {
+        int size = 0;
+        while( ( std::abs( value ) >> size ) != 0 )
+            ++size;
+        put_bits( size, 4 );
+        if( size )
+            put_bits( uint32_t( value > 0 ? value : value - 1 ), size );
+    }
+
+    void flush()
+    {
+        if( _n_bits )
+            put_bits( 0x7F, 8 - _n_bits );
+    }
+
+    std::vector< uint8_t > _out;
+    uint32_t _bits;
+    int _n_bits;
+};
+
+static int bytes_per_pixel( rs2_format format )
+{
+    return format == RS2_FORMAT_Y8 ? 1 : ( format == RS2_FORMAT_RGB8 || format == RS2_FORMAT_BGR8 ) ? 3 : 4;
+}
+
+// What stb_image decodes, in 'format'
+static std::vector< uint8_t > reference( std::vector< uint8_t > const & jpeg, rs2_format format )
+{
+    int const n = bytes_per_pixel( format );
+    int w, h, comp;
+    auto pixels = stbi_load_from_memory( jpeg.data(), int( jpeg.size() ), &w, &h, &comp, n );
+    REQUIRE( pixels );
+    std::vector< uint8_t > image( pixels, pixels + w * h * n );
+    stbi_image_free( pixels );
+    if( format == RS2_FORMAT_BGR8 || format == RS2_FORMAT_BGRA8 )
+        for( size_t i = 0; i < image.size(); i += n )
+            std::swap( image[i], image[i + 2] );
+    return image;
+}
+
+static rs2_format const formats[]
+    = { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8 };
+
+TEST_CASE( "MJPEG decoding is identical to stb_image", "[mjpeg]" )
+{
+    std::vector< std::vector< jpeg_writer::component > > const samplings = {
+        { { 2, 2 }, { 1, 1 }, { 1, 1 } },    // 4:2:0
+        { { 2, 1 }, { 1, 1 }, { 1, 1 } },    // 4:2:2
+        { { 1, 1 }, { 1, 1 }, { 1, 1 } },    // 4:4:4
+        { { 1, 1 } },                        // Grayscale
+    };
+
+    jpeg_writer writer;
+    mjpeg_decoder decoder;
+    for( size_t s = 0; s < samplings.size(); ++s )
+        for( int restart_interval : { 0, 1, 3, 7 } )
+        {
+            // Odd sizes leave partial MCUs, and some intervals end mid-row
+            int const width = 150, height = 91;
+            auto const jpeg = writer.write( width, height, samplings[s], restart_interval, unsigned( s ) );
+            for( auto format : formats )
+                for( int max_threads : { 0, 1 } )
+                {
+                    CAPTURE( s, restart_interval, format, max_threads );
+                    auto const expected = reference( jpeg, format );
+                    std::vector< uint8_t > image( expected.size() + 1, 0xAB );
+                    REQUIRE( decoder.decode( jpeg.data(), jpeg.size(), format, image.data(), width, height, max_threads ) );
+                    CHECK( image.back() == 0xAB );
+                    image.pop_back();
+                    CHECK( image == expected );
+                }
+        }
+}
+
+TEST_CASE( "MJPEG frames without Huffman tables reuse the previous ones", "[mjpeg]" )
+{
+    std::vector< jpeg_writer::component > const comps = { { 2, 1 }, { 1, 1 }, { 1, 1 } };
+    jpeg_writer writer;
+    mjpeg_decoder decoder;
+    int const width = 64, height = 48;
+    std::vector< uint8_t > image( width * height * 3 );
+
+    auto const first = writer.write( width, height, comps, 4, 1 );
+    REQUIRE( decoder.decode( first.data(), first.size(), RS2_FORMAT_RGB8, image.data(), width, height ) );
+
+    auto const with_tables = writer.write( width, height, comps, 4, 2 );
+    auto const without_tables = writer.write( width, height, comps, 4, 2, false );
+    REQUIRE( decoder.decode( without_tables.data(), without_tables.size(), RS2_FORMAT_RGB8, image.data(), width, height ) );
+    CHECK( image == reference( with_tables, RS2_FORMAT_RGB8 ) );
+}
+
+TEST_CASE( "MJPEG decoding fails on images of another width", "[mjpeg]" )
+{
+    jpeg_writer writer;
+    mjpeg_decoder decoder;
+    auto const jpeg = writer.write( 64, 48, { { 1, 1 }, { 1, 1 }, { 1, 1 } }, 0, 1 );
+    std::vector< uint8_t > image( 128 * 48 * 3 );
+    CHECK( ! decoder.decode( jpeg.data(), jpeg.size(), RS2_FORMAT_RGB8, image.data(), 128, 48 ) );
+    CHECK( ! decoder.decode( jpeg.data(), jpeg.size() / 4, RS2_FORMAT_Z16, image.data(), 64, 48 ) );
+}
@@ -0,0 +1,97 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/motion-transform.h>
+#include <src/proc/sse/sse-motion-transform.h>
+#include <src/proc/neon/neon-motion-transform.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <random>
+
+using namespace librealsense;
+
+#if defined( __SSSE3__ )
+#define SIMD( kernel ) kernel##_sse
+#elif defined( __ARM_NEON ) && defined( BUILD_WITH_NEON ) && ! defined( ANDROID )
+#define SIMD( kernel ) kernel##_neon
+#endif
+
+// No whole number of SIMD groups: the kernels leave a tail to the scalar one
+static size_t const count = 83;
+
+// D400 alignment of the IMU axes to the depth ones
+static float3x3 const alignment = { { -1, 0, 0 }, { 0, 1, 0 }, { 0, 0, -1 } };
+
+static float3x3 make_sensitivity( std::mt19937 & gen )
+{
+    std::uniform_real_distribution< float > off( -0.02f, 0.02f );
+    return { { 1 + off( gen ), off( gen ), off( gen ) },
+             { off( gen ), 1 + off( gen ), off( gen ) },
+             { off( gen ), off( gen ), 1 + off( gen ) } };
+}
+
+// Accelerations, in m/s^2, as separate x, y and z arrays
+static std::vector< float > make_axis( std::mt19937 & gen )
+{
+    std::uniform_real_distribution< float > value( -20.f, 20.f );
+    std::vector< float > axis( count );
+    for( auto & v : axis )
+        v = value( gen );
+    return axis;
+}
+
+TEST_CASE( "Batch correction is the per-sample correction", "[motion]" )
+{
+    std::mt19937 gen( 0 );
+    auto const sensitivity = make_sensitivity( gen );
+    float3 const bias = { 0.05f, -0.1f, 0.2f };
+    auto x = make_axis( gen ), y = make_axis( gen ), z = make_axis( gen );
+    auto const x0 = x, y0 = y, z0 = z;
+
+    // motion_batch_transform folds the two matrices into one
+    correct_motion_samples( x.data(), y.data(), z.data(), sensitivity * alignment, bias, 0, count );
+
+    for( size_t i = 0; i < count; i++ )
+    {
+        // As motion_transform::correct_motion_helper() corrects single samples
+        float3 const expected = sensitivity * ( alignment * float3{ x0[i], y0[i], z0[i] } ) - bias;
+        CHECK( std::abs( x[i] - expected.x ) < 1e-5f );
+        CHECK( std::abs( y[i] - expected.y ) < 1e-5f );
+        CHECK( std::abs( z[i] - expected.z ) < 1e-5f );
+    }
+}
+
+TEST_CASE( "Motion samples are laid out the same everywhere", "[motion]" )
+{
+    CHECK( sizeof( rs2_motion_sample ) == 24 );
+    CHECK( offsetof( rs2_motion_sample, timestamp ) == 0 );
+    CHECK( offsetof( rs2_motion_sample, x ) == 8 );
+    CHECK( offsetof( rs2_motion_sample, z ) == 16 );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD motion correction is identical to scalar", "[motion]" )
+{
+    std::mt19937 gen( 1 );
+    auto const m = make_sensitivity( gen ) * alignment;
+    float3 const bias = { -0.3f, 0.01f, 0.07f };
+    auto x = make_axis( gen ), y = make_axis( gen ), z = make_axis( gen );
+    auto simd_x = x, simd_y = y, simd_z = z;
+
+    correct_motion_samples( x.data(), y.data(), z.data(), m, bias, 0, count );
+    size_t const end = count / 4 * 4;
+    SIMD( correct_motion_samples )( simd_x.data(), simd_y.data(), simd_z.data(), m, bias, 0, end );
+    correct_motion_samples( simd_x.data(), simd_y.data(), simd_z.data(), m, bias, end, count );
+
+    CHECK( std::memcmp( x.data(), simd_x.data(), count * sizeof( float ) ) == 0 );
+    CHECK( std::memcmp( y.data(), simd_y.data(), count * sizeof( float ) ) == 0 );
+    CHECK( std::memcmp( z.data(), simd_z.data(), count * sizeof( float ) ) == 0 );
+}
+
+#endif
@@ -0,0 +1,163 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <librealsense2/rsutil.h>
+#include <src/proc/pointcloud.h>
+#include <src/proc/sse/sse-pointcloud.h>
+#include <src/proc/sse/avx-pointcloud.h>
+#include <src/proc/neon/neon-pointcloud.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// An odd-sized image, so the SIMD kernels leave a tail to the scalar one
+static rs2_intrinsics make_intrinsics( rs2_distortion model )
+{
+    rs2_intrinsics intrin = { 643, 37, 321.7f, 18.2f, 390.4f, 390.9f, model, { 0, 0, 0, 0, 0 } };
+    if( model == RS2_DISTORTION_BROWN_CONRADY || model == RS2_DISTORTION_INVERSE_BROWN_CONRADY )
+    {
+        float const coeffs[] = { 0.180086836f, -0.534179211f, -0.00139013783f, 0.000118769123f, 0.470662683f };
+        std::copy( std::begin( coeffs ), std::end( coeffs ), intrin.coeffs );
+    }
+    else if( model == RS2_DISTORTION_KANNALA_BRANDT4 )
+    {
+        float const coeffs[] = { -0.0133f, 0.0442f, -0.0391f, 0.0106f, 0 };
+        std::copy( std::begin( coeffs ), std::end( coeffs ), intrin.coeffs );
+    }
+    else if( model == RS2_DISTORTION_FTHETA )
+        intrin.coeffs[0] = 0.92f;
+    return intrin;
+}
+
+static std::vector< uint16_t > make_depth( size_t pixels, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > z( 0, 65535 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< uint16_t > depth( pixels );
+    for( auto & d : depth )
+        d = uint16_t( kind( gen ) < 20 ? 0 : z( gen ) );
+    return depth;
+}
+
+static bool identical( std::vector< float3 > const & a, std::vector< float3 > const & b )
+{
+    return a.size() == b.size() && memcmp( a.data(), b.data(), a.size() * sizeof( float3 ) ) == 0;
+}
+
+static rs2_distortion const models[] = { RS2_DISTORTION_NONE,
+                                         RS2_DISTORTION_BROWN_CONRADY,
+                                         RS2_DISTORTION_INVERSE_BROWN_CONRADY,
+                                         RS2_DISTORTION_KANNALA_BRANDT4,
+                                         RS2_DISTORTION_FTHETA };
+
+TEST_CASE( "deprojecting through the ray table is identical to rs2_deproject_pixel_to_point", "[pointcloud]" )
+{
+    for( auto model : models )
+    {
+        CAPTURE( model );
+        auto const intrin = make_intrinsics( model );
+        size_t const pixels = intrin.width * intrin.height;
+        std::vector< float > rays_x( pixels ), rays_y( pixels );
+        compute_pixel_rays( intrin, rays_x.data(), rays_y.data() );
+
+        auto const depth = make_depth( pixels, 1 );
+        float const depth_scale = 0.001f;
+        std::vector< float3 > points( pixels );
+        deproject_depth_pixels( points.data(), depth.data(), rays_x.data(), rays_y.data(), 0, pixels, depth_scale );
+
+        std::vector< float3 > expected( pixels );
+        for( int y = 0; y < intrin.height; ++y )
+            for( int x = 0; x < intrin.width; ++x )
+            {
+                float const pixel[] = { float( x ), float( y ) };
+                size_t const i = y * intrin.width + x;
+                rs2_deproject_pixel_to_point( &expected[i].x, &intrin, pixel, depth_scale * depth[i] );
+            }
+        CHECK( identical( points, expected ) );
+    }
+}
+
+// Runs a SIMD kernel over the whole multiple of 8 pixels, and the scalar one over the rest
+template< class KERNEL >
+static void check_kernel( KERNEL kernel )
+{
+    for( auto model : models )
+        for( float depth_scale : { 0.001f, 0.0001f, 0.000125f } )
+        {
+            CAPTURE( model, depth_scale );
+            auto const intrin = make_intrinsics( model );
+            size_t const pixels = intrin.width * intrin.height;
+            std::vector< float > rays_x( pixels ), rays_y( pixels );
+            compute_pixel_rays( intrin, rays_x.data(), rays_y.data() );
+            auto const depth = make_depth( pixels, unsigned( model ) );
+
+            std::vector< float3 > scalar( pixels );
+            deproject_depth_pixels( scalar.data(), depth.data(), rays_x.data(), rays_y.data(), 0, pixels, depth_scale );
+
+            std::vector< float3 > simd( pixels );
+            size_t const end = pixels / 8 * 8;
+            kernel( simd.data(), depth.data(), rays_x.data(), rays_y.data(), 0, end, depth_scale );
+            deproject_depth_pixels( simd.data(), depth.data(), rays_x.data(), rays_y.data(), end, pixels, depth_scale );
+
+            CHECK( identical( scalar, simd ) );
+        }
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD deprojection is identical to scalar", "[pointcloud]" )
+{
+    check_kernel( SIMD( deproject_depth_pixels ) );
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 deprojection is identical to scalar", "[pointcloud]" )
+{
+    if( ! has_avx2() )
+        return;
+    check_kernel( deproject_depth_pixels_avx2 );
+}
+
+#endif
+
+TEST_CASE( "compacted points keep their order and texture coordinates", "[pointcloud]" )
+{
+    size_t const n = 1001;
+    auto const depth = make_depth( n, 7 );
+
+    // Laid out as in a points frame: all the vertices, then all the texture coordinates
+    std::vector< uint8_t > frame( n * ( sizeof( float3 ) + sizeof( float2 ) ) );
+    auto vertices = reinterpret_cast< float3 * >( frame.data() );
+    auto texcoords = reinterpret_cast< float2 * >( vertices + n );
+    std::vector< float3 > expected_vertices;
+    std::vector< float2 > expected_texcoords;
+    for( size_t i = 0; i < n; ++i )
+    {
+        vertices[i] = { float( i ), -float( i ), float( depth[i] ) };
+        texcoords[i] = { float( i ) / n, 1.f - float( i ) / n };
+        if( depth[i] )
+        {
+            expected_vertices.push_back( vertices[i] );
+            expected_texcoords.push_back( texcoords[i] );
+        }
+    }
+
+    size_t const count = compact_points( vertices, texcoords, n );
+    REQUIRE( count == expected_vertices.size() );
+    REQUIRE( count < n );
+    auto packed_texcoords = reinterpret_cast< float2 * >( vertices + count );
+    for( size_t i = 0; i < count; ++i )
+    {
+        CAPTURE( i );
+        CHECK( memcmp( &vertices[i], &expected_vertices[i], sizeof( float3 ) ) == 0 );
+        CHECK( memcmp( &packed_texcoords[i], &expected_texcoords[i], sizeof( float2 ) ) == 0 );
+    }
+}
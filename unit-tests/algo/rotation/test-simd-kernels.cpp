@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/rotation-filter.h>
+#include <src/proc/sse/sse-rotation.h>
+#include <src/proc/neon/neon-rotation.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// The source and destination images are larger than the blocks, and are walked forwards or backwards
+static int const image_size = 20;
+
+typedef void ( *transpose_function )( const uint8_t *, ptrdiff_t, uint8_t *, ptrdiff_t );
+
+static std::vector< uint8_t > random_image( int bpp, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    std::vector< uint8_t > image( image_size * image_size * bpp );
+    for( auto & b : image )
+        b = uint8_t( byte( gen ) );
+    return image;
+}
+
+// Transposes an 8x8 block with the reference and with 'simd', for every direction of the source and destination
+static void check_kernel( transpose_function simd, int bpp )
+{
+    ptrdiff_t const stride = image_size * bpp;
+    auto const source = random_image( bpp, unsigned( bpp ) );
+    for( bool src_up : { false, true } )
+        for( bool dst_up : { false, true } )
+        {
+            CAPTURE( bpp, src_up, dst_up );
+            // Block origins away from the edges, with an odd pixel offset
+            auto src = source.data() + ( src_up ? 15 : 3 ) * stride + 5 * bpp;
+            std::vector< uint8_t > expected( source.size(), 0xAB ), actual( source.size(), 0xAB );
+            ptrdiff_t const ss = src_up ? -stride : stride;
+            ptrdiff_t const ds = dst_up ? -stride : stride;
+            ptrdiff_t const origin = ( dst_up ? 12 : 2 ) * stride + 7 * bpp;
+            transpose_pixels( src, ss, expected.data() + origin, ds, bpp, 8, 8 );
+            simd( src, ss, actual.data() + origin, ds );
+            CHECK( actual == expected );
+        }
+}
+
+TEST_CASE( "transpose_pixels swaps rows and columns", "[rotation]" )
+{
+    // 2 rows of 3 pixels of 2 bytes
+    uint8_t const source[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint8_t out[12] = {};
+    transpose_pixels( source, 6, out, 4, 2, 2, 3 );
+    uint8_t const expected[] = { 1, 2, 7, 8, 3, 4, 9, 10, 5, 6, 11, 12 };
+    CHECK( std::vector< uint8_t >( out, out + 12 ) == std::vector< uint8_t >( expected, expected + 12 ) );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "SIMD 8x8 transposes are identical to scalar", "[rotation]" )
+{
+    check_kernel( SIMD( transpose_8x8_u8 ), 1 );
+    check_kernel( SIMD( transpose_8x8_u16 ), 2 );
+    check_kernel( SIMD( transpose_8x8_u24 ), 3 );
+    check_kernel( SIMD( transpose_8x8_u32 ), 4 );
+}
+
+#endif
@@ -0,0 +1,189 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/spatial-filter.h>
+#include <src/proc/sse/sse-spatial-filter.h>
+#include <src/proc/sse/avx-spatial-filter.h>
+#include <src/proc/neon/neon-spatial-filter.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// Depth with noise, edges and holes, including pixels of 1 (invalid for some of the scalar comparisons)
+static std::vector< uint16_t > make_z16( size_t width, size_t height, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > noise( -30, 30 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< uint16_t > image( width * height );
+    for( size_t v = 0; v < height; ++v )
+        for( size_t u = 0; u < width; ++u )
+        {
+            int k = kind( gen );
+            int z = ( u * 3 / width ) * 5000 + 1000 + int( v ) + noise( gen );
+            image[v * width + u] = uint16_t( k < 10 ? 0 : k < 12 ? 1 : k < 14 ? 65535 : z );
+        }
+    return image;
+}
+
+// Disparity with noise, edges and holes
+static std::vector< float > make_disparity( size_t width, size_t height, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_real_distribution< float > noise( -2.f, 2.f );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< float > image( width * height );
+    for( size_t v = 0; v < height; ++v )
+        for( size_t u = 0; u < width; ++u )
+        {
+            int k = kind( gen );
+            image[v * width + u] = k < 10 ? 0.f : k < 12 ? -0.f : ( u * 3 / width ) * 40.f + 20.f + noise( gen );
+        }
+    return image;
+}
+
+static void check_equal( std::vector< uint16_t > const & a, std::vector< uint16_t > const & b )
+{
+    REQUIRE( a.size() == b.size() );
+    CHECK( std::equal( a.begin(), a.end(), b.begin() ) );
+}
+
+static void check_equal( std::vector< float > const & a, std::vector< float > const & b )
+{
+    REQUIRE( a.size() == b.size() );
+    CHECK( memcmp( a.data(), b.data(), a.size() * sizeof( float ) ) == 0 );
+}
+
+#ifdef SIMD
+
+TEST_CASE( "Z16 SIMD kernels are identical to scalar", "[spatial-filter]" )
+{
+    for( auto size : { std::make_pair( 64, 16 ), std::make_pair( 37, 24 ), std::make_pair( 848, 480 ) } )
+        for( float alpha : { 0.25f, 0.5f, 0.73f, 1.f } )
+            for( float delta : { 1.f, 20.f, 50.f } )
+                for( uint8_t radius : { 0, 2, 16, 0xff } )
+                {
+                    size_t const width = size.first, height = size.second;
+                    CAPTURE( width, height, alpha, delta, radius );
+                    auto const input = make_z16( width, height, unsigned( width + radius ) );
+
+                    auto scalar = input;
+                    recursive_filter_horizontal_rows( scalar.data(), width, 0, height, alpha, delta, radius );
+                    auto simd = input;
+                    SIMD( recursive_filter_horizontal_rows )( simd.data(), width, 0, height, alpha, delta, radius );
+                    check_equal( scalar, simd );
+
+                    scalar = input;
+                    recursive_filter_vertical_columns( scalar.data(), width, height, 0, width, alpha, delta );
+                    simd = input;
+                    size_t const end = width / 8 * 8;
+                    SIMD( recursive_filter_vertical_columns )( simd.data(), width, height, 0, end, alpha, delta );
+                    recursive_filter_vertical_columns( simd.data(), width, height, end, width, alpha, delta );
+                    check_equal( scalar, simd );
+                }
+}
+
+TEST_CASE( "disparity SIMD kernels are identical to scalar", "[spatial-filter]" )
+{
+    for( auto size : { std::make_pair( 64, 16 ), std::make_pair( 37, 24 ), std::make_pair( 848, 480 ) } )
+        for( float alpha : { 0.25f, 0.5f, 0.73f, 1.f } )
+            for( float delta : { 0.5f, 2.f, 50.f } )
+            {
+                size_t const width = size.first, height = size.second;
+                CAPTURE( width, height, alpha, delta );
+                auto const input = make_disparity( width, height, unsigned( width ) );
+
+                auto scalar = input;
+                recursive_filter_horizontal_rows_fp( scalar.data(), width, 0, height, alpha, delta );
+                auto simd = input;
+                SIMD( recursive_filter_horizontal_rows_fp )( simd.data(), width, 0, height, alpha, delta );
+                check_equal( scalar, simd );
+
+                scalar = input;
+                recursive_filter_vertical_columns_fp( scalar.data(), width, height, 0, width, alpha, delta );
+                simd = input;
+                size_t const end = width / 4 * 4;
+                SIMD( recursive_filter_vertical_columns_fp )( simd.data(), width, height, 0, end, alpha, delta );
+                recursive_filter_vertical_columns_fp( simd.data(), width, height, end, width, alpha, delta );
+                check_equal( scalar, simd );
+            }
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 kernels are identical to scalar", "[spatial-filter]" )
+{
+    if( ! has_avx2() )
+        return;
+    for( auto size : { std::make_pair( 64, 16 ), std::make_pair( 37, 32 ), std::make_pair( 848, 480 ) } )
+        for( float alpha : { 0.25f, 0.5f, 0.73f, 1.f } )
+        {
+            size_t const width = size.first, height = size.second;
+            for( float delta : { 1.f, 20.f, 50.f } )
+                for( uint8_t radius : { 0, 2, 16, 0xff } )
+                {
+                    CAPTURE( width, height, alpha, delta, radius );
+                    auto const input = make_z16( width, height, unsigned( width + radius ) );
+
+                    auto scalar = input;
+                    recursive_filter_horizontal_rows( scalar.data(), width, 0, height, alpha, delta, radius );
+                    auto simd = input;
+                    recursive_filter_horizontal_rows_avx2( simd.data(), width, 0, height, alpha, delta, radius );
+                    check_equal( scalar, simd );
+
+                    scalar = input;
+                    recursive_filter_vertical_columns( scalar.data(), width, height, 0, width, alpha, delta );
+                    simd = input;
+                    size_t const end = width / 16 * 16;
+                    recursive_filter_vertical_columns_avx2( simd.data(), width, height, 0, end, alpha, delta );
+                    recursive_filter_vertical_columns( simd.data(), width, height, end, width, alpha, delta );
+                    check_equal( scalar, simd );
+                }
+
+            for( float delta : { 0.5f, 2.f, 50.f } )
+            {
+                CAPTURE( width, height, alpha, delta );
+                auto const input = make_disparity( width, height, unsigned( width ) );
+
+                auto scalar = input;
+                recursive_filter_horizontal_rows_fp( scalar.data(), width, 0, height, alpha, delta );
+                auto simd = input;
+                recursive_filter_horizontal_rows_fp_avx2( simd.data(), width, 0, height, alpha, delta );
+                check_equal( scalar, simd );
+
+                scalar = input;
+                recursive_filter_vertical_columns_fp( scalar.data(), width, height, 0, width, alpha, delta );
+                simd = input;
+                size_t const end = width / 8 * 8;
+                recursive_filter_vertical_columns_fp_avx2( simd.data(), width, height, 0, end, alpha, delta );
+                recursive_filter_vertical_columns_fp( simd.data(), width, height, end, width, alpha, delta );
+                check_equal( scalar, simd );
+            }
+        }
+}
+
+#endif
+
+TEST_CASE( "filtering a range of rows or columns is the same as the whole", "[spatial-filter]" )
+{
+    size_t const width = 100, height = 50;
+    auto const input = make_z16( width, height, 1 );
+
+    auto whole = input;
+    recursive_filter_horizontal_rows( whole.data(), width, 0, height, 0.5f, 20.f, 4 );
+    recursive_filter_vertical_columns( whole.data(), width, height, 0, width, 0.5f, 20.f );
+
+    auto parts = input;
+    for( size_t v = 0; v < height; v += 7 )
+        recursive_filter_horizontal_rows( parts.data(), width, v, std::min( height, v + 7 ), 0.5f, 20.f, 4 );
+    for( size_t u = 0; u < width; u += 9 )
+        recursive_filter_vertical_columns( parts.data(), width, height, u, std::min( width, u + 9 ), 0.5f, 20.f );
+    check_equal( whole, parts );
+}
@@ -0,0 +1,169 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/temporal-filter.h>
+#include <src/proc/sse/sse-temporal-filter.h>
+#include <src/proc/sse/avx-temporal-filter.h>
+#include <src/proc/neon/neon-temporal-filter.h>
+
+#include <random>
+
+using namespace librealsense;
+
+// A sequence of depth frames around a slowly moving surface, with flickering holes and outliers
+static std::vector< std::vector< uint16_t > > make_z16_frames( size_t pixels, size_t n_frames, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > noise( -30, 30 );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< std::vector< uint16_t > > frames( n_frames, std::vector< uint16_t >( pixels ) );
+    for( size_t f = 0; f < n_frames; ++f )
+        for( size_t i = 0; i < pixels; ++i )
+        {
+            int k = kind( gen );
+            int z = int( i % 700 ) * 10 + 1000 + int( f ) + noise( gen );
+            frames[f][i] = uint16_t( k < 30 ? 0 : k < 32 ? 1 : k < 34 ? 65535 : z );
+        }
+    return frames;
+}
+
+// Same for disparity
+static std::vector< std::vector< float > > make_disparity_frames( size_t pixels, size_t n_frames, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_real_distribution< float > noise( -2.f, 2.f );
+    std::uniform_int_distribution< int > kind( 0, 99 );
+    std::vector< std::vector< float > > frames( n_frames, std::vector< float >( pixels ) );
+    for( size_t f = 0; f < n_frames; ++f )
+        for( size_t i = 0; i < pixels; ++i )
+        {
+            int k = kind( gen );
+            frames[f][i] = k < 30 ? 0.f : k < 32 ? -0.f : float( i % 70 ) + 20.f + noise( gen );
+        }
+    return frames;
+}
+
+static std::array< uint8_t, PRESISTENCY_LUT_SIZE > make_persistence_map( unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    std::array< uint8_t, PRESISTENCY_LUT_SIZE > map;
+    for( auto & m : map )
+        m = uint8_t( byte( gen ) );
+    return map;
+}
+
+template< class T >
+static bool identical( std::vector< T > const & a, std::vector< T > const & b )
+{
+    return a.size() == b.size() && memcmp( a.data(), b.data(), a.size() * sizeof( T ) ) == 0;
+}
+
+template< class T >
+using simd_kernel = void ( * )( T *, T *, uint8_t *, size_t, size_t, float, uint8_t, uint8_t, const uint8_t * );
+
+// Runs the scalar kernel and 'simd' (which filters 'step' pixels at a time) over the same sequence (all eight phases
+// and more) and compares every output
+template< class T >
+static void check_sequence( std::vector< std::vector< T > > const & frames, float alpha, uint8_t delta, unsigned seed,
+                            simd_kernel< T > simd_filter, size_t step )
+{
+    size_t const pixels = frames.front().size();
+    auto const map = make_persistence_map( seed );
+    std::vector< T > scalar_last( pixels ), simd_last( pixels );
+    std::vector< uint8_t > scalar_history( pixels ), simd_history( pixels );
+
+    for( size_t f = 0; f < frames.size(); ++f )
+    {
+        uint8_t const phase = uint8_t( f % 8 );
+        CAPTURE( f );
+
+        auto scalar = frames[f];
+        temporal_filter_pixels( scalar.data(), scalar_last.data(), scalar_history.data(), 0, pixels,
+                                alpha, delta, uint8_t( 1 << phase ), map.data() );
+
+        auto simd = frames[f];
+        size_t const end = pixels / step * step;
+        simd_filter( simd.data(), simd_last.data(), simd_history.data(), 0, end, alpha, delta, phase, map.data() );
+        temporal_filter_pixels( simd.data(), simd_last.data(), simd_history.data(), end, pixels,
+                                alpha, delta, uint8_t( 1 << phase ), map.data() );
+
+        CHECK( identical( scalar, simd ) );
+        CHECK( identical( scalar_last, simd_last ) );
+        CHECK( identical( scalar_history, simd_history ) );
+    }
+}
+
+#ifdef SIMD
+
+TEST_CASE( "Z16 SIMD kernel is identical to scalar", "[temporal-filter]" )
+{
+    for( size_t pixels : { 16, 37, 848 * 10 } )
+        for( float alpha : { 0.f, 0.4f, 0.73f, 1.f } )
+            for( uint8_t delta : { 1, 20, 100 } )
+            {
+                CAPTURE( pixels, alpha, delta );
+                check_sequence( make_z16_frames( pixels, 20, unsigned( pixels ) ), alpha, delta, delta,
+                                SIMD( temporal_filter_pixels ), 16 );
+            }
+}
+
+TEST_CASE( "disparity SIMD kernel is identical to scalar", "[temporal-filter]" )
+{
+    for( size_t pixels : { 16, 37, 848 * 10 } )
+        for( float alpha : { 0.f, 0.4f, 0.73f, 1.f } )
+            for( uint8_t delta : { 1, 20, 100 } )
+            {
+                CAPTURE( pixels, alpha, delta );
+                check_sequence( make_disparity_frames( pixels, 20, unsigned( pixels ) ), alpha, delta, delta,
+                                SIMD( temporal_filter_pixels ), 16 );
+            }
+}
+
+#endif
+
+#ifdef AVX2_KERNELS
+
+TEST_CASE( "AVX2 kernels are identical to scalar", "[temporal-filter]" )
+{
+    if( ! has_avx2() )
+        return;
+    for( size_t pixels : { 32, 53, 848 * 10 } )
+        for( float alpha : { 0.f, 0.4f, 0.73f, 1.f } )
+            for( uint8_t delta : { 1, 20, 100 } )
+            {
+                CAPTURE( pixels, alpha, delta );
+                check_sequence( make_z16_frames( pixels, 20, unsigned( pixels ) ), alpha, delta, delta,
+                                temporal_filter_pixels_avx2, 32 );
+                check_sequence( make_disparity_frames( pixels, 20, unsigned( pixels ) ), alpha, delta, delta,
+                                temporal_filter_pixels_avx2, 32 );
+            }
+}
+
+#endif
+
+TEST_CASE( "filtering a range of pixels is the same as the whole", "[temporal-filter]" )
+{
+    size_t const pixels = 1000;
+    auto const frames = make_z16_frames( pixels, 10, 1 );
+    auto const map = make_persistence_map( 1 );
+    std::vector< uint16_t > whole_last( pixels ), parts_last( pixels );
+    std::vector< uint8_t > whole_history( pixels ), parts_history( pixels );
+
+    for( size_t f = 0; f < frames.size(); ++f )
+    {
+        uint8_t const mask = uint8_t( 1 << ( f % 8 ) );
+        auto whole = frames[f];
+        temporal_filter_pixels( whole.data(), whole_last.data(), whole_history.data(), 0, pixels, 0.4f, 20, mask, map.data() );
+        auto parts = frames[f];
+        for( size_t i = 0; i < pixels; i += 77 )
+            temporal_filter_pixels( parts.data(), parts_last.data(), parts_history.data(), i, std::min( pixels, i + 77 ),
+                                    0.4f, 20, mask, map.data() );
+        CHECK( identical( whole, parts ) );
+        CHECK( identical( whole_history, parts_history ) );
+    }
+}
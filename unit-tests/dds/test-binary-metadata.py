@@ -0,0 +1,173 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#test:donotrun:!dds
+#test:retries 2
+
+# Disabled under Linux for the same reason as test-metadata.py: two participants in the same process, one from
+# pyrealdds and the other from pyrealsense2, interfere with each other
+#test:donotrun:linux
+
+import pyrealdds as dds
+from rspy import log, test, config_file
+import d435i
+
+
+with test.remote.fork( nested_indent='  S' ) as remote:
+    if remote is None:  # we're the server fork
+
+        dds.debug( log.is_debug_on(), log.nested )
+
+        participant = dds.participant()
+        participant.init( config_file.get_domain_from_config_file_or_default(), "server" )
+
+        device_server = dds.device_server( participant, d435i.device_info.topic_root )
+
+        depth_stream = dds.depth_stream_server( 'Depth', 'Depth Module' )
+        depth_stream.enable_metadata()
+        depth_stream.init_profiles( d435i.depth_stream_profiles(), 0 )
+        depth_stream.init_options( [] )
+
+        def on_control( server, id, control, reply ):
+            return True
+
+        device_server.on_control( on_control )
+        device_server.enable_binary_metadata()  # must come before init()
+        device_server.init( [depth_stream], [], {} )
+
+
+        def broadcast():
+            global device_server
+            device_server.broadcast( d435i.device_info )
+
+
+        def new_image( width, height, bpp ):
+            i = dds.message.image()
+            i.width = width
+            i.height = height
+            i.data = bytearray( width * height * bpp )
+            return i
+
+
+        def publish_image( img, timestamp ):
+            img.timestamp = timestamp
+            depth_stream.publish_image( img )
+
+
+        def publish_metadata( timestamp_as_ns, frame_number, values ):
+            md = dds.message.metadata( 'Depth', timestamp_as_ns )
+            if frame_number is not None:
+                md.frame_number = frame_number
+            md.depth_units = 0.0005
+            for key, value in values.items():
+                md.add( key, value )
+            device_server.publish_metadata( md )
+
+
+        raise StopIteration()
+
+
+    ###############################################################################################################
+    # The client
+    #
+
+    import threading
+
+    dds.debug( log.is_debug_on(), 'C  ' )
+    log.nested = 'C  '
+
+    participant = dds.participant()
+    participant.init( config_file.get_domain_from_config_file_or_default(), "client" )
+
+    device_direct = dds.device( participant, d435i.device_info )
+    device_direct.wait_until_ready()
+    test.check( device_direct.is_ready(), on_fail=test.ABORT )
+
+    metadata_received = threading.Event()
+    metadata_content = []
+
+    def on_binary_metadata_available( device, md ):
+        log.d( f'----> metadata[{len(metadata_content)}]= {md}' )
+        metadata_content.append( md )
+        metadata_received.set()
+
+    metadata_subscription = device_direct.on_binary_metadata_available( on_binary_metadata_available )
+
+    #############################################################################################
+    #
+    with test.closure( "The device offers binary metadata" ):
+        test.check( device_direct.supports_binary_metadata() )
+    #
+    #############################################################################################
+    #
+    with test.closure( "Binary metadata direct from server" ):
+        metadata_received.clear()
+        remote.run( 'publish_metadata( 1234, 5, { 3: 0xbaad, 40: -1 } )' )
+        test.check( metadata_received.wait( 1 ) )
+        if test.check_equal( len( metadata_content ), 1 ):
+            md = metadata_content[0]
+            test.check_equal( md.stream_name, 'Depth' )
+            test.check_equal( md.timestamp, 1234 )
+            test.check_equal( md.frame_number, 5 )
+            test.check_equal( md.timestamp_domain, None )
+            test.check_approx_abs( md.depth_units, 0.0005, 1e-9 )
+            test.check_equal( md.items(), [( 3, 0xbaad ), ( 40, -1 )] )
+    #
+    #############################################################################################
+    #
+    with test.closure( "Broadcast the device" ):  # otherwise librs won't see it
+        remote.run( 'broadcast()' )
+    #
+    #############################################################################################
+    #
+    with test.closure( "Initialize librs device", on_fail=test.ABORT ):
+        from rspy import librs as rs
+        if log.is_debug_on():
+            rs.log_to_console( rs.log_severity.debug )
+        context = rs.context( { 'dds': { 'enabled': True, 'domain': config_file.get_domain_from_config_file_or_default(), 'participant': 'librs' }} )
+        device = rs.wait_for_devices( context, rs.only_sw_devices, n=1. )
+        sensor = device.sensors[0]
+        profile = rs.video_stream_profile( sensor.get_stream_profiles()[0] )
+        encoding = dds.video_encoding.from_rs2( profile.format() )
+        YUYV_BPP = 2  # the camera is actually sending us in YUYV format, and in LibRS we convert it to profile.format
+        remote.run( f'img = new_image( {profile.width()}, {profile.height()}, {YUYV_BPP} )', on_fail='abort' )
+        sensor.open( [profile] )
+        queue = rs.frame_queue( 100 )
+        sensor.start( queue )
+        remote.run( f'depth_stream.start_streaming( dds.video_encoding( "{encoding}" ), img.width, img.height )' )
+    #
+    #############################################################################################
+    #
+    with test.closure( 'Frames are matched to binary metadata' ):
+        temperature = int( rs.frame_metadata_value.temperature )
+        timestamp = dds.now()
+        remote.run( f'publish_metadata( {timestamp.to_ns()}, 1234, {{ {temperature}: 0xf00d }} )' )
+        remote.run( f'publish_image( img, dds.time.from_ns( {timestamp.to_ns()} ))' )
+        f = queue.wait_for_frame( 1000 )
+        log.d( '---->', f )
+        if test.check( f ) and test.check_equal( f.get_frame_number(), 1234 ):
+            test.check_approx_abs( f.as_depth_frame().get_units(), 0.0005, 1e-9 )
+            test.check_false( f.supports_frame_metadata( rs.frame_metadata_value.white_balance ) )
+            if test.check( f.supports_frame_metadata( rs.frame_metadata_value.temperature ) ):
+                test.check_equal( f.get_frame_metadata( rs.frame_metadata_value.temperature ), 0xf00d )
+    #
+    #############################################################################################
+    #
+    with test.closure( 'Without a frame-number, frames are counted' ):
+        timestamp = dds.now()
+        remote.run( f'publish_metadata( {timestamp.to_ns()}, None, {{}} )' )
+        remote.run( f'publish_image( img, dds.time.from_ns( {timestamp.to_ns()} ))' )
+        f = queue.wait_for_frame( 1000 )
+        if test.check( f ):
+            test.check_equal( f.get_frame_number(), 1235 )
+            test.check_false( f.supports_frame_metadata( rs.frame_metadata_value.temperature ) )
+    #
+    #############################################################################################
+    #
+    with test.closure( "Stop streaming" ):
+        remote.run( 'depth_stream.stop_streaming()', on_fail='log' )
+        sensor.stop()
+        sensor.close()
+
+
+test.print_results()
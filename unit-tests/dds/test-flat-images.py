@@ -0,0 +1,176 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#test:donotrun:!dds
+#test:retries 2
+
+# Disabled under Linux for the same reason as test-metadata.py: two participants in the same process, one from
+# pyrealdds and the other from pyrealsense2, interfere with each other
+#test:donotrun:linux
+
+import pyrealdds as dds
+from rspy import log, test, config_file
+import d435i
+
+
+with test.remote.fork( nested_indent='  S' ) as remote:
+    if remote is None:  # we're the server fork
+
+        dds.debug( log.is_debug_on(), log.nested )
+
+        participant = dds.participant()
+        participant.init( config_file.get_domain_from_config_file_or_default(), "server" )
+
+        device_server = dds.device_server( participant, d435i.device_info.topic_root )
+
+        depth_stream = dds.depth_stream_server( 'Depth', 'Depth Module' )
+        depth_stream.init_profiles( d435i.depth_stream_profiles(), 0 )
+        depth_stream.init_options( [] )
+        depth_stream.enable_flat_images()  # must come before init()
+
+        def on_control( server, id, control, reply ):
+            return True
+
+        device_server.on_control( on_control )
+        device_server.init( [depth_stream], [], {} )
+
+
+        def broadcast():
+            global device_server
+            device_server.broadcast( d435i.device_info )
+
+
+        def new_image( width, height, bpp ):
+            i = dds.message.image()
+            i.width = width
+            i.height = height
+            i.data = bytearray( width * height * bpp )
+            return i
+
+
+        def publish_image( img, timestamp, fill ):
+            img.timestamp = timestamp
+            img.data = bytearray( [fill] ) * len( img.data )
+            depth_stream.publish_image( img )
+
+
+        raise StopIteration()
+
+
+    ###############################################################################################################
+    # The client
+    #
+
+    dds.debug( log.is_debug_on(), 'C  ' )
+    log.nested = 'C  '
+
+    participant = dds.participant()
+    participant.init( config_file.get_domain_from_config_file_or_default(), "client" )
+
+    device_direct = dds.device( participant, d435i.device_info )
+    device_direct.wait_until_ready()
+    test.check( device_direct.is_ready(), on_fail=test.ABORT )
+
+    #############################################################################################
+    #
+    with test.closure( "The stream offers flat images" ):
+        if test.check_equal( len( device_direct.streams() ), 1 ):
+            stream = device_direct.streams()[0]
+            test.check( stream.flat_image_size() > 0 )
+            test.check_equal( stream.flat_image_depth(), 4 )  # the default
+            test.check_false( stream.is_reading_flat_images() )  # not open
+    #
+    #############################################################################################
+    #
+    with test.closure( "Broadcast the device" ):  # otherwise librs won't see it
+        remote.run( 'broadcast()' )
+    #
+    #############################################################################################
+    #
+    with test.closure( "Initialize librs device", on_fail=test.ABORT ):
+        from rspy import librs as rs
+        if log.is_debug_on():
+            rs.log_to_console( rs.log_severity.debug )
+        context = rs.context( { 'dds': {
+            'enabled': True,
+            'domain': config_file.get_domain_from_config_file_or_default(),
+            'participant': 'librs',
+            'device': { 'flat-images': { 'enabled': True } } }} )
+        device = rs.wait_for_devices( context, rs.only_sw_devices, n=1. )
+        sensor = device.sensors[0]
+        profile = rs.video_stream_profile( sensor.get_stream_profiles()[0] )
+        encoding = dds.video_encoding.from_rs2( profile.format() )
+        bpp = 2  # Z16
+        remote.run( f'img = new_image( {profile.width()}, {profile.height()}, {bpp} )', on_fail='abort' )
+        sensor.open( [profile] )
+        queue = rs.frame_queue( 100 )
+        sensor.start( queue )
+        remote.run( f'depth_stream.start_streaming( dds.video_encoding( "{encoding}" ), img.width, img.height )' )
+    #
+    #############################################################################################
+    #
+    with test.closure( 'Frames arrive intact' ):
+        remote.run( f'publish_image( img, dds.now(), 0x5a )' )
+        f1 = queue.wait_for_frame( 1000 )
+        log.d( '---->', f1 )
+        if test.check( f1 ):
+            test.check_equal( f1.get_data_size(), profile.width() * profile.height() * bpp )
+            data = bytes( f1.get_data() )
+            test.check_equal( data[0], 0x5a )
+            test.check_equal( data[-1], 0x5a )
+    #
+    #############################################################################################
+    #
+    with test.closure( 'A held frame is not overwritten by the next one' ):
+        # The writer keeps a history of a few images, so the first frame's memory is not reused yet
+        remote.run( f'publish_image( img, dds.now(), 0xa5 )' )
+        f2 = queue.wait_for_frame( 1000 )
+        if test.check( f2 ):
+            test.check_equal( bytes( f2.get_data() )[0], 0xa5 )
+            if f1:
+                test.check_equal( bytes( f1.get_data() )[0], 0x5a )
+        del f1, f2
+    #
+    #############################################################################################
+    #
+    with test.closure( 'A kept frame outlives the server history' ):
+        remote.run( f'publish_image( img, dds.now(), 0x11 )' )
+        kept = queue.wait_for_frame( 1000 )
+        if test.check( kept ):
+            kept.keep()  # gets its own copy
+            for fill in range( 0x20, 0x28 ):  # twice the history depth
+                remote.run( f'publish_image( img, dds.now(), {fill} )' )
+                f = queue.wait_for_frame( 1000 )
+                if test.check( f ):
+                    test.check_equal( bytes( f.get_data() )[0], fill )
+                del f
+            test.check_equal( bytes( kept.get_data() )[0], 0x11 )
+            test.check_equal( bytes( kept.get_data() )[-1], 0x11 )
+        del kept
+    #
+    #############################################################################################
+    #
+    with test.closure( 'A held frame that is not kept outlives the server history, too' ):
+        remote.run( f'publish_image( img, dds.now(), 0x33 )' )
+        held = queue.wait_for_frame( 1000 )
+        if test.check( held ):
+            for fill in range( 0x40, 0x48 ):  # twice the history depth
+                remote.run( f'publish_image( img, dds.now(), {fill} )' )
+                f = queue.wait_for_frame( 1000 )
+                if test.check( f ):
+                    test.check_equal( bytes( f.get_data() )[0], fill )
+                del f
+            # Given a copy before the server could reuse its memory
+            test.check_equal( bytes( held.get_data() )[0], 0x33 )
+            test.check_equal( bytes( held.get_data() )[-1], 0x33 )
+        del held
+    #
+    #############################################################################################
+    #
+    with test.closure( "Stop streaming" ):
+        remote.run( 'depth_stream.stop_streaming()', on_fail='log' )
+        sensor.stop()
+        sensor.close()
+
+
+test.print_results()
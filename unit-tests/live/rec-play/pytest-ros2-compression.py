@@ -82,7 +82,9 @@ def _record_synthetic_bag(filename):
     sensor.stop()
     sensor.close()
     recorder.pause()
+    stats = recorder.get_statistics()
     recorder = None
+    return stats
 
 
 def _skip_cdr_string(buf, off):
@@ -151,7 +153,8 @@ def _playback_depth_frames(filename):
 
 def test_compressed_frames_match_playback(tmp_path):
     bag = str(tmp_path / "recording.db3")
-    _record_synthetic_bag(bag)
+    stats = _record_synthetic_bag(bag)
+    assert stats.frames_dropped == 0, "recorders should never drop frames unless asked to"
 
     blobs = _read_frame_blobs(bag)
     assert len(blobs) == NUM_FRAMES, \
@@ -0,0 +1,127 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Records software-device depth frames, interleaved with accel frames, to both file formats and verifies that seeking
+# playback to the N-th depth frame plays from that very frame
+
+import os
+import tempfile
+import time
+import logging
+
+import numpy as np
+import pytest
+import pyrealsense2 as rs
+from pytest_check import check
+
+log = logging.getLogger(__name__)
+
+W, H, BPP = 64, 48, 2
+NUM_FRAMES = 10
+SEEK_FRAME = 6
+
+
+def _add_streams(sensor):
+    depth_intrinsics = rs.intrinsics()
+    depth_intrinsics.width = W
+    depth_intrinsics.height = H
+    depth_intrinsics.ppx = W / 2
+    depth_intrinsics.ppy = H / 2
+    depth_intrinsics.fx = W
+    depth_intrinsics.fy = H
+    depth_intrinsics.model = rs.distortion.brown_conrady
+    depth_intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = 60
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = depth_intrinsics
+
+    motion_intrinsics = rs.motion_device_intrinsic()
+    motion_intrinsics.data = [[1.0] * 4] * 3
+    motion_intrinsics.noise_variances = [2, 2, 2]
+    motion_intrinsics.bias_variances = [3, 3, 3]
+
+    ms = rs.motion_stream()
+    ms.type = rs.stream.accel
+    ms.index = 0
+    ms.uid = 1
+    ms.fps = 200
+    ms.fmt = rs.format.motion_raw
+    ms.intrinsics = motion_intrinsics
+
+    return sensor.add_video_stream(vs), sensor.add_motion_stream(ms)
+
+
+def _record(file_name):
+    sd = rs.software_device()
+    sensor = sd.add_sensor("Synthetic")
+    depth_profile, accel_profile = _add_streams(sensor)
+    recorder = rs.recorder(file_name, sd)
+    sensor.open([depth_profile, accel_profile])
+    sensor.start(rs.syncer())
+
+    pixels = np.zeros(W * H * BPP, dtype=np.uint8)
+    accel = rs.vector()
+    for i in range(NUM_FRAMES):
+        # Two accel frames between depth frames, so the depth frame index differs from the message index
+        for j in range(2):
+            motion_frame = rs.software_motion_frame()
+            motion_frame.data = accel
+            motion_frame.timestamp = i * 10 + j * 3
+            motion_frame.domain = rs.timestamp_domain.hardware_clock
+            motion_frame.frame_number = i * 2 + j
+            motion_frame.profile = accel_profile.as_motion_stream_profile()
+            sensor.on_motion_frame(motion_frame)
+            time.sleep(0.005)  # the file is stamped with the time of arrival
+
+        video_frame = rs.software_video_frame()
+        video_frame.pixels = pixels
+        video_frame.bpp = BPP
+        video_frame.stride = W * BPP
+        video_frame.timestamp = i * 10 + 5
+        video_frame.domain = rs.timestamp_domain.hardware_clock
+        video_frame.frame_number = i
+        video_frame.profile = depth_profile.as_video_stream_profile()
+        sensor.on_video_frame(video_frame)
+        time.sleep(0.005)
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()
+    del recorder
+
+
+@pytest.mark.parametrize("extension", [".db3", ".bag"])
+def test_seek_to_frame(extension):
+    file_name = os.path.join(tempfile.mkdtemp(), "recording" + extension)
+    _record(file_name)
+
+    ctx = rs.context()
+    dev = ctx.load_device(file_name)
+    playback = dev.as_playback()
+    playback.set_real_time(False)
+    sensor = dev.query_sensors()[0]
+    depth_profile = next(p for p in sensor.get_stream_profiles() if p.stream_type() == rs.stream.depth)
+
+    played = []
+    sensor.open(depth_profile)
+    playback.seek_to_frame(depth_profile, SEEK_FRAME)
+    sensor.start(lambda f: played.append(f.get_frame_number()))
+    deadline = time.time() + 10
+    while playback.current_status() != rs.playback_status.stopped and time.time() < deadline:
+        time.sleep(0.1)
+    sensor.stop()
+
+    check.equal(played, list(range(SEEK_FRAME, NUM_FRAMES)))
+
+    # There is no frame past the last one
+    with pytest.raises(Exception):
+        playback.seek_to_frame(depth_profile, NUM_FRAMES)
+    sensor.close()
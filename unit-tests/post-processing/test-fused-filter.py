@@ -0,0 +1,137 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+
+W = 640
+H = 480
+BPP = 2
+N_FRAMES = 10
+fps = 30
+depth_unit = 0.001
+
+intrinsics = rs.intrinsics()
+intrinsics.width = W
+intrinsics.height = H
+intrinsics.ppx = W / 2
+intrinsics.ppy = H / 2
+intrinsics.fx = 380
+intrinsics.fy = 380
+intrinsics.model = rs.distortion.none
+intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+sd = rs.software_device()
+software_sensor = sd.add_sensor("software_sensor")
+software_sensor.add_read_only_option(rs.option.depth_units, depth_unit)
+
+vs = rs.video_stream()
+vs.type = rs.stream.depth
+vs.index = 0
+vs.uid = 0
+vs.width = W
+vs.height = H
+vs.fps = fps
+vs.bpp = BPP
+vs.fmt = rs.format.z16
+vs.intrinsics = intrinsics
+software_sensor.add_video_stream(vs)
+
+profiles = software_sensor.get_stream_profiles()
+depth = profiles[0].as_video_stream_profile()
+
+queue = rs.frame_queue(N_FRAMES)
+software_sensor.open(profiles)
+software_sensor.start(queue)
+
+# A noisy slope with flickering holes
+rng = np.random.default_rng(1)
+frames = []
+for k in range(N_FRAMES):
+    pixels = (np.tile(np.arange(W, dtype=np.int32) * 4 + 500, H) + rng.integers(-20, 20, W * H)).astype(np.uint16)
+    pixels[rng.random(W * H) < 0.2] = 0
+    frame = rs.software_video_frame()
+    frame.pixels = pixels
+    frame.bpp = BPP
+    frame.stride = BPP * W
+    frame.timestamp = float(k * 33)
+    frame.domain = rs.timestamp_domain.hardware_clock
+    frame.frame_number = k + 1
+    frame.profile = depth
+    software_sensor.on_video_frame(frame)
+    frames.append(queue.wait_for_frame())
+
+
+def make_filters():
+    decimation = rs.decimation_filter(2)
+    threshold = rs.threshold_filter(0.5, 2.5)
+    to_disparity = rs.disparity_transform(True)
+    spatial = rs.spatial_filter()
+    spatial.set_option(rs.option.holes_fill, 2)
+    temporal = rs.temporal_filter()
+    to_depth = rs.disparity_transform(False)
+    hole_filling = rs.hole_filling_filter(1)
+    return [decimation, threshold, to_disparity, spatial, temporal, to_depth, hole_filling]
+
+
+################################################################################################
+with test.closure("Fused chain is identical to the filters run one after the other"):
+    separate = make_filters()
+    chained = make_filters()
+    fused = rs.fused_filter(chained)
+    for f in frames:
+        expected = f
+        for filt in separate:
+            expected = filt.process(expected)
+        actual = fused.process(f)
+        test.check_equal(actual.get_profile().format(), expected.get_profile().format())
+        test.check_equal(actual.as_video_frame().get_width(), expected.as_video_frame().get_width())
+        test.check_equal(actual.as_video_frame().get_height(), expected.as_video_frame().get_height())
+        test.check(np.array_equal(np.asarray(actual.get_data()), np.asarray(expected.get_data())))
+
+################################################################################################
+with test.closure("Options are set on the chained filters"):
+    separate = make_filters()
+    chained = make_filters()
+    fused = rs.fused_filter(chained)
+    for filters in (separate, chained):
+        filters[0].set_option(rs.option.filter_magnitude, 3)
+        filters[4].set_option(rs.option.filter_smooth_alpha, 0.8)
+    for f in frames:
+        expected = f
+        for filt in separate:
+            expected = filt.process(expected)
+        actual = fused.process(f)
+        test.check_equal(actual.as_video_frame().get_width(), expected.as_video_frame().get_width())
+        test.check(np.array_equal(np.asarray(actual.get_data()), np.asarray(expected.get_data())))
+
+################################################################################################
+with test.closure("Fused filters sharing filters in different orders do not deadlock"):
+    import threading
+    spatial = rs.spatial_filter()
+    hole_filling = rs.hole_filling_filter(1)
+    forward = rs.fused_filter([spatial, hole_filling])
+    backward = rs.fused_filter([hole_filling, spatial])
+
+    def process_all(fused):
+        for _ in range(20):
+            for f in frames:
+                fused.process(f)
+
+    threads = [threading.Thread(target=process_all, args=(fused,), daemon=True) for fused in (forward, backward)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join(60)
+        test.check(not t.is_alive())
+
+################################################################################################
+with test.closure("Only fusable filters can be chained"):
+    test.check_throws(lambda: rs.fused_filter([rs.colorizer()]), RuntimeError)
+    temporal = rs.temporal_filter()
+    test.check_throws(lambda: rs.fused_filter([temporal, temporal]), RuntimeError)
+
+software_sensor.stop()
+software_sensor.close()
+test.print_results_and_exit()
@@ -0,0 +1,143 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#temporary fix to prevent the test from running on Win_SH_Py_DDS_CI
+#test:donotrun:dds
+
+# Replays HDR sequences of depth and IR frames through the hdr_merge block, checking the merged frames and timing
+# the merge. The sequences are recorded once from a software device, then replayed as many times as needed.
+
+from rspy import test, log
+from rspy.stopwatch import Stopwatch
+import pyrealsense2 as rs
+import numpy as np
+
+width = 848
+height = 480
+pairs = 4  # HDR sequences of two framesets each
+replays = 50  # of all the pairs, when timing the merge
+
+# The IR thresholds of hdr_merge: IR values must lie strictly between them for their depth to be used
+ir_thresholds = { rs.format.y8: ( 5, 250 ), rs.format.y16: ( 20, 1003 ) }
+
+
+def create_intrinsics():
+    intrinsics = rs.intrinsics()
+    intrinsics.width = width
+    intrinsics.height = height
+    intrinsics.ppx = width / 2.0
+    intrinsics.ppy = height / 2.0
+    intrinsics.fx = 600
+    intrinsics.fy = 600
+    intrinsics.model = rs.distortion.brown_conrady
+    intrinsics.coeffs = [0, 0, 0, 0, 0]
+    return intrinsics
+
+
+def create_video_stream(stream, index, fmt, bpp):
+    vs = rs.video_stream()
+    vs.type = stream
+    vs.index = index
+    vs.uid = index
+    vs.width = width
+    vs.height = height
+    vs.fps = 60
+    vs.bpp = bpp
+    vs.fmt = fmt
+    vs.intrinsics = create_intrinsics()
+    return vs
+
+
+def create_frame(profile, pixels, bpp, number):
+    frame = rs.software_video_frame()
+    frame.pixels = pixels.tobytes()
+    frame.bpp = bpp
+    frame.stride = width * bpp
+    frame.timestamp = number * 16
+    frame.domain = rs.timestamp_domain.system_time
+    frame.frame_number = number
+    frame.profile = profile.as_video_stream_profile()
+    frame.depth_units = 0.001
+    return frame
+
+
+def generate_frames(rng, ir_format):
+    """
+    Depth with holes, and IR across its whole range, about half of it saturated
+    """
+    depth = rng.integers(1, 0xFFFF, size=(height, width), dtype=np.uint16)
+    depth[rng.random((height, width)) < 0.3] = 0
+    ir_max = 0xFF if ir_format == rs.format.y8 else 0x3FF
+    ir = rng.integers(0, ir_max + 1, size=(height, width))
+    ir[rng.random((height, width)) < 0.25] = 0
+    ir[rng.random((height, width)) < 0.25] = ir_max
+    return depth, ir.astype(np.uint8 if ir_format == rs.format.y8 else np.uint16)
+
+
+def record_sequences(ir_format):
+    """
+    Returns the framesets of 'pairs' HDR sequences, with the depth and IR frames that went into them
+    """
+    ir_bpp = 1 if ir_format == rs.format.y8 else 2
+    device = rs.software_device()
+    sensor = device.add_sensor("Stereo Module")
+    depth_profile = sensor.add_video_stream(create_video_stream(rs.stream.depth, 0, rs.format.z16, 2))
+    ir_profile = sensor.add_video_stream(create_video_stream(rs.stream.infrared, 1, ir_format, ir_bpp))
+    sensor.add_read_only_option(rs.option.depth_units, 0.001)
+    device.create_matcher(rs.matchers.dlr_c)
+
+    sync = rs.syncer()
+    sensor.open([depth_profile, ir_profile])
+    sensor.start(sync)
+
+    rng = np.random.default_rng(ir_bpp)
+    sequences = []
+    for number in range(2 * pairs):
+        depth, ir = generate_frames(rng, ir_format)
+        sensor.set_metadata(rs.frame_metadata_value.frame_counter, number)
+        sensor.set_metadata(rs.frame_metadata_value.sequence_size, 2)
+        sensor.set_metadata(rs.frame_metadata_value.sequence_id, number % 2)
+        sensor.on_video_frame(create_frame(depth_profile, depth, 2, number))
+        sensor.on_video_frame(create_frame(ir_profile, ir, ir_bpp, number))
+        sequences.append((sync.wait_for_frames(), depth, ir))
+
+    sensor.stop()
+    sensor.close()
+    return sequences
+
+
+def expected_merge(first, second, ir_format):
+    ir_min, ir_max = ir_thresholds[ir_format]
+    _, d0, ir0 = first
+    _, d1, ir1 = second
+    valid0 = (ir0 > ir_min) & (ir0 < ir_max) & (d0 != 0)
+    valid1 = (ir1 > ir_min) & (ir1 < ir_max) & (d1 != 0)
+    return np.where(valid0, d0, np.where(valid1, d1, 0)).astype(np.uint16)
+
+
+################################################################################################
+for ir_format in [rs.format.y8, rs.format.y16]:
+    sequences = record_sequences(ir_format)
+
+    with test.closure("HDR merge of " + str(ir_format) + " sequences"):
+        hdr = rs.hdr_merge()
+        for first, second in zip(sequences[0::2], sequences[1::2]):
+            hdr.process(first[0])
+            merged = hdr.process(second[0])
+            test.check(merged.is_depth_frame())
+            data = np.frombuffer(merged.get_data(), dtype=np.uint16).reshape((height, width))
+            test.check(np.array_equal(data, expected_merge(first, second, ir_format)))
+
+    with test.closure("HDR merge of " + str(ir_format) + " sequences, timed"):
+        hdr = rs.hdr_merge()
+        stopwatch = Stopwatch()
+        for _ in range(replays):
+            for fs, _, _ in sequences:
+                hdr.process(fs)
+        elapsed = stopwatch.get_elapsed()
+        merges = replays * pairs
+        log.i("{} HDR merges of {}x{} {}: {:.3f} ms each, on {} kernels".format(
+            merges, width, height, ir_format, 1000 * elapsed / merges, hdr.get_info(rs.camera_info.simd_level)))
+
+################################################################################################
+test.print_results_and_exit()
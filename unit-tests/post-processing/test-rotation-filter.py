@@ -127,5 +127,81 @@ with test.closure("Test rotation filter"):
         depth_sensor.stop()
         depth_sensor.close()
 
+################################################################################################
+def expected_yuyv(data, angle):
+    # Each pixel has its own luma, and the chroma of its pair; the two pixels of an output pair average theirs
+    height, width = data.shape[0], data.shape[1] // 2
+    pixels = data.reshape((height, width, 2))
+    u = np.repeat(pixels[:, 0::2, 1], 2, axis=1).astype(np.uint16)
+    v = np.repeat(pixels[:, 1::2, 1], 2, axis=1).astype(np.uint16)
+    k = {90: -1, 180: 2, -90: 1}[angle]
+    y, u, v = np.rot90(pixels[:, :, 0], k), np.rot90(u, k), np.rot90(v, k)
+    out = np.empty(y.shape + (2,), dtype=np.uint8)
+    out[:, :, 0] = y
+    out[:, 0::2, 1] = (u[:, 0::2] + u[:, 1::2] + 1) // 2
+    out[:, 1::2, 1] = (v[:, 0::2] + v[:, 1::2] + 1) // 2
+    return out.reshape((y.shape[0], y.shape[1] * 2))
+
+
+with test.closure("Test rotation filter on color formats"):
+    # Sizes that are not a multiple of the blocks the filter works in
+    width, height = 100, 58
+    sw_dev = rs.software_device()
+    color_sensor = sw_dev.add_sensor("Color")
+    intrinsics = rs.intrinsics()
+    intrinsics.width, intrinsics.height = width, height
+    intrinsics.ppx, intrinsics.ppy = width / 2.0, height / 2.0
+    intrinsics.fx = intrinsics.fy = focal_length
+    intrinsics.model = rs.distortion.none
+    intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    formats = [(rs.format.y8, 1), (rs.format.yuyv, 2), (rs.format.rgb8, 3), (rs.format.bgra8, 4)]
+    for uid, (fmt, bpp) in enumerate(formats):
+        vs = rs.video_stream()
+        vs.type = rs.stream.color
+        vs.index = 0
+        vs.uid = 100 + uid
+        vs.width = width
+        vs.height = height
+        vs.fps = 30
+        vs.bpp = bpp
+        vs.fmt = fmt
+        vs.intrinsics = intrinsics
+        profile = color_sensor.add_video_stream(vs)
+
+        data = np.random.default_rng(uid).integers(0, 256, (height, width * bpp), dtype=np.uint8)
+        for angle in [90, 180, -90]:
+            rotation_filter = rs.rotation_filter([rs.stream.color])
+            rotation_filter.set_option(rs.option.rotation, angle)
+
+            queue = rs.frame_queue(1)
+            color_sensor.open(profile)
+            color_sensor.start(queue)
+            frame = rs.software_video_frame()
+            frame.pixels = data.tobytes()
+            frame.bpp = bpp
+            frame.stride = width * bpp
+            frame.timestamp = 0
+            frame.domain = rs.timestamp_domain.system_time
+            frame.frame_number = 1
+            frame.profile = profile.as_video_stream_profile()
+            color_sensor.on_video_frame(frame)
+            rotated = rotation_filter.process(queue.wait_for_frame())
+            color_sensor.stop()
+            color_sensor.close()
+
+            rotated_profile = rotated.profile.as_video_stream_profile()
+            rotated_data = np.frombuffer(rotated.get_data(), dtype=np.uint8).reshape(
+                (rotated_profile.height(), rotated_profile.width() * bpp))
+            if fmt == rs.format.yuyv:
+                expected = expected_yuyv(data, angle)
+            else:
+                k = {90: -1, 180: 2, -90: 1}[angle]
+                expected = np.rot90(data.reshape((height, width, bpp)), k).reshape(rotated_data.shape)
+            test.info("format", fmt)
+            test.info("angle", angle)
+            test.check(np.array_equal(rotated_data, expected))
+            test.reset_info()
+
 ################################################################################################
 test.print_results_and_exit()
\ No newline at end of file
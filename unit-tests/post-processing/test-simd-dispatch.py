@@ -0,0 +1,38 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+import os
+import subprocess
+import sys
+import pyrealsense2 as rs
+from rspy import test
+
+levels = ['Scalar', 'SSSE3', 'AVX2', 'NEON']
+
+
+def make_blocks():
+    return [rs.decimation_filter(), rs.spatial_filter(), rs.temporal_filter(), rs.colorizer(),
+            rs.pointcloud(), rs.align(rs.stream.color), rs.threshold_filter(), rs.units_transform(),
+            rs.disparity_transform()]
+
+
+################################################################################################
+with test.closure("Processing blocks report the instruction set of their kernels"):
+    for block in make_blocks():
+        test.check(block.supports(rs.camera_info.simd_level))
+        test.check(block.get_info(rs.camera_info.simd_level) in levels)
+
+################################################################################################
+with test.closure("LRS_SIMD_LEVEL=scalar makes every block use its scalar kernels"):
+    # The level is read once per process, so another one has to be started
+    script = ('import pyrealsense2 as rs\n'
+              'for block in [rs.decimation_filter(), rs.spatial_filter(), rs.temporal_filter(), rs.colorizer(),\n'
+              '              rs.pointcloud(), rs.align(rs.stream.color), rs.threshold_filter(), rs.units_transform(),\n'
+              '              rs.disparity_transform()]:\n'
+              '    print(block.get_info(rs.camera_info.simd_level))\n')
+    env = dict(os.environ, LRS_SIMD_LEVEL='scalar', PYTHONPATH=os.pathsep.join(sys.path))
+    result = subprocess.run([sys.executable, '-c', script], env=env, capture_output=True, text=True)
+    test.check_equal(result.returncode, 0)
+    test.check_equal(result.stdout.split(), ['Scalar'] * len(make_blocks()))
+
+test.print_results_and_exit()
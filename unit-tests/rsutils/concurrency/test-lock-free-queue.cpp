@@ -0,0 +1,241 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/time/timer.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+using namespace rsutils::time;
+
+TEST_CASE( "lock-free queue drops the oldest" )
+{
+    std::vector< int > dropped;
+    lock_free_queue< int > q( 3, [&]( int const & i ) { dropped.push_back( i ); } );
+
+    for( int i = 0; i < 5; ++i )
+        REQUIRE( q.enqueue( std::move( i ) ) );
+    REQUIRE( q.size() == 3 );
+    REQUIRE( dropped == std::vector< int >{ 0, 1 } );
+
+    int i;
+    for( int expected = 2; expected < 5; ++expected )
+    {
+        REQUIRE( q.try_dequeue( &i ) );
+        REQUIRE( i == expected );
+    }
+    REQUIRE_FALSE( q.try_dequeue( &i ) );
+    REQUIRE( q.empty() );
+}
+
+TEST_CASE( "lock-free queue keeps what it peeked at" )
+{
+    std::vector< int > dropped;
+    lock_free_queue< int > q( 2, [&]( int const & i ) { dropped.push_back( i ); } );
+
+    q.enqueue( 1 );
+    q.enqueue( 2 );
+    REQUIRE( q.peek( [&]( int const & i ) { REQUIRE( i == 1 ); } ) );
+
+    // The item peeked at is never dropped: the next oldest is
+    q.enqueue( 3 );
+    REQUIRE( q.size() == 2 );
+    REQUIRE( dropped == std::vector< int >{ 2 } );
+
+    int i;
+    REQUIRE( q.dequeue( &i, 0 ) );
+    REQUIRE( i == 1 );
+    REQUIRE( q.dequeue( &i, 0 ) );
+    REQUIRE( i == 3 );
+}
+
+TEST_CASE( "lock-free queue stops" )
+{
+    lock_free_queue< std::function< void( void ) > > q;
+    std::function< void( void ) > f;
+
+    q.enqueue( []() {} );
+    REQUIRE( q.peek( [&]( std::function< void( void ) > const & ) {} ) );
+    q.stop();
+    REQUIRE( q.stopped() );
+    REQUIRE( q.empty() );
+    REQUIRE_FALSE( q.peek( [&]( std::function< void( void ) > const & ) {} ) );
+    REQUIRE_FALSE( q.enqueue( []() {} ) );
+    REQUIRE_FALSE( q.blocking_enqueue( []() {} ) );
+
+    timer t( std::chrono::seconds( 1 ) );
+    t.start();
+    REQUIRE_FALSE( q.dequeue( &f, 2000 ) );
+    REQUIRE_FALSE( t.has_expired() );
+
+    q.start();
+    REQUIRE( q.enqueue( []() {} ) );
+    REQUIRE( q.size() == 1 );
+}
+
+TEST_CASE( "lock-free queue dequeue waits for an item" )
+{
+    lock_free_queue< int > q;
+    int i;
+
+    stopwatch sw;
+    REQUIRE_FALSE( q.dequeue( &i, 200 ) );
+    REQUIRE( sw.get_elapsed_ms() >= 200 );
+
+    // Parked, then woken by the producer
+    std::thread producer( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+        q.enqueue( 7 );
+    } );
+    sw.reset();
+    REQUIRE( q.dequeue( &i, 5000 ) );
+    REQUIRE( i == 7 );
+    REQUIRE( sw.get_elapsed_ms() < 1000 );
+    producer.join();
+}
+
+TEST_CASE( "lock-free queue blocking enqueue waits for room" )
+{
+    lock_free_queue< int > q( 2 );
+    int i;
+
+    q.blocking_enqueue( 0 );
+    q.blocking_enqueue( 1 );
+    std::thread consumer( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        q.dequeue( &i, 1000 );
+    } );
+
+    stopwatch sw;
+    REQUIRE( q.blocking_enqueue( 2 ) );
+    REQUIRE( sw.get_elapsed_ms() >= 150 );
+    consumer.join();
+    REQUIRE( i == 0 );
+    REQUIRE( q.size() == 2 );
+}
+
+TEST_CASE( "lock-free queue with many producers" )
+{
+    // Blocking producers lose nothing, and each one's items come out in order
+    int const producers = 4;
+    int const items = 20000;
+    lock_free_queue< int > q( 16 );
+
+    std::vector< std::thread > threads;
+    for( int p = 0; p < producers; ++p )
+        threads.emplace_back( [&, p]() {
+            for( int i = 0; i < items; ++i )
+                q.blocking_enqueue( p * items + i );
+        } );
+
+    std::vector< int > last( producers, -1 );
+    int received = 0;
+    int value;
+    while( received < producers * items && q.dequeue( &value, 5000 ) )
+    {
+        int const p = value / items;
+        REQUIRE( value % items == last[p] + 1 );
+        last[p] = value % items;
+        ++received;
+    }
+    for( auto & t : threads )
+        t.join();
+    REQUIRE( received == producers * items );
+    REQUIRE( q.empty() );
+}
+
+TEST_CASE( "lock-free queue accounts for every item under pressure" )
+{
+    std::atomic< int > dropped( 0 );
+    lock_free_queue< int > q( 4, [&]( int const & ) { ++dropped; } );
+
+    int const producers = 3;
+    int const items = 20000;
+    std::atomic< int > done( 0 );
+    std::vector< std::thread > threads;
+    for( int p = 0; p < producers; ++p )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < items; ++i )
+                q.enqueue( std::move( i ) );
+            ++done;
+        } );
+
+    int received = 0;
+    int value;
+    while( done < producers || ! q.empty() )
+        if( q.dequeue( &value, 10 ) )
+            ++received;
+    for( auto & t : threads )
+        t.join();
+    REQUIRE( received + dropped == producers * items );
+    REQUIRE( q.size() == 0 );
+}
+
+TEST_CASE( "lock-free queue drops nothing while there's room" )
+{
+    // The producer never overfills the queue, but often finds the ring full while the consumer frees a slot
+    std::atomic< int > dropped( 0 );
+    lock_free_queue< int > q( 2, [&]( int const & ) { ++dropped; } );
+
+    int const items = 100000;
+    std::thread producer( [&]() {
+        for( int i = 0; i < items; ++i )
+        {
+            while( q.size() >= 2 )
+                std::this_thread::yield();
+            q.enqueue( std::move( i ) );
+        }
+    } );
+
+    int received = 0;
+    int value;
+    while( received < items && q.dequeue( &value, 1000 ) )
+        ++received;
+    producer.join();
+    REQUIRE( dropped == 0 );
+    REQUIRE( received == items );
+}
+
+// Times items from a producer to a consumer that waits for them, as frames travel between threads
+template< class Queue >
+static std::chrono::nanoseconds median_latency( int items, std::chrono::microseconds interval )
+{
+    typedef std::chrono::steady_clock clock;
+    Queue q( QUEUE_MAX_SIZE );
+    std::thread producer( [&]() {
+        for( int i = 0; i < items; ++i )
+        {
+            auto const next = clock::now() + interval;
+            q.blocking_enqueue( clock::now() );
+            while( clock::now() < next )
+                std::this_thread::yield();
+        }
+    } );
+
+    std::vector< clock::duration > latencies;
+    clock::time_point sent;
+    while( int( latencies.size() ) < items && q.dequeue( &sent, 1000 ) )
+        latencies.push_back( clock::now() - sent );
+    producer.join();
+
+    REQUIRE( int( latencies.size() ) == items );
+    std::nth_element( latencies.begin(), latencies.begin() + items / 2, latencies.end() );
+    return latencies[items / 2];
+}
+
+TEST_CASE( "lock-free queue latency" )
+{
+    typedef std::chrono::steady_clock::time_point item;
+    for( auto interval : { std::chrono::microseconds( 0 ), std::chrono::microseconds( 50 ) } )
+    {
+        auto const locked = median_latency< single_consumer_queue< item > >( 20000, interval );
+        auto const lock_free = median_latency< lock_free_queue< item > >( 20000, interval );
+        std::cout << "median latency, items every " << interval.count() << " us: " << locked.count()
+                  << " ns locked, " << lock_free.count() << " ns lock-free" << std::endl;
+    }
+}
@@ -0,0 +1,140 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/frame-buffer-pool.h>
+
+#include <rsutils/easylogging/easyloggingpp.h>
+// Catch also defines CHECK(), and so we have to undefine it or we get compilation errors!
+#undef CHECK
+#include "../catch.h"
+
+#include <thread>
+
+using namespace librealsense;
+
+
+TEST_CASE( "released buffers are reused", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+    auto const before = frame_buffer_pool::get_stats();
+
+    auto buffer = pool.acquire( 1000 );
+    REQUIRE( buffer.size() == 1000 );
+    auto const data = buffer.data();
+    pool.release( std::move( buffer ) );
+
+    auto again = pool.acquire( 1000 );
+    CHECK( again.size() == 1000 );
+    CHECK( again.data() == data );
+
+    auto const after = frame_buffer_pool::get_stats();
+    CHECK( after.hits - before.hits == 1 );
+    CHECK( after.misses - before.misses == 1 );
+}
+
+
+TEST_CASE( "buffers are 64-byte aligned", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+
+    std::vector< frame_buffer > buffers;
+    for( size_t size = 1; size < 200; size += 7 )
+    {
+        buffers.push_back( pool.acquire( size ) );
+        CHECK( reinterpret_cast< uintptr_t >( buffers.back().data() ) % 64 == 0 );
+    }
+}
+
+
+TEST_CASE( "buffers are kept per size", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+
+    auto small = pool.acquire( 10 );
+    auto big = pool.acquire( 20 );
+    auto const small_data = small.data();
+    auto const big_data = big.data();
+    pool.release( std::move( small ) );
+    pool.release( std::move( big ) );
+
+    auto b = pool.acquire( 20 );
+    CHECK( b.size() == 20 );
+    CHECK( b.data() == big_data );
+    auto s = pool.acquire( 10 );
+    CHECK( s.size() == 10 );
+    CHECK( s.data() == small_data );
+
+    // Nothing of another size
+    CHECK( pool.acquire( 30 ).size() == 30 );
+}
+
+
+TEST_CASE( "at most BUFFERS_PER_SIZE are kept", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+    auto const n = frame_buffer_pool::BUFFERS_PER_SIZE + 5;
+
+    std::vector< frame_buffer > buffers;
+    for( int i = 0; i < n; ++i )
+        buffers.push_back( pool.acquire( 100 ) );
+    for( auto & buffer : buffers )
+        pool.release( std::move( buffer ) );
+
+    auto const before = frame_buffer_pool::get_stats();
+    buffers.clear();
+    for( int i = 0; i < n; ++i )
+        buffers.push_back( pool.acquire( 100 ) );
+    auto const after = frame_buffer_pool::get_stats();
+    CHECK( after.hits - before.hits == frame_buffer_pool::BUFFERS_PER_SIZE );
+    CHECK( after.misses - before.misses == 5 );
+}
+
+
+TEST_CASE( "trim evicts old buffers", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+
+    pool.release( pool.acquire( 100 ) );
+    pool.trim( std::chrono::hours( 1 ) );  // still fresh
+
+    auto const before = frame_buffer_pool::get_stats();
+    pool.release( pool.acquire( 100 ) );
+    pool.clear();
+    auto const after = frame_buffer_pool::get_stats();
+    CHECK( after.hits - before.hits == 1 );
+    CHECK( after.evictions - before.evictions == 1 );
+
+    // The freed size no longer holds a bucket, so we can keep MAX_SIZES other sizes
+    for( int size = 1; size <= frame_buffer_pool::MAX_SIZES; ++size )
+        pool.release( pool.acquire( size ) );
+    auto const hits = frame_buffer_pool::get_stats().hits;
+    for( int size = 1; size <= frame_buffer_pool::MAX_SIZES; ++size )
+        pool.acquire( size );
+    CHECK( frame_buffer_pool::get_stats().hits - hits == frame_buffer_pool::MAX_SIZES );
+}
+
+
+TEST_CASE( "concurrent acquire and release", "[frame-buffer-pool]" )
+{
+    frame_buffer_pool pool;
+
+    std::vector< std::thread > threads;
+    for( int t = 0; t < 4; ++t )
+        threads.emplace_back(
+            [&pool, t]()
+            {
+                size_t const size = 64 * ( t % 2 + 1 );
+                for( int i = 0; i < 10000; ++i )
+                {
+                    auto buffer = pool.acquire( size );
+                    if( buffer.size() != size )
+                        throw std::runtime_error( "bad buffer size" );
+                    buffer[0] = uint8_t( i );
+                    pool.release( std::move( buffer ) );
+                }
+            } );
+    for( auto & thread : threads )
+        thread.join();
+}
@@ -0,0 +1,205 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/small-heap.h>
+
+#include <rsutils/easylogging/easyloggingpp.h>
+// Catch also defines CHECK(), and so we have to undefine it or we get compilation errors!
+#undef CHECK
+#include "../catch.h"
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+
+
+TEST_CASE( "allocate up to capacity", "[small-heap]" )
+{
+    small_heap< int, 4 > heap;
+    CHECK( heap.is_empty() );
+
+    std::vector< int * > items;
+    for( int i = 0; i < 4; ++i )
+    {
+        auto item = heap.allocate();
+        REQUIRE( item );
+        *item = i;
+        items.push_back( item );
+    }
+    CHECK( heap.get_size() == 4 );
+    CHECK_FALSE( heap.allocate() );
+    CHECK( heap.get_size() == 4 );
+
+    heap.deallocate( items.back() );
+    items.pop_back();
+    CHECK( heap.get_size() == 3 );
+    auto item = heap.allocate();
+    REQUIRE( item );
+    CHECK( *item == 0 );  // freed items are reset
+    heap.deallocate( item );
+
+    for( auto i : items )
+        heap.deallocate( i );
+    CHECK( heap.is_empty() );
+
+    int other;
+    CHECK_THROWS( heap.deallocate( &other ) );
+}
+
+
+TEST_CASE( "stop_allocation", "[small-heap]" )
+{
+    small_heap< int, 4 > heap;
+    auto item = heap.allocate();
+    REQUIRE( item );
+
+    heap.stop_allocation();
+    CHECK_FALSE( heap.allocate() );
+    CHECK( heap.get_size() == 1 );
+
+    heap.deallocate( item );
+    CHECK( heap.is_empty() );
+    CHECK_FALSE( heap.allocate() );
+}
+
+
+TEST_CASE( "wait_until_empty", "[small-heap]" )
+{
+    small_heap< int, 4 > heap;
+    heap.wait_until_empty();  // already empty: returns immediately
+
+    auto a = heap.allocate();
+    auto b = heap.allocate();
+    std::thread releaser(
+        [&]()
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            heap.deallocate( a );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            heap.deallocate( b );
+        } );
+    heap.stop_allocation();
+    heap.wait_until_empty();
+    CHECK( heap.is_empty() );
+    releaser.join();
+}
+
+
+TEST_CASE( "concurrent allocate and deallocate", "[small-heap]" )
+{
+    small_heap< int, 16 > heap;
+    std::atomic< int > failures( 0 );
+
+    std::vector< std::thread > threads;
+    for( int t = 1; t <= 32; ++t )
+        threads.emplace_back(
+            [&heap, &failures, t]()
+            {
+                for( int i = 0; i < 20000; ++i )
+                {
+                    auto item = heap.allocate();
+                    if( ! item )
+                        continue;
+                    // No one else may be holding the same item
+                    if( *item != 0 )
+                        ++failures;
+                    *item = t;
+                    std::this_thread::yield();
+                    if( *item != t )
+                        ++failures;
+                    heap.deallocate( item );
+                }
+            } );
+    for( auto & thread : threads )
+        thread.join();
+
+    CHECK( failures.load() == 0 );
+    CHECK( heap.is_empty() );
+}
+
+
+// The mutex-based implementation small_heap used to have, for comparison
+template< class T, int C >
+class locked_heap
+{
+    T buffer[C];
+    bool is_free[C];
+    std::mutex mutex;
+
+public:
+    locked_heap()
+    {
+        for( auto & f : is_free )
+            f = true;
+    }
+
+    T * allocate()
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        for( auto i = 0; i < C; i++ )
+        {
+            if( is_free[i] )
+            {
+                is_free[i] = false;
+                return &buffer[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void deallocate( T * item )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        is_free[item - buffer] = true;
+    }
+};
+
+
+// Returns the average time, in ns, of an allocate+deallocate pair when 'n_threads' are hammering the same heap
+template< class heap_type >
+double time_allocations( int n_threads )
+{
+    int const N = 100000;
+    heap_type heap;
+    std::atomic< bool > go( false );
+
+    std::vector< std::thread > threads;
+    for( int t = 0; t < n_threads; ++t )
+        threads.emplace_back(
+            [&]()
+            {
+                while( ! go )
+                    std::this_thread::yield();
+                for( int i = 0; i < N; ++i )
+                    if( auto item = heap.allocate() )
+                        heap.deallocate( item );
+            } );
+
+    auto const start = std::chrono::steady_clock::now();
+    go = true;
+    for( auto & thread : threads )
+        thread.join();
+    std::chrono::duration< double, std::nano > const elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ( double( N ) * n_threads );
+}
+
+
+// Not a pass/fail test: shows how both implementations behave under contention, with the same capacity as
+// frame_archive::published_frames
+TEST_CASE( "contention", "[small-heap][benchmark]" )
+{
+    int const CAPACITY = 128;
+    for( int n_threads : { 1, 4, 16 } )
+    {
+        auto const lock_free = time_allocations< small_heap< int, CAPACITY > >( n_threads );
+        auto const locked = time_allocations< locked_heap< int, CAPACITY > >( n_threads );
+        std::cout << n_threads << " thread(s): small_heap " << lock_free << " ns, mutex " << locked
+                  << " ns per allocate+deallocate" << std::endl;
+    }
+}
@@ -0,0 +1,155 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/proc/worker-pool.h>
+
+#include <rsutils/easylogging/easyloggingpp.h>
+// Catch also defines CHECK(), and so we have to undefine it or we get compilation errors!
+#undef CHECK
+#include "../catch.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace librealsense;
+
+
+// Runs a parallel_for() of chunks that take a while, and returns the largest number of threads that ran at once
+static int max_concurrency( worker_pool & pool, size_t n, int max_threads, std::vector< int > & visits )
+{
+    std::atomic< int > running( 0 ), most( 0 );
+    pool.parallel_for( n, 1, [&]( size_t begin, size_t end )
+    {
+        int now = ++running;
+        int prev = most;
+        while( now > prev && ! most.compare_exchange_weak( prev, now ) )
+        {
+        }
+        for( auto i = begin; i < end; ++i )
+            ++visits[i];
+        std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+        --running;
+    }, max_threads );
+    return most;
+}
+
+
+TEST_CASE( "every index is processed once", "[worker-pool]" )
+{
+    for( int n_workers : { 0, 1, 3 } )
+    {
+        CAPTURE( n_workers );
+        worker_pool pool( n_workers );
+        CHECK( pool.get_concurrency() == n_workers + 1 );
+
+        for( size_t chunk : { 1, 7, 1000, 5000 } )
+        {
+            // Catch assertions are not thread-safe: only check from the main thread
+            std::vector< std::atomic< int > > counts( 1000 );
+            for( auto & count : counts )
+                count = 0;
+            std::atomic< bool > too_long( false );
+            pool.parallel_for( counts.size(), chunk, [&]( size_t begin, size_t end ) {
+                if( end - begin > chunk )
+                    too_long = true;
+                for( auto i = begin; i < end; ++i )
+                    ++counts[i];
+            } );
+            CHECK( ! too_long );
+            for( auto & count : counts )
+                CHECK( count == 1 );
+        }
+    }
+}
+
+
+TEST_CASE( "concurrent and nested parallel_for", "[worker-pool]" )
+{
+    worker_pool pool( 2 );
+    std::atomic< size_t > total( 0 );
+
+    std::vector< std::thread > threads;
+    for( int t = 0; t < 4; ++t )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < 100; ++i )
+                pool.parallel_for( 10, 1, [&]( size_t, size_t ) {
+                    pool.parallel_for( 10, 3, [&]( size_t begin, size_t end ) { total += end - begin; } );
+                } );
+        } );
+    for( auto & thread : threads )
+        thread.join();
+    CHECK( total == 4 * 100 * 10 * 10 );
+}
+
+
+TEST_CASE( "exceptions are rethrown to the caller", "[worker-pool]" )
+{
+    worker_pool pool( 2 );
+    std::atomic< int > calls( 0 );
+    CHECK_THROWS_AS( pool.parallel_for( 100,
+                                        1,
+                                        [&]( size_t begin, size_t )
+                                        {
+                                            ++calls;
+                                            if( begin == 50 )
+                                                throw std::runtime_error( "failed" );
+                                        } ),
+                     std::runtime_error );
+    CHECK( calls == 100 );
+
+    // The pool is still usable
+    pool.parallel_for( 10, 1, [&]( size_t, size_t ) { ++calls; } );
+    CHECK( calls == 110 );
+}
+
+
+TEST_CASE( "every index is processed once, with max_threads", "[worker-pool]" )
+{
+    worker_pool pool( 3 );
+    for( int max_threads : { 0, 1, 2, 4 } )
+    {
+        CAPTURE( max_threads );
+        std::vector< int > visits( 40, 0 );
+        max_concurrency( pool, visits.size(), max_threads, visits );
+        CHECK( visits == std::vector< int >( visits.size(), 1 ) );
+    }
+}
+
+
+TEST_CASE( "parallel_for keeps to max_threads", "[worker-pool]" )
+{
+    worker_pool pool( 3 );
+    for( int max_threads : { 1, 2, 3 } )
+    {
+        CAPTURE( max_threads );
+        std::vector< int > visits( 40, 0 );
+        CHECK( max_concurrency( pool, visits.size(), max_threads, visits ) <= max_threads );
+    }
+}
+
+
+TEST_CASE( "a full job leaves the workers to the next one", "[worker-pool]" )
+{
+    worker_pool pool( 2 );
+    std::vector< int > first( 40, 0 ), second( 40, 0 );
+    int first_most = 0, second_most = 0;
+    std::thread other( [&]() { first_most = max_concurrency( pool, first.size(), 2, first ); } );
+    second_most = max_concurrency( pool, second.size(), 0, second );
+    other.join();
+    CHECK( first_most <= 2 );
+    CHECK( second_most <= 3 );
+    CHECK( first == std::vector< int >( first.size(), 1 ) );
+    CHECK( second == std::vector< int >( second.size(), 1 ) );
+}
+
+
+TEST_CASE( "the shared pool", "[worker-pool]" )
+{
+    auto pool = worker_pool::get();
+    REQUIRE( pool );
+    CHECK( pool == worker_pool::get() );
+    CHECK( pool->get_concurrency() >= 1 );
+}
@@ -19,7 +19,8 @@ public enum CameraInfo {
     CONNECTION_TYPE(15),
     SMCU_FW_VERSION(16),
     IMU_TYPE(17),
-    MIPI_DRIVER_VERSION(18);
+    MIPI_DRIVER_VERSION(18),
+    SIMD_LEVEL(19);
 
 
     private final int mValue;
@@ -68,5 +68,8 @@ namespace Intel.RealSense
 
         /// <summary> MIPI driver version (Jetson platform only)</summary>
         MipiDriverVersion = 18,
+
+        /// <summary> Instruction set the kernels of a processing block run with: Scalar, SSSE3, AVX2 or NEON</summary>
+        SimdLevel = 19,
     }
 }
@@ -167,6 +167,20 @@ void init_c_files(py::module &m) {
                   return ss.str();
               } );
 
+    py::class_< rs2_motion_sample > motion_sample( m, "motion_sample", "One GYRO or ACCEL sample of a motion batch frame" );
+    motion_sample.def( py::init<>() )
+        .def_readwrite( "timestamp", &rs2_motion_sample::timestamp, "Timestamp of the sample, in milliseconds" )
+        .def_readwrite( "x", &rs2_motion_sample::x )
+        .def_readwrite( "y", &rs2_motion_sample::y )
+        .def_readwrite( "z", &rs2_motion_sample::z )
+        .def( "__repr__",
+              []( const rs2_motion_sample & self )
+              {
+                  std::ostringstream ss;
+                  ss << self.timestamp << " [" << self.x << "," << self.y << "," << self.z << "]";
+                  return ss.str();
+              } );
+
     py::class_<rs2_pose> pose(m, "pose"); // No docstring in C++
     pose.def(py::init<>())
         .def_readwrite("translation", &rs2_pose::translation, "X, Y, Z values of translation, in meters (relative to initial position)")
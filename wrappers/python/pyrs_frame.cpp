@@ -309,6 +309,10 @@ void init_frame(py::module &m) {
     motion_frame.def(py::init<rs2::frame>())
         .def("get_motion_data", &rs2::motion_frame::get_motion_data, "Retrieve motion data from a GYRO/ACCEL sensor")
         .def("get_combined_motion_data", &rs2::motion_frame::get_combined_motion_data, "Retrieve motion data from a MOTION sensor")
+        .def("get_motion_samples", [](const rs2::motion_frame& self) {
+            auto samples = self.get_motion_samples();
+            return std::vector<rs2_motion_sample>(samples, samples + self.get_motion_sample_count());
+        }, "Retrieve the samples of a motion batch frame, each with its own timestamp, oldest first")
         .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.");
 
     py::class_<rs2::pose_frame, rs2::frame> pose_frame(m, "pose_frame", "Extends the frame class with additional pose related attributes and functions.");
@@ -200,6 +200,10 @@ void init_processing(py::module &m) {
     py::class_<rs2::sequence_id_filter, rs2::filter> sequence_id_filter(m, "sequence_id_filter", "Splits depth frames with different sequence ID");
     sequence_id_filter.def(py::init<>())
         .def(py::init<float>(), "sequence_id"_a);
+
+    py::class_<rs2::fused_filter, rs2::filter> fused_filter(m, "fused_filter", "Runs a chain of depth post-processing filters as a single pass over each frame. "
+                                                            "The filters keep their options and state.");
+    fused_filter.def(py::init<std::vector<rs2::filter>>(), "filters"_a);
     // rs2::rates_printer
 
     py::class_<rs2::embedded_filter, rs2::options> embedded_filter(m, "embedded_filter", "Define the embedded filter workflow.");
@@ -17,6 +17,7 @@ void init_record_playback(py::module &m) {
         .def("get_position", &rs2::playback::get_position, "Retrieves the current position of the playback in the file in terms of time. Units are expressed in nanoseconds.")
         .def("get_duration", &rs2::playback::get_duration, "Retrieves the total duration of the file.")
         .def("seek", &rs2::playback::seek, "Sets the playback to a specified time point of the played data.", "time"_a)
+        .def("seek_to_frame", &rs2::playback::seek_to_frame, "Sets the playback to a recorded frame of one of its streams, counting from 0.", "profile"_a, "frame_index"_a)
         .def("is_real_time", &rs2::playback::is_real_time, "Indicates if playback is in real time mode or non real time.")
         .def("set_real_time", &rs2::playback::set_real_time, "Set the playback to work in real time or non real time. In real time mode, playback will "
              "play the same way the file was recorded. If the application takes too long to handle the callback, frames may be dropped. In non real time "
@@ -31,11 +32,20 @@ void init_record_playback(py::module &m) {
         .def("current_status", &rs2::playback::current_status, "Returns the current state of the playback device");
     // Stop?
 
+    py::class_<rs2_record_statistics> record_statistics(m, "record_statistics", "How well a recorder kept up with the device.");
+    record_statistics.def_readonly("messages_written", &rs2_record_statistics::messages_written, "Messages written to the file so far")
+        .def_readonly("batches_written", &rs2_record_statistics::batches_written, "Transactions the messages were written in")
+        .def_readonly("frames_dropped", &rs2_record_statistics::frames_dropped, "Frames dropped because the writer was behind")
+        .def_readonly("backpressure_waits", &rs2_record_statistics::backpressure_waits, "Times a write had to wait for the writer to catch up")
+        .def_readonly("backpressure_time", &rs2_record_statistics::backpressure_time, "Total time spent waiting, in milliseconds");
+
     py::class_<rs2::recorder, rs2::device, py_holder<rs2::recorder>> recorder(m, "recorder", "Records the given device and saves it to the given file as rosbag format.");
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
+        .def(py::init<const std::string&, rs2::device, bool, bool>(), "file"_a, "device"_a, "compression_enabled"_a, "drop_frames_when_full"_a)
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("get_statistics", &rs2::recorder::get_statistics, "Returns how well the recorder has kept up with the device so far");
     // filename?
     /** end rs_record_playback.hpp **/
 }